@@ -0,0 +1,942 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* SDL_gpu_bench
+ *
+ * Headless microbenchmarks for the public API. No window is created and
+ * no swapchain is claimed, so this runs unattended on CI machines.
+ *
+ * Usage:
+ *   SDL_gpu_bench [--backend vulkan|d3d11|metal] [--format json|csv]
+ *                 [--iterations N] [--threads N] [--shaders DIR] [--debug]
+ *
+ * Cases that record draws or push uniforms need a bound graphics pipeline,
+ * so they only run when --shaders points at a directory holding
+ * bench.vert.spv and bench.frag.spv. The vertex shader must take no vertex
+ * inputs and one uniform buffer, the fragment shader one sampler and
+ * nothing else. Without them those cases are reported as "skipped".
+ */
+
+#include <stdio.h>
+
+#include "SDL_gpu.h"
+
+#define BENCH_MAX_RESULTS 64
+#define BENCH_MAX_THREADS 64
+#define BENCH_TRANSFER_SIZE (16 * 1024 * 1024)
+#define BENCH_TARGET_SIZE 256
+#define BENCH_COPIES_PER_PASS 16
+#define BENCH_COPY_SIZE 256
+#define BENCH_UNIFORM_SIZE 64
+
+typedef struct BenchResult
+{
+	char name[64];
+	const char *unit;
+	double value;
+	Uint32 iterations;
+	SDL_bool skipped;
+} BenchResult;
+
+typedef struct BenchContext
+{
+	SDL_GpuDevice *device;
+	Uint32 iterations;
+	Uint32 maxThreads;
+	const char *shaderDirectory;
+
+	SDL_GpuTexture *target;
+	SDL_GpuSampler *samplers[2];
+	SDL_GpuBuffer *vertexBuffers[2];
+	SDL_GpuBuffer *storageBuffers[2];
+	SDL_GpuGraphicsPipeline *pipeline;
+	SDL_GpuShader *vertexShader;
+	SDL_GpuShader *fragmentShader;
+
+	BenchResult results[BENCH_MAX_RESULTS];
+	Uint32 resultCount;
+} BenchContext;
+
+typedef struct BenchThread
+{
+	BenchContext *context;
+	SDL_sem *start;
+	SDL_GpuBuffer *source;
+	SDL_GpuBuffer *destination;
+	Uint32 failures;
+} BenchThread;
+
+/* Timing and results */
+
+static double Bench_Seconds(Uint64 start, Uint64 end)
+{
+	return (double) (end - start) / (double) SDL_GetPerformanceFrequency();
+}
+
+static void Bench_Report(
+	BenchContext *context,
+	const char *name,
+	const char *unit,
+	double value,
+	Uint32 iterations,
+	SDL_bool skipped
+) {
+	BenchResult *result;
+
+	if (context->resultCount == BENCH_MAX_RESULTS)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Too many bench results, dropping %s", name);
+		return;
+	}
+
+	result = &context->results[context->resultCount];
+	context->resultCount += 1;
+
+	SDL_strlcpy(result->name, name, sizeof(result->name));
+	result->unit = unit;
+	result->value = value;
+	result->iterations = iterations;
+	result->skipped = skipped;
+}
+
+static void Bench_Skip(BenchContext *context, const char *name, const char *unit)
+{
+	Bench_Report(context, name, unit, 0.0, 0, SDL_TRUE);
+}
+
+static const char *Bench_BackendName(SDL_GpuBackend backend)
+{
+	switch (backend)
+	{
+		case SDL_GPU_BACKEND_VULKAN: return "vulkan";
+		case SDL_GPU_BACKEND_D3D11: return "d3d11";
+		case SDL_GPU_BACKEND_METAL: return "metal";
+		default: return "unknown";
+	}
+}
+
+static void Bench_PrintJSON(BenchContext *context)
+{
+	Uint32 i;
+
+	printf("{\n");
+	printf("  \"backend\": \"%s\",\n", Bench_BackendName(SDL_GpuGetBackend(context->device)));
+	printf("  \"results\": [\n");
+	for (i = 0; i < context->resultCount; i += 1)
+	{
+		BenchResult *result = &context->results[i];
+		printf(
+			"    {\"name\": \"%s\", \"unit\": \"%s\", \"value\": %.3f, \"iterations\": %u, \"status\": \"%s\"}%s\n",
+			result->name,
+			result->unit,
+			result->value,
+			result->iterations,
+			result->skipped ? "skipped" : "ok",
+			(i + 1 < context->resultCount) ? "," : ""
+		);
+	}
+	printf("  ]\n");
+	printf("}\n");
+}
+
+static void Bench_PrintCSV(BenchContext *context)
+{
+	Uint32 i;
+
+	printf("name,unit,value,iterations,status\n");
+	for (i = 0; i < context->resultCount; i += 1)
+	{
+		BenchResult *result = &context->results[i];
+		printf(
+			"%s,%s,%.3f,%u,%s\n",
+			result->name,
+			result->unit,
+			result->value,
+			result->iterations,
+			result->skipped ? "skipped" : "ok"
+		);
+	}
+}
+
+/* Helpers */
+
+static SDL_bool Bench_SubmitAndWait(SDL_GpuDevice *device, SDL_GpuCommandBuffer *commandBuffer)
+{
+	SDL_GpuFence *fence = SDL_GpuSubmitAndAcquireFence(commandBuffer);
+
+	if (fence == NULL)
+	{
+		return SDL_FALSE;
+	}
+
+	SDL_GpuWaitForFences(device, SDL_TRUE, 1, &fence);
+	SDL_GpuReleaseFence(device, fence);
+	return SDL_TRUE;
+}
+
+static SDL_GpuRenderPass *Bench_BeginRenderPass(BenchContext *context, SDL_GpuCommandBuffer *commandBuffer)
+{
+	SDL_GpuColorAttachmentInfo colorAttachmentInfo;
+
+	SDL_zero(colorAttachmentInfo);
+	colorAttachmentInfo.textureSlice.texture = context->target;
+	colorAttachmentInfo.loadOp = SDL_GPU_LOADOP_DONT_CARE;
+	colorAttachmentInfo.storeOp = SDL_GPU_STOREOP_DONT_CARE;
+	colorAttachmentInfo.cycle = SDL_TRUE;
+
+	return SDL_GpuBeginRenderPass(commandBuffer, &colorAttachmentInfo, 1, NULL);
+}
+
+static SDL_GpuShader *Bench_LoadShader(
+	BenchContext *context,
+	const char *fileName,
+	SDL_GpuShaderStage stage
+) {
+	SDL_GpuShaderCreateInfo shaderCreateInfo;
+	SDL_GpuShader *shader;
+	char path[1024];
+	size_t codeSize;
+	void *code;
+
+	SDL_snprintf(path, sizeof(path), "%s/%s", context->shaderDirectory, fileName);
+	code = SDL_LoadFile(path, &codeSize);
+	if (code == NULL)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load shader %s: %s", path, SDL_GetError());
+		return NULL;
+	}
+
+	shaderCreateInfo.codeSize = codeSize;
+	shaderCreateInfo.code = (const Uint8*) code;
+	shaderCreateInfo.entryPointName = "main";
+	shaderCreateInfo.stage = stage;
+	shaderCreateInfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
+
+	shader = SDL_GpuCreateShader(context->device, &shaderCreateInfo);
+	SDL_free(code);
+	return shader;
+}
+
+static SDL_GpuGraphicsPipeline *Bench_CreatePipeline(BenchContext *context)
+{
+	SDL_GpuGraphicsPipelineCreateInfo pipelineCreateInfo;
+	SDL_GpuColorAttachmentDescription colorAttachmentDescription;
+
+	SDL_zero(colorAttachmentDescription);
+	colorAttachmentDescription.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8;
+	colorAttachmentDescription.blendState.colorWriteMask =
+		SDL_GPU_COLORCOMPONENT_R_BIT |
+		SDL_GPU_COLORCOMPONENT_G_BIT |
+		SDL_GPU_COLORCOMPONENT_B_BIT |
+		SDL_GPU_COLORCOMPONENT_A_BIT;
+
+	SDL_zero(pipelineCreateInfo);
+	pipelineCreateInfo.vertexShader = context->vertexShader;
+	pipelineCreateInfo.fragmentShader = context->fragmentShader;
+	pipelineCreateInfo.primitiveType = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+	pipelineCreateInfo.rasterizerState.fillMode = SDL_GPU_FILLMODE_FILL;
+	pipelineCreateInfo.rasterizerState.cullMode = SDL_GPU_CULLMODE_NONE;
+	pipelineCreateInfo.rasterizerState.frontFace = SDL_GPU_FRONTFACE_COUNTER_CLOCKWISE;
+	pipelineCreateInfo.multisampleState.multisampleCount = SDL_GPU_SAMPLECOUNT_1;
+	pipelineCreateInfo.multisampleState.sampleMask = 0xFFFFFFFF;
+	pipelineCreateInfo.attachmentInfo.colorAttachmentDescriptions = &colorAttachmentDescription;
+	pipelineCreateInfo.attachmentInfo.colorAttachmentCount = 1;
+	pipelineCreateInfo.vertexResourceInfo.uniformBufferCount = 1;
+	pipelineCreateInfo.fragmentResourceInfo.samplerCount = 1;
+
+	return SDL_GpuCreateGraphicsPipeline(context->device, &pipelineCreateInfo);
+}
+
+static SDL_bool Bench_CreateResources(BenchContext *context)
+{
+	SDL_GpuTextureCreateInfo textureCreateInfo;
+	SDL_GpuSamplerCreateInfo samplerCreateInfo;
+	Uint32 i;
+
+	SDL_zero(textureCreateInfo);
+	textureCreateInfo.width = BENCH_TARGET_SIZE;
+	textureCreateInfo.height = BENCH_TARGET_SIZE;
+	textureCreateInfo.depth = 1;
+	textureCreateInfo.layerCount = 1;
+	textureCreateInfo.levelCount = 1;
+	textureCreateInfo.sampleCount = SDL_GPU_SAMPLECOUNT_1;
+	textureCreateInfo.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8;
+	textureCreateInfo.usageFlags = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET_BIT | SDL_GPU_TEXTUREUSAGE_SAMPLER_BIT;
+
+	context->target = SDL_GpuCreateTexture(context->device, &textureCreateInfo);
+	if (context->target == NULL)
+	{
+		return SDL_FALSE;
+	}
+
+	SDL_zero(samplerCreateInfo);
+	samplerCreateInfo.mipmapMode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST;
+	samplerCreateInfo.addressModeU = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+	samplerCreateInfo.addressModeV = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+	samplerCreateInfo.addressModeW = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+	samplerCreateInfo.maxLod = 1000.0f;
+
+	for (i = 0; i < 2; i += 1)
+	{
+		samplerCreateInfo.minFilter = (i == 0) ? SDL_GPU_FILTER_NEAREST : SDL_GPU_FILTER_LINEAR;
+		samplerCreateInfo.magFilter = samplerCreateInfo.minFilter;
+		context->samplers[i] = SDL_GpuCreateSampler(context->device, &samplerCreateInfo);
+
+		context->vertexBuffers[i] = SDL_GpuCreateBuffer(
+			context->device,
+			SDL_GPU_BUFFERUSAGE_VERTEX_BIT,
+			BENCH_COPY_SIZE
+		);
+
+		context->storageBuffers[i] = SDL_GpuCreateBuffer(
+			context->device,
+			SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ_BIT,
+			BENCH_COPY_SIZE
+		);
+
+		if (	context->samplers[i] == NULL ||
+			context->vertexBuffers[i] == NULL ||
+			context->storageBuffers[i] == NULL	)
+		{
+			return SDL_FALSE;
+		}
+	}
+
+	if (context->shaderDirectory != NULL)
+	{
+		context->vertexShader = Bench_LoadShader(context, "bench.vert.spv", SDL_GPU_SHADERSTAGE_VERTEX);
+		context->fragmentShader = Bench_LoadShader(context, "bench.frag.spv", SDL_GPU_SHADERSTAGE_FRAGMENT);
+
+		if (context->vertexShader != NULL && context->fragmentShader != NULL)
+		{
+			context->pipeline = Bench_CreatePipeline(context);
+		}
+
+		if (context->pipeline == NULL)
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Bench pipeline unavailable, skipping draw cases");
+		}
+	}
+
+	return SDL_TRUE;
+}
+
+static void Bench_DestroyResources(BenchContext *context)
+{
+	Uint32 i;
+
+	if (context->pipeline != NULL)
+	{
+		SDL_GpuReleaseGraphicsPipeline(context->device, context->pipeline);
+	}
+	if (context->vertexShader != NULL)
+	{
+		SDL_GpuReleaseShader(context->device, context->vertexShader);
+	}
+	if (context->fragmentShader != NULL)
+	{
+		SDL_GpuReleaseShader(context->device, context->fragmentShader);
+	}
+
+	for (i = 0; i < 2; i += 1)
+	{
+		if (context->samplers[i] != NULL)
+		{
+			SDL_GpuReleaseSampler(context->device, context->samplers[i]);
+		}
+		if (context->vertexBuffers[i] != NULL)
+		{
+			SDL_GpuReleaseBuffer(context->device, context->vertexBuffers[i]);
+		}
+		if (context->storageBuffers[i] != NULL)
+		{
+			SDL_GpuReleaseBuffer(context->device, context->storageBuffers[i]);
+		}
+	}
+
+	if (context->target != NULL)
+	{
+		SDL_GpuReleaseTexture(context->device, context->target);
+	}
+}
+
+/* Cases */
+
+static void Bench_AcquireSubmit(BenchContext *context)
+{
+	SDL_GpuCommandBuffer *commandBuffer;
+	Uint64 start;
+	Uint32 i;
+
+	/* Empty command buffers, so this is pure front-end and driver overhead */
+	start = SDL_GetPerformanceCounter();
+	for (i = 0; i < context->iterations; i += 1)
+	{
+		commandBuffer = SDL_GpuAcquireCommandBuffer(context->device);
+		SDL_GpuSubmit(commandBuffer);
+	}
+	SDL_GpuWait(context->device);
+	Bench_Report(
+		context,
+		"acquire_submit_latency",
+		"us",
+		Bench_Seconds(start, SDL_GetPerformanceCounter()) * 1000000.0 / context->iterations,
+		context->iterations,
+		SDL_FALSE
+	);
+
+	/* Same again, but waiting for each one to retire */
+	start = SDL_GetPerformanceCounter();
+	for (i = 0; i < context->iterations; i += 1)
+	{
+		commandBuffer = SDL_GpuAcquireCommandBuffer(context->device);
+		Bench_SubmitAndWait(context->device, commandBuffer);
+	}
+	Bench_Report(
+		context,
+		"acquire_submit_wait_latency",
+		"us",
+		Bench_Seconds(start, SDL_GetPerformanceCounter()) * 1000000.0 / context->iterations,
+		context->iterations,
+		SDL_FALSE
+	);
+}
+
+static void Bench_Bandwidth(BenchContext *context, SDL_bool download)
+{
+	const char *name = download ? "download_bandwidth" : "upload_bandwidth";
+	SDL_GpuTransferBuffer *transferBuffer;
+	SDL_GpuBuffer *buffer;
+	SDL_GpuCommandBuffer *commandBuffer;
+	SDL_GpuCopyPass *copyPass;
+	SDL_GpuBufferCopy copyParams;
+	Uint32 iterations = SDL_max(context->iterations / 10, 1);
+	Uint64 start;
+	Uint32 i;
+
+	transferBuffer = SDL_GpuCreateTransferBuffer(
+		context->device,
+		SDL_GPU_TRANSFERUSAGE_BUFFER,
+		download ? SDL_GPU_TRANSFER_MAP_READ : SDL_GPU_TRANSFER_MAP_WRITE,
+		BENCH_TRANSFER_SIZE
+	);
+	buffer = SDL_GpuCreateBuffer(
+		context->device,
+		SDL_GPU_BUFFERUSAGE_VERTEX_BIT,
+		BENCH_TRANSFER_SIZE
+	);
+
+	if (transferBuffer == NULL || buffer == NULL)
+	{
+		Bench_Skip(context, name, "MB/s");
+		goto cleanup;
+	}
+
+	copyParams.srcOffset = 0;
+	copyParams.dstOffset = 0;
+	copyParams.size = BENCH_TRANSFER_SIZE;
+
+	start = SDL_GetPerformanceCounter();
+	for (i = 0; i < iterations; i += 1)
+	{
+		commandBuffer = SDL_GpuAcquireCommandBuffer(context->device);
+		copyPass = SDL_GpuBeginCopyPass(commandBuffer);
+		if (download)
+		{
+			SDL_GpuDownloadFromBuffer(copyPass, buffer, transferBuffer, &copyParams);
+		}
+		else
+		{
+			SDL_GpuUploadToBuffer(copyPass, transferBuffer, buffer, &copyParams, SDL_FALSE);
+		}
+		SDL_GpuEndCopyPass(copyPass);
+		Bench_SubmitAndWait(context->device, commandBuffer);
+	}
+	Bench_Report(
+		context,
+		name,
+		"MB/s",
+		((double) BENCH_TRANSFER_SIZE * iterations / (1024.0 * 1024.0)) /
+			Bench_Seconds(start, SDL_GetPerformanceCounter()),
+		iterations,
+		SDL_FALSE
+	);
+
+cleanup:
+	if (buffer != NULL)
+	{
+		SDL_GpuReleaseBuffer(context->device, buffer);
+	}
+	if (transferBuffer != NULL)
+	{
+		SDL_GpuReleaseTransferBuffer(context->device, transferBuffer);
+	}
+}
+
+static void Bench_BindChurn(BenchContext *context)
+{
+	SDL_GpuCommandBuffer *commandBuffer;
+	SDL_GpuRenderPass *renderPass;
+	SDL_GpuComputePass *computePass;
+	SDL_GpuTextureSamplerBinding samplerBinding;
+	SDL_GpuBufferBinding vertexBinding;
+	Uint32 binds = context->iterations * 100;
+	Uint64 start;
+	Uint32 i;
+
+	/* Alternate between two bindings so the front-end shadow state
+	 * can't filter the binds out as redundant.
+	 */
+	samplerBinding.texture = context->target;
+	vertexBinding.offset = 0;
+
+	commandBuffer = SDL_GpuAcquireCommandBuffer(context->device);
+	renderPass = Bench_BeginRenderPass(context, commandBuffer);
+
+	start = SDL_GetPerformanceCounter();
+	for (i = 0; i < binds; i += 1)
+	{
+		samplerBinding.sampler = context->samplers[i & 1];
+		vertexBinding.buffer = context->vertexBuffers[i & 1];
+		SDL_GpuBindFragmentSamplers(renderPass, 0, &samplerBinding, 1);
+		SDL_GpuBindVertexBuffers(renderPass, 0, &vertexBinding, 1);
+	}
+	Bench_Report(
+		context,
+		"graphics_bind_churn",
+		"Mbinds/s",
+		(binds * 2.0 / 1000000.0) / Bench_Seconds(start, SDL_GetPerformanceCounter()),
+		binds,
+		SDL_FALSE
+	);
+
+	SDL_GpuEndRenderPass(renderPass);
+
+	/* No pipeline and no dispatch, so only the bind path is measured */
+	computePass = SDL_GpuBeginComputePass(commandBuffer, NULL, 0, NULL, 0);
+
+	start = SDL_GetPerformanceCounter();
+	for (i = 0; i < binds; i += 1)
+	{
+		SDL_GpuBindComputeStorageBuffers(computePass, 0, &context->storageBuffers[i & 1], 1);
+	}
+	Bench_Report(
+		context,
+		"compute_bind_churn",
+		"Mbinds/s",
+		(binds / 1000000.0) / Bench_Seconds(start, SDL_GetPerformanceCounter()),
+		binds,
+		SDL_FALSE
+	);
+
+	SDL_GpuEndComputePass(computePass);
+	Bench_SubmitAndWait(context->device, commandBuffer);
+}
+
+static void Bench_UniformPush(BenchContext *context)
+{
+	SDL_GpuCommandBuffer *commandBuffer;
+	SDL_GpuRenderPass *renderPass;
+	Uint8 uniforms[BENCH_UNIFORM_SIZE];
+	Uint32 pushes = context->iterations * 100;
+	Uint64 start;
+	Uint32 i;
+
+	if (context->pipeline == NULL)
+	{
+		Bench_Skip(context, "uniform_push_rate", "Mpushes/s");
+		return;
+	}
+
+	SDL_memset(uniforms, 0, sizeof(uniforms));
+
+	commandBuffer = SDL_GpuAcquireCommandBuffer(context->device);
+	renderPass = Bench_BeginRenderPass(context, commandBuffer);
+	SDL_GpuBindGraphicsPipeline(renderPass, context->pipeline);
+
+	start = SDL_GetPerformanceCounter();
+	for (i = 0; i < pushes; i += 1)
+	{
+		uniforms[0] = (Uint8) i;
+		SDL_GpuPushVertexUniformData(renderPass, 0, uniforms, sizeof(uniforms));
+	}
+	Bench_Report(
+		context,
+		"uniform_push_rate",
+		"Mpushes/s",
+		(pushes / 1000000.0) / Bench_Seconds(start, SDL_GetPerformanceCounter()),
+		pushes,
+		SDL_FALSE
+	);
+
+	SDL_GpuEndRenderPass(renderPass);
+	Bench_SubmitAndWait(context->device, commandBuffer);
+}
+
+static void Bench_Draws(BenchContext *context, SDL_bool changeState)
+{
+	const char *name = changeState ? "draw_throughput_state_changes" : "draw_throughput";
+	SDL_GpuCommandBuffer *commandBuffer;
+	SDL_GpuRenderPass *renderPass;
+	SDL_GpuTextureSamplerBinding samplerBinding;
+	Uint8 uniforms[BENCH_UNIFORM_SIZE];
+	Uint32 draws = context->iterations * 10;
+	Uint64 start;
+	Uint32 i;
+
+	if (context->pipeline == NULL)
+	{
+		Bench_Skip(context, name, "Kdraws/s");
+		return;
+	}
+
+	/* The draws sample the target they render to, which is fine
+	 * because nothing ever reads the result back.
+	 */
+	SDL_memset(uniforms, 0, sizeof(uniforms));
+	samplerBinding.texture = context->target;
+	samplerBinding.sampler = context->samplers[0];
+
+	start = SDL_GetPerformanceCounter();
+	commandBuffer = SDL_GpuAcquireCommandBuffer(context->device);
+	renderPass = Bench_BeginRenderPass(context, commandBuffer);
+	SDL_GpuBindGraphicsPipeline(renderPass, context->pipeline);
+	SDL_GpuBindFragmentSamplers(renderPass, 0, &samplerBinding, 1);
+	SDL_GpuPushVertexUniformData(renderPass, 0, uniforms, sizeof(uniforms));
+
+	for (i = 0; i < draws; i += 1)
+	{
+		if (changeState)
+		{
+			uniforms[0] = (Uint8) i;
+			samplerBinding.sampler = context->samplers[i & 1];
+			SDL_GpuBindFragmentSamplers(renderPass, 0, &samplerBinding, 1);
+			SDL_GpuPushVertexUniformData(renderPass, 0, uniforms, sizeof(uniforms));
+		}
+		SDL_GpuDrawPrimitives(renderPass, 0, 1);
+	}
+
+	SDL_GpuEndRenderPass(renderPass);
+	Bench_SubmitAndWait(context->device, commandBuffer);
+	Bench_Report(
+		context,
+		name,
+		"Kdraws/s",
+		(draws / 1000.0) / Bench_Seconds(start, SDL_GetPerformanceCounter()),
+		draws,
+		SDL_FALSE
+	);
+}
+
+static void Bench_PipelineCreate(BenchContext *context)
+{
+	SDL_GpuGraphicsPipeline *pipeline;
+	Uint32 iterations = SDL_max(context->iterations / 10, 1);
+	Uint64 start;
+	Uint32 i;
+
+	if (context->pipeline == NULL)
+	{
+		Bench_Skip(context, "pipeline_create_time", "ms");
+		return;
+	}
+
+	/* Identical state every time, so driver pipeline caches are included */
+	start = SDL_GetPerformanceCounter();
+	for (i = 0; i < iterations; i += 1)
+	{
+		pipeline = Bench_CreatePipeline(context);
+		if (pipeline != NULL)
+		{
+			SDL_GpuReleaseGraphicsPipeline(context->device, pipeline);
+		}
+	}
+	Bench_Report(
+		context,
+		"pipeline_create_time",
+		"ms",
+		Bench_Seconds(start, SDL_GetPerformanceCounter()) * 1000.0 / iterations,
+		iterations,
+		SDL_FALSE
+	);
+}
+
+static int SDLCALL Bench_RecordThread(void *data)
+{
+	BenchThread *thread = (BenchThread*) data;
+	SDL_GpuDevice *device = thread->context->device;
+	SDL_GpuCommandBuffer *commandBuffer;
+	SDL_GpuCopyPass *copyPass;
+	SDL_GpuBufferCopy copyParams;
+	Uint32 i, j;
+
+	SDL_SemWait(thread->start);
+
+	copyParams.size = BENCH_COPY_SIZE / BENCH_COPIES_PER_PASS;
+
+	for (i = 0; i < thread->context->iterations; i += 1)
+	{
+		commandBuffer = SDL_GpuAcquireCommandBuffer(device);
+		if (commandBuffer == NULL)
+		{
+			thread->failures += 1;
+			continue;
+		}
+
+		copyPass = SDL_GpuBeginCopyPass(commandBuffer);
+		for (j = 0; j < BENCH_COPIES_PER_PASS; j += 1)
+		{
+			copyParams.srcOffset = j * copyParams.size;
+			copyParams.dstOffset = copyParams.srcOffset;
+			SDL_GpuCopyBufferToBuffer(copyPass, thread->source, thread->destination, &copyParams, SDL_FALSE);
+		}
+		SDL_GpuEndCopyPass(copyPass);
+		SDL_GpuSubmit(commandBuffer);
+	}
+
+	return 0;
+}
+
+static void Bench_RecordScaling(BenchContext *context)
+{
+	BenchThread threads[BENCH_MAX_THREADS];
+	SDL_Thread *handles[BENCH_MAX_THREADS];
+	SDL_sem *start;
+	char name[64];
+	Uint32 threadCount, i, failures;
+	Uint64 startTime;
+
+	SDL_zeroa(threads);
+
+	start = SDL_CreateSemaphore(0);
+	if (start == NULL)
+	{
+		Bench_Skip(context, "record_scaling", "Kcmdbufs/s");
+		return;
+	}
+
+	/* Each thread owns its buffers so nothing is shared but the device */
+	for (i = 0; i < context->maxThreads; i += 1)
+	{
+		threads[i].context = context;
+		threads[i].start = start;
+		threads[i].source = SDL_GpuCreateBuffer(context->device, SDL_GPU_BUFFERUSAGE_VERTEX_BIT, BENCH_COPY_SIZE);
+		threads[i].destination = SDL_GpuCreateBuffer(context->device, SDL_GPU_BUFFERUSAGE_VERTEX_BIT, BENCH_COPY_SIZE);
+	}
+
+	/* Powers of two, always finishing on the requested thread count */
+	threadCount = 1;
+	for (;;)
+	{
+		SDL_snprintf(name, sizeof(name), "record_scaling_%u_threads", threadCount);
+		failures = 0;
+
+		for (i = 0; i < threadCount; i += 1)
+		{
+			threads[i].failures = 0;
+			handles[i] = SDL_CreateThread(Bench_RecordThread, "BenchRecordThread", &threads[i]);
+		}
+
+		startTime = SDL_GetPerformanceCounter();
+		for (i = 0; i < threadCount; i += 1)
+		{
+			SDL_SemPost(start);
+		}
+
+		for (i = 0; i < threadCount; i += 1)
+		{
+			if (handles[i] == NULL)
+			{
+				SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create bench thread: %s", SDL_GetError());
+				failures += context->iterations;
+				continue;
+			}
+			SDL_WaitThread(handles[i], NULL);
+			failures += threads[i].failures;
+		}
+		SDL_GpuWait(context->device);
+
+		Bench_Report(
+			context,
+			name,
+			"Kcmdbufs/s",
+			((threadCount * context->iterations - failures) / 1000.0) /
+				Bench_Seconds(startTime, SDL_GetPerformanceCounter()),
+			threadCount * context->iterations - failures,
+			SDL_FALSE
+		);
+
+		if (threadCount == context->maxThreads)
+		{
+			break;
+		}
+		threadCount = SDL_min(threadCount * 2, context->maxThreads);
+	}
+
+	for (i = 0; i < context->maxThreads; i += 1)
+	{
+		if (threads[i].source != NULL)
+		{
+			SDL_GpuReleaseBuffer(context->device, threads[i].source);
+		}
+		if (threads[i].destination != NULL)
+		{
+			SDL_GpuReleaseBuffer(context->device, threads[i].destination);
+		}
+	}
+
+	SDL_DestroySemaphore(start);
+}
+
+/* Entry point */
+
+static void Bench_Usage(const char *program)
+{
+	SDL_Log(
+		"Usage: %s [--backend vulkan|d3d11|metal] [--format json|csv] "
+		"[--iterations N] [--threads N] [--shaders DIR] [--debug]",
+		program
+	);
+}
+
+int main(int argc, char **argv)
+{
+	BenchContext context;
+	SDL_GpuBackend backends = SDL_GPU_BACKEND_ALL;
+	SDL_bool csv = SDL_FALSE;
+	SDL_bool debugMode = SDL_FALSE;
+	int i;
+
+	SDL_zero(context);
+	context.iterations = 1000;
+	context.maxThreads = SDL_max(SDL_GetCPUCount(), 1);
+
+	for (i = 1; i < argc; i += 1)
+	{
+		const char *arg = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if (SDL_strcmp(arg, "--debug") == 0)
+		{
+			debugMode = SDL_TRUE;
+			continue;
+		}
+
+		if (value == NULL)
+		{
+			Bench_Usage(argv[0]);
+			return 1;
+		}
+		i += 1;
+
+		if (SDL_strcmp(arg, "--backend") == 0)
+		{
+			if (SDL_strcmp(value, "vulkan") == 0)
+			{
+				backends = SDL_GPU_BACKEND_VULKAN;
+			}
+			else if (SDL_strcmp(value, "d3d11") == 0)
+			{
+				backends = SDL_GPU_BACKEND_D3D11;
+			}
+			else if (SDL_strcmp(value, "metal") == 0)
+			{
+				backends = SDL_GPU_BACKEND_METAL;
+			}
+			else
+			{
+				Bench_Usage(argv[0]);
+				return 1;
+			}
+		}
+		else if (SDL_strcmp(arg, "--format") == 0)
+		{
+			csv = SDL_strcmp(value, "csv") == 0;
+		}
+		else if (SDL_strcmp(arg, "--iterations") == 0)
+		{
+			context.iterations = SDL_max(SDL_atoi(value), 1);
+		}
+		else if (SDL_strcmp(arg, "--threads") == 0)
+		{
+			context.maxThreads = SDL_clamp(SDL_atoi(value), 1, BENCH_MAX_THREADS);
+		}
+		else if (SDL_strcmp(arg, "--shaders") == 0)
+		{
+			context.shaderDirectory = value;
+		}
+		else
+		{
+			Bench_Usage(argv[0]);
+			return 1;
+		}
+	}
+
+	context.maxThreads = SDL_min(context.maxThreads, BENCH_MAX_THREADS);
+
+	/* The Vulkan backend creates a hidden window during device creation */
+	if (SDL_Init(SDL_INIT_VIDEO) < 0)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to initialize SDL: %s", SDL_GetError());
+		return 1;
+	}
+
+	context.device = SDL_GpuCreateDevice(backends, debugMode);
+	if (context.device == NULL)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create GPU device");
+		SDL_Quit();
+		return 1;
+	}
+
+	if (!Bench_CreateResources(&context))
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create bench resources");
+		Bench_DestroyResources(&context);
+		SDL_GpuDestroyDevice(context.device);
+		SDL_Quit();
+		return 1;
+	}
+
+	Bench_AcquireSubmit(&context);
+	Bench_Bandwidth(&context, SDL_FALSE);
+	Bench_Bandwidth(&context, SDL_TRUE);
+	Bench_BindChurn(&context);
+	Bench_UniformPush(&context);
+	Bench_Draws(&context, SDL_FALSE);
+	Bench_Draws(&context, SDL_TRUE);
+	Bench_PipelineCreate(&context);
+	Bench_RecordScaling(&context);
+
+	if (csv)
+	{
+		Bench_PrintCSV(&context);
+	}
+	else
+	{
+		Bench_PrintJSON(&context);
+	}
+
+	Bench_DestroyResources(&context);
+	SDL_GpuDestroyDevice(context.device);
+	SDL_Quit();
+	return 0;
+}
@@ -72,10 +72,16 @@ typedef struct SDL_GpuComputePipeline SDL_GpuComputePipeline;
 typedef struct SDL_GpuGraphicsPipeline SDL_GpuGraphicsPipeline;
 typedef struct SDL_GpuCommandBuffer SDL_GpuCommandBuffer;
 typedef struct SDL_GpuRenderPass SDL_GpuRenderPass;
+typedef struct SDL_GpuParallelRenderPass SDL_GpuParallelRenderPass;
 typedef struct SDL_GpuComputePass SDL_GpuComputePass;
 typedef struct SDL_GpuCopyPass SDL_GpuCopyPass;
 typedef struct SDL_GpuFence SDL_GpuFence;
 typedef struct SDL_GpuOcclusionQuery SDL_GpuOcclusionQuery;
+typedef struct SDL_GpuTimestampQuery SDL_GpuTimestampQuery;
+typedef struct SDL_GpuCompileJob SDL_GpuCompileJob;
+typedef struct SDL_GpuTextureStreamer SDL_GpuTextureStreamer;
+typedef struct SDL_GpuRenderGraph SDL_GpuRenderGraph;
+typedef struct SDL_GpuBindlessTable SDL_GpuBindlessTable;
 
 typedef enum SDL_GpuPrimitiveType
 {
@@ -162,7 +168,8 @@ typedef enum SDL_GpuTextureUsageFlagBits
 	SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET_BIT   = 0x00000004,
 	SDL_GPU_TEXTUREUSAGE_GRAPHICS_STORAGE_READ_BIT  = 0x00000008,
 	SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ_BIT   = 0x00000020,
-	SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE_BIT  = 0x00000040
+	SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE_BIT  = 0x00000040,
+	SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT              = 0x00000080  /* see SDL_GpuDiscardTransientTexture */
 } SDL_GpuTextureUsageFlagBits;
 
 typedef Uint32 SDL_GpuTextureUsageFlags;
@@ -207,7 +214,8 @@ typedef Uint32 SDL_GpuBufferUsageFlags;
 typedef enum SDL_GpuTransferBufferMapFlagBits
 {
     SDL_GPU_TRANSFER_MAP_READ  = 0x00000001,
-    SDL_GPU_TRANSFER_MAP_WRITE = 0x00000002
+    SDL_GPU_TRANSFER_MAP_WRITE = 0x00000002,
+    SDL_GPU_TRANSFER_MAP_PERSISTENT = 0x00000004 /* stays mapped, see SDL_GpuFlushTransferBuffer */
 } SDL_GpuTransferBufferMapFlagBits;
 
 typedef Uint32 SDL_GpuTransferBufferMapFlags;
@@ -410,6 +418,37 @@ typedef enum SDL_GpuSwapchainComposition
     SDL_GPU_SWAPCHAINCOMPOSITION_HDR10_ST2048
 } SDL_GpuSwapchainComposition;
 
+typedef enum SDL_GpuCompileStatus
+{
+	SDL_GPU_COMPILESTATUS_PENDING,
+	SDL_GPU_COMPILESTATUS_READY,
+	SDL_GPU_COMPILESTATUS_FAILED
+} SDL_GpuCompileStatus;
+
+typedef enum SDL_GpuPassType
+{
+	SDL_GPU_PASSTYPE_RENDER,
+	SDL_GPU_PASSTYPE_COMPUTE,
+	SDL_GPU_PASSTYPE_COPY
+} SDL_GpuPassType;
+
+/*
+ * GRAPHICS:
+ *   Can record every pass type, present and blit. This is the queue SDL_GpuAcquireCommandBuffer uses.
+ * COMPUTE:
+ *   Can record compute and copy passes, but not render passes, blits or mipmap generation.
+ * TRANSFER:
+ *   Can only record copy passes, without mipmap generation.
+ *
+ * Backends without dedicated queues run everything on the graphics queue.
+ */
+typedef enum SDL_GpuCommandQueue
+{
+	SDL_GPU_COMMANDQUEUE_GRAPHICS,
+	SDL_GPU_COMMANDQUEUE_COMPUTE,
+	SDL_GPU_COMMANDQUEUE_TRANSFER
+} SDL_GpuCommandQueue;
+
 typedef enum SDL_GpuBackendBits
 {
 	SDL_GPU_BACKEND_INVALID = 0,
@@ -473,6 +512,12 @@ typedef struct SDL_GpuTextureRegion
 	Uint32 d;
 } SDL_GpuTextureRegion;
 
+typedef struct SDL_GpuBlitRegion
+{
+    SDL_GpuTextureRegion source;
+    SDL_GpuTextureRegion destination;
+} SDL_GpuBlitRegion;
+
 typedef struct SDL_GpuBufferImageCopy
 {
 	Uint32 bufferOffset;
@@ -504,6 +549,17 @@ typedef struct SDL_GpuIndexedIndirectDrawCommand
     Uint32 firstInstance; /* ID of the first instance to draw */
 } SDL_GpuIndexedIndirectDrawCommand;
 
+typedef struct SDL_GpuIndexedDrawRecord
+{
+    Uint32 baseVertex;         /* value added to vertex index before indexing into the vertex buffer */
+    Uint32 startIndex;         /* base index within the index buffer */
+    Uint32 primitiveCount;     /* number of primitives to draw */
+    Uint32 firstInstance;      /* ID of the first instance to draw */
+    Uint32 instanceCount;      /* number of instances to draw */
+    void *vertexUniformData;   /* pushed to vertex uniform slot 0 before the draw, can be NULL */
+    void *fragmentUniformData; /* pushed to fragment uniform slot 0 before the draw, can be NULL */
+} SDL_GpuIndexedDrawRecord;
+
 /* State structures */
 
 typedef struct SDL_GpuSamplerCreateInfo
@@ -660,6 +716,7 @@ typedef struct SDL_GpuGraphicsPipelineCreateInfo
 	SDL_GpuGraphicsPipelineResourceInfo vertexResourceInfo;
     SDL_GpuGraphicsPipelineResourceInfo fragmentResourceInfo;
 	float blendConstants[4];
+	SDL_bool useBindlessTable; /* see SDL_GpuCreateBindlessTable */
 } SDL_GpuGraphicsPipelineCreateInfo;
 
 typedef struct SDL_GpuComputePipelineResourceInfo
@@ -675,6 +732,7 @@ typedef struct SDL_GpuComputePipelineCreateInfo
 {
 	SDL_GpuShader *computeShader;
 	SDL_GpuComputePipelineResourceInfo pipelineResourceInfo;
+	SDL_bool useBindlessTable; /* see SDL_GpuCreateBindlessTable */
 } SDL_GpuComputePipelineCreateInfo;
 
 typedef struct SDL_GpuColorAttachmentInfo
@@ -806,6 +864,99 @@ typedef struct SDL_GpuStorageTextureReadWriteBinding
 	SDL_bool cycle;
 } SDL_GpuStorageTextureReadWriteBinding;
 
+/* Statistics structs */
+
+#define SDL_GPU_MAX_MEMORY_HEAPS 16
+
+typedef struct SDL_GpuMemoryHeapStats
+{
+	Uint64 budgetBytes;           /* how much this process can use before the OS starts evicting, or the heap size if unknown */
+	Uint64 usageBytes;            /* how much this process is using as reported by the OS, or allocatedBytes if unknown */
+	Uint64 allocatedBytes;        /* device memory allocated by this GPU context */
+	Uint64 usedBytes;             /* portion of allocatedBytes bound to live resources */
+	Uint64 largestFreeBlockBytes; /* largest contiguous free range inside allocatedBytes */
+	Uint32 allocationCount;       /* number of device memory allocations */
+	Uint32 freeBlockCount;        /* number of free ranges inside allocatedBytes */
+	SDL_bool deviceLocal;         /* SDL_TRUE if this heap is video memory */
+} SDL_GpuMemoryHeapStats;
+
+typedef struct SDL_GpuMemoryStats
+{
+	Uint32 heapCount;
+	SDL_GpuMemoryHeapStats heaps[SDL_GPU_MAX_MEMORY_HEAPS];
+	Uint32 bufferCount;  /* live buffers, including cycled copies */
+	Uint32 textureCount; /* live textures, including cycled copies */
+} SDL_GpuMemoryStats;
+
+/* Passes after this many in a single command buffer are not timed */
+#define SDL_GPU_MAX_TIMED_PASSES 64
+
+typedef struct SDL_GpuPassTiming
+{
+	SDL_GpuPassType passType;
+	Uint64 durationNanoseconds; /* GPU time from the start to the end of the pass */
+} SDL_GpuPassTiming;
+
+/* Counters that do not apply to the active backend are always 0 */
+typedef struct SDL_GpuFrameStats
+{
+	Uint64 commandBuffersAcquired;
+	Uint64 commandBuffersSubmitted;
+	Uint64 drawCalls;              /* indirect draws count once per call */
+	Uint64 dispatches;
+	Uint64 graphicsPipelineBinds;
+	Uint64 computePipelineBinds;
+	Uint64 filteredBinds;          /* see SDL_GpuGetFilteredBindCount */
+	Uint64 uniformBytesPushed;
+	Uint64 bytesUploaded;          /* transfer buffer to buffer or texture */
+	Uint64 bytesDownloaded;        /* buffer or texture to transfer buffer */
+	Uint64 descriptorSetsAllocated;
+	Uint64 renderPassCacheHits;
+	Uint64 renderPassCacheMisses;
+	Uint64 framebufferCacheHits;
+	Uint64 framebufferCacheMisses;
+	Uint64 barriersIssued;
+
+	/* Only filled in for command buffers with SDL_GpuEnablePipelineStatistics */
+	Uint64 inputAssemblyVertices;
+	Uint64 vertexShaderInvocations;
+	Uint64 clippingPrimitives;
+	Uint64 fragmentShaderInvocations;
+	Uint64 computeShaderInvocations;
+} SDL_GpuFrameStats;
+
+/* Render graph structs */
+
+/* Only valid until the graph is executed, 0 is never a valid handle */
+typedef Uint32 SDL_GpuRenderGraphResource;
+typedef Uint32 SDL_GpuRenderGraphPass;
+
+typedef enum SDL_GpuRenderGraphPassFlagBits
+{
+	SDL_GPU_RENDERGRAPHPASS_ALLOW_ASYNC_BIT = 0x00000001, /* see SDL_GpuExecuteRenderGraph */
+	SDL_GPU_RENDERGRAPHPASS_NEVER_CULL_BIT  = 0x00000002  /* record the pass even if nothing uses what it writes */
+} SDL_GpuRenderGraphPassFlagBits;
+
+typedef Uint32 SDL_GpuRenderGraphPassFlags;
+
+typedef void (SDLCALL *SDL_GpuRenderGraphRenderFunc)(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderPass *renderPass,
+	void *userdata
+);
+
+typedef void (SDLCALL *SDL_GpuRenderGraphComputeFunc)(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuComputePass *computePass,
+	void *userdata
+);
+
+typedef void (SDLCALL *SDL_GpuRenderGraphCopyFunc)(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuCopyPass *copyPass,
+	void *userdata
+);
+
 /* Functions */
 
 /* Device */
@@ -831,6 +982,30 @@ extern SDL_DECLSPEC SDL_GpuDevice *SDLCALL SDL_GpuCreateDevice(
 	SDL_bool debugMode
 );
 
+/**
+ * Creates a GPU context, seeding the backend's pipeline cache with data
+ * previously returned by SDL_GpuGetPipelineCacheData.
+ *
+ * The cache data is tagged with the backend, device and driver version that produced it. If any of these do not match the selected device, the data is ignored and the device starts with an empty cache, so it is always safe to pass in whatever was saved on a previous run.
+ *
+ * \param preferredBackends a bitflag containing the renderers most recognized by the application
+ * \param debugMode enable debug mode properties and validations
+ * \param pipelineCacheData a pointer to cache data, may be NULL
+ * \param pipelineCacheSize the size of pipelineCacheData in bytes
+ * \returns a GPU context on success or NULL on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateDevice
+ * \sa SDL_GpuGetPipelineCacheData
+ */
+extern SDL_DECLSPEC SDL_GpuDevice *SDLCALL SDL_GpuCreateDeviceWithPipelineCache(
+	SDL_GpuBackend preferredBackends,
+	SDL_bool debugMode,
+	const void *pipelineCacheData,
+	size_t pipelineCacheSize
+);
+
 /**
  * Destroys a GPU context previously returned by SDL_GpuCreateDevice.
  *
@@ -854,6 +1029,52 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuDestroyDevice(SDL_GpuDevice *device);
  */
 extern SDL_DECLSPEC SDL_GpuBackend SDLCALL SDL_GpuGetBackend(SDL_GpuDevice *device);
 
+/**
+ * Retrieves the contents of the device's pipeline cache, so that it can be
+ * saved to disk and passed to SDL_GpuCreateDeviceWithPipelineCache on the
+ * next run.
+ *
+ * On Vulkan this contains the VkPipelineCache data, on D3D11 the compiled bytecode of shaders created via SPIRV-Cross, and on Metal a serialized MTLBinaryArchive.
+ *
+ * If data is NULL, the required size is written to dataSize. Otherwise dataSize must contain the size of the data buffer, and is overwritten with the number of bytes written.
+ *
+ * \param device a GPU context to query
+ * \param data a buffer to write the cache data to, or NULL
+ * \param dataSize a pointer to the size of the data buffer in bytes
+ * \returns SDL_TRUE on success, SDL_FALSE on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateDeviceWithPipelineCache
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuGetPipelineCacheData(
+	SDL_GpuDevice *device,
+	void *data,
+	size_t *dataSize
+);
+
+/**
+ * Sets a directory in which shaders translated from SPIR-V are cached.
+ *
+ * On D3D11 and Metal, SPIR-V shaders are translated to HLSL or MSL with
+ * SPIRV-Cross. The output is always cached in memory for the lifetime of
+ * the device. With a directory set, it is also written to and read from
+ * that directory, so later runs can skip the translation. The directory
+ * must already exist. This has no effect on Vulkan.
+ *
+ * \param device a GPU context
+ * \param directory the path of the cache directory, or NULL to disable the on-disk cache
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateShader
+ * \sa SDL_GpuGetPipelineCacheData
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuSetShaderCacheDirectory(
+	SDL_GpuDevice *device,
+	const char *directory
+);
+
 /* State Creation */
 
 /**
@@ -935,6 +1156,11 @@ extern SDL_DECLSPEC SDL_GpuShader *SDLCALL SDL_GpuCreateShader(
  * Note that certain combinations of usage flags are invalid.
  * For example, a texture cannot have both the SAMPLER and GRAPHICS_STORAGE_READ flags.
  *
+ * A texture with the TRANSIENT flag only keeps its contents within a single command buffer,
+ * and may only be used by one command buffer at a time. Transient textures are never cycled,
+ * cannot be placed in a bindless table, and on Metal share memory with each other
+ * according to SDL_GpuDiscardTransientTexture.
+ *
  * \param device a GPU Context
  * \param textureCreateInfo a struct describing the state of the texture to create
  * \returns a texture object on success, or NULL on failure
@@ -987,6 +1213,10 @@ extern SDL_DECLSPEC SDL_GpuBuffer *SDLCALL SDL_GpuCreateBuffer(
 /**
  * Creates a transfer buffer to be used when uploading to or downloading from graphics resources.
  *
+ * Any transfer buffer may be downloaded into. Leaving out
+ * SDL_GPU_TRANSFER_MAP_READ is a hint that the buffer is only used for uploads,
+ * which on D3D11 keeps its maps off the immediate context until its first download.
+ *
  * \param device a GPU Context
  * \param usage specifies whether the transfer buffer will transfer buffers or textures
  * \param mapFlags specify read-write options for the transfer buffer
@@ -1025,6 +1255,238 @@ extern SDL_DECLSPEC SDL_GpuOcclusionQuery *SDLCALL SDL_GpuCreateOcclusionQuery(
     SDL_GpuDevice *device
 );
 
+/**
+ * Creates a timestamp query object.
+ * Write it with SDL_GpuWriteTimestamp and subtract two results to measure GPU time.
+ *
+ * \param device a GPU context
+ * \returns a timestamp query object, or NULL if the device does not support timestamps
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuWriteTimestamp
+ * \sa SDL_GpuTimestampQueryResult
+ * \sa SDL_GpuReleaseTimestampQuery
+ */
+extern SDL_DECLSPEC SDL_GpuTimestampQuery *SDLCALL SDL_GpuCreateTimestampQuery(
+    SDL_GpuDevice *device
+);
+
+/**
+ * Creates a bindless table, a large array of texture-sampler pairs
+ * that shaders index directly instead of going through binding slots.
+ * Pipelines created with useBindlessTable set can read the table bound to their pass.
+ *
+ * The table is laid out per backend as follows:
+ *   Vulkan: set 4 (graphics) or set 3 (compute), binding 0,
+ *           a runtime array of combined image samplers.
+ *   Metal:  an argument buffer in buffer slot 14 (graphics only),
+ *           "capacity" textures at [[id(0)]] followed by "capacity" samplers.
+ *   D3D11:  not supported.
+ *
+ * \param device a GPU context
+ * \param capacity the number of entries, at most SDL_GpuGetMaxBindlessTableSize
+ * \returns a bindless table, or NULL on failure or if bindless tables are not supported
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuGetMaxBindlessTableSize
+ * \sa SDL_GpuUpdateBindlessTable
+ * \sa SDL_GpuBindGraphicsBindlessTable
+ * \sa SDL_GpuBindComputeBindlessTable
+ * \sa SDL_GpuReleaseBindlessTable
+ */
+extern SDL_DECLSPEC SDL_GpuBindlessTable *SDLCALL SDL_GpuCreateBindlessTable(
+    SDL_GpuDevice *device,
+    Uint32 capacity
+);
+
+/**
+ * Writes texture-sampler pairs into a range of bindless table entries.
+ * Entries that are not written stay empty and must not be read by shaders.
+ *
+ * The table captures each texture as it is right now, so a texture that is
+ * cycled afterwards must be written again to be seen with its new contents.
+ * You may update entries while the table is in use by submitted commands,
+ * as long as those commands do not read the entries being replaced.
+ * Updates to the same table must not happen on several threads at once.
+ *
+ * \param device a GPU context
+ * \param bindlessTable a bindless table
+ * \param firstIndex the first table entry to write
+ * \param textureSamplerBindings an array of texture-sampler pairs
+ * \param bindingCount the number of pairs to write from the array
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuUpdateBindlessTable(
+    SDL_GpuDevice *device,
+    SDL_GpuBindlessTable *bindlessTable,
+    Uint32 firstIndex,
+    SDL_GpuTextureSamplerBinding *textureSamplerBindings,
+    Uint32 bindingCount
+);
+
+/* Asynchronous State Creation */
+
+/**
+ * Queues a shader to be created on a background thread.
+ * This is useful for SPIR-V shaders on D3D11 and Metal,
+ * which must be translated and compiled before they can be used.
+ *
+ * The create info is copied, so it does not need to outlive this call.
+ *
+ * \param device a GPU Context
+ * \param shaderCreateInfo a struct describing the state of the desired shader
+ * \returns a compile job handle on success, or NULL on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuQueryCompileJob
+ * \sa SDL_GpuGetCompiledShader
+ * \sa SDL_GpuReleaseCompileJob
+ */
+extern SDL_DECLSPEC SDL_GpuCompileJob *SDLCALL SDL_GpuCreateShaderAsync(
+	SDL_GpuDevice *device,
+	SDL_GpuShaderCreateInfo *shaderCreateInfo
+);
+
+/**
+ * Queues a graphics pipeline to be created on a background thread.
+ *
+ * The create info and the arrays it points to are copied, but the shaders
+ * referenced by it must not be released until the job has finished.
+ *
+ * \param device a GPU Context
+ * \param pipelineCreateInfo a struct describing the state of the desired graphics pipeline
+ * \returns a compile job handle on success, or NULL on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuQueryCompileJob
+ * \sa SDL_GpuGetCompiledGraphicsPipeline
+ * \sa SDL_GpuBindGraphicsPipelineAsync
+ * \sa SDL_GpuReleaseCompileJob
+ */
+extern SDL_DECLSPEC SDL_GpuCompileJob *SDLCALL SDL_GpuCreateGraphicsPipelineAsync(
+	SDL_GpuDevice *device,
+	SDL_GpuGraphicsPipelineCreateInfo *pipelineCreateInfo
+);
+
+/**
+ * Queues a compute pipeline to be created on a background thread.
+ *
+ * The compute shader referenced by the create info must not be released
+ * until the job has finished.
+ *
+ * \param device a GPU Context
+ * \param computePipelineCreateInfo a struct describing the state of the requested compute pipeline
+ * \returns a compile job handle on success, or NULL on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuQueryCompileJob
+ * \sa SDL_GpuGetCompiledComputePipeline
+ * \sa SDL_GpuBindComputePipelineAsync
+ * \sa SDL_GpuReleaseCompileJob
+ */
+extern SDL_DECLSPEC SDL_GpuCompileJob *SDLCALL SDL_GpuCreateComputePipelineAsync(
+	SDL_GpuDevice *device,
+	SDL_GpuComputePipelineCreateInfo *computePipelineCreateInfo
+);
+
+/**
+ * Checks whether a compile job has finished. This never blocks.
+ *
+ * \param device a GPU Context
+ * \param job a compile job handle
+ * \returns the current status of the job
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuWaitForCompileJob
+ */
+extern SDL_DECLSPEC SDL_GpuCompileStatus SDLCALL SDL_GpuQueryCompileJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+);
+
+/**
+ * Blocks the thread until a compile job has finished.
+ *
+ * \param device a GPU Context
+ * \param job a compile job handle
+ * \returns SDL_GPU_COMPILESTATUS_READY or SDL_GPU_COMPILESTATUS_FAILED
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuQueryCompileJob
+ */
+extern SDL_DECLSPEC SDL_GpuCompileStatus SDLCALL SDL_GpuWaitForCompileJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+);
+
+/**
+ * Gets the shader created by a compile job.
+ * The shader is owned by the job and is released along with it.
+ *
+ * \param device a GPU Context
+ * \param job a compile job handle returned by SDL_GpuCreateShaderAsync
+ * \returns the shader, or NULL if the job is still pending or has failed
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC SDL_GpuShader *SDLCALL SDL_GpuGetCompiledShader(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+);
+
+/**
+ * Gets the graphics pipeline created by a compile job.
+ * The pipeline is owned by the job and is released along with it.
+ *
+ * \param device a GPU Context
+ * \param job a compile job handle returned by SDL_GpuCreateGraphicsPipelineAsync
+ * \returns the graphics pipeline, or NULL if the job is still pending or has failed
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC SDL_GpuGraphicsPipeline *SDLCALL SDL_GpuGetCompiledGraphicsPipeline(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+);
+
+/**
+ * Gets the compute pipeline created by a compile job.
+ * The pipeline is owned by the job and is released along with it.
+ *
+ * \param device a GPU Context
+ * \param job a compile job handle returned by SDL_GpuCreateComputePipelineAsync
+ * \returns the compute pipeline, or NULL if the job is still pending or has failed
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC SDL_GpuComputePipeline *SDLCALL SDL_GpuGetCompiledComputePipeline(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+);
+
+/**
+ * Releases a compile job along with the object it created.
+ * If the job is still pending it is cancelled, or discarded once it finishes.
+ * All compile jobs must be released before the device is destroyed.
+ *
+ * \param device a GPU Context
+ * \param job a compile job handle
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuReleaseCompileJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+);
+
 /* Debug Naming */
 
 /**
@@ -1184,6 +1646,34 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuReleaseOcclusionQuery(
     SDL_GpuOcclusionQuery *query
 );
 
+/**
+ * Frees the given timestamp query as soon as it is safe to do so.
+ * You must not reference the timestamp query after calling this function.
+ *
+ * \param device a GPU context
+ * \param query a timestamp query object to be destroyed
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuReleaseTimestampQuery(
+    SDL_GpuDevice *device,
+    SDL_GpuTimestampQuery *query
+);
+
+/**
+ * Frees the given bindless table as soon as it is safe to do so.
+ * You must not reference the bindless table after calling this function.
+ *
+ * \param device a GPU context
+ * \param bindlessTable a bindless table to be destroyed
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuReleaseBindlessTable(
+    SDL_GpuDevice *device,
+    SDL_GpuBindlessTable *bindlessTable
+);
+
 /*
  * A NOTE ON CYCLING
  *
@@ -1264,6 +1754,28 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuBindGraphicsPipeline(
 	SDL_GpuGraphicsPipeline *graphicsPipeline
 );
 
+/**
+ * Binds the graphics pipeline of a compile job, if it is ready.
+ *
+ * If the job has not finished (or has failed), fallbackPipeline is bound
+ * instead. If fallbackPipeline is NULL, all uniform pushes, resource binds
+ * and draw calls are silently skipped until another pipeline is bound.
+ *
+ * \param renderPass a render pass handle
+ * \param job a compile job handle returned by SDL_GpuCreateGraphicsPipelineAsync
+ * \param fallbackPipeline the graphics pipeline to bind if the job is not ready, may be NULL
+ * \returns SDL_TRUE if the job's pipeline was bound, SDL_FALSE otherwise
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateGraphicsPipelineAsync
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuBindGraphicsPipelineAsync(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuCompileJob *job,
+    SDL_GpuGraphicsPipeline *fallbackPipeline
+);
+
 /**
  * Sets the current viewport state on a command buffer.
  *
@@ -1430,6 +1942,23 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuBindFragmentStorageBuffers(
     Uint32 bindingCount
 );
 
+/**
+ * Binds a bindless table for use by the vertex and fragment shaders.
+ * The table stays bound across pipeline changes until the render pass ends,
+ * and is ignored by pipelines that were not created with useBindlessTable.
+ *
+ * \param renderPass a render pass handle
+ * \param bindlessTable a bindless table
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateBindlessTable
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuBindGraphicsBindlessTable(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuBindlessTable *bindlessTable
+);
+
 /**
  * Pushes data to a vertex uniform slot on the bound graphics pipeline.
  * Subsequent draw calls will use this uniform data.
@@ -1548,29 +2077,199 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuDrawIndexedPrimitivesIndirect(
 );
 
 /**
- * Ends the given render pass.
- * All bound graphics state on the render pass command buffer is unset.
- * The render pass handle is now invalid.
+ * Draws data using bound graphics state and with draw parameters set from a buffer.
+ * The number of draws is read from a second buffer on the GPU timeline.
+ * The draw buffer layout should match the layout of SDL_GpuIndirectDrawCommand.
+ * The count buffer must hold a Uint32 draw count at countOffsetInBytes.
+ * Both buffers must have been created with SDL_GPU_BUFFERUSAGE_INDIRECT_BIT.
+ * You must not call this function before binding a graphics pipeline.
+ * Devices that do not support SDL_GpuSupportsIndirectCount draw nothing.
  *
  * \param renderPass a render pass handle
+ * \param buffer a buffer containing draw parameters
+ * \param offsetInBytes the offset to start reading from the draw buffer
+ * \param countBuffer a buffer containing the draw count
+ * \param countOffsetInBytes the offset of the draw count in the count buffer
+ * \param maxDrawCount the maximum number of draws that will be issued, regardless of the count buffer
+ * \param stride the byte stride between sets of draw parameters
  *
  * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuDrawPrimitivesIndirect
+ * \sa SDL_GpuSupportsIndirectCount
  */
-extern SDL_DECLSPEC void SDLCALL SDL_GpuEndRenderPass(
-	SDL_GpuRenderPass *renderPass
+extern SDL_DECLSPEC void SDLCALL SDL_GpuDrawPrimitivesIndirectCount(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
 );
 
-/* Compute Pass */
-
 /**
- * Begins a compute pass on a command buffer.
- * A compute pass is defined by a set of texture slices and buffers that
- * will be written to by compute pipelines.
- * These textures and buffers must have been created with the COMPUTE_STORAGE_WRITE bit.
- * If these resources will also be read during the pass, they must be created with the COMPUTE_STORAGE_READ bit.
- * All operations related to compute pipelines must take place inside of a compute pass.
- * You must not begin another compute pass, or a render pass or copy pass
- * before ending the compute pass.
+ * Draws data using bound graphics state with an index buffer enabled
+ * and with draw parameters set from a buffer.
+ * The number of draws is read from a second buffer on the GPU timeline.
+ * The draw buffer layout should match the layout of SDL_GpuIndexedIndirectDrawCommand.
+ * The count buffer must hold a Uint32 draw count at countOffsetInBytes.
+ * Both buffers must have been created with SDL_GPU_BUFFERUSAGE_INDIRECT_BIT.
+ * You must not call this function before binding a graphics pipeline.
+ * Devices that do not support SDL_GpuSupportsIndirectCount draw nothing.
+ *
+ * \param renderPass a render pass handle
+ * \param buffer a buffer containing draw parameters
+ * \param offsetInBytes the offset to start reading from the draw buffer
+ * \param countBuffer a buffer containing the draw count
+ * \param countOffsetInBytes the offset of the draw count in the count buffer
+ * \param maxDrawCount the maximum number of draws that will be issued, regardless of the count buffer
+ * \param stride the byte stride between sets of draw parameters
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuDrawIndexedPrimitivesIndirect
+ * \sa SDL_GpuSupportsIndirectCount
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuDrawIndexedPrimitivesIndirectCount(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
+);
+
+/**
+ * Draws many small indexed draws using bound graphics state, each with its own uniform data.
+ * This is equivalent to pushing each record's uniform data to slot 0 and calling
+ * SDL_GpuDrawIndexedPrimitives, but the uniform data is packed into as few uploads as possible.
+ * A NULL uniform data pointer keeps whatever was last pushed to that slot.
+ * You must not call this function before binding a graphics pipeline.
+ *
+ * \param renderPass a render pass handle
+ * \param draws an array of draw records
+ * \param drawCount the number of draw records in the array
+ * \param vertexUniformDataLengthInBytes the length of each record's vertex uniform data
+ * \param fragmentUniformDataLengthInBytes the length of each record's fragment uniform data
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuDrawIndexedPrimitives
+ * \sa SDL_GpuPushVertexUniformData
+ * \sa SDL_GpuPushFragmentUniformData
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuDrawIndexedPrimitivesBatch(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuIndexedDrawRecord *draws,
+    Uint32 drawCount,
+    Uint32 vertexUniformDataLengthInBytes,
+    Uint32 fragmentUniformDataLengthInBytes
+);
+
+/**
+ * Ends the given render pass.
+ * All bound graphics state on the render pass command buffer is unset.
+ * The render pass handle is now invalid.
+ *
+ * \param renderPass a render pass handle
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuEndRenderPass(
+	SDL_GpuRenderPass *renderPass
+);
+
+/* Parallel Render Pass */
+
+/**
+ * Begins a render pass whose commands are recorded by sub passes.
+ * Takes the same attachment arguments as SDL_GpuBeginRenderPass,
+ * but no commands can be recorded on the parallel render pass itself.
+ * Instead, acquire sub passes with SDL_GpuAcquireRenderSubPass and record
+ * draws into those, potentially on several threads at once.
+ * You cannot begin another render pass, or begin a compute pass or copy pass
+ * until you have ended the parallel render pass.
+ *
+ * \param commandBuffer a command buffer
+ * \param colorAttachmentInfos an array of SDL_GpuColorAttachmentInfo structs
+ * \param colorAttachmentCount the number of color attachments in the colorAttachmentInfos array
+ * \param depthStencilAttachmentInfo the depth-stencil target and clear value, may be NULL
+ * \returns a parallel render pass handle
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuAcquireRenderSubPass
+ * \sa SDL_GpuEndParallelRenderPass
+ */
+extern SDL_DECLSPEC SDL_GpuParallelRenderPass *SDLCALL SDL_GpuBeginParallelRenderPass(
+	SDL_GpuCommandBuffer *commandBuffer,
+	SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+	Uint32 colorAttachmentCount,
+	SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+);
+
+/**
+ * Acquires a sub pass of a parallel render pass.
+ * The returned handle can be used with every render pass function,
+ * and starts out with the default viewport and scissor state and nothing bound.
+ * This function may be called from any thread, but the sub pass must only be
+ * recorded on the thread that acquired it.
+ * Sub passes are executed in the order they were acquired.
+ *
+ * \param parallelRenderPass a parallel render pass handle
+ * \returns a render pass handle, or NULL on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuEndRenderSubPass
+ */
+extern SDL_DECLSPEC SDL_GpuRenderPass *SDLCALL SDL_GpuAcquireRenderSubPass(
+	SDL_GpuParallelRenderPass *parallelRenderPass
+);
+
+/**
+ * Ends a sub pass acquired from a parallel render pass.
+ * This must be called on the thread that recorded the sub pass.
+ * The render pass handle is now invalid.
+ *
+ * \param renderPass a render pass handle returned by SDL_GpuAcquireRenderSubPass
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuAcquireRenderSubPass
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuEndRenderSubPass(
+	SDL_GpuRenderPass *renderPass
+);
+
+/**
+ * Ends the given parallel render pass.
+ * All of its sub passes must have been ended before calling this.
+ * The parallel render pass handle is now invalid.
+ *
+ * \param parallelRenderPass a parallel render pass handle
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuBeginParallelRenderPass
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuEndParallelRenderPass(
+	SDL_GpuParallelRenderPass *parallelRenderPass
+);
+
+/* Compute Pass */
+
+/**
+ * Begins a compute pass on a command buffer.
+ * A compute pass is defined by a set of texture slices and buffers that
+ * will be written to by compute pipelines.
+ * These textures and buffers must have been created with the COMPUTE_STORAGE_WRITE bit.
+ * If these resources will also be read during the pass, they must be created with the COMPUTE_STORAGE_READ bit.
+ * All operations related to compute pipelines must take place inside of a compute pass.
+ * You must not begin another compute pass, or a render pass or copy pass
+ * before ending the compute pass.
  *
  * \param commandBuffer a command buffer
  * \param storageTextureBindings an array of writeable storage texture binding structs
@@ -1605,6 +2304,28 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuBindComputePipeline(
 	SDL_GpuComputePipeline *computePipeline
 );
 
+/**
+ * Binds the compute pipeline of a compile job, if it is ready.
+ *
+ * If the job has not finished (or has failed), fallbackPipeline is bound
+ * instead. If fallbackPipeline is NULL, all uniform pushes, resource binds
+ * and dispatches are silently skipped until another pipeline is bound.
+ *
+ * \param computePass a compute pass handle
+ * \param job a compile job handle returned by SDL_GpuCreateComputePipelineAsync
+ * \param fallbackPipeline the compute pipeline to bind if the job is not ready, may be NULL
+ * \returns SDL_TRUE if the job's pipeline was bound, SDL_FALSE otherwise
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateComputePipelineAsync
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuBindComputePipelineAsync(
+	SDL_GpuComputePass *computePass,
+	SDL_GpuCompileJob *job,
+	SDL_GpuComputePipeline *fallbackPipeline
+);
+
 /**
  * Binds storage textures as readonly for use on the compute shader.
  * These textures must have been created with SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ_BIT.
@@ -1641,6 +2362,23 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuBindComputeStorageBuffers(
     Uint32 bindingCount
 );
 
+/**
+ * Binds a bindless table for use by the compute shader.
+ * The table stays bound across pipeline changes until the compute pass ends,
+ * and is ignored by pipelines that were not created with useBindlessTable.
+ *
+ * \param computePass a compute pass handle
+ * \param bindlessTable a bindless table
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateBindlessTable
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuBindComputeBindlessTable(
+    SDL_GpuComputePass *computePass,
+    SDL_GpuBindlessTable *bindlessTable
+);
+
 /**
  * Pushes data to a uniform slot on the bound compute pipeline.
  * Subsequent draw calls will use this uniform data.
@@ -1700,7 +2438,8 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuEndComputePass(
 
 /**
  * Maps a transfer buffer into application address space.
- * You must unmap the transfer buffer before encoding upload commands.
+ * You must unmap the transfer buffer before encoding upload commands,
+ * unless it was created with SDL_GPU_TRANSFER_MAP_PERSISTENT.
  *
  * \param device a GPU context
  * \param transferBuffer a transfer buffer
@@ -1729,6 +2468,54 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuUnmapTransferBuffer(
     SDL_GpuTransferBuffer *transferBuffer
 );
 
+/**
+ * Makes host writes to a range of a persistently mapped transfer buffer
+ * visible to the GPU. Call this after writing through the pointer from
+ * SDL_GpuMapTransferBuffer and before recording uploads from the range.
+ *
+ * Transfer buffers created with SDL_GPU_TRANSFER_MAP_PERSISTENT do not need
+ * to be unmapped before recording copies. The mapped pointer stays valid
+ * until the transfer buffer is cycled or released.
+ *
+ * \param device a GPU context
+ * \param transferBuffer a transfer buffer
+ * \param offsetInBytes the start of the written range
+ * \param sizeInBytes the length of the written range
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuMapTransferBuffer
+ * \sa SDL_GpuInvalidateTransferBuffer
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuFlushTransferBuffer(
+    SDL_GpuDevice *device,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+);
+
+/**
+ * Makes GPU writes to a range of a persistently mapped transfer buffer
+ * visible to the host. Call this after the download has completed and
+ * before reading through the mapped pointer.
+ *
+ * \param device a GPU context
+ * \param transferBuffer a transfer buffer
+ * \param offsetInBytes the start of the range to read
+ * \param sizeInBytes the length of the range to read
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuMapTransferBuffer
+ * \sa SDL_GpuFlushTransferBuffer
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuInvalidateTransferBuffer(
+    SDL_GpuDevice *device,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+);
+
 /**
  * Immediately copies data from a pointer to a transfer buffer.
  *
@@ -1906,6 +2693,9 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuDownloadFromTexture(
  * Copies data from a buffer to a transfer buffer on the GPU timeline.
  * This data is not guaranteed to be copied until the command buffer fence is signaled.
  *
+ * The transfer buffer does not need SDL_GPU_TRANSFER_MAP_READ, but without it
+ * the first download allocates the readback storage on D3D11.
+ *
  * \param copyPass a copy pass handle
  * \param buffer the buffer to download
  * \param transferBuffer the transfer buffer to download into
@@ -1952,6 +2742,50 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuBlit(
     SDL_bool cycle
 );
 
+/**
+ * Performs many blits at once, sharing barriers and pipeline state between them.
+ * This is equivalent to calling SDL_GpuBlit for each region, except that the blits
+ * are unordered: no blit may read a texture slice that another blit in the batch writes.
+ * This function must not be called inside of any render, compute, or copy pass.
+ *
+ * \param commandBuffer a command buffer
+ * \param blits an array of source and destination region pairs
+ * \param blitCount the number of blits in the array
+ * \param filterMode the filter mode that will be used when blitting
+ * \param cycle if SDL_TRUE, cycles each destination texture the first time the batch writes it, if it is bound
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuBlit
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuBlitBatch(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBlitRegion *blits,
+    Uint32 blitCount,
+    SDL_GpuFilter filterMode,
+    SDL_bool cycle
+);
+
+/**
+ * Ends the lifetime of a transient texture's contents in the given command buffer.
+ * Transient textures first used after this point may reuse its memory,
+ * and its own contents are undefined the next time it is used.
+ * This function must not be called inside of any render, compute, or copy pass.
+ *
+ * On D3D11 this discards the texture, on Vulkan it does nothing.
+ *
+ * \param commandBuffer a command buffer
+ * \param texture a texture created with SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateTexture
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuDiscardTransientTexture(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTexture *texture
+);
+
 /* Submission/Presentation */
 
 /**
@@ -2062,6 +2896,14 @@ extern SDL_DECLSPEC SDL_GpuTextureFormat SDLCALL SDL_GpuGetSwapchainTextureForma
  * Acquire a command buffer.
  * This command buffer is managed by the implementation and should not be freed by the user.
  * A command buffer may only be used on the thread it was acquired on.
+ * Command buffers acquired on different threads may be recorded in parallel.
+ *
+ * On D3D11 recording never takes the device's immediate context, but these
+ * calls still do and are serialized across threads: submission, fence and
+ * query readback, swapchain teardown, and mapping, invalidating, setting or
+ * getting the data of a readable transfer buffer. A transfer buffer is
+ * readable if it was created with SDL_GPU_TRANSFER_MAP_READ or has been
+ * downloaded into.
  *
  * \param device a GPU context
  * \returns a command buffer
@@ -2075,6 +2917,31 @@ extern SDL_DECLSPEC SDL_GpuCommandBuffer *SDLCALL SDL_GpuAcquireCommandBuffer(
 	SDL_GpuDevice *device
 );
 
+/**
+ * Acquire a command buffer that will be submitted to a specific queue.
+ * On devices with dedicated transfer or compute queues, this work can run
+ * alongside the graphics queue instead of serializing behind it.
+ *
+ * Work submitted on the transfer queue is visible to the next compute and graphics
+ * submissions, and work on the compute queue is visible to the next graphics submission.
+ * The reverse is not synchronized: do not write from a transfer or compute
+ * command buffer to a resource that in-flight graphics work is using,
+ * unless the write cycles the resource.
+ *
+ * \param device a GPU context
+ * \param queue the queue the command buffer will be submitted to
+ * \returns a command buffer
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuAcquireCommandBuffer
+ * \sa SDL_GpuSubmit
+ */
+extern SDL_DECLSPEC SDL_GpuCommandBuffer *SDLCALL SDL_GpuAcquireCommandBufferForQueue(
+	SDL_GpuDevice *device,
+	SDL_GpuCommandQueue queue
+);
+
 /**
  * Acquire a texture to use in presentation.
  * When a swapchain texture is acquired on a command buffer,
@@ -2202,105 +3069,666 @@ extern SDL_DECLSPEC void SDLCALL SDL_GpuReleaseFence(
 	SDL_GpuFence *fence
 );
 
-/* Format Info */
+/* Texture Streaming */
 
 /**
- * Obtains the texel block size for a texture format.
+ * Creates a texture streamer, which batches texture uploads from any thread
+ * into one copy pass per frame through a persistently mapped staging ring.
  *
- * \param textureFormat the texture format you want to know the texel size of
- * \returns the texel block size of the texture format
+ * \param device a GPU context
+ * \param stagingSizeInBytes the size of the staging ring, which bounds both the largest single upload and the amount of upload data in flight
+ * \param bytesPerFrame the most upload data SDL_GpuSubmitTextureStreamer will write in one call, or 0 for no limit
+ * \returns a texture streamer on success, or NULL on failure
  *
  * \since This function is available since SDL 3.x.x
  *
- * \sa SDL_GpuSetTransferData
- * \sa SDL_GpuUploadToTexture
+ * \sa SDL_GpuQueueTextureUpload
+ * \sa SDL_GpuSubmitTextureStreamer
+ * \sa SDL_GpuDestroyTextureStreamer
  */
-extern SDL_DECLSPEC Uint32 SDLCALL SDL_GpuTextureFormatTexelBlockSize(
-    SDL_GpuTextureFormat textureFormat
+extern SDL_DECLSPEC SDL_GpuTextureStreamer *SDLCALL SDL_GpuCreateTextureStreamer(
+	SDL_GpuDevice *device,
+	Uint32 stagingSizeInBytes,
+	Uint32 bytesPerFrame
 );
 
 /**
- * Determines whether a texture format is supported for a given type and usage.
+ * Waits for every in-flight upload and frees the streamer.
+ * Uploads that were queued but never submitted are discarded.
  *
- * \param device a GPU context
- * \param format the texture format to check
- * \param type the type of texture (2D, 3D, Cube)
- * \param usage a bitmask of all usage scenarios to check
- * \returns whether the texture format is supported for this type and usage
+ * \param streamer a texture streamer
  *
  * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateTextureStreamer
  */
-extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuIsTextureFormatSupported(
-    SDL_GpuDevice *device,
-    SDL_GpuTextureFormat format,
-    SDL_GpuTextureType type,
-    SDL_GpuTextureUsageFlags usage
+extern SDL_DECLSPEC void SDLCALL SDL_GpuDestroyTextureStreamer(
+	SDL_GpuTextureStreamer *streamer
 );
 
 /**
- * Determines the "best" sample count for a texture format, i.e.
- * the highest supported sample count that is <= the desired sample count.
+ * Queues tightly packed texel data to be uploaded to a texture region.
+ * The data is copied, so it does not need to outlive this call.
+ * This function may be called from any thread.
  *
- * \param device a GPU context
- * \param format the texture format to check
- * \param desiredSampleCount the sample count you want
- * \returns a hardware-specific version of min(preferred, possible)
+ * Pending uploads are submitted smallest mip level first,
+ * then in the order they were queued.
+ *
+ * Uploads are written in place on the transfer queue, which does not wait
+ * for graphics or compute work. Do not upload to a region that command
+ * buffers which have not finished yet may still read. Upload to a different
+ * texture, or wait for the fence of the last command buffer that read it.
+ *
+ * \param streamer a texture streamer
+ * \param textureRegion the texture region to upload to
+ * \param data the texel data
+ * \param sizeInBytes the length of the data
+ * \returns a nonzero ticket identifying the upload, or 0 on failure
  *
  * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuSubmitTextureStreamer
+ * \sa SDL_GpuQueryTextureUpload
  */
-extern SDL_DECLSPEC SDL_GpuSampleCount SDLCALL SDL_GpuGetBestSampleCount(
-    SDL_GpuDevice *device,
-    SDL_GpuTextureFormat format,
-    SDL_GpuSampleCount desiredSampleCount
+extern SDL_DECLSPEC Uint64 SDLCALL SDL_GpuQueueTextureUpload(
+	SDL_GpuTextureStreamer *streamer,
+	SDL_GpuTextureRegion *textureRegion,
+	const void *data,
+	Uint32 sizeInBytes
 );
 
-/* Queries */
-
 /**
- * Begins an occlusion query.
+ * Records pending uploads into a single copy pass on the transfer queue and submits it.
+ * Uploads that do not fit in this frame's budget or in the staging ring
+ * stay queued for the next call. Call this once per frame.
  *
- * This function is included for compatibility with old render systems.
- * If you are not supporting an old application, do NOT use this.
+ * Textures uploaded here may be used by command buffers submitted afterwards.
  *
- * \param commandBuffer a command buffer
- * \param query an occlusion query object
+ * \param streamer a texture streamer
+ * \returns the number of uploads that were submitted
  *
  * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuQueueTextureUpload
  */
-extern SDL_DECLSPEC void SDLCALL SDL_GpuOcclusionQueryBegin(
-    SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuOcclusionQuery *query
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GpuSubmitTextureStreamer(
+	SDL_GpuTextureStreamer *streamer
 );
 
 /**
- * Ends an occlusion query.
- * You must have called SDL_GpuOcclusionQueryBegin on the query beforehand.
- *
- * This function is included for compatibility with old render systems.
- * If you are not supporting an old application, do NOT use this.
+ * Checks whether a queued upload has finished on the GPU.
  *
- * \param commandBuffer a commandBuffer
- * \param query an occlusion query object
+ * \param streamer a texture streamer
+ * \param ticket a ticket returned by SDL_GpuQueueTextureUpload
+ * \returns SDL_TRUE if the upload has completed, SDL_FALSE if it is pending or in flight
  *
  * \since This function is available since SDL 3.x.x
  *
- * \sa SDL_GpuBeginQuery
+ * \sa SDL_GpuWaitForTextureUpload
  */
-extern SDL_DECLSPEC void SDLCALL SDL_GpuOcclusionQueryEnd(
-    SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuOcclusionQuery *query
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuQueryTextureUpload(
+	SDL_GpuTextureStreamer *streamer,
+	Uint64 ticket
 );
 
 /**
- * Checks if an occlusion query is complete and fills in the pixel count of the query.
- *
- * This function is included for compatibility with old render systems.
- * If you are not supporting an old application, do NOT use this.
+ * Blocks the thread until a submitted upload has finished on the GPU.
  *
- * \param device a GPU context
- * \param query an occlusion query object
- * \param pixelCount a pointer to be filled with the pixel count
- * \returns SDL_TRUE if the occlusion query is complete, SDL_FALSE otherwise
+ * \param streamer a texture streamer
+ * \param ticket a ticket returned by SDL_GpuQueueTextureUpload
+ * \returns SDL_FALSE if the upload has not been submitted yet, SDL_TRUE otherwise
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuQueryTextureUpload
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuWaitForTextureUpload(
+	SDL_GpuTextureStreamer *streamer,
+	Uint64 ticket
+);
+
+/* Render Graph */
+
+/**
+ * Creates a render graph, which records a frame's passes from declarations of
+ * the resources each pass reads and writes. On execution it culls passes whose
+ * results are never used, merges copy work, shares memory between
+ * graph-owned resources whose lifetimes do not overlap, and moves eligible
+ * work to the transfer and compute queues.
+ *
+ * A render graph is not thread safe.
+ *
+ * \param device a GPU context
+ * \returns a render graph on success, or NULL on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuExecuteRenderGraph
+ * \sa SDL_GpuDestroyRenderGraph
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraph *SDLCALL SDL_GpuCreateRenderGraph(
+	SDL_GpuDevice *device
+);
+
+/**
+ * Frees the render graph and releases the textures and buffers it owns.
+ * Passes that were added but never executed are discarded.
+ *
+ * \param graph a render graph
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateRenderGraph
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuDestroyRenderGraph(
+	SDL_GpuRenderGraph *graph
+);
+
+/**
+ * Makes a texture owned by the application available to this frame's passes.
+ * Imported resources are visible outside of the graph,
+ * so passes that write to them are never culled.
+ *
+ * \param graph a render graph
+ * \param texture the texture to import
+ * \returns a resource handle on success, or 0 on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateRenderGraphTexture
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraphResource SDLCALL SDL_GpuImportRenderGraphTexture(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuTexture *texture
+);
+
+/**
+ * Makes a buffer owned by the application available to this frame's passes.
+ * Imported resources are visible outside of the graph,
+ * so passes that write to them are never culled.
+ *
+ * \param graph a render graph
+ * \param buffer the buffer to import
+ * \returns a resource handle on success, or 0 on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateRenderGraphBuffer
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraphResource SDLCALL SDL_GpuImportRenderGraphBuffer(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuBuffer *buffer
+);
+
+/**
+ * Declares a texture that only lives for this frame of the graph.
+ * The texture is created with SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT added,
+ * its contents are undefined before the first pass that writes it,
+ * and it may share memory with any graph texture whose passes all run before its first one.
+ * Passes that use it always run on the graphics queue.
+ *
+ * \param graph a render graph
+ * \param textureCreateInfo a struct describing the texture
+ * \returns a resource handle on success, or 0 on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuGetRenderGraphTexture
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraphResource SDLCALL SDL_GpuCreateRenderGraphTexture(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuTextureCreateInfo *textureCreateInfo
+);
+
+/**
+ * Declares a buffer that only lives for this frame of the graph.
+ * Its contents are undefined before the first pass that writes it,
+ * and it may be the same buffer as any graph buffer with the same usage and size
+ * whose passes all run before its first one.
+ * Passes that use it always run on the graphics queue.
+ *
+ * \param graph a render graph
+ * \param usageFlags bitflag mask hinting at how the buffer will be used
+ * \param sizeInBytes the size of the buffer
+ * \returns a resource handle on success, or 0 on failure
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuGetRenderGraphBuffer
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraphResource SDLCALL SDL_GpuCreateRenderGraphBuffer(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuBufferUsageFlags usageFlags,
+	Uint32 sizeInBytes
+);
+
+/**
+ * Adds a render pass to the graph. Its attachments are declared with
+ * SDL_GpuAddRenderGraphColorAttachment and SDL_GpuSetRenderGraphDepthStencilAttachment,
+ * and anything else it samples, reads or writes must be declared as well.
+ * Passes must be added in the order their work would be submitted in.
+ *
+ * \param graph a render graph
+ * \param callback records the pass when the graph executes
+ * \param userdata passed to the callback
+ * \param flags options for the pass
+ * \returns a pass handle
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuReadRenderGraphResource
+ * \sa SDL_GpuWriteRenderGraphResource
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraphPass SDLCALL SDL_GpuAddRenderGraphRenderPass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphRenderFunc callback,
+	void *userdata,
+	SDL_GpuRenderGraphPassFlags flags
+);
+
+/**
+ * Adds a compute pass to the graph. Its read-write storage bindings are
+ * declared with SDL_GpuAddRenderGraphStorageTextureWrite and
+ * SDL_GpuAddRenderGraphStorageBufferWrite, and anything else it reads must be declared as well.
+ * Passes must be added in the order their work would be submitted in.
+ *
+ * \param graph a render graph
+ * \param callback records the pass when the graph executes
+ * \param userdata passed to the callback
+ * \param flags options for the pass
+ * \returns a pass handle
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuReadRenderGraphResource
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraphPass SDLCALL SDL_GpuAddRenderGraphComputePass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphComputeFunc callback,
+	void *userdata,
+	SDL_GpuRenderGraphPassFlags flags
+);
+
+/**
+ * Adds a copy pass to the graph. Every resource it copies from or to must be declared.
+ * Copy passes that are ready at the same point are recorded into one copy pass,
+ * so the callback must not assume it begins or ends the copy pass.
+ * Passes must be added in the order their work would be submitted in.
+ *
+ * \param graph a render graph
+ * \param callback records the pass when the graph executes
+ * \param userdata passed to the callback
+ * \param flags options for the pass
+ * \returns a pass handle
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuReadRenderGraphResource
+ * \sa SDL_GpuWriteRenderGraphResource
+ */
+extern SDL_DECLSPEC SDL_GpuRenderGraphPass SDLCALL SDL_GpuAddRenderGraphCopyPass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphCopyFunc callback,
+	void *userdata,
+	SDL_GpuRenderGraphPassFlags flags
+);
+
+/**
+ * Adds a color attachment to a render pass of the graph, in slot order.
+ * The texture in the attachment's slice is filled in by the graph.
+ * The cycle option only applies to the first write of the texture in the frame,
+ * and never to textures created by the graph.
+ *
+ * \param graph a render graph
+ * \param pass a render pass of the graph
+ * \param texture the texture resource to render to
+ * \param colorAttachmentInfo the attachment, with any texture in its slice ignored
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuBeginRenderPass
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuAddRenderGraphColorAttachment(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource texture,
+	SDL_GpuColorAttachmentInfo *colorAttachmentInfo
+);
+
+/**
+ * Sets the depth stencil attachment of a render pass of the graph.
+ * The texture in the attachment's slice is filled in by the graph.
+ * The cycle option only applies to the first write of the texture in the frame,
+ * and never to textures created by the graph.
+ *
+ * \param graph a render graph
+ * \param pass a render pass of the graph
+ * \param texture the texture resource to use for depth and stencil
+ * \param depthStencilAttachmentInfo the attachment, with any texture in its slice ignored
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuBeginRenderPass
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuSetRenderGraphDepthStencilAttachment(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource texture,
+	SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+);
+
+/**
+ * Adds a read-write storage texture binding to a compute pass of the graph.
+ * Bindings are passed to SDL_GpuBeginComputePass in the order they were added.
+ *
+ * \param graph a render graph
+ * \param pass a compute pass of the graph
+ * \param texture the texture resource to write
+ * \param mipLevel the mip level to bind
+ * \param layer the layer to bind
+ * \param cycle if SDL_TRUE, cycles the texture if this is its first write in the frame and it is not a graph texture
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuBeginComputePass
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuAddRenderGraphStorageTextureWrite(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource texture,
+	Uint32 mipLevel,
+	Uint32 layer,
+	SDL_bool cycle
+);
+
+/**
+ * Adds a read-write storage buffer binding to a compute pass of the graph.
+ * Bindings are passed to SDL_GpuBeginComputePass in the order they were added.
+ *
+ * \param graph a render graph
+ * \param pass a compute pass of the graph
+ * \param buffer the buffer resource to write
+ * \param cycle if SDL_TRUE, cycles the buffer if this is its first write in the frame and it is not a graph buffer
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuBeginComputePass
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuAddRenderGraphStorageBufferWrite(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource buffer,
+	SDL_bool cycle
+);
+
+/**
+ * Declares that a pass of the graph reads a resource,
+ * for example by sampling it or copying from it.
+ *
+ * \param graph a render graph
+ * \param pass a pass of the graph
+ * \param resource the resource the pass reads
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuWriteRenderGraphResource
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuReadRenderGraphResource(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource resource
+);
+
+/**
+ * Declares that a pass of the graph writes a resource outside of its attachments
+ * and storage bindings, for example by copying to it.
+ *
+ * \param graph a render graph
+ * \param pass a pass of the graph
+ * \param resource the resource the pass writes
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuReadRenderGraphResource
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuWriteRenderGraphResource(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource resource
+);
+
+/**
+ * Gets the texture behind a resource of the graph.
+ * Textures created by the graph are only available inside of pass callbacks.
+ *
+ * \param graph a render graph
+ * \param texture a texture resource
+ * \returns the texture, or NULL if it is not available
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC SDL_GpuTexture *SDLCALL SDL_GpuGetRenderGraphTexture(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphResource texture
+);
+
+/**
+ * Gets the buffer behind a resource of the graph.
+ * Buffers created by the graph are only available inside of pass callbacks.
+ *
+ * \param graph a render graph
+ * \param buffer a buffer resource
+ * \returns the buffer, or NULL if it is not available
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC SDL_GpuBuffer *SDLCALL SDL_GpuGetRenderGraphBuffer(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphResource buffer
+);
+
+/**
+ * Records every pass that contributes to an imported resource, then resets the
+ * graph for the next frame, invalidating all of its handles.
+ *
+ * Compute and copy passes with SDL_GPU_RENDERGRAPHPASS_ALLOW_ASYNC_BIT that only
+ * use imported resources are recorded on the compute or transfer queue when
+ * all of the passes they depend on are too, and those command buffers are
+ * submitted before this function returns. Such passes must not generate mipmaps,
+ * and must follow the rules of SDL_GpuAcquireCommandBufferForQueue for resources
+ * that in-flight graphics work may be using.
+ * Everything else is recorded into the given command buffer,
+ * which the application then submits as usual.
+ *
+ * \param graph a render graph
+ * \param commandBuffer a graphics command buffer, with no pass in progress
+ * \returns the number of passes that were recorded
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuAcquireCommandBufferForQueue
+ */
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GpuExecuteRenderGraph(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuCommandBuffer *commandBuffer
+);
+
+/* Memory Management */
+
+/**
+ * Performs one incremental defragmentation pass over GPU memory.
+ * Backends that present already run a budgeted pass once per frame,
+ * this is for applications that never present, like headless or compute-only tools.
+ * Resources still in use by submitted command buffers are skipped until they retire,
+ * so it may take several passes for all fragmented memory to be compacted.
+ *
+ * \param device a GPU context
+ * \param maxBytes the maximum number of bytes to move in this pass, or 0 for the default budget
+ * \param maxMilliseconds the maximum CPU time to spend in this pass, or 0 for the default budget
+ * \returns SDL_TRUE if fragmented memory remains to be processed, SDL_FALSE otherwise
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuSubmit
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuDefragment(
+	SDL_GpuDevice *device,
+	Uint32 maxBytes,
+	Uint32 maxMilliseconds
+);
+
+/**
+ * Reports GPU memory usage and budget for each memory heap.
+ * The budget is the best estimate of how much memory this process can use
+ * before the OS starts demoting or evicting resources, so streaming systems
+ * should compare usageBytes against it rather than waiting for allocation failures.
+ * Fragmentation of a heap can be estimated as
+ * 1 - largestFreeBlockBytes / (allocatedBytes - usedBytes).
+ *
+ * This walks the allocator state, so avoid calling it many times per frame.
+ *
+ * \param device a GPU context
+ * \param stats a pointer filled with the current memory statistics
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuDefragment
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuGetMemoryStats(
+	SDL_GpuDevice *device,
+	SDL_GpuMemoryStats *stats
+);
+
+/* Format Info */
+
+/**
+ * Obtains the texel block size for a texture format.
+ *
+ * \param textureFormat the texture format you want to know the texel size of
+ * \returns the texel block size of the texture format
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuSetTransferData
+ * \sa SDL_GpuUploadToTexture
+ */
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GpuTextureFormatTexelBlockSize(
+    SDL_GpuTextureFormat textureFormat
+);
+
+/**
+ * Determines whether a texture format is supported for a given type and usage.
+ *
+ * \param device a GPU context
+ * \param format the texture format to check
+ * \param type the type of texture (2D, 3D, Cube)
+ * \param usage a bitmask of all usage scenarios to check
+ * \returns whether the texture format is supported for this type and usage
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuIsTextureFormatSupported(
+    SDL_GpuDevice *device,
+    SDL_GpuTextureFormat format,
+    SDL_GpuTextureType type,
+    SDL_GpuTextureUsageFlags usage
+);
+
+/**
+ * Determines the "best" sample count for a texture format, i.e.
+ * the highest supported sample count that is <= the desired sample count.
+ *
+ * \param device a GPU context
+ * \param format the texture format to check
+ * \param desiredSampleCount the sample count you want
+ * \returns a hardware-specific version of min(preferred, possible)
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC SDL_GpuSampleCount SDLCALL SDL_GpuGetBestSampleCount(
+    SDL_GpuDevice *device,
+    SDL_GpuTextureFormat format,
+    SDL_GpuSampleCount desiredSampleCount
+);
+
+/**
+ * Determines the largest bindless table the device can create.
+ *
+ * \param device a GPU context
+ * \returns the maximum bindless table capacity, or 0 if bindless tables are not supported
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuCreateBindlessTable
+ */
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GpuGetMaxBindlessTableSize(
+    SDL_GpuDevice *device
+);
+
+/**
+ * Determines whether the device can draw with a GPU-side draw count.
+ * D3D11 emulates this, Vulkan needs VK_KHR_draw_indirect_count,
+ * and Metal does not support it.
+ *
+ * \param device a GPU context
+ * \returns SDL_TRUE if SDL_GpuDrawPrimitivesIndirectCount and SDL_GpuDrawIndexedPrimitivesIndirectCount can be used
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuDrawPrimitivesIndirectCount
+ * \sa SDL_GpuDrawIndexedPrimitivesIndirectCount
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuSupportsIndirectCount(
+    SDL_GpuDevice *device
+);
+
+/* Queries */
+
+/**
+ * Begins an occlusion query.
+ *
+ * This function is included for compatibility with old render systems.
+ * If you are not supporting an old application, do NOT use this.
+ *
+ * \param commandBuffer a command buffer
+ * \param query an occlusion query object
+ *
+ * \since This function is available since SDL 3.x.x
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuOcclusionQueryBegin(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuOcclusionQuery *query
+);
+
+/**
+ * Ends an occlusion query.
+ * You must have called SDL_GpuOcclusionQueryBegin on the query beforehand.
+ *
+ * This function is included for compatibility with old render systems.
+ * If you are not supporting an old application, do NOT use this.
+ *
+ * \param commandBuffer a commandBuffer
+ * \param query an occlusion query object
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuBeginQuery
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuOcclusionQueryEnd(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuOcclusionQuery *query
+);
+
+/**
+ * Checks if an occlusion query is complete and fills in the pixel count of the query.
+ *
+ * This function is included for compatibility with old render systems.
+ * If you are not supporting an old application, do NOT use this.
+ *
+ * \param device a GPU context
+ * \param query an occlusion query object
+ * \param pixelCount a pointer to be filled with the pixel count
+ * \returns SDL_TRUE if the occlusion query is complete, SDL_FALSE otherwise
  *
  * \since This function is available since SDL 3.x.x
  */
@@ -2310,6 +3738,133 @@ extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuOcclusionQueryPixelCount(
     Uint32 *pixelCount
 );
 
+/**
+ * Records the GPU time at which all prior work in the command buffer has finished.
+ * This must be called outside of any pass.
+ *
+ * \param commandBuffer a command buffer
+ * \param query a timestamp query object
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuTimestampQueryResult
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuWriteTimestamp(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTimestampQuery *query
+);
+
+/**
+ * Checks if a timestamp query is complete and fills in its value.
+ * Timestamps are only meaningful relative to other timestamps from the same device.
+ *
+ * \param device a GPU context
+ * \param query a timestamp query object
+ * \param nanoseconds a pointer to be filled with the timestamp in nanoseconds
+ * \returns SDL_TRUE if the timestamp query is complete, SDL_FALSE otherwise
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuWriteTimestamp
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GpuTimestampQueryResult(
+    SDL_GpuDevice *device,
+    SDL_GpuTimestampQuery *query,
+    Uint64 *nanoseconds
+);
+
+/**
+ * Brackets every subsequent render, compute and copy pass in the command buffer
+ * with GPU timestamps. The durations can be read with SDL_GpuGetPassTimings
+ * once the fence from SDL_GpuSubmitAndAcquireFence has signaled.
+ * This must be called outside of any pass.
+ *
+ * \param commandBuffer a command buffer
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuGetPassTimings
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuEnablePassTiming(
+    SDL_GpuCommandBuffer *commandBuffer
+);
+
+/**
+ * Obtains the pass durations recorded by a command buffer that had pass timing enabled.
+ * Passes are reported in the order they were recorded.
+ *
+ * \param device a GPU context
+ * \param fence the fence acquired when the command buffer was submitted
+ * \param timings an array to be filled with pass timings
+ * \param maxTimings the number of elements in timings
+ * \returns the number of timings written, or 0 if the fence has not signaled yet
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuEnablePassTiming
+ * \sa SDL_GpuSubmitAndAcquireFence
+ */
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GpuGetPassTimings(
+    SDL_GpuDevice *device,
+    SDL_GpuFence *fence,
+    SDL_GpuPassTiming *timings,
+    Uint32 maxTimings
+);
+
+/**
+ * Obtains the number of redundant binds that were dropped before reaching the backend.
+ * A bind is redundant when it matches what is already bound in the current pass.
+ * Counts are added to the total when a command buffer is submitted.
+ *
+ * \param device a GPU context
+ * \returns the number of filtered binds since the device was created
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuSubmit
+ */
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GpuGetFilteredBindCount(
+    SDL_GpuDevice *device
+);
+
+/**
+ * Collects GPU pipeline statistics (vertices, shader invocations, primitives)
+ * for everything recorded in the command buffer from now on.
+ * The totals are added to SDL_GpuGetFrameStats once the command buffer has finished executing.
+ * This is not supported on transfer queue command buffers, and is not available on Metal.
+ * This must be called outside of any pass.
+ *
+ * \param commandBuffer a command buffer
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuGetFrameStats
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuEnablePipelineStatistics(
+    SDL_GpuCommandBuffer *commandBuffer
+);
+
+/**
+ * Obtains the counters accumulated since the previous call and resets them.
+ * Call this once per frame to get per-frame numbers.
+ *
+ * Counts recorded into a command buffer are added when it is submitted.
+ * GPU pipeline statistics are added when the command buffer has finished executing,
+ * so they usually trail the other counters by a frame or two.
+ * The counters are always collected, including in release builds.
+ *
+ * \param device a GPU context
+ * \param stats a pointer to be filled with the counters
+ *
+ * \since This function is available since SDL 3.x.x
+ *
+ * \sa SDL_GpuEnablePipelineStatistics
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GpuGetFrameStats(
+    SDL_GpuDevice *device,
+    SDL_GpuFrameStats *stats
+);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -21,64 +21,148 @@
 
 #include "SDL_gpu_driver.h"
 #include "SDL_gpu_spirv_c.h"
+#include "SDL_gpu_async_c.h"
+
+/* Validation
+ *
+ * Define SDL_GPU_DISABLE_VALIDATION to compile every check below out.
+ * Otherwise checks only run for devices created with debugMode enabled,
+ * so release callers go straight through to the function table.
+ */
+
+#ifdef SDL_GPU_DISABLE_VALIDATION
+
+#define VALIDATION_ENABLED(device) SDL_FALSE
+
+#define NULL_ASSERT(name)
+
+#define CHECK_COMMAND_BUFFER
+#define CHECK_COMMAND_BUFFER_RETURN_NULL
+#define CHECK_ANY_PASS_IN_PROGRESS
+#define CHECK_RENDERPASS
+#define CHECK_PARALLELRENDERPASS
+#define CHECK_COMPUTEPASS
+#define CHECK_COPYPASS
+
+/* Async skipping is not validation, it has to survive */
+#define CHECK_GRAPHICS_PIPELINE_BOUND \
+    if (((CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER)->graphicsPipelineSkipped) { \
+        return; \
+    }
+
+#define CHECK_COMPUTE_PIPELINE_BOUND \
+    if (((CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER)->computePipelineSkipped) { \
+        return; \
+    }
+
+#else
+
+#define VALIDATION_ENABLED(device) ((device)->debugMode)
 
 #define NULL_ASSERT(name) SDL_assert(name != NULL);
 
 #define CHECK_COMMAND_BUFFER \
     if (commandBuffer == NULL) { return; } \
-    if (((CommandBufferCommonHeader*) commandBuffer)->submitted) \
-    { \
+    if ( \
+        VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && \
+        ((CommandBufferCommonHeader*) commandBuffer)->submitted \
+    ) { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Command buffer already submitted!"); \
         return; \
     }
 
 #define CHECK_COMMAND_BUFFER_RETURN_NULL \
     if (commandBuffer == NULL) { return NULL; } \
-    if (((CommandBufferCommonHeader*) commandBuffer)->submitted) \
-    { \
+    if ( \
+        VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && \
+        ((CommandBufferCommonHeader*) commandBuffer)->submitted \
+    ) { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Command buffer already submitted!"); \
         return NULL; \
     }
 
 #define CHECK_ANY_PASS_IN_PROGRESS \
-    if ( \
-        ((CommandBufferCommonHeader*) commandBuffer)->renderPass.inProgress || \
-        ((CommandBufferCommonHeader*) commandBuffer)->computePass.inProgress || \
-        ((CommandBufferCommonHeader*) commandBuffer)->copyPass.inProgress ) \
+    if (VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && ANY_PASS_IN_PROGRESS) \
     { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Pass already in progress!"); \
         return NULL; \
     }
 
 #define CHECK_RENDERPASS \
-    if (!((Pass*) renderPass)->inProgress) { \
+    if (VALIDATION_ENABLED(RENDERPASS_DEVICE) && !((Pass*) renderPass)->inProgress) { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Render pass not in progress!"); \
         return; \
     }
 
+#define CHECK_PARALLELRENDERPASS \
+    if (VALIDATION_ENABLED(PARALLELRENDERPASS_DEVICE) && !((Pass*) parallelRenderPass)->inProgress) { \
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Parallel render pass not in progress!"); \
+        return; \
+    }
+
 #define CHECK_GRAPHICS_PIPELINE_BOUND \
-    if (!((CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER)->graphicsPipelineBound) { \
+    if (((CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER)->graphicsPipelineSkipped) { \
+        return; \
+    } \
+    if ( \
+        VALIDATION_ENABLED(RENDERPASS_DEVICE) && \
+        !((CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER)->graphicsPipelineBound \
+    ) { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Graphics pipeline not bound!"); \
         return; \
     }
 
 #define CHECK_COMPUTEPASS \
-    if (!((Pass*) computePass)->inProgress) { \
+    if (VALIDATION_ENABLED(COMPUTEPASS_DEVICE) && !((Pass*) computePass)->inProgress) { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Compute pass not in progress!"); \
         return; \
     }
 
 #define CHECK_COMPUTE_PIPELINE_BOUND \
-    if (!((CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER)->computePipelineBound) { \
+    if (((CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER)->computePipelineSkipped) { \
+        return; \
+    } \
+    if ( \
+        VALIDATION_ENABLED(COMPUTEPASS_DEVICE) && \
+        !((CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER)->computePipelineBound \
+    ) { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Compute pipeline not bound!"); \
         return; \
     }
 
 #define CHECK_COPYPASS \
-    if (!((Pass*) copyPass)->inProgress) { \
+    if (VALIDATION_ENABLED(COPYPASS_DEVICE) && !((Pass*) copyPass)->inProgress) { \
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Copy pass not in progress!"); \
         return; \
-    } \
+    }
+
+#endif /* SDL_GPU_DISABLE_VALIDATION */
+
+/* Queues are ordered by capability, graphics can record anything compute can */
+#define CHECK_QUEUE(requiredQueue) \
+    if ( \
+        VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && \
+        ((CommandBufferCommonHeader*) commandBuffer)->queue > requiredQueue \
+    ) { \
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Command not supported on this command buffer's queue!"); \
+        return; \
+    }
+
+#define CHECK_QUEUE_RETURN_NULL(requiredQueue) \
+    if ( \
+        VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && \
+        ((CommandBufferCommonHeader*) commandBuffer)->queue > requiredQueue \
+    ) { \
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Command not supported on this command buffer's queue!"); \
+        return NULL; \
+    }
+
+#define ANY_PASS_IN_PROGRESS \
+    ( \
+        ((CommandBufferCommonHeader*) commandBuffer)->renderPass.inProgress || \
+        ((CommandBufferCommonHeader*) commandBuffer)->computePass.inProgress || \
+        ((CommandBufferCommonHeader*) commandBuffer)->copyPass.inProgress \
+    )
 
 #define COMMAND_BUFFER_DEVICE \
     ((CommandBufferCommonHeader*) commandBuffer)->device
@@ -89,6 +173,12 @@
 #define RENDERPASS_DEVICE \
     ((CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER)->device
 
+#define PARALLELRENDERPASS_COMMAND_BUFFER \
+    ((Pass*) parallelRenderPass)->commandBuffer
+
+#define PARALLELRENDERPASS_DEVICE \
+    ((CommandBufferCommonHeader*) PARALLELRENDERPASS_COMMAND_BUFFER)->device
+
 #define COMPUTEPASS_COMMAND_BUFFER \
     ((Pass*) computePass)->commandBuffer
 
@@ -101,6 +191,60 @@
 #define COPYPASS_DEVICE \
     ((CommandBufferCommonHeader*) COPYPASS_COMMAND_BUFFER)->device
 
+#define RENDERPASS_STATS \
+    ((CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER)->stats
+
+#define COMPUTEPASS_STATS \
+    ((CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER)->stats
+
+#define COPYPASS_STATS \
+    ((CommandBufferCommonHeader*) COPYPASS_COMMAND_BUFFER)->stats
+
+/* Shadow State */
+
+/* Returns SDL_FALSE if the range already matches the shadow copy, otherwise stores it */
+static SDL_bool ShadowState_UpdateRange(
+    void *shadowArray,
+    const void *bindings,
+    size_t bindingSize,
+    Uint32 firstSlot,
+    Uint32 bindingCount,
+    Uint32 maxBindings
+) {
+    Uint8 *shadow = (Uint8*) shadowArray + (firstSlot * bindingSize);
+
+    /* Let the backend complain about out-of-range slots */
+    if (bindings == NULL || firstSlot + bindingCount > maxBindings)
+    {
+        return SDL_TRUE;
+    }
+
+    if (SDL_memcmp(shadow, bindings, bindingCount * bindingSize) == 0)
+    {
+        return SDL_FALSE;
+    }
+
+    SDL_memcpy(shadow, bindings, bindingCount * bindingSize);
+    return SDL_TRUE;
+}
+
+/* Frame Stats */
+
+/* Moves the command buffer counters into the device totals, call before filteredBindCount is reset */
+static void FrameStats_Flush(
+    CommandBufferCommonHeader *commandBufferHeader
+) {
+    SDL_GpuDevice *device = commandBufferHeader->device;
+
+    commandBufferHeader->stats.filteredBinds += commandBufferHeader->filteredBindCount;
+
+    SDL_LockMutex(device->frameStatsLock);
+    AccumulateFrameStats(&device->frameStats, &commandBufferHeader->stats);
+    SDL_UnlockMutex(device->frameStatsLock);
+
+    SDL_zero(commandBufferHeader->stats);
+}
+
 /* Drivers */
 
 static const SDL_GpuDriver *backends[] = {
@@ -167,6 +311,20 @@ static SDL_GpuBackend SDL_GpuSelectBackend(SDL_GpuBackend preferredBackends)
 SDL_GpuDevice* SDL_GpuCreateDevice(
 	SDL_GpuBackend preferredBackends,
 	SDL_bool debugMode
+) {
+	return SDL_GpuCreateDeviceWithPipelineCache(
+		preferredBackends,
+		debugMode,
+		NULL,
+		0
+	);
+}
+
+SDL_GpuDevice* SDL_GpuCreateDeviceWithPipelineCache(
+	SDL_GpuBackend preferredBackends,
+	SDL_bool debugMode,
+	const void *pipelineCacheData,
+	size_t pipelineCacheSize
 ) {
 	int i;
 	SDL_GpuDevice *result = NULL;
@@ -179,9 +337,19 @@ SDL_GpuDevice* SDL_GpuCreateDevice(
 		{
 			if (backends[i]->backendflag == selectedBackend)
 			{
-				result = backends[i]->CreateDevice(debugMode);
+				result = backends[i]->CreateDevice(
+					debugMode,
+					pipelineCacheData,
+					pipelineCacheSize
+				);
 				if (result != NULL) {
 					result->backend = backends[i]->backendflag;
+					result->debugMode = debugMode;
+					result->compileQueue = NULL;
+					SDL_AtomicSet(&result->filteredBindCount, 0);
+					result->frameStatsLock = SDL_CreateMutex();
+					SDL_zero(result->frameStats);
+					result->spirvCache = SDL_CreateSPIRVCache();
 					break;
 				}
 			}
@@ -193,6 +361,9 @@ SDL_GpuDevice* SDL_GpuCreateDevice(
 void SDL_GpuDestroyDevice(SDL_GpuDevice *device)
 {
 	NULL_ASSERT(device);
+	SDL_GpuDestroyCompileQueue(device);
+	SDL_DestroySPIRVCache(device->spirvCache);
+	SDL_DestroyMutex(device->frameStatsLock);
 	device->DestroyDevice(device);
 }
 
@@ -204,6 +375,20 @@ SDL_GpuBackend SDL_GpuGetBackend(SDL_GpuDevice *device)
     return device->backend;
 }
 
+SDL_bool SDL_GpuGetPipelineCacheData(
+	SDL_GpuDevice *device,
+	void *data,
+	size_t *dataSize
+) {
+	NULL_ASSERT(device)
+	NULL_ASSERT(dataSize)
+	return device->GetPipelineCacheData(
+		device->driverData,
+		data,
+		dataSize
+	);
+}
+
 Uint32 SDL_GpuTextureFormatTexelBlockSize(
     SDL_GpuTextureFormat textureFormat
 ) {
@@ -284,6 +469,24 @@ SDL_GpuSampleCount SDL_GpuGetBestSampleCount(
     );
 }
 
+Uint32 SDL_GpuGetMaxBindlessTableSize(
+    SDL_GpuDevice *device
+) {
+    if (device == NULL) { return 0; }
+    return device->GetMaxBindlessTableSize(
+        device->driverData
+    );
+}
+
+SDL_bool SDL_GpuSupportsIndirectCount(
+    SDL_GpuDevice *device
+) {
+    if (device == NULL) { return SDL_FALSE; }
+    return device->SupportsIndirectCount(
+        device->driverData
+    );
+}
+
 /* State Creation */
 
 SDL_GpuComputePipeline* SDL_GpuCreateComputePipeline(
@@ -473,6 +676,50 @@ SDL_GpuOcclusionQuery* SDL_GpuCreateOcclusionQuery(
     );
 }
 
+SDL_GpuTimestampQuery* SDL_GpuCreateTimestampQuery(
+    SDL_GpuDevice *device
+) {
+    NULL_ASSERT(device)
+    return device->CreateTimestampQuery(
+        device->driverData
+    );
+}
+
+SDL_GpuBindlessTable* SDL_GpuCreateBindlessTable(
+    SDL_GpuDevice *device,
+    Uint32 capacity
+) {
+    NULL_ASSERT(device)
+    return device->CreateBindlessTable(
+        device->driverData,
+        capacity
+    );
+}
+
+void SDL_GpuUpdateBindlessTable(
+    SDL_GpuDevice *device,
+    SDL_GpuBindlessTable *bindlessTable,
+    Uint32 firstIndex,
+    SDL_GpuTextureSamplerBinding *textureSamplerBindings,
+    Uint32 bindingCount
+) {
+    NULL_ASSERT(device)
+    NULL_ASSERT(bindlessTable)
+
+    if (bindingCount == 0)
+    {
+        return;
+    }
+
+    device->UpdateBindlessTable(
+        device->driverData,
+        bindlessTable,
+        firstIndex,
+        textureSamplerBindings,
+        bindingCount
+    );
+}
+
 /* Debug Naming */
 
 void SDL_GpuSetBufferName(
@@ -606,6 +853,28 @@ void SDL_GpuReleaseOcclusionQuery(
     );
 }
 
+void SDL_GpuReleaseTimestampQuery(
+    SDL_GpuDevice *device,
+    SDL_GpuTimestampQuery *query
+) {
+    NULL_ASSERT(device);
+    device->ReleaseTimestampQuery(
+        device->driverData,
+        query
+    );
+}
+
+void SDL_GpuReleaseBindlessTable(
+    SDL_GpuDevice *device,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    NULL_ASSERT(device);
+    device->ReleaseBindlessTable(
+        device->driverData,
+        bindlessTable
+    );
+}
+
 /* Render Pass */
 
 SDL_GpuRenderPass* SDL_GpuBeginRenderPass(
@@ -618,6 +887,7 @@ SDL_GpuRenderPass* SDL_GpuBeginRenderPass(
 
     CHECK_COMMAND_BUFFER_RETURN_NULL
     CHECK_ANY_PASS_IN_PROGRESS
+    CHECK_QUEUE_RETURN_NULL(SDL_GPU_COMMANDQUEUE_GRAPHICS)
 	COMMAND_BUFFER_DEVICE->BeginRenderPass(
 		commandBuffer,
 		colorAttachmentInfos,
@@ -627,6 +897,7 @@ SDL_GpuRenderPass* SDL_GpuBeginRenderPass(
 
     commandBufferHeader = (CommandBufferCommonHeader*) commandBuffer;
     commandBufferHeader->renderPass.inProgress = SDL_TRUE;
+    SDL_zero(commandBufferHeader->shadowState);
     return (SDL_GpuRenderPass*) &(commandBufferHeader->renderPass);
 }
 
@@ -637,37 +908,111 @@ void SDL_GpuBindGraphicsPipeline(
     CommandBufferCommonHeader *commandBufferHeader;
 
     NULL_ASSERT(renderPass)
+
+    commandBufferHeader = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (
+        commandBufferHeader->graphicsPipelineBound &&
+        commandBufferHeader->shadowState.graphicsPipeline == graphicsPipeline
+    ) {
+        commandBufferHeader->filteredBindCount += 1;
+        return;
+    }
+
 	RENDERPASS_DEVICE->BindGraphicsPipeline(
 		RENDERPASS_COMMAND_BUFFER,
 		graphicsPipeline
 	);
 
-    commandBufferHeader = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    commandBufferHeader->stats.graphicsPipelineBinds += 1;
+    commandBufferHeader->shadowState.graphicsPipeline = graphicsPipeline;
     commandBufferHeader->graphicsPipelineBound = SDL_TRUE;
+    commandBufferHeader->graphicsPipelineSkipped = SDL_FALSE;
+}
+
+SDL_bool SDL_GpuBindGraphicsPipelineAsync(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuCompileJob *job,
+    SDL_GpuGraphicsPipeline *fallbackPipeline
+) {
+    CommandBufferCommonHeader *commandBufferHeader;
+    SDL_GpuGraphicsPipeline *graphicsPipeline;
+
+    NULL_ASSERT(renderPass)
+    NULL_ASSERT(job)
+
+    graphicsPipeline = SDL_GpuGetCompiledGraphicsPipeline(RENDERPASS_DEVICE, job);
+    if (graphicsPipeline != NULL)
+    {
+        SDL_GpuBindGraphicsPipeline(renderPass, graphicsPipeline);
+        return SDL_TRUE;
+    }
+
+    if (fallbackPipeline != NULL)
+    {
+        SDL_GpuBindGraphicsPipeline(renderPass, fallbackPipeline);
+        return SDL_FALSE;
+    }
+
+    /* Nothing to draw with yet, skip everything until the next bind */
+    commandBufferHeader = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    commandBufferHeader->graphicsPipelineBound = SDL_FALSE;
+    commandBufferHeader->graphicsPipelineSkipped = SDL_TRUE;
+    commandBufferHeader->shadowState.graphicsPipeline = NULL;
+    return SDL_FALSE;
 }
 
 void SDL_GpuSetViewport(
 	SDL_GpuRenderPass *renderPass,
 	SDL_GpuViewport *viewport
 ) {
+    CommandBufferCommonHeader *header;
+
 	NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (
+        header->shadowState.viewportSet &&
+        SDL_memcmp(&header->shadowState.viewport, viewport, sizeof(SDL_GpuViewport)) == 0
+    ) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
 	RENDERPASS_DEVICE->SetViewport(
 		RENDERPASS_COMMAND_BUFFER,
 		viewport
 	);
+
+    header->shadowState.viewportSet = SDL_TRUE;
+    header->shadowState.viewport = *viewport;
 }
 
 void SDL_GpuSetScissor(
 	SDL_GpuRenderPass *renderPass,
 	SDL_GpuRect *scissor
 ) {
+    CommandBufferCommonHeader *header;
+
 	NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (
+        header->shadowState.scissorSet &&
+        SDL_memcmp(&header->shadowState.scissor, scissor, sizeof(SDL_GpuRect)) == 0
+    ) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
 	RENDERPASS_DEVICE->SetScissor(
 		RENDERPASS_COMMAND_BUFFER,
 		scissor
 	);
+
+    header->shadowState.scissorSet = SDL_TRUE;
+    header->shadowState.scissor = *scissor;
 }
 
 void SDL_GpuBindVertexBuffers(
@@ -676,9 +1021,25 @@ void SDL_GpuBindVertexBuffers(
     SDL_GpuBufferBinding *pBindings,
 	Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
 	NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.vertexBuffers,
+        pBindings,
+        sizeof(SDL_GpuBufferBinding),
+        firstBinding,
+        bindingCount,
+        MAX_BUFFER_BINDINGS
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
 	RENDERPASS_DEVICE->BindVertexBuffers(
 		RENDERPASS_COMMAND_BUFFER,
 		firstBinding,
@@ -692,14 +1053,32 @@ void SDL_GpuBindIndexBuffer(
 	SDL_GpuBufferBinding *pBinding,
 	SDL_GpuIndexElementSize indexElementSize
 ) {
+    CommandBufferCommonHeader *header;
+
 	NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (
+        header->shadowState.indexBufferSet &&
+        header->shadowState.indexBuffer.buffer == pBinding->buffer &&
+        header->shadowState.indexBuffer.offset == pBinding->offset &&
+        header->shadowState.indexElementSize == indexElementSize
+    ) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
 	RENDERPASS_DEVICE->BindIndexBuffer(
 		RENDERPASS_COMMAND_BUFFER,
 		pBinding,
 		indexElementSize
 	);
+
+    header->shadowState.indexBufferSet = SDL_TRUE;
+    header->shadowState.indexBuffer = *pBinding;
+    header->shadowState.indexElementSize = indexElementSize;
 }
 
 void SDL_GpuBindVertexSamplers(
@@ -708,9 +1087,25 @@ void SDL_GpuBindVertexSamplers(
     SDL_GpuTextureSamplerBinding *textureSamplerBindings,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.vertexSamplers,
+        textureSamplerBindings,
+        sizeof(SDL_GpuTextureSamplerBinding),
+        firstSlot,
+        bindingCount,
+        MAX_TEXTURE_SAMPLERS_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     RENDERPASS_DEVICE->BindVertexSamplers(
         RENDERPASS_COMMAND_BUFFER,
         firstSlot,
@@ -725,9 +1120,25 @@ void SDL_GpuBindVertexStorageTextures(
     SDL_GpuTextureSlice *storageTextureSlices,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.vertexStorageTextures,
+        storageTextureSlices,
+        sizeof(SDL_GpuTextureSlice),
+        firstSlot,
+        bindingCount,
+        MAX_STORAGE_TEXTURES_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     RENDERPASS_DEVICE->BindVertexStorageTextures(
         RENDERPASS_COMMAND_BUFFER,
         firstSlot,
@@ -742,9 +1153,25 @@ void SDL_GpuBindVertexStorageBuffers(
     SDL_GpuBuffer **storageBuffers,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.vertexStorageBuffers,
+        storageBuffers,
+        sizeof(SDL_GpuBuffer*),
+        firstSlot,
+        bindingCount,
+        MAX_STORAGE_BUFFERS_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     RENDERPASS_DEVICE->BindVertexStorageBuffers(
         RENDERPASS_COMMAND_BUFFER,
         firstSlot,
@@ -759,9 +1186,25 @@ void SDL_GpuBindFragmentSamplers(
     SDL_GpuTextureSamplerBinding *textureSamplerBindings,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.fragmentSamplers,
+        textureSamplerBindings,
+        sizeof(SDL_GpuTextureSamplerBinding),
+        firstSlot,
+        bindingCount,
+        MAX_TEXTURE_SAMPLERS_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     RENDERPASS_DEVICE->BindFragmentSamplers(
         RENDERPASS_COMMAND_BUFFER,
         firstSlot,
@@ -776,9 +1219,25 @@ void SDL_GpuBindFragmentStorageTextures(
     SDL_GpuTextureSlice *storageTextureSlices,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.fragmentStorageTextures,
+        storageTextureSlices,
+        sizeof(SDL_GpuTextureSlice),
+        firstSlot,
+        bindingCount,
+        MAX_STORAGE_TEXTURES_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     RENDERPASS_DEVICE->BindFragmentStorageTextures(
         RENDERPASS_COMMAND_BUFFER,
         firstSlot,
@@ -793,9 +1252,25 @@ void SDL_GpuBindFragmentStorageBuffers(
     SDL_GpuBuffer **storageBuffers,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
     CHECK_GRAPHICS_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.fragmentStorageBuffers,
+        storageBuffers,
+        sizeof(SDL_GpuBuffer*),
+        firstSlot,
+        bindingCount,
+        MAX_STORAGE_BUFFERS_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     RENDERPASS_DEVICE->BindFragmentStorageBuffers(
         RENDERPASS_COMMAND_BUFFER,
         firstSlot,
@@ -804,6 +1279,20 @@ void SDL_GpuBindFragmentStorageBuffers(
     );
 }
 
+void SDL_GpuBindGraphicsBindlessTable(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    NULL_ASSERT(renderPass)
+    NULL_ASSERT(bindlessTable)
+    CHECK_RENDERPASS
+
+    RENDERPASS_DEVICE->BindGraphicsBindlessTable(
+        RENDERPASS_COMMAND_BUFFER,
+        bindlessTable
+    );
+}
+
 void SDL_GpuPushVertexUniformData(
 	SDL_GpuRenderPass *renderPass,
 	Uint32 slotIndex,
@@ -819,6 +1308,7 @@ void SDL_GpuPushVertexUniformData(
 		data,
 		dataLengthInBytes
 	);
+    RENDERPASS_STATS.uniformBytesPushed += dataLengthInBytes;
 }
 
 void SDL_GpuPushFragmentUniformData(
@@ -836,6 +1326,7 @@ void SDL_GpuPushFragmentUniformData(
         data,
         dataLengthInBytes
     );
+    RENDERPASS_STATS.uniformBytesPushed += dataLengthInBytes;
 }
 
 void SDL_GpuDrawIndexedPrimitives(
@@ -855,6 +1346,7 @@ void SDL_GpuDrawIndexedPrimitives(
 		primitiveCount,
 		instanceCount
 	);
+    RENDERPASS_STATS.drawCalls += 1;
 }
 
 void SDL_GpuDrawPrimitives(
@@ -870,6 +1362,7 @@ void SDL_GpuDrawPrimitives(
 		vertexStart,
 		primitiveCount
 	);
+    RENDERPASS_STATS.drawCalls += 1;
 }
 
 void SDL_GpuDrawPrimitivesIndirect(
@@ -889,6 +1382,7 @@ void SDL_GpuDrawPrimitivesIndirect(
 		drawCount,
 		stride
 	);
+    RENDERPASS_STATS.drawCalls += 1;
 }
 
 void SDL_GpuDrawIndexedPrimitivesIndirect(
@@ -908,12 +1402,89 @@ void SDL_GpuDrawIndexedPrimitivesIndirect(
         drawCount,
         stride
     );
+    RENDERPASS_STATS.drawCalls += 1;
 }
 
-void SDL_GpuEndRenderPass(
-    SDL_GpuRenderPass *renderPass
+void SDL_GpuDrawPrimitivesIndirectCount(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
 ) {
-    CommandBufferCommonHeader *commandBufferCommonHeader;
+    NULL_ASSERT(renderPass)
+    CHECK_RENDERPASS
+    CHECK_GRAPHICS_PIPELINE_BOUND
+    RENDERPASS_DEVICE->DrawPrimitivesIndirectCount(
+        RENDERPASS_COMMAND_BUFFER,
+        buffer,
+        offsetInBytes,
+        countBuffer,
+        countOffsetInBytes,
+        maxDrawCount,
+        stride
+    );
+    RENDERPASS_STATS.drawCalls += 1;
+}
+
+void SDL_GpuDrawIndexedPrimitivesIndirectCount(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
+) {
+    NULL_ASSERT(renderPass)
+    CHECK_RENDERPASS
+    CHECK_GRAPHICS_PIPELINE_BOUND
+    RENDERPASS_DEVICE->DrawIndexedPrimitivesIndirectCount(
+        RENDERPASS_COMMAND_BUFFER,
+        buffer,
+        offsetInBytes,
+        countBuffer,
+        countOffsetInBytes,
+        maxDrawCount,
+        stride
+    );
+    RENDERPASS_STATS.drawCalls += 1;
+}
+
+void SDL_GpuDrawIndexedPrimitivesBatch(
+    SDL_GpuRenderPass *renderPass,
+    SDL_GpuIndexedDrawRecord *draws,
+    Uint32 drawCount,
+    Uint32 vertexUniformDataLengthInBytes,
+    Uint32 fragmentUniformDataLengthInBytes
+) {
+    NULL_ASSERT(renderPass)
+    CHECK_RENDERPASS
+    CHECK_GRAPHICS_PIPELINE_BOUND
+
+    if (drawCount == 0)
+    {
+        return;
+    }
+
+    NULL_ASSERT(draws)
+    RENDERPASS_DEVICE->DrawIndexedPrimitivesBatch(
+        RENDERPASS_COMMAND_BUFFER,
+        draws,
+        drawCount,
+        vertexUniformDataLengthInBytes,
+        fragmentUniformDataLengthInBytes
+    );
+    RENDERPASS_STATS.drawCalls += drawCount;
+    RENDERPASS_STATS.uniformBytesPushed += (Uint64) drawCount * (vertexUniformDataLengthInBytes + fragmentUniformDataLengthInBytes);
+}
+
+void SDL_GpuEndRenderPass(
+    SDL_GpuRenderPass *renderPass
+) {
+    CommandBufferCommonHeader *commandBufferCommonHeader;
 
 	NULL_ASSERT(renderPass)
     CHECK_RENDERPASS
@@ -924,6 +1495,117 @@ void SDL_GpuEndRenderPass(
     commandBufferCommonHeader = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
     commandBufferCommonHeader->renderPass.inProgress = SDL_FALSE;
     commandBufferCommonHeader->graphicsPipelineBound = SDL_FALSE;
+    commandBufferCommonHeader->graphicsPipelineSkipped = SDL_FALSE;
+}
+
+/* Parallel Render Pass */
+
+SDL_GpuParallelRenderPass* SDL_GpuBeginParallelRenderPass(
+	SDL_GpuCommandBuffer *commandBuffer,
+	SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+	Uint32 colorAttachmentCount,
+	SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+) {
+    CommandBufferCommonHeader *commandBufferHeader;
+
+    CHECK_COMMAND_BUFFER_RETURN_NULL
+    CHECK_ANY_PASS_IN_PROGRESS
+    CHECK_QUEUE_RETURN_NULL(SDL_GPU_COMMANDQUEUE_GRAPHICS)
+	COMMAND_BUFFER_DEVICE->BeginParallelRenderPass(
+		commandBuffer,
+		colorAttachmentInfos,
+		colorAttachmentCount,
+		depthStencilAttachmentInfo
+	);
+
+    /* The render pass slot is taken, but only sub passes hand out SDL_GpuRenderPass handles */
+    commandBufferHeader = (CommandBufferCommonHeader*) commandBuffer;
+    commandBufferHeader->renderPass.inProgress = SDL_TRUE;
+    SDL_zero(commandBufferHeader->shadowState);
+    return (SDL_GpuParallelRenderPass*) &(commandBufferHeader->renderPass);
+}
+
+SDL_GpuRenderPass* SDL_GpuAcquireRenderSubPass(
+    SDL_GpuParallelRenderPass *parallelRenderPass
+) {
+    SDL_GpuCommandBuffer *subPassCommandBuffer;
+    CommandBufferCommonHeader *subPassHeader;
+
+    NULL_ASSERT(parallelRenderPass)
+
+    if (
+        VALIDATION_ENABLED(PARALLELRENDERPASS_DEVICE) &&
+        !((Pass*) parallelRenderPass)->inProgress
+    ) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Parallel render pass not in progress!");
+        return NULL;
+    }
+
+    subPassCommandBuffer = PARALLELRENDERPASS_DEVICE->AcquireRenderSubPass(
+        PARALLELRENDERPASS_COMMAND_BUFFER
+    );
+
+    if (subPassCommandBuffer == NULL)
+    {
+        return NULL;
+    }
+
+    subPassHeader = (CommandBufferCommonHeader*) subPassCommandBuffer;
+    subPassHeader->device = PARALLELRENDERPASS_DEVICE;
+    subPassHeader->renderPass.commandBuffer = subPassCommandBuffer;
+    subPassHeader->renderPass.inProgress = SDL_TRUE;
+    subPassHeader->graphicsPipelineBound = SDL_FALSE;
+    subPassHeader->graphicsPipelineSkipped = SDL_FALSE;
+    subPassHeader->computePass.commandBuffer = subPassCommandBuffer;
+    subPassHeader->computePass.inProgress = SDL_FALSE;
+    subPassHeader->computePipelineBound = SDL_FALSE;
+    subPassHeader->computePipelineSkipped = SDL_FALSE;
+    subPassHeader->copyPass.commandBuffer = subPassCommandBuffer;
+    subPassHeader->copyPass.inProgress = SDL_FALSE;
+    subPassHeader->submitted = SDL_FALSE;
+    subPassHeader->queue = SDL_GPU_COMMANDQUEUE_GRAPHICS;
+    SDL_zero(subPassHeader->shadowState);
+    subPassHeader->filteredBindCount = 0;
+    SDL_zero(subPassHeader->stats);
+
+    return (SDL_GpuRenderPass*) &(subPassHeader->renderPass);
+}
+
+void SDL_GpuEndRenderSubPass(
+    SDL_GpuRenderPass *renderPass
+) {
+    CommandBufferCommonHeader *subPassHeader;
+
+    NULL_ASSERT(renderPass)
+    CHECK_RENDERPASS
+    RENDERPASS_DEVICE->EndRenderSubPass(
+        RENDERPASS_COMMAND_BUFFER
+    );
+
+    subPassHeader = (CommandBufferCommonHeader*) RENDERPASS_COMMAND_BUFFER;
+    subPassHeader->renderPass.inProgress = SDL_FALSE;
+    subPassHeader->graphicsPipelineBound = SDL_FALSE;
+    subPassHeader->graphicsPipelineSkipped = SDL_FALSE;
+
+    /* Sub passes are never submitted, so flush their counts here */
+    FrameStats_Flush(subPassHeader);
+    SDL_AtomicAdd(&RENDERPASS_DEVICE->filteredBindCount, (int) subPassHeader->filteredBindCount);
+    subPassHeader->filteredBindCount = 0;
+}
+
+void SDL_GpuEndParallelRenderPass(
+    SDL_GpuParallelRenderPass *parallelRenderPass
+) {
+    CommandBufferCommonHeader *commandBufferHeader;
+
+    NULL_ASSERT(parallelRenderPass)
+    CHECK_PARALLELRENDERPASS
+    PARALLELRENDERPASS_DEVICE->EndParallelRenderPass(
+        PARALLELRENDERPASS_COMMAND_BUFFER
+    );
+
+    commandBufferHeader = (CommandBufferCommonHeader*) PARALLELRENDERPASS_COMMAND_BUFFER;
+    commandBufferHeader->renderPass.inProgress = SDL_FALSE;
 }
 
 /* Compute Pass */
@@ -939,6 +1621,7 @@ SDL_GpuComputePass* SDL_GpuBeginComputePass(
 
     CHECK_COMMAND_BUFFER_RETURN_NULL
     CHECK_ANY_PASS_IN_PROGRESS
+    CHECK_QUEUE_RETURN_NULL(SDL_GPU_COMMANDQUEUE_COMPUTE)
 	COMMAND_BUFFER_DEVICE->BeginComputePass(
 		commandBuffer,
         storageTextureBindings,
@@ -949,6 +1632,7 @@ SDL_GpuComputePass* SDL_GpuBeginComputePass(
 
     commandBufferHeader = (CommandBufferCommonHeader*) commandBuffer;
     commandBufferHeader->computePass.inProgress = SDL_TRUE;
+    SDL_zero(commandBufferHeader->shadowState);
     return (SDL_GpuComputePass*) &(commandBufferHeader->computePass);
 }
 
@@ -960,14 +1644,57 @@ void SDL_GpuBindComputePipeline(
 
 	NULL_ASSERT(computePass)
     CHECK_COMPUTEPASS
+
+    commandBufferHeader = (CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER;
+    if (
+        commandBufferHeader->computePipelineBound &&
+        commandBufferHeader->shadowState.computePipeline == computePipeline
+    ) {
+        commandBufferHeader->filteredBindCount += 1;
+        return;
+    }
+
 	COMPUTEPASS_DEVICE->BindComputePipeline(
 		COMPUTEPASS_COMMAND_BUFFER,
 		computePipeline
 	);
 
-    commandBufferHeader = (CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER;
+    commandBufferHeader->stats.computePipelineBinds += 1;
+    commandBufferHeader->shadowState.computePipeline = computePipeline;
     commandBufferHeader->computePipelineBound = SDL_TRUE;
+    commandBufferHeader->computePipelineSkipped = SDL_FALSE;
+}
+
+SDL_bool SDL_GpuBindComputePipelineAsync(
+	SDL_GpuComputePass *computePass,
+	SDL_GpuCompileJob *job,
+	SDL_GpuComputePipeline *fallbackPipeline
+) {
+    CommandBufferCommonHeader *commandBufferHeader;
+    SDL_GpuComputePipeline *computePipeline;
 
+    NULL_ASSERT(computePass)
+    NULL_ASSERT(job)
+
+    computePipeline = SDL_GpuGetCompiledComputePipeline(COMPUTEPASS_DEVICE, job);
+    if (computePipeline != NULL)
+    {
+        SDL_GpuBindComputePipeline(computePass, computePipeline);
+        return SDL_TRUE;
+    }
+
+    if (fallbackPipeline != NULL)
+    {
+        SDL_GpuBindComputePipeline(computePass, fallbackPipeline);
+        return SDL_FALSE;
+    }
+
+    /* Nothing to dispatch with yet, skip everything until the next bind */
+    commandBufferHeader = (CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER;
+    commandBufferHeader->computePipelineBound = SDL_FALSE;
+    commandBufferHeader->computePipelineSkipped = SDL_TRUE;
+    commandBufferHeader->shadowState.computePipeline = NULL;
+    return SDL_FALSE;
 }
 
 void SDL_GpuBindComputeStorageTextures(
@@ -976,9 +1703,25 @@ void SDL_GpuBindComputeStorageTextures(
     SDL_GpuTextureSlice *storageTextureSlices,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(computePass)
     CHECK_COMPUTEPASS
     CHECK_COMPUTE_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.computeStorageTextures,
+        storageTextureSlices,
+        sizeof(SDL_GpuTextureSlice),
+        firstSlot,
+        bindingCount,
+        MAX_STORAGE_TEXTURES_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     COMPUTEPASS_DEVICE->BindComputeStorageTextures(
         COMPUTEPASS_COMMAND_BUFFER,
         firstSlot,
@@ -993,9 +1736,25 @@ void SDL_GpuBindComputeStorageBuffers(
     SDL_GpuBuffer **storageBuffers,
     Uint32 bindingCount
 ) {
+    CommandBufferCommonHeader *header;
+
     NULL_ASSERT(computePass)
     CHECK_COMPUTEPASS
     CHECK_COMPUTE_PIPELINE_BOUND
+
+    header = (CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER;
+    if (!ShadowState_UpdateRange(
+        header->shadowState.computeStorageBuffers,
+        storageBuffers,
+        sizeof(SDL_GpuBuffer*),
+        firstSlot,
+        bindingCount,
+        MAX_STORAGE_BUFFERS_PER_STAGE
+    )) {
+        header->filteredBindCount += 1;
+        return;
+    }
+
     COMPUTEPASS_DEVICE->BindComputeStorageBuffers(
         COMPUTEPASS_COMMAND_BUFFER,
         firstSlot,
@@ -1004,6 +1763,20 @@ void SDL_GpuBindComputeStorageBuffers(
     );
 }
 
+void SDL_GpuBindComputeBindlessTable(
+    SDL_GpuComputePass *computePass,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    NULL_ASSERT(computePass)
+    NULL_ASSERT(bindlessTable)
+    CHECK_COMPUTEPASS
+
+    COMPUTEPASS_DEVICE->BindComputeBindlessTable(
+        COMPUTEPASS_COMMAND_BUFFER,
+        bindlessTable
+    );
+}
+
 void SDL_GpuPushComputeUniformData(
 	SDL_GpuComputePass *computePass,
 	Uint32 slotIndex,
@@ -1019,6 +1792,7 @@ void SDL_GpuPushComputeUniformData(
 		data,
 		dataLengthInBytes
 	);
+    COMPUTEPASS_STATS.uniformBytesPushed += dataLengthInBytes;
 }
 
 void SDL_GpuDispatchCompute(
@@ -1036,6 +1810,7 @@ void SDL_GpuDispatchCompute(
 		groupCountY,
 		groupCountZ
 	);
+    COMPUTEPASS_STATS.dispatches += 1;
 }
 
 void SDL_GpuEndComputePass(
@@ -1052,6 +1827,7 @@ void SDL_GpuEndComputePass(
     commandBufferCommonHeader = (CommandBufferCommonHeader*) COMPUTEPASS_COMMAND_BUFFER;
     commandBufferCommonHeader->computePass.inProgress = SDL_FALSE;
     commandBufferCommonHeader->computePipelineBound = SDL_FALSE;
+    commandBufferCommonHeader->computePipelineSkipped = SDL_FALSE;
 }
 
 /* TransferBuffer Data */
@@ -1084,6 +1860,50 @@ void SDL_GpuUnmapTransferBuffer(
     );
 }
 
+void SDL_GpuFlushTransferBuffer(
+    SDL_GpuDevice *device,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+) {
+    NULL_ASSERT(device)
+    NULL_ASSERT(transferBuffer)
+
+    if (sizeInBytes == 0)
+    {
+        return;
+    }
+
+    device->FlushTransferBuffer(
+        device->driverData,
+        transferBuffer,
+        offsetInBytes,
+        sizeInBytes
+    );
+}
+
+void SDL_GpuInvalidateTransferBuffer(
+    SDL_GpuDevice *device,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+) {
+    NULL_ASSERT(device)
+    NULL_ASSERT(transferBuffer)
+
+    if (sizeInBytes == 0)
+    {
+        return;
+    }
+
+    device->InvalidateTransferBuffer(
+        device->driverData,
+        transferBuffer,
+        offsetInBytes,
+        sizeInBytes
+    );
+}
+
 void SDL_GpuSetTransferData(
 	SDL_GpuDevice *device,
 	void* data,
@@ -1167,6 +1987,7 @@ void SDL_GpuUploadToBuffer(
 		copyParams,
 		cycle
 	);
+    COPYPASS_STATS.bytesUploaded += copyParams->size;
 }
 
 void SDL_GpuCopyTextureToTexture(
@@ -1206,6 +2027,15 @@ void SDL_GpuGenerateMipmaps(
 	SDL_GpuTexture *texture
 ) {
 	NULL_ASSERT(copyPass)
+
+    if (
+        VALIDATION_ENABLED(COPYPASS_DEVICE) &&
+        ((CommandBufferCommonHeader*) COPYPASS_COMMAND_BUFFER)->queue != SDL_GPU_COMMANDQUEUE_GRAPHICS
+    ) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Mipmap generation requires a graphics queue command buffer!");
+        return;
+    }
+
 	COPYPASS_DEVICE->GenerateMipmaps(
 		COPYPASS_COMMAND_BUFFER,
 		texture
@@ -1240,6 +2070,7 @@ void SDL_GpuDownloadFromBuffer(
 		transferBuffer,
 		copyParams
 	);
+    COPYPASS_STATS.bytesDownloaded += copyParams->size;
 }
 
 void SDL_GpuEndCopyPass(
@@ -1262,6 +2093,7 @@ void SDL_GpuBlit(
 	SDL_bool cycle
 ) {
     CHECK_COMMAND_BUFFER
+    CHECK_QUEUE(SDL_GPU_COMMANDQUEUE_GRAPHICS)
     COMMAND_BUFFER_DEVICE->Blit(
         commandBuffer,
         source,
@@ -1271,6 +2103,50 @@ void SDL_GpuBlit(
     );
 }
 
+void SDL_GpuBlitBatch(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBlitRegion *blits,
+    Uint32 blitCount,
+    SDL_GpuFilter filterMode,
+    SDL_bool cycle
+) {
+    CHECK_COMMAND_BUFFER
+    CHECK_QUEUE(SDL_GPU_COMMANDQUEUE_GRAPHICS)
+
+    if (blitCount == 0)
+    {
+        return;
+    }
+
+    NULL_ASSERT(blits)
+    COMMAND_BUFFER_DEVICE->BlitBatch(
+        commandBuffer,
+        blits,
+        blitCount,
+        filterMode,
+        cycle
+    );
+}
+
+void SDL_GpuDiscardTransientTexture(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTexture *texture
+) {
+    CHECK_COMMAND_BUFFER
+    NULL_ASSERT(texture)
+
+    if (VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && ANY_PASS_IN_PROGRESS)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Pass already in progress!");
+        return;
+    }
+
+    COMMAND_BUFFER_DEVICE->DiscardTransientTexture(
+        commandBuffer,
+        texture
+    );
+}
+
 /* Submission/Presentation */
 
 SDL_bool SDL_GpuSupportsSwapchainComposition(
@@ -1353,13 +2229,24 @@ SDL_GpuTextureFormat SDL_GpuGetSwapchainTextureFormat(
 
 SDL_GpuCommandBuffer* SDL_GpuAcquireCommandBuffer(
 	SDL_GpuDevice *device
+) {
+    return SDL_GpuAcquireCommandBufferForQueue(
+        device,
+        SDL_GPU_COMMANDQUEUE_GRAPHICS
+    );
+}
+
+SDL_GpuCommandBuffer* SDL_GpuAcquireCommandBufferForQueue(
+	SDL_GpuDevice *device,
+	SDL_GpuCommandQueue queue
 ) {
 	SDL_GpuCommandBuffer* commandBuffer;
     CommandBufferCommonHeader *commandBufferHeader;
     NULL_ASSERT(device);
 
     commandBuffer = device->AcquireCommandBuffer(
-		device->driverData
+		device->driverData,
+		queue
 	);
 
     if (commandBuffer == NULL)
@@ -1372,12 +2259,19 @@ SDL_GpuCommandBuffer* SDL_GpuAcquireCommandBuffer(
     commandBufferHeader->renderPass.commandBuffer = commandBuffer;
     commandBufferHeader->renderPass.inProgress = SDL_FALSE;
     commandBufferHeader->graphicsPipelineBound = SDL_FALSE;
+    commandBufferHeader->graphicsPipelineSkipped = SDL_FALSE;
     commandBufferHeader->computePass.commandBuffer = commandBuffer;
     commandBufferHeader->computePass.inProgress = SDL_FALSE;
     commandBufferHeader->computePipelineBound = SDL_FALSE;
+    commandBufferHeader->computePipelineSkipped = SDL_FALSE;
     commandBufferHeader->copyPass.commandBuffer = commandBuffer;
     commandBufferHeader->copyPass.inProgress = SDL_FALSE;
     commandBufferHeader->submitted = SDL_FALSE;
+    commandBufferHeader->queue = queue;
+    SDL_zero(commandBufferHeader->shadowState);
+    commandBufferHeader->filteredBindCount = 0;
+    SDL_zero(commandBufferHeader->stats);
+    commandBufferHeader->stats.commandBuffersAcquired = 1;
 
     return commandBuffer;
 }
@@ -1389,6 +2283,7 @@ SDL_GpuTexture* SDL_GpuAcquireSwapchainTexture(
 	Uint32 *pHeight
 ) {
     CHECK_COMMAND_BUFFER_RETURN_NULL
+    CHECK_QUEUE_RETURN_NULL(SDL_GPU_COMMANDQUEUE_GRAPHICS)
 	return COMMAND_BUFFER_DEVICE->AcquireSwapchainTexture(
 		commandBuffer,
 		window,
@@ -1403,17 +2298,19 @@ void SDL_GpuSubmit(
     CHECK_COMMAND_BUFFER
     CommandBufferCommonHeader *commandBufferHeader = (CommandBufferCommonHeader*) commandBuffer;
 
-    if (
-        commandBufferHeader->renderPass.inProgress ||
-        commandBufferHeader->computePass.inProgress ||
-        commandBufferHeader->copyPass.inProgress
-    ) {
+    if (VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && ANY_PASS_IN_PROGRESS)
+    {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot submit command buffer while a pass is in progress!");
         return;
     }
 
     commandBufferHeader->submitted = SDL_TRUE;
 
+    commandBufferHeader->stats.commandBuffersSubmitted += 1;
+    FrameStats_Flush(commandBufferHeader);
+    SDL_AtomicAdd(&COMMAND_BUFFER_DEVICE->filteredBindCount, (int) commandBufferHeader->filteredBindCount);
+    commandBufferHeader->filteredBindCount = 0;
+
 	COMMAND_BUFFER_DEVICE->Submit(
 		commandBuffer
 	);
@@ -1425,17 +2322,19 @@ SDL_GpuFence* SDL_GpuSubmitAndAcquireFence(
     CHECK_COMMAND_BUFFER_RETURN_NULL
     CommandBufferCommonHeader *commandBufferHeader = (CommandBufferCommonHeader*) commandBuffer;
 
-    if (
-        commandBufferHeader->renderPass.inProgress ||
-        commandBufferHeader->computePass.inProgress ||
-        commandBufferHeader->copyPass.inProgress
-    ) {
+    if (VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && ANY_PASS_IN_PROGRESS)
+    {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot submit command buffer while a pass is in progress!");
         return NULL;
     }
 
     commandBufferHeader->submitted = SDL_TRUE;
 
+    commandBufferHeader->stats.commandBuffersSubmitted += 1;
+    FrameStats_Flush(commandBufferHeader);
+    SDL_AtomicAdd(&COMMAND_BUFFER_DEVICE->filteredBindCount, (int) commandBufferHeader->filteredBindCount);
+    commandBufferHeader->filteredBindCount = 0;
+
 	return COMMAND_BUFFER_DEVICE->SubmitAndAcquireFence(
 		commandBuffer
 	);
@@ -1488,6 +2387,32 @@ void SDL_GpuReleaseFence(
 	);
 }
 
+SDL_bool SDL_GpuDefragment(
+	SDL_GpuDevice *device,
+	Uint32 maxBytes,
+	Uint32 maxMilliseconds
+) {
+	NULL_ASSERT(device)
+	return device->Defragment(
+		device->driverData,
+		maxBytes,
+		maxMilliseconds
+	);
+}
+
+void SDL_GpuGetMemoryStats(
+	SDL_GpuDevice *device,
+	SDL_GpuMemoryStats *stats
+) {
+	NULL_ASSERT(device)
+	NULL_ASSERT(stats)
+	SDL_zerop(stats);
+	device->GetMemoryStats(
+		device->driverData,
+		stats
+	);
+}
+
 void SDL_GpuOcclusionQueryBegin(
     SDL_GpuCommandBuffer *commandBuffer,
     SDL_GpuOcclusionQuery *query
@@ -1524,3 +2449,107 @@ SDL_bool SDL_GpuOcclusionQueryPixelCount(
         pixelCount
     );
 }
+
+void SDL_GpuWriteTimestamp(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTimestampQuery *query
+) {
+    NULL_ASSERT(query)
+    CHECK_COMMAND_BUFFER
+    if (VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && ANY_PASS_IN_PROGRESS)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot write a timestamp during a pass!");
+        return;
+    }
+
+    COMMAND_BUFFER_DEVICE->WriteTimestamp(
+        commandBuffer,
+        query
+    );
+}
+
+SDL_bool SDL_GpuTimestampQueryResult(
+    SDL_GpuDevice *device,
+    SDL_GpuTimestampQuery *query,
+    Uint64 *nanoseconds
+) {
+    if (device == NULL)
+        return SDL_FALSE;
+
+    return device->TimestampQueryResult(
+        device->driverData,
+        query,
+        nanoseconds
+    );
+}
+
+void SDL_GpuEnablePassTiming(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    CHECK_COMMAND_BUFFER
+    if (VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && ANY_PASS_IN_PROGRESS)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot enable pass timing during a pass!");
+        return;
+    }
+
+    COMMAND_BUFFER_DEVICE->EnablePassTiming(
+        commandBuffer
+    );
+}
+
+Uint32 SDL_GpuGetPassTimings(
+    SDL_GpuDevice *device,
+    SDL_GpuFence *fence,
+    SDL_GpuPassTiming *timings,
+    Uint32 maxTimings
+) {
+    NULL_ASSERT(device)
+    NULL_ASSERT(fence)
+    return device->GetPassTimings(
+        device->driverData,
+        fence,
+        timings,
+        maxTimings
+    );
+}
+
+Uint32 SDL_GpuGetFilteredBindCount(
+    SDL_GpuDevice *device
+) {
+    NULL_ASSERT(device)
+    return (Uint32) SDL_AtomicGet(&device->filteredBindCount);
+}
+
+void SDL_GpuEnablePipelineStatistics(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    CHECK_COMMAND_BUFFER
+    if (VALIDATION_ENABLED(COMMAND_BUFFER_DEVICE) && ANY_PASS_IN_PROGRESS)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot enable pipeline statistics during a pass!");
+        return;
+    }
+
+    COMMAND_BUFFER_DEVICE->EnablePipelineStatistics(
+        commandBuffer
+    );
+}
+
+void SDL_GpuGetFrameStats(
+    SDL_GpuDevice *device,
+    SDL_GpuFrameStats *stats
+) {
+    NULL_ASSERT(device)
+    NULL_ASSERT(stats)
+
+    SDL_LockMutex(device->frameStatsLock);
+    *stats = device->frameStats;
+    SDL_zero(device->frameStats);
+    SDL_UnlockMutex(device->frameStatsLock);
+
+    device->GetFrameStats(
+        device->driverData,
+        stats
+    );
+}
@@ -0,0 +1,583 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "SDL_gpu_driver.h"
+#include "SDL_gpu_async_c.h"
+
+/* Backend object creation can take a long time when it involves SPIR-V
+ * translation or a driver-side shader compile, so the *Async functions hand
+ * the work off to a small pool of worker threads owned by the device.
+ * The workers simply call the regular SDL_GpuCreate* entry points, which
+ * the backends already allow from any thread.
+ */
+
+#define MAX_COMPILE_THREADS 4
+
+typedef enum SDL_GpuCompileJobType
+{
+	SDL_GPU_COMPILEJOB_SHADER,
+	SDL_GPU_COMPILEJOB_GRAPHICS_PIPELINE,
+	SDL_GPU_COMPILEJOB_COMPUTE_PIPELINE
+} SDL_GpuCompileJobType;
+
+struct SDL_GpuCompileJob
+{
+	SDL_GpuCompileJobType type;
+	SDL_atomic_t status;
+
+	/* Protected by the queue lock */
+	SDL_bool abandoned;
+	SDL_GpuCompileJob *next;
+
+	union
+	{
+		SDL_GpuShaderCreateInfo shader;
+		SDL_GpuGraphicsPipelineCreateInfo graphicsPipeline;
+		SDL_GpuComputePipelineCreateInfo computePipeline;
+	} createInfo;
+
+	/* Owned copies of the data the create info points to */
+	void *createInfoData;
+
+	union
+	{
+		SDL_GpuShader *shader;
+		SDL_GpuGraphicsPipeline *graphicsPipeline;
+		SDL_GpuComputePipeline *computePipeline;
+	} result;
+};
+
+struct SDL_GpuCompileQueue
+{
+	SDL_GpuDevice *device;
+
+	SDL_Thread *threads[MAX_COMPILE_THREADS];
+	Uint32 threadCount;
+
+	SDL_mutex *lock;
+	SDL_cond *jobAvailable;
+	SDL_cond *jobFinished;
+
+	SDL_GpuCompileJob *head;
+	SDL_GpuCompileJob *tail;
+
+	SDL_bool quit;
+};
+
+/* Jobs */
+
+static void SDL_GpuINTERNAL_ReleaseJobResult(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	switch (job->type)
+	{
+		case SDL_GPU_COMPILEJOB_SHADER:
+			if (job->result.shader != NULL)
+			{
+				SDL_GpuReleaseShader(device, job->result.shader);
+			}
+			break;
+		case SDL_GPU_COMPILEJOB_GRAPHICS_PIPELINE:
+			if (job->result.graphicsPipeline != NULL)
+			{
+				SDL_GpuReleaseGraphicsPipeline(device, job->result.graphicsPipeline);
+			}
+			break;
+		case SDL_GPU_COMPILEJOB_COMPUTE_PIPELINE:
+			if (job->result.computePipeline != NULL)
+			{
+				SDL_GpuReleaseComputePipeline(device, job->result.computePipeline);
+			}
+			break;
+	}
+}
+
+static void SDL_GpuINTERNAL_FreeJob(SDL_GpuCompileJob *job)
+{
+	SDL_free(job->createInfoData);
+	SDL_free(job);
+}
+
+/* Does the actual work. The caller publishes the returned status, under the
+ * queue lock if there is one, so that a concurrent release can't free the
+ * job out from under a worker.
+ */
+static SDL_GpuCompileStatus SDL_GpuINTERNAL_RunJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	void *result = NULL;
+
+	switch (job->type)
+	{
+		case SDL_GPU_COMPILEJOB_SHADER:
+			job->result.shader = SDL_GpuCreateShader(
+				device,
+				&job->createInfo.shader
+			);
+			result = job->result.shader;
+			break;
+
+		case SDL_GPU_COMPILEJOB_GRAPHICS_PIPELINE:
+			job->result.graphicsPipeline = SDL_GpuCreateGraphicsPipeline(
+				device,
+				&job->createInfo.graphicsPipeline
+			);
+			result = job->result.graphicsPipeline;
+			break;
+
+		case SDL_GPU_COMPILEJOB_COMPUTE_PIPELINE:
+			job->result.computePipeline = SDL_GpuCreateComputePipeline(
+				device,
+				&job->createInfo.computePipeline
+			);
+			result = job->result.computePipeline;
+			break;
+	}
+
+	return result != NULL ? SDL_GPU_COMPILESTATUS_READY : SDL_GPU_COMPILESTATUS_FAILED;
+}
+
+/* Worker Threads */
+
+static int SDL_GpuINTERNAL_CompileThread(void *data)
+{
+	SDL_GpuCompileQueue *queue = (SDL_GpuCompileQueue*) data;
+	SDL_GpuCompileJob *job;
+	SDL_GpuCompileStatus status;
+
+	SDL_LockMutex(queue->lock);
+
+	while (!queue->quit)
+	{
+		if (queue->head == NULL)
+		{
+			SDL_CondWait(queue->jobAvailable, queue->lock);
+			continue;
+		}
+
+		job = queue->head;
+		queue->head = job->next;
+		if (queue->head == NULL)
+		{
+			queue->tail = NULL;
+		}
+
+		/* Released before we got to it, don't bother compiling */
+		if (job->abandoned)
+		{
+			SDL_GpuINTERNAL_FreeJob(job);
+			continue;
+		}
+
+		SDL_UnlockMutex(queue->lock);
+		status = SDL_GpuINTERNAL_RunJob(queue->device, job);
+		SDL_LockMutex(queue->lock);
+
+		SDL_AtomicSet(&job->status, status);
+
+		if (job->abandoned)
+		{
+			SDL_GpuINTERNAL_ReleaseJobResult(queue->device, job);
+			SDL_GpuINTERNAL_FreeJob(job);
+		}
+
+		SDL_CondBroadcast(queue->jobFinished);
+	}
+
+	SDL_UnlockMutex(queue->lock);
+
+	return 0;
+}
+
+static SDL_GpuCompileQueue* SDL_GpuINTERNAL_CreateCompileQueue(SDL_GpuDevice *device)
+{
+	SDL_GpuCompileQueue *queue;
+	Uint32 threadCount;
+	Uint32 i;
+
+	queue = (SDL_GpuCompileQueue*) SDL_calloc(1, sizeof(SDL_GpuCompileQueue));
+	queue->device = device;
+	queue->lock = SDL_CreateMutex();
+	queue->jobAvailable = SDL_CreateCond();
+	queue->jobFinished = SDL_CreateCond();
+
+	/* Leave a core for the thread that is doing the rendering */
+	threadCount = SDL_GetCPUCount() > 1 ? SDL_GetCPUCount() - 1 : 1;
+	threadCount = SDL_min(threadCount, MAX_COMPILE_THREADS);
+
+	for (i = 0; i < threadCount; i += 1)
+	{
+		queue->threads[queue->threadCount] = SDL_CreateThread(
+			SDL_GpuINTERNAL_CompileThread,
+			"SDL_GpuCompileThread",
+			queue
+		);
+
+		if (queue->threads[queue->threadCount] == NULL)
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Failed to create compile thread: %s", SDL_GetError());
+			break;
+		}
+
+		queue->threadCount += 1;
+	}
+
+	if (queue->threadCount == 0)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create any compile threads!");
+		SDL_DestroyCond(queue->jobFinished);
+		SDL_DestroyCond(queue->jobAvailable);
+		SDL_DestroyMutex(queue->lock);
+		SDL_free(queue);
+		return NULL;
+	}
+
+	return queue;
+}
+
+static void SDL_GpuINTERNAL_DestroyCompileQueue(SDL_GpuCompileQueue *queue)
+{
+	SDL_GpuCompileJob *job;
+	SDL_GpuCompileJob *next;
+	Uint32 i;
+
+	SDL_LockMutex(queue->lock);
+	queue->quit = SDL_TRUE;
+	SDL_CondBroadcast(queue->jobAvailable);
+	SDL_UnlockMutex(queue->lock);
+
+	/* Workers finish whatever they are compiling before they exit */
+	for (i = 0; i < queue->threadCount; i += 1)
+	{
+		SDL_WaitThread(queue->threads[i], NULL);
+	}
+
+	/* Anything still queued never ran */
+	for (job = queue->head; job != NULL; job = next)
+	{
+		next = job->next;
+
+		if (job->abandoned)
+		{
+			SDL_GpuINTERNAL_FreeJob(job);
+		}
+		else
+		{
+			job->next = NULL;
+			SDL_AtomicSet(&job->status, SDL_GPU_COMPILESTATUS_FAILED);
+		}
+	}
+
+	SDL_DestroyCond(queue->jobFinished);
+	SDL_DestroyCond(queue->jobAvailable);
+	SDL_DestroyMutex(queue->lock);
+	SDL_free(queue);
+}
+
+static SDL_GpuCompileQueue* SDL_GpuINTERNAL_FetchCompileQueue(SDL_GpuDevice *device)
+{
+	SDL_GpuCompileQueue *queue = (SDL_GpuCompileQueue*) SDL_AtomicGetPtr((void**) &device->compileQueue);
+
+	if (queue != NULL)
+	{
+		return queue;
+	}
+
+	queue = SDL_GpuINTERNAL_CreateCompileQueue(device);
+	if (queue == NULL)
+	{
+		return NULL;
+	}
+
+	/* Another thread may have beaten us to it, in which case we use theirs */
+	if (!SDL_AtomicCASPtr((void**) &device->compileQueue, NULL, queue))
+	{
+		SDL_GpuINTERNAL_DestroyCompileQueue(queue);
+		queue = (SDL_GpuCompileQueue*) SDL_AtomicGetPtr((void**) &device->compileQueue);
+	}
+
+	return queue;
+}
+
+static SDL_GpuCompileJob* SDL_GpuINTERNAL_SubmitJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	SDL_GpuCompileQueue *queue = SDL_GpuINTERNAL_FetchCompileQueue(device);
+
+	if (queue == NULL)
+	{
+		/* No worker threads, so just do the work here */
+		SDL_AtomicSet(&job->status, SDL_GpuINTERNAL_RunJob(device, job));
+		return job;
+	}
+
+	SDL_AtomicSet(&job->status, SDL_GPU_COMPILESTATUS_PENDING);
+
+	SDL_LockMutex(queue->lock);
+
+	if (queue->tail != NULL)
+	{
+		queue->tail->next = job;
+	}
+	else
+	{
+		queue->head = job;
+	}
+	queue->tail = job;
+
+	SDL_CondSignal(queue->jobAvailable);
+	SDL_UnlockMutex(queue->lock);
+
+	return job;
+}
+
+void SDL_GpuDestroyCompileQueue(SDL_GpuDevice *device)
+{
+	SDL_GpuCompileQueue *queue = device->compileQueue;
+
+	if (queue != NULL)
+	{
+		SDL_GpuINTERNAL_DestroyCompileQueue(queue);
+		device->compileQueue = NULL;
+	}
+}
+
+/* Public API */
+
+SDL_GpuCompileJob* SDL_GpuCreateShaderAsync(
+	SDL_GpuDevice *device,
+	SDL_GpuShaderCreateInfo *shaderCreateInfo
+) {
+	SDL_GpuCompileJob *job;
+	size_t entryPointLength;
+	Uint8 *data;
+
+	SDL_assert(device != NULL);
+	SDL_assert(shaderCreateInfo != NULL);
+
+	entryPointLength = SDL_strlen(shaderCreateInfo->entryPointName) + 1;
+
+	job = (SDL_GpuCompileJob*) SDL_calloc(1, sizeof(SDL_GpuCompileJob));
+	job->type = SDL_GPU_COMPILEJOB_SHADER;
+	job->createInfo.shader = *shaderCreateInfo;
+
+	data = (Uint8*) SDL_malloc(shaderCreateInfo->codeSize + entryPointLength);
+	SDL_memcpy(data, shaderCreateInfo->code, shaderCreateInfo->codeSize);
+	SDL_memcpy(data + shaderCreateInfo->codeSize, shaderCreateInfo->entryPointName, entryPointLength);
+	job->createInfo.shader.code = data;
+	job->createInfo.shader.entryPointName = (const char*) (data + shaderCreateInfo->codeSize);
+	job->createInfoData = data;
+
+	return SDL_GpuINTERNAL_SubmitJob(device, job);
+}
+
+SDL_GpuCompileJob* SDL_GpuCreateGraphicsPipelineAsync(
+	SDL_GpuDevice *device,
+	SDL_GpuGraphicsPipelineCreateInfo *pipelineCreateInfo
+) {
+	SDL_GpuCompileJob *job;
+	SDL_GpuGraphicsPipelineCreateInfo *createInfo;
+	size_t bindingsSize;
+	size_t attributesSize;
+	size_t attachmentsSize;
+	Uint8 *data;
+
+	SDL_assert(device != NULL);
+	SDL_assert(pipelineCreateInfo != NULL);
+
+	job = (SDL_GpuCompileJob*) SDL_calloc(1, sizeof(SDL_GpuCompileJob));
+	job->type = SDL_GPU_COMPILEJOB_GRAPHICS_PIPELINE;
+	job->createInfo.graphicsPipeline = *pipelineCreateInfo;
+	createInfo = &job->createInfo.graphicsPipeline;
+
+	/* Every element type here is 4-byte aligned, so one allocation is enough */
+	bindingsSize = sizeof(SDL_GpuVertexBinding) * pipelineCreateInfo->vertexInputState.vertexBindingCount;
+	attributesSize = sizeof(SDL_GpuVertexAttribute) * pipelineCreateInfo->vertexInputState.vertexAttributeCount;
+	attachmentsSize = sizeof(SDL_GpuColorAttachmentDescription) * pipelineCreateInfo->attachmentInfo.colorAttachmentCount;
+
+	data = (Uint8*) SDL_malloc(bindingsSize + attributesSize + attachmentsSize + 1);
+	job->createInfoData = data;
+
+	if (bindingsSize > 0)
+	{
+		SDL_memcpy(data, pipelineCreateInfo->vertexInputState.vertexBindings, bindingsSize);
+		createInfo->vertexInputState.vertexBindings = (const SDL_GpuVertexBinding*) data;
+		data += bindingsSize;
+	}
+
+	if (attributesSize > 0)
+	{
+		SDL_memcpy(data, pipelineCreateInfo->vertexInputState.vertexAttributes, attributesSize);
+		createInfo->vertexInputState.vertexAttributes = (const SDL_GpuVertexAttribute*) data;
+		data += attributesSize;
+	}
+
+	if (attachmentsSize > 0)
+	{
+		SDL_memcpy(data, pipelineCreateInfo->attachmentInfo.colorAttachmentDescriptions, attachmentsSize);
+		createInfo->attachmentInfo.colorAttachmentDescriptions = (SDL_GpuColorAttachmentDescription*) data;
+	}
+
+	return SDL_GpuINTERNAL_SubmitJob(device, job);
+}
+
+SDL_GpuCompileJob* SDL_GpuCreateComputePipelineAsync(
+	SDL_GpuDevice *device,
+	SDL_GpuComputePipelineCreateInfo *computePipelineCreateInfo
+) {
+	SDL_GpuCompileJob *job;
+
+	SDL_assert(device != NULL);
+	SDL_assert(computePipelineCreateInfo != NULL);
+
+	job = (SDL_GpuCompileJob*) SDL_calloc(1, sizeof(SDL_GpuCompileJob));
+	job->type = SDL_GPU_COMPILEJOB_COMPUTE_PIPELINE;
+	job->createInfo.computePipeline = *computePipelineCreateInfo;
+
+	return SDL_GpuINTERNAL_SubmitJob(device, job);
+}
+
+SDL_GpuCompileStatus SDL_GpuQueryCompileJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	SDL_assert(job != NULL);
+	return (SDL_GpuCompileStatus) SDL_AtomicGet(&job->status);
+}
+
+SDL_GpuCompileStatus SDL_GpuWaitForCompileJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	SDL_GpuCompileQueue *queue;
+
+	SDL_assert(device != NULL);
+	SDL_assert(job != NULL);
+
+	queue = (SDL_GpuCompileQueue*) SDL_AtomicGetPtr((void**) &device->compileQueue);
+
+	if (queue != NULL && SDL_AtomicGet(&job->status) == SDL_GPU_COMPILESTATUS_PENDING)
+	{
+		SDL_LockMutex(queue->lock);
+		while (SDL_AtomicGet(&job->status) == SDL_GPU_COMPILESTATUS_PENDING)
+		{
+			SDL_CondWait(queue->jobFinished, queue->lock);
+		}
+		SDL_UnlockMutex(queue->lock);
+	}
+
+	return (SDL_GpuCompileStatus) SDL_AtomicGet(&job->status);
+}
+
+SDL_GpuShader* SDL_GpuGetCompiledShader(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	SDL_assert(job != NULL);
+
+	if (job->type != SDL_GPU_COMPILEJOB_SHADER)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Compile job is not a shader job!");
+		return NULL;
+	}
+
+	if (SDL_AtomicGet(&job->status) != SDL_GPU_COMPILESTATUS_READY)
+	{
+		return NULL;
+	}
+
+	return job->result.shader;
+}
+
+SDL_GpuGraphicsPipeline* SDL_GpuGetCompiledGraphicsPipeline(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	SDL_assert(job != NULL);
+
+	if (job->type != SDL_GPU_COMPILEJOB_GRAPHICS_PIPELINE)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Compile job is not a graphics pipeline job!");
+		return NULL;
+	}
+
+	if (SDL_AtomicGet(&job->status) != SDL_GPU_COMPILESTATUS_READY)
+	{
+		return NULL;
+	}
+
+	return job->result.graphicsPipeline;
+}
+
+SDL_GpuComputePipeline* SDL_GpuGetCompiledComputePipeline(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	SDL_assert(job != NULL);
+
+	if (job->type != SDL_GPU_COMPILEJOB_COMPUTE_PIPELINE)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Compile job is not a compute pipeline job!");
+		return NULL;
+	}
+
+	if (SDL_AtomicGet(&job->status) != SDL_GPU_COMPILESTATUS_READY)
+	{
+		return NULL;
+	}
+
+	return job->result.computePipeline;
+}
+
+void SDL_GpuReleaseCompileJob(
+	SDL_GpuDevice *device,
+	SDL_GpuCompileJob *job
+) {
+	SDL_GpuCompileQueue *queue;
+
+	SDL_assert(device != NULL);
+
+	if (job == NULL)
+	{
+		return;
+	}
+
+	queue = (SDL_GpuCompileQueue*) SDL_AtomicGetPtr((void**) &device->compileQueue);
+
+	if (queue != NULL)
+	{
+		SDL_LockMutex(queue->lock);
+		if (SDL_AtomicGet(&job->status) == SDL_GPU_COMPILESTATUS_PENDING)
+		{
+			/* The worker that picks it up will clean up after itself */
+			job->abandoned = SDL_TRUE;
+			SDL_UnlockMutex(queue->lock);
+			return;
+		}
+		SDL_UnlockMutex(queue->lock);
+	}
+
+	SDL_GpuINTERNAL_ReleaseJobResult(device, job);
+	SDL_GpuINTERNAL_FreeJob(job);
+}
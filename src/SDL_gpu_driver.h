@@ -25,6 +25,17 @@
 #ifndef SDL_GPU_DRIVER_H
 #define SDL_GPU_DRIVER_H
 
+/* GraphicsDevice Limits */
+
+#define MAX_TEXTURE_SAMPLERS_PER_STAGE  16
+#define MAX_STORAGE_TEXTURES_PER_STAGE  8
+#define MAX_STORAGE_BUFFERS_PER_STAGE   8
+#define MAX_UNIFORM_BUFFERS_PER_STAGE   14
+#define MAX_BUFFER_BINDINGS			    16
+#define MAX_COLOR_TARGET_BINDINGS	    4
+#define MAX_PRESENT_COUNT               16
+#define MAX_FRAMES_IN_FLIGHT            3
+
 /* Common Struct */
 
 typedef struct Pass
@@ -33,15 +44,52 @@ typedef struct Pass
     SDL_bool inProgress;
 } Pass;
 
+/* The last state forwarded to the backend, so identical binds can be dropped.
+ * Backends reset their bindings between passes, so this is cleared whenever a pass begins.
+ * Zeroed entries never match a real binding, state whose zero value is valid has a Set flag.
+ */
+typedef struct ShadowState
+{
+    SDL_GpuGraphicsPipeline *graphicsPipeline;
+    SDL_GpuComputePipeline *computePipeline;
+
+    SDL_bool viewportSet;
+    SDL_GpuViewport viewport;
+    SDL_bool scissorSet;
+    SDL_GpuRect scissor;
+
+    SDL_GpuBufferBinding vertexBuffers[MAX_BUFFER_BINDINGS];
+    SDL_bool indexBufferSet; /* a zeroed binding with 16-bit indices is a valid first bind */
+    SDL_GpuBufferBinding indexBuffer;
+    SDL_GpuIndexElementSize indexElementSize;
+
+    SDL_GpuTextureSamplerBinding vertexSamplers[MAX_TEXTURE_SAMPLERS_PER_STAGE];
+    SDL_GpuTextureSlice vertexStorageTextures[MAX_STORAGE_TEXTURES_PER_STAGE];
+    SDL_GpuBuffer *vertexStorageBuffers[MAX_STORAGE_BUFFERS_PER_STAGE];
+
+    SDL_GpuTextureSamplerBinding fragmentSamplers[MAX_TEXTURE_SAMPLERS_PER_STAGE];
+    SDL_GpuTextureSlice fragmentStorageTextures[MAX_STORAGE_TEXTURES_PER_STAGE];
+    SDL_GpuBuffer *fragmentStorageBuffers[MAX_STORAGE_BUFFERS_PER_STAGE];
+
+    SDL_GpuTextureSlice computeStorageTextures[MAX_STORAGE_TEXTURES_PER_STAGE];
+    SDL_GpuBuffer *computeStorageBuffers[MAX_STORAGE_BUFFERS_PER_STAGE];
+} ShadowState;
+
 typedef struct CommandBufferCommonHeader
 {
     SDL_GpuDevice *device;
     Pass renderPass;
     SDL_bool graphicsPipelineBound;
+    SDL_bool graphicsPipelineSkipped; /* Async pipeline not ready, skip draws */
     Pass computePass;
     SDL_bool computePipelineBound;
+    SDL_bool computePipelineSkipped; /* Async pipeline not ready, skip dispatches */
     Pass copyPass;
     SDL_bool submitted;
+    SDL_GpuCommandQueue queue;
+    ShadowState shadowState;
+    Uint32 filteredBindCount; /* flushed to the device on submit */
+    SDL_GpuFrameStats stats; /* flushed to the device on submit */
 } CommandBufferCommonHeader;
 
 /* Internal Helper Utilities */
@@ -190,20 +238,130 @@ static inline Sint32 BytesPerImage(
 	return blocksPerRow * blocksPerColumn * SDL_GpuTextureFormatTexelBlockSize(format);
 }
 
-/* GraphicsDevice Limits */
+/* 64-bit FNV-1a, pass the previous result as the seed to hash multiple blocks */
 
-#define MAX_TEXTURE_SAMPLERS_PER_STAGE  16
-#define MAX_STORAGE_TEXTURES_PER_STAGE  8
-#define MAX_STORAGE_BUFFERS_PER_STAGE   8
-#define MAX_UNIFORM_BUFFERS_PER_STAGE   14
-#define MAX_BUFFER_BINDINGS			    16
-#define MAX_COLOR_TARGET_BINDINGS	    4
-#define MAX_PRESENT_COUNT               16
-#define MAX_FRAMES_IN_FLIGHT            3
+#define HASH_SEED 0xCBF29CE484222325ULL
+
+static inline Uint64 HashBytes(
+	const void *data,
+	size_t size,
+	Uint64 seed
+) {
+	const Uint8 *bytes = (const Uint8*) data;
+	Uint64 hash = seed;
+	size_t i;
+
+	for (i = 0; i < size; i += 1)
+	{
+		hash ^= bytes[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+/* Every SDL_GpuFrameStats field is a Uint64 counter */
+static inline void AccumulateFrameStats(
+	SDL_GpuFrameStats *dst,
+	const SDL_GpuFrameStats *src
+) {
+	Uint64 *dstCounters = (Uint64*) dst;
+	const Uint64 *srcCounters = (const Uint64*) src;
+	size_t i;
+
+	for (i = 0; i < sizeof(SDL_GpuFrameStats) / sizeof(Uint64); i += 1)
+	{
+		dstCounters[i] += srcCounters[i];
+	}
+}
+
+/* Pipeline Cache Blobs */
+
+/* Every blob returned from SDL_GpuGetPipelineCacheData starts with this
+ * header, followed by dataSize bytes of backend-specific payload. The
+ * identity fields are filled in by the backend and must all match for the
+ * payload to be accepted when seeding a new device.
+ */
+
+#define PIPELINE_CACHE_MAGIC    0x43505347 /* "GSPC" */
+#define PIPELINE_CACHE_VERSION  1
+
+typedef struct PipelineCacheHeader
+{
+	Uint32 magic;
+	Uint32 version;
+	Uint32 backend;
+	Uint32 vendorID;
+	Uint32 deviceID;
+	Uint32 padding;
+	Uint64 driverVersion;
+	Uint8 deviceUUID[16];
+	Uint64 dataSize;
+} PipelineCacheHeader;
+
+/* Returns a pointer to the payload within blob, or NULL if the blob is
+ * missing, truncated, or was produced by a different device/driver.
+ */
+static inline const void* PipelineCache_GetPayload(
+	const PipelineCacheHeader *identity,
+	const void *blob,
+	size_t blobSize,
+	size_t *payloadSize
+) {
+	PipelineCacheHeader header;
+
+	*payloadSize = 0;
+
+	if (blob == NULL || blobSize < sizeof(PipelineCacheHeader))
+	{
+		return NULL;
+	}
+
+	/* The blob may not be aligned, so copy the header out */
+	SDL_memcpy(&header, blob, sizeof(PipelineCacheHeader));
+
+	if (	header.magic != PIPELINE_CACHE_MAGIC ||
+		header.version != PIPELINE_CACHE_VERSION ||
+		header.backend != identity->backend ||
+		header.vendorID != identity->vendorID ||
+		header.deviceID != identity->deviceID ||
+		header.driverVersion != identity->driverVersion ||
+		SDL_memcmp(header.deviceUUID, identity->deviceUUID, sizeof(header.deviceUUID)) != 0 ||
+		header.dataSize > blobSize - sizeof(PipelineCacheHeader)	)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Pipeline cache data is stale or invalid, ignoring");
+		return NULL;
+	}
+
+	*payloadSize = (size_t) header.dataSize;
+	return (const Uint8*) blob + sizeof(PipelineCacheHeader);
+}
+
+/* Writes the blob header into data, which must hold at least
+ * sizeof(PipelineCacheHeader) + payloadSize bytes. Returns where the
+ * backend should write its payload.
+ */
+static inline void* PipelineCache_WriteHeader(
+	const PipelineCacheHeader *identity,
+	size_t payloadSize,
+	void *data
+) {
+	PipelineCacheHeader header = *identity;
+
+	header.magic = PIPELINE_CACHE_MAGIC;
+	header.version = PIPELINE_CACHE_VERSION;
+	header.padding = 0;
+	header.dataSize = payloadSize;
+	SDL_memcpy(data, &header, sizeof(PipelineCacheHeader));
+
+	return (Uint8*) data + sizeof(PipelineCacheHeader);
+}
 
 /* SDL_GpuDevice Definition */
 
 typedef struct SDL_GpuRenderer SDL_GpuRenderer;
+typedef struct SDL_GpuCompileQueue SDL_GpuCompileQueue;
+typedef struct SDL_GpuSPIRVCache SDL_GpuSPIRVCache;
 
 struct SDL_GpuDevice
 {
@@ -255,6 +413,23 @@ struct SDL_GpuDevice
         SDL_GpuRenderer *driverData
     );
 
+    SDL_GpuTimestampQuery* (*CreateTimestampQuery)(
+        SDL_GpuRenderer *driverData
+    );
+
+    SDL_GpuBindlessTable* (*CreateBindlessTable)(
+        SDL_GpuRenderer *driverData,
+        Uint32 capacity
+    );
+
+    void (*UpdateBindlessTable)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuBindlessTable *bindlessTable,
+        Uint32 firstIndex,
+        SDL_GpuTextureSamplerBinding *textureSamplerBindings,
+        Uint32 bindingCount
+    );
+
 	/* Debug Naming */
 
 	void (*SetBufferName)(
@@ -316,6 +491,16 @@ struct SDL_GpuDevice
         SDL_GpuOcclusionQuery *query
     );
 
+    void (*ReleaseTimestampQuery)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuTimestampQuery *query
+    );
+
+    void (*ReleaseBindlessTable)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuBindlessTable *bindlessTable
+    );
+
 	/* Render Pass */
 
 	void (*BeginRenderPass)(
@@ -395,6 +580,11 @@ struct SDL_GpuDevice
         Uint32 bindingCount
     );
 
+    void (*BindGraphicsBindlessTable)(
+        SDL_GpuCommandBuffer *commandBuffer,
+        SDL_GpuBindlessTable *bindlessTable
+    );
+
 	void (*PushVertexUniformData)(
 		SDL_GpuCommandBuffer *commandBuffer,
         Uint32 slotIndex,
@@ -439,10 +629,60 @@ struct SDL_GpuDevice
         Uint32 stride
     );
 
+	void (*DrawPrimitivesIndirectCount)(
+		SDL_GpuCommandBuffer *commandBuffer,
+		SDL_GpuBuffer *buffer,
+		Uint32 offsetInBytes,
+		SDL_GpuBuffer *countBuffer,
+		Uint32 countOffsetInBytes,
+		Uint32 maxDrawCount,
+		Uint32 stride
+	);
+
+	void (*DrawIndexedPrimitivesIndirectCount)(
+		SDL_GpuCommandBuffer *commandBuffer,
+		SDL_GpuBuffer *buffer,
+		Uint32 offsetInBytes,
+		SDL_GpuBuffer *countBuffer,
+		Uint32 countOffsetInBytes,
+		Uint32 maxDrawCount,
+		Uint32 stride
+	);
+
+	void (*DrawIndexedPrimitivesBatch)(
+		SDL_GpuCommandBuffer *commandBuffer,
+		SDL_GpuIndexedDrawRecord *draws,
+		Uint32 drawCount,
+		Uint32 vertexUniformDataLengthInBytes,
+		Uint32 fragmentUniformDataLengthInBytes
+	);
+
 	void (*EndRenderPass)(
 		SDL_GpuCommandBuffer *commandBuffer
 	);
 
+	/* Parallel Render Pass */
+
+	void (*BeginParallelRenderPass)(
+		SDL_GpuCommandBuffer *commandBuffer,
+		SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+		Uint32 colorAttachmentCount,
+		SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+	);
+
+	/* Returns a command buffer that records into the parallel pass */
+	SDL_GpuCommandBuffer* (*AcquireRenderSubPass)(
+		SDL_GpuCommandBuffer *commandBuffer
+	);
+
+	void (*EndRenderSubPass)(
+		SDL_GpuCommandBuffer *subPassCommandBuffer
+	);
+
+	void (*EndParallelRenderPass)(
+		SDL_GpuCommandBuffer *commandBuffer
+	);
+
 	/* Compute Pass */
 
 	void (*BeginComputePass)(
@@ -472,6 +712,11 @@ struct SDL_GpuDevice
         Uint32 bindingCount
     );
 
+    void (*BindComputeBindlessTable)(
+        SDL_GpuCommandBuffer *commandBuffer,
+        SDL_GpuBindlessTable *bindlessTable
+    );
+
 	void (*PushComputeUniformData)(
 		SDL_GpuCommandBuffer *commandBuffer,
 		Uint32 slotIndex,
@@ -504,6 +749,20 @@ struct SDL_GpuDevice
         SDL_GpuTransferBuffer *transferBuffer
     );
 
+    void (*FlushTransferBuffer)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuTransferBuffer *transferBuffer,
+        Uint32 offsetInBytes,
+        Uint32 sizeInBytes
+    );
+
+    void (*InvalidateTransferBuffer)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuTransferBuffer *transferBuffer,
+        Uint32 offsetInBytes,
+        Uint32 sizeInBytes
+    );
+
 	void (*SetTransferData)(
 		SDL_GpuRenderer *driverData,
 		void* data,
@@ -587,6 +846,19 @@ struct SDL_GpuDevice
 		SDL_bool cycle
     );
 
+    void (*BlitBatch)(
+        SDL_GpuCommandBuffer *commandBuffer,
+        SDL_GpuBlitRegion *blits,
+        Uint32 blitCount,
+        SDL_GpuFilter filterMode,
+        SDL_bool cycle
+    );
+
+    void (*DiscardTransientTexture)(
+        SDL_GpuCommandBuffer *commandBuffer,
+        SDL_GpuTexture *texture
+    );
+
 	/* Submission/Presentation */
 
     SDL_bool (*SupportsSwapchainComposition)(
@@ -626,7 +898,8 @@ struct SDL_GpuDevice
 	);
 
 	SDL_GpuCommandBuffer* (*AcquireCommandBuffer)(
-		SDL_GpuRenderer *driverData
+		SDL_GpuRenderer *driverData,
+		SDL_GpuCommandQueue queue
 	);
 
 	SDL_GpuTexture* (*AcquireSwapchainTexture)(
@@ -665,6 +938,25 @@ struct SDL_GpuDevice
 		SDL_GpuFence *fence
 	);
 
+    /* Memory Management */
+
+    SDL_bool (*Defragment)(
+        SDL_GpuRenderer *driverData,
+        Uint32 maxBytes,
+        Uint32 maxMilliseconds
+    );
+
+    void (*GetMemoryStats)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuMemoryStats *stats
+    );
+
+    /* Adds the counters the backend could only collect after submission, then resets them */
+    void (*GetFrameStats)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuFrameStats *stats
+    );
+
     /* Queries */
 
     void (*OcclusionQueryBegin)(
@@ -683,6 +975,32 @@ struct SDL_GpuDevice
         Uint32 *pixelCount
     );
 
+    void (*WriteTimestamp)(
+        SDL_GpuCommandBuffer *commandBuffer,
+        SDL_GpuTimestampQuery *query
+    );
+
+    SDL_bool (*TimestampQueryResult)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuTimestampQuery *query,
+        Uint64 *nanoseconds
+    );
+
+    void (*EnablePassTiming)(
+        SDL_GpuCommandBuffer *commandBuffer
+    );
+
+    Uint32 (*GetPassTimings)(
+        SDL_GpuRenderer *driverData,
+        SDL_GpuFence *fence,
+        SDL_GpuPassTiming *timings,
+        Uint32 maxTimings
+    );
+
+    void (*EnablePipelineStatistics)(
+        SDL_GpuCommandBuffer *commandBuffer
+    );
+
     /* Feature Queries */
 
     SDL_bool (*IsTextureFormatSupported)(
@@ -692,12 +1010,28 @@ struct SDL_GpuDevice
         SDL_GpuTextureUsageFlags usage
     );
 
+    Uint32 (*GetMaxBindlessTableSize)(
+        SDL_GpuRenderer *driverData
+    );
+
+    SDL_bool (*SupportsIndirectCount)(
+        SDL_GpuRenderer *driverData
+    );
+
     SDL_GpuSampleCount (*GetBestSampleCount)(
         SDL_GpuRenderer *driverData,
         SDL_GpuTextureFormat format,
         SDL_GpuSampleCount desiredSampleCount
     );
 
+    /* Pipeline Cache */
+
+    SDL_bool (*GetPipelineCacheData)(
+        SDL_GpuRenderer *driverData,
+        void *data,
+        size_t *dataSize
+    );
+
     /* SPIR-V Cross Interop */
 
     SDL_GpuShader* (*CompileFromSPIRVCross)(
@@ -712,6 +1046,22 @@ struct SDL_GpuDevice
 
 	/* Store this for SDL_GpuGetBackend() */
 	SDL_GpuBackend backend;
+
+	/* Enables front-end validation, see SDL_gpu.c */
+	SDL_bool debugMode;
+
+	/* Worker threads for the *Async creation functions, created on first use */
+	SDL_GpuCompileQueue *compileQueue;
+
+	/* Translated SPIR-V for the non-Vulkan backends */
+	SDL_GpuSPIRVCache *spirvCache;
+
+	/* Redundant binds dropped by the front end, see SDL_GpuGetFilteredBindCount() */
+	SDL_atomic_t filteredBindCount;
+
+	/* Counters flushed from submitted command buffers, see SDL_GpuGetFrameStats() */
+	SDL_mutex *frameStatsLock;
+	SDL_GpuFrameStats frameStats;
 };
 
 #define ASSIGN_DRIVER_FUNC(func, name) \
@@ -726,6 +1076,9 @@ struct SDL_GpuDevice
 	ASSIGN_DRIVER_FUNC(CreateBuffer, name) \
 	ASSIGN_DRIVER_FUNC(CreateTransferBuffer, name) \
     ASSIGN_DRIVER_FUNC(CreateOcclusionQuery, name) \
+    ASSIGN_DRIVER_FUNC(CreateTimestampQuery, name) \
+    ASSIGN_DRIVER_FUNC(CreateBindlessTable, name) \
+    ASSIGN_DRIVER_FUNC(UpdateBindlessTable, name) \
 	ASSIGN_DRIVER_FUNC(SetBufferName, name) \
 	ASSIGN_DRIVER_FUNC(SetTextureName, name) \
     ASSIGN_DRIVER_FUNC(SetStringMarker, name) \
@@ -737,6 +1090,8 @@ struct SDL_GpuDevice
 	ASSIGN_DRIVER_FUNC(ReleaseComputePipeline, name) \
 	ASSIGN_DRIVER_FUNC(ReleaseGraphicsPipeline, name) \
     ASSIGN_DRIVER_FUNC(ReleaseOcclusionQuery, name) \
+    ASSIGN_DRIVER_FUNC(ReleaseTimestampQuery, name) \
+    ASSIGN_DRIVER_FUNC(ReleaseBindlessTable, name) \
 	ASSIGN_DRIVER_FUNC(BeginRenderPass, name) \
 	ASSIGN_DRIVER_FUNC(BindGraphicsPipeline, name) \
 	ASSIGN_DRIVER_FUNC(SetViewport, name) \
@@ -749,22 +1104,33 @@ struct SDL_GpuDevice
     ASSIGN_DRIVER_FUNC(BindFragmentSamplers, name) \
     ASSIGN_DRIVER_FUNC(BindFragmentStorageTextures, name) \
     ASSIGN_DRIVER_FUNC(BindFragmentStorageBuffers, name) \
+    ASSIGN_DRIVER_FUNC(BindGraphicsBindlessTable, name) \
 	ASSIGN_DRIVER_FUNC(PushVertexUniformData, name) \
     ASSIGN_DRIVER_FUNC(PushFragmentUniformData, name) \
 	ASSIGN_DRIVER_FUNC(DrawIndexedPrimitives, name) \
 	ASSIGN_DRIVER_FUNC(DrawPrimitives, name) \
 	ASSIGN_DRIVER_FUNC(DrawPrimitivesIndirect, name) \
 	ASSIGN_DRIVER_FUNC(DrawIndexedPrimitivesIndirect, name) \
+	ASSIGN_DRIVER_FUNC(DrawPrimitivesIndirectCount, name) \
+	ASSIGN_DRIVER_FUNC(DrawIndexedPrimitivesIndirectCount, name) \
+	ASSIGN_DRIVER_FUNC(DrawIndexedPrimitivesBatch, name) \
 	ASSIGN_DRIVER_FUNC(EndRenderPass, name) \
+	ASSIGN_DRIVER_FUNC(BeginParallelRenderPass, name) \
+	ASSIGN_DRIVER_FUNC(AcquireRenderSubPass, name) \
+	ASSIGN_DRIVER_FUNC(EndRenderSubPass, name) \
+	ASSIGN_DRIVER_FUNC(EndParallelRenderPass, name) \
 	ASSIGN_DRIVER_FUNC(BeginComputePass, name) \
     ASSIGN_DRIVER_FUNC(BindComputePipeline, name) \
     ASSIGN_DRIVER_FUNC(BindComputeStorageTextures, name) \
     ASSIGN_DRIVER_FUNC(BindComputeStorageBuffers, name) \
+    ASSIGN_DRIVER_FUNC(BindComputeBindlessTable, name) \
 	ASSIGN_DRIVER_FUNC(PushComputeUniformData, name) \
 	ASSIGN_DRIVER_FUNC(DispatchCompute, name) \
 	ASSIGN_DRIVER_FUNC(EndComputePass, name) \
     ASSIGN_DRIVER_FUNC(MapTransferBuffer, name) \
     ASSIGN_DRIVER_FUNC(UnmapTransferBuffer, name) \
+    ASSIGN_DRIVER_FUNC(FlushTransferBuffer, name) \
+    ASSIGN_DRIVER_FUNC(InvalidateTransferBuffer, name) \
 	ASSIGN_DRIVER_FUNC(SetTransferData, name) \
 	ASSIGN_DRIVER_FUNC(GetTransferData, name) \
 	ASSIGN_DRIVER_FUNC(BeginCopyPass, name) \
@@ -777,6 +1143,8 @@ struct SDL_GpuDevice
 	ASSIGN_DRIVER_FUNC(GenerateMipmaps, name) \
 	ASSIGN_DRIVER_FUNC(EndCopyPass, name) \
     ASSIGN_DRIVER_FUNC(Blit, name) \
+    ASSIGN_DRIVER_FUNC(BlitBatch, name) \
+    ASSIGN_DRIVER_FUNC(DiscardTransientTexture, name) \
     ASSIGN_DRIVER_FUNC(SupportsSwapchainComposition, name) \
 	ASSIGN_DRIVER_FUNC(SupportsPresentMode, name) \
 	ASSIGN_DRIVER_FUNC(ClaimWindow, name) \
@@ -791,11 +1159,22 @@ struct SDL_GpuDevice
 	ASSIGN_DRIVER_FUNC(WaitForFences, name) \
 	ASSIGN_DRIVER_FUNC(QueryFence, name) \
 	ASSIGN_DRIVER_FUNC(ReleaseFence, name) \
+    ASSIGN_DRIVER_FUNC(Defragment, name) \
+    ASSIGN_DRIVER_FUNC(GetMemoryStats, name) \
+    ASSIGN_DRIVER_FUNC(GetFrameStats, name) \
     ASSIGN_DRIVER_FUNC(OcclusionQueryBegin, name) \
     ASSIGN_DRIVER_FUNC(OcclusionQueryEnd, name) \
     ASSIGN_DRIVER_FUNC(OcclusionQueryPixelCount, name) \
+    ASSIGN_DRIVER_FUNC(WriteTimestamp, name) \
+    ASSIGN_DRIVER_FUNC(TimestampQueryResult, name) \
+    ASSIGN_DRIVER_FUNC(EnablePassTiming, name) \
+    ASSIGN_DRIVER_FUNC(GetPassTimings, name) \
+    ASSIGN_DRIVER_FUNC(EnablePipelineStatistics, name) \
     ASSIGN_DRIVER_FUNC(IsTextureFormatSupported, name) \
+    ASSIGN_DRIVER_FUNC(GetMaxBindlessTableSize, name) \
+    ASSIGN_DRIVER_FUNC(SupportsIndirectCount, name) \
     ASSIGN_DRIVER_FUNC(GetBestSampleCount, name) \
+    ASSIGN_DRIVER_FUNC(GetPipelineCacheData, name) \
 	ASSIGN_DRIVER_FUNC(CompileFromSPIRVCross, name)
 
 typedef struct SDL_GpuDriver
@@ -803,7 +1182,11 @@ typedef struct SDL_GpuDriver
 	const char *Name;
 	const SDL_GpuBackend backendflag;
 	SDL_bool (*PrepareDriver)();
-	SDL_GpuDevice* (*CreateDevice)(SDL_bool debugMode);
+	SDL_GpuDevice* (*CreateDevice)(
+		SDL_bool debugMode,
+		const void *pipelineCacheData,
+		size_t pipelineCacheSize
+	);
 } SDL_GpuDriver;
 
 extern SDL_GpuDriver VulkanDriver;
@@ -0,0 +1,1465 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "SDL_gpu_driver.h"
+
+/* The render graph sits entirely on top of the public pass API.
+ * Passes are declared in submission order along with every resource they
+ * read and write, and nothing is recorded until SDL_GpuExecuteRenderGraph:
+ *
+ * - Each access depends on the last earlier write of the same resource,
+ *   and each write also depends on the reads since that write.
+ * - Passes are kept only if they write an imported resource or are marked
+ *   NEVER_CULL, plus everything that produces what a kept pass reads.
+ * - Passes marked ALLOW_ASYNC that only touch imported resources move to the
+ *   transfer or compute queue whenever everything they depend on was already
+ *   submitted to a queue whose work they can see.
+ * - Within each queue, ready copy passes are scheduled first so runs of them
+ *   share one copy pass.
+ * - Graph-owned textures and buffers live from their first to their last use
+ *   in the graphics schedule, and are assigned from a pool so that resources
+ *   with disjoint lifetimes share the same object. Pooled textures are
+ *   transient, and are discarded right after their last use so that
+ *   backends which alias transient memory can hand it to the next one.
+ *
+ * Handles are indices plus one and only last until the graph is executed.
+ */
+
+/* Pooled resources left unused for this many executions are released */
+#define RENDERGRAPH_POOL_MAX_IDLE_FRAMES 8
+
+/* The order queues are submitted in, each one sees the work of the ones before it */
+static const SDL_GpuCommandQueue RenderGraphSubmitOrder[] =
+{
+	SDL_GPU_COMMANDQUEUE_TRANSFER,
+	SDL_GPU_COMMANDQUEUE_COMPUTE,
+	SDL_GPU_COMMANDQUEUE_GRAPHICS
+};
+
+#define RENDERGRAPH_QUEUE_COUNT SDL_arraysize(RenderGraphSubmitOrder)
+
+typedef enum RenderGraphResourceType
+{
+	RENDERGRAPH_RESOURCE_TEXTURE,
+	RENDERGRAPH_RESOURCE_BUFFER
+} RenderGraphResourceType;
+
+typedef struct RenderGraphResource
+{
+	RenderGraphResourceType type;
+	SDL_bool imported;
+
+	/* Graph-owned resources are created from these when the graph executes */
+	SDL_GpuTextureCreateInfo textureCreateInfo;
+	SDL_GpuBufferUsageFlags bufferUsageFlags;
+	Uint32 bufferSizeInBytes;
+
+	SDL_GpuTexture *texture;
+	SDL_GpuBuffer *buffer;
+
+	/* Compile state */
+	Uint32 lastWriter; /* pass index + 1, or 0 */
+	Uint32 *readers;   /* passes that read the resource since lastWriter */
+	Uint32 readerCount;
+	Uint32 readerCapacity;
+
+	/* Positions in the graphics schedule */
+	SDL_bool used;
+	Uint32 firstUse;
+	Uint32 lastUse;
+
+	/* Execution state */
+	SDL_bool written;
+} RenderGraphResource;
+
+typedef struct RenderGraphAccess
+{
+	Uint32 resource; /* resource index */
+	SDL_bool write;
+} RenderGraphAccess;
+
+typedef struct RenderGraphDependency
+{
+	Uint32 pass; /* pass index */
+	SDL_bool producer; /* the dependent pass reads something this pass wrote */
+} RenderGraphDependency;
+
+typedef struct RenderGraphPass
+{
+	SDL_GpuPassType type;
+	SDL_GpuRenderGraphPassFlags flags;
+	SDL_GpuRenderGraphRenderFunc renderFunc;
+	SDL_GpuRenderGraphComputeFunc computeFunc;
+	SDL_GpuRenderGraphCopyFunc copyFunc;
+	void *userdata;
+
+	SDL_GpuColorAttachmentInfo colorAttachments[MAX_COLOR_TARGET_BINDINGS];
+	Uint32 colorAttachmentResources[MAX_COLOR_TARGET_BINDINGS];
+	Uint32 colorAttachmentCount;
+
+	SDL_GpuDepthStencilAttachmentInfo depthStencilAttachment;
+	Uint32 depthStencilResource; /* resource index + 1, or 0 */
+
+	SDL_GpuStorageTextureReadWriteBinding storageTextures[MAX_STORAGE_TEXTURES_PER_STAGE];
+	Uint32 storageTextureResources[MAX_STORAGE_TEXTURES_PER_STAGE];
+	Uint32 storageTextureCount;
+
+	SDL_GpuStorageBufferReadWriteBinding storageBuffers[MAX_STORAGE_BUFFERS_PER_STAGE];
+	Uint32 storageBufferResources[MAX_STORAGE_BUFFERS_PER_STAGE];
+	Uint32 storageBufferCount;
+
+	RenderGraphAccess *accesses;
+	Uint32 accessCount;
+	Uint32 accessCapacity;
+
+	RenderGraphDependency *dependencies;
+	Uint32 dependencyCount;
+	Uint32 dependencyCapacity;
+
+	/* Compile state */
+	SDL_bool live;
+	SDL_bool scheduled;
+	SDL_GpuCommandQueue queue;
+} RenderGraphPass;
+
+typedef struct RenderGraphPoolEntry
+{
+	RenderGraphResourceType type;
+	SDL_GpuTextureCreateInfo textureCreateInfo;
+	SDL_GpuBufferUsageFlags bufferUsageFlags;
+	Uint32 bufferSizeInBytes;
+
+	SDL_GpuTexture *texture;
+	SDL_GpuBuffer *buffer;
+
+	SDL_bool assigned;     /* in the current execution */
+	Uint32 availableAfter; /* last use of the resource it is assigned to */
+	Uint32 idleFrames;
+} RenderGraphPoolEntry;
+
+struct SDL_GpuRenderGraph
+{
+	SDL_GpuDevice *device;
+
+	/* Slots past the counts keep their arrays for reuse by later frames */
+	RenderGraphResource *resources;
+	Uint32 resourceCount;
+	Uint32 resourceCapacity;
+
+	RenderGraphPass *passes;
+	Uint32 passCount;
+	Uint32 passCapacity;
+
+	/* Live pass indices, grouped by queue in RenderGraphSubmitOrder */
+	Uint32 *schedule;
+	Uint32 scheduleCapacity;
+	Uint32 scheduleCounts[RENDERGRAPH_QUEUE_COUNT];
+
+	RenderGraphPoolEntry *pool;
+	Uint32 poolCount;
+	Uint32 poolCapacity;
+};
+
+/* Declaration */
+
+static RenderGraphResource* SDL_GpuINTERNAL_FetchRenderGraphResource(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphResource handle
+) {
+	if (handle == 0 || handle > graph->resourceCount)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Invalid render graph resource!");
+		return NULL;
+	}
+
+	return &graph->resources[handle - 1];
+}
+
+static RenderGraphPass* SDL_GpuINTERNAL_FetchRenderGraphPass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass handle
+) {
+	if (handle == 0 || handle > graph->passCount)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Invalid render graph pass!");
+		return NULL;
+	}
+
+	return &graph->passes[handle - 1];
+}
+
+static SDL_GpuRenderGraphResource SDL_GpuINTERNAL_NewRenderGraphResource(
+	SDL_GpuRenderGraph *graph,
+	RenderGraphResourceType type,
+	SDL_bool imported
+) {
+	RenderGraphResource *resource;
+	Uint32 *readers;
+	Uint32 readerCapacity;
+
+	if (graph->resourceCount == graph->resourceCapacity)
+	{
+		graph->resourceCapacity = SDL_max(graph->resourceCapacity * 2, 16);
+		graph->resources = (RenderGraphResource*) SDL_realloc(
+			graph->resources,
+			sizeof(RenderGraphResource) * graph->resourceCapacity
+		);
+		SDL_memset(
+			graph->resources + graph->resourceCount,
+			0,
+			sizeof(RenderGraphResource) * (graph->resourceCapacity - graph->resourceCount)
+		);
+	}
+
+	resource = &graph->resources[graph->resourceCount];
+	readers = resource->readers;
+	readerCapacity = resource->readerCapacity;
+
+	SDL_zerop(resource);
+	resource->type = type;
+	resource->imported = imported;
+	resource->readers = readers;
+	resource->readerCapacity = readerCapacity;
+
+	graph->resourceCount += 1;
+	return graph->resourceCount;
+}
+
+static SDL_GpuRenderGraphPass SDL_GpuINTERNAL_NewRenderGraphPass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuPassType type,
+	SDL_GpuRenderGraphPassFlags flags,
+	void *userdata
+) {
+	RenderGraphPass *pass;
+	RenderGraphAccess *accesses;
+	RenderGraphDependency *dependencies;
+	Uint32 accessCapacity, dependencyCapacity;
+
+	if (graph->passCount == graph->passCapacity)
+	{
+		graph->passCapacity = SDL_max(graph->passCapacity * 2, 16);
+		graph->passes = (RenderGraphPass*) SDL_realloc(
+			graph->passes,
+			sizeof(RenderGraphPass) * graph->passCapacity
+		);
+		SDL_memset(
+			graph->passes + graph->passCount,
+			0,
+			sizeof(RenderGraphPass) * (graph->passCapacity - graph->passCount)
+		);
+	}
+
+	pass = &graph->passes[graph->passCount];
+	accesses = pass->accesses;
+	accessCapacity = pass->accessCapacity;
+	dependencies = pass->dependencies;
+	dependencyCapacity = pass->dependencyCapacity;
+
+	SDL_zerop(pass);
+	pass->type = type;
+	pass->flags = flags;
+	pass->userdata = userdata;
+	pass->accesses = accesses;
+	pass->accessCapacity = accessCapacity;
+	pass->dependencies = dependencies;
+	pass->dependencyCapacity = dependencyCapacity;
+
+	graph->passCount += 1;
+	return graph->passCount;
+}
+
+static void SDL_GpuINTERNAL_AddRenderGraphAccess(
+	RenderGraphPass *pass,
+	Uint32 resourceIndex,
+	SDL_bool write
+) {
+	if (pass->accessCount == pass->accessCapacity)
+	{
+		pass->accessCapacity = SDL_max(pass->accessCapacity * 2, 8);
+		pass->accesses = (RenderGraphAccess*) SDL_realloc(
+			pass->accesses,
+			sizeof(RenderGraphAccess) * pass->accessCapacity
+		);
+	}
+
+	pass->accesses[pass->accessCount].resource = resourceIndex;
+	pass->accesses[pass->accessCount].write = write;
+	pass->accessCount += 1;
+}
+
+/* Compilation */
+
+static void SDL_GpuINTERNAL_AddRenderGraphDependency(
+	RenderGraphPass *pass,
+	Uint32 passIndex,
+	SDL_bool producer
+) {
+	Uint32 i;
+
+	for (i = 0; i < pass->dependencyCount; i += 1)
+	{
+		if (pass->dependencies[i].pass == passIndex)
+		{
+			pass->dependencies[i].producer |= producer;
+			return;
+		}
+	}
+
+	if (pass->dependencyCount == pass->dependencyCapacity)
+	{
+		pass->dependencyCapacity = SDL_max(pass->dependencyCapacity * 2, 8);
+		pass->dependencies = (RenderGraphDependency*) SDL_realloc(
+			pass->dependencies,
+			sizeof(RenderGraphDependency) * pass->dependencyCapacity
+		);
+	}
+
+	pass->dependencies[pass->dependencyCount].pass = passIndex;
+	pass->dependencies[pass->dependencyCount].producer = producer;
+	pass->dependencyCount += 1;
+}
+
+static void SDL_GpuINTERNAL_BuildRenderGraphDependencies(SDL_GpuRenderGraph *graph)
+{
+	Uint32 i, j, k;
+
+	for (i = 0; i < graph->passCount; i += 1)
+	{
+		RenderGraphPass *pass = &graph->passes[i];
+
+		/* Reads first, so a pass that reads and writes a resource sees the previous write */
+		for (j = 0; j < pass->accessCount; j += 1)
+		{
+			RenderGraphResource *resource = &graph->resources[pass->accesses[j].resource];
+
+			if (pass->accesses[j].write)
+			{
+				continue;
+			}
+
+			if (resource->lastWriter != 0 && resource->lastWriter - 1 != i)
+			{
+				SDL_GpuINTERNAL_AddRenderGraphDependency(pass, resource->lastWriter - 1, SDL_TRUE);
+			}
+
+			if (resource->readerCount == resource->readerCapacity)
+			{
+				resource->readerCapacity = SDL_max(resource->readerCapacity * 2, 8);
+				resource->readers = (Uint32*) SDL_realloc(
+					resource->readers,
+					sizeof(Uint32) * resource->readerCapacity
+				);
+			}
+
+			resource->readers[resource->readerCount] = i;
+			resource->readerCount += 1;
+		}
+
+		for (j = 0; j < pass->accessCount; j += 1)
+		{
+			RenderGraphResource *resource = &graph->resources[pass->accesses[j].resource];
+
+			if (!pass->accesses[j].write)
+			{
+				continue;
+			}
+
+			if (resource->lastWriter != 0 && resource->lastWriter - 1 != i)
+			{
+				SDL_GpuINTERNAL_AddRenderGraphDependency(pass, resource->lastWriter - 1, SDL_FALSE);
+			}
+
+			for (k = 0; k < resource->readerCount; k += 1)
+			{
+				if (resource->readers[k] != i)
+				{
+					SDL_GpuINTERNAL_AddRenderGraphDependency(pass, resource->readers[k], SDL_FALSE);
+				}
+			}
+
+			resource->lastWriter = i + 1;
+			resource->readerCount = 0;
+		}
+	}
+}
+
+static void SDL_GpuINTERNAL_CullRenderGraphPasses(SDL_GpuRenderGraph *graph)
+{
+	Uint32 i, j;
+
+	/* Dependencies always point to earlier passes, so one backwards sweep is enough */
+	for (i = graph->passCount; i > 0; i -= 1)
+	{
+		RenderGraphPass *pass = &graph->passes[i - 1];
+
+		if (pass->flags & SDL_GPU_RENDERGRAPHPASS_NEVER_CULL_BIT)
+		{
+			pass->live = SDL_TRUE;
+		}
+
+		for (j = 0; j < pass->accessCount && !pass->live; j += 1)
+		{
+			if (	pass->accesses[j].write &&
+				graph->resources[pass->accesses[j].resource].imported	)
+			{
+				pass->live = SDL_TRUE;
+			}
+		}
+
+		if (!pass->live)
+		{
+			continue;
+		}
+
+		for (j = 0; j < pass->dependencyCount; j += 1)
+		{
+			if (pass->dependencies[j].producer)
+			{
+				graph->passes[pass->dependencies[j].pass].live = SDL_TRUE;
+			}
+		}
+	}
+}
+
+static Uint32 SDL_GpuINTERNAL_GetRenderGraphQueueSlot(SDL_GpuCommandQueue queue)
+{
+	Uint32 i;
+
+	for (i = 0; i < RENDERGRAPH_QUEUE_COUNT; i += 1)
+	{
+		if (RenderGraphSubmitOrder[i] == queue)
+		{
+			return i;
+		}
+	}
+
+	return RENDERGRAPH_QUEUE_COUNT - 1;
+}
+
+static void SDL_GpuINTERNAL_AssignRenderGraphQueues(SDL_GpuRenderGraph *graph)
+{
+	Uint32 transferSlot = SDL_GpuINTERNAL_GetRenderGraphQueueSlot(SDL_GPU_COMMANDQUEUE_TRANSFER);
+	Uint32 computeSlot = SDL_GpuINTERNAL_GetRenderGraphQueueSlot(SDL_GPU_COMMANDQUEUE_COMPUTE);
+	Uint32 latestSlot;
+	SDL_bool asyncAllowed;
+	Uint32 i, j;
+
+	for (i = 0; i < graph->passCount; i += 1)
+	{
+		RenderGraphPass *pass = &graph->passes[i];
+
+		pass->queue = SDL_GPU_COMMANDQUEUE_GRAPHICS;
+
+		if (	!pass->live ||
+			pass->type == SDL_GPU_PASSTYPE_RENDER ||
+			!(pass->flags & SDL_GPU_RENDERGRAPHPASS_ALLOW_ASYNC_BIT)	)
+		{
+			continue;
+		}
+
+		/* Graph-owned resources are transient, so they must stay in the graphics command buffer */
+		asyncAllowed = SDL_TRUE;
+		for (j = 0; j < pass->accessCount; j += 1)
+		{
+			if (!graph->resources[pass->accesses[j].resource].imported)
+			{
+				asyncAllowed = SDL_FALSE;
+				break;
+			}
+		}
+
+		if (!asyncAllowed)
+		{
+			continue;
+		}
+
+		latestSlot = transferSlot;
+		for (j = 0; j < pass->dependencyCount; j += 1)
+		{
+			RenderGraphPass *dependency = &graph->passes[pass->dependencies[j].pass];
+
+			if (dependency->live)
+			{
+				latestSlot = SDL_max(
+					latestSlot,
+					SDL_GpuINTERNAL_GetRenderGraphQueueSlot(dependency->queue)
+				);
+			}
+		}
+
+		if (pass->type == SDL_GPU_PASSTYPE_COPY && latestSlot <= transferSlot)
+		{
+			pass->queue = SDL_GPU_COMMANDQUEUE_TRANSFER;
+		}
+		else if (latestSlot <= computeSlot)
+		{
+			pass->queue = SDL_GPU_COMMANDQUEUE_COMPUTE;
+		}
+	}
+}
+
+static SDL_bool SDL_GpuINTERNAL_IsRenderGraphPassReady(
+	SDL_GpuRenderGraph *graph,
+	RenderGraphPass *pass
+) {
+	Uint32 i;
+
+	if (pass->scheduled)
+	{
+		return SDL_FALSE;
+	}
+
+	/* Dependencies on earlier queues are satisfied by submission order */
+	for (i = 0; i < pass->dependencyCount; i += 1)
+	{
+		RenderGraphPass *dependency = &graph->passes[pass->dependencies[i].pass];
+
+		if (	dependency->live &&
+			dependency->queue == pass->queue &&
+			!dependency->scheduled	)
+		{
+			return SDL_FALSE;
+		}
+	}
+
+	return SDL_TRUE;
+}
+
+static void SDL_GpuINTERNAL_ScheduleRenderGraphPasses(SDL_GpuRenderGraph *graph)
+{
+	Uint32 scheduleCount = 0;
+	Uint32 queueCount, scheduled;
+	Uint32 next;
+	Uint32 slot, i;
+
+	if (graph->passCount > graph->scheduleCapacity)
+	{
+		graph->scheduleCapacity = graph->passCount;
+		graph->schedule = (Uint32*) SDL_realloc(
+			graph->schedule,
+			sizeof(Uint32) * graph->scheduleCapacity
+		);
+	}
+
+	for (slot = 0; slot < RENDERGRAPH_QUEUE_COUNT; slot += 1)
+	{
+		queueCount = 0;
+		for (i = 0; i < graph->passCount; i += 1)
+		{
+			if (graph->passes[i].live && graph->passes[i].queue == RenderGraphSubmitOrder[slot])
+			{
+				queueCount += 1;
+			}
+		}
+
+		for (scheduled = 0; scheduled < queueCount; scheduled += 1)
+		{
+			/* Declaration order is always valid, but ready copy passes go first so they can merge */
+			next = graph->passCount;
+			for (i = 0; i < graph->passCount; i += 1)
+			{
+				RenderGraphPass *pass = &graph->passes[i];
+
+				if (	!pass->live ||
+					pass->queue != RenderGraphSubmitOrder[slot] ||
+					!SDL_GpuINTERNAL_IsRenderGraphPassReady(graph, pass)	)
+				{
+					continue;
+				}
+
+				if (next == graph->passCount)
+				{
+					next = i;
+				}
+
+				if (pass->type == SDL_GPU_PASSTYPE_COPY)
+				{
+					next = i;
+					break;
+				}
+			}
+
+			graph->passes[next].scheduled = SDL_TRUE;
+			graph->schedule[scheduleCount] = next;
+			scheduleCount += 1;
+		}
+
+		graph->scheduleCounts[slot] = queueCount;
+	}
+}
+
+static void SDL_GpuINTERNAL_ComputeRenderGraphLifetimes(
+	SDL_GpuRenderGraph *graph,
+	Uint32 *graphicsSchedule,
+	Uint32 graphicsCount
+) {
+	Uint32 position, i;
+
+	for (position = 0; position < graphicsCount; position += 1)
+	{
+		RenderGraphPass *pass = &graph->passes[graphicsSchedule[position]];
+
+		for (i = 0; i < pass->accessCount; i += 1)
+		{
+			RenderGraphResource *resource = &graph->resources[pass->accesses[i].resource];
+
+			if (resource->imported)
+			{
+				continue;
+			}
+
+			if (!resource->used)
+			{
+				resource->used = SDL_TRUE;
+				resource->firstUse = position;
+			}
+			resource->lastUse = position;
+		}
+	}
+}
+
+/* Pool */
+
+static SDL_bool SDL_GpuINTERNAL_PoolEntryMatches(
+	RenderGraphPoolEntry *entry,
+	RenderGraphResource *resource
+) {
+	if (entry->type != resource->type)
+	{
+		return SDL_FALSE;
+	}
+
+	if (entry->assigned && entry->availableAfter >= resource->firstUse)
+	{
+		return SDL_FALSE;
+	}
+
+	if (resource->type == RENDERGRAPH_RESOURCE_TEXTURE)
+	{
+		return SDL_memcmp(
+			&entry->textureCreateInfo,
+			&resource->textureCreateInfo,
+			sizeof(SDL_GpuTextureCreateInfo)
+		) == 0;
+	}
+
+	return (
+		entry->bufferUsageFlags == resource->bufferUsageFlags &&
+		entry->bufferSizeInBytes == resource->bufferSizeInBytes
+	);
+}
+
+static SDL_bool SDL_GpuINTERNAL_AssignRenderGraphResource(
+	SDL_GpuRenderGraph *graph,
+	RenderGraphResource *resource
+) {
+	RenderGraphPoolEntry *entry = NULL;
+	Uint32 i;
+
+	for (i = 0; i < graph->poolCount; i += 1)
+	{
+		if (SDL_GpuINTERNAL_PoolEntryMatches(&graph->pool[i], resource))
+		{
+			entry = &graph->pool[i];
+			break;
+		}
+	}
+
+	if (entry == NULL)
+	{
+		if (graph->poolCount == graph->poolCapacity)
+		{
+			graph->poolCapacity = SDL_max(graph->poolCapacity * 2, 16);
+			graph->pool = (RenderGraphPoolEntry*) SDL_realloc(
+				graph->pool,
+				sizeof(RenderGraphPoolEntry) * graph->poolCapacity
+			);
+		}
+
+		entry = &graph->pool[graph->poolCount];
+		SDL_zerop(entry);
+		entry->type = resource->type;
+		entry->textureCreateInfo = resource->textureCreateInfo;
+		entry->bufferUsageFlags = resource->bufferUsageFlags;
+		entry->bufferSizeInBytes = resource->bufferSizeInBytes;
+
+		if (resource->type == RENDERGRAPH_RESOURCE_TEXTURE)
+		{
+			entry->texture = SDL_GpuCreateTexture(graph->device, &entry->textureCreateInfo);
+			if (entry->texture == NULL)
+			{
+				SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create render graph texture!");
+				return SDL_FALSE;
+			}
+		}
+		else
+		{
+			entry->buffer = SDL_GpuCreateBuffer(
+				graph->device,
+				entry->bufferUsageFlags,
+				entry->bufferSizeInBytes
+			);
+			if (entry->buffer == NULL)
+			{
+				SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create render graph buffer!");
+				return SDL_FALSE;
+			}
+		}
+
+		graph->poolCount += 1;
+	}
+
+	entry->assigned = SDL_TRUE;
+	entry->availableAfter = resource->lastUse;
+	entry->idleFrames = 0;
+
+	resource->texture = entry->texture;
+	resource->buffer = entry->buffer;
+
+	return SDL_TRUE;
+}
+
+static SDL_bool SDL_GpuINTERNAL_AssignRenderGraphResources(
+	SDL_GpuRenderGraph *graph,
+	Uint32 *graphicsSchedule,
+	Uint32 graphicsCount
+) {
+	Uint32 position, i;
+
+	/* Assigning in order of first use lets each resource take over any that already ended */
+	for (position = 0; position < graphicsCount; position += 1)
+	{
+		RenderGraphPass *pass = &graph->passes[graphicsSchedule[position]];
+
+		for (i = 0; i < pass->accessCount; i += 1)
+		{
+			RenderGraphResource *resource = &graph->resources[pass->accesses[i].resource];
+
+			if (	resource->imported ||
+				resource->firstUse != position ||
+				resource->texture != NULL ||
+				resource->buffer != NULL	)
+			{
+				continue;
+			}
+
+			if (!SDL_GpuINTERNAL_AssignRenderGraphResource(graph, resource))
+			{
+				return SDL_FALSE;
+			}
+		}
+	}
+
+	return SDL_TRUE;
+}
+
+static void SDL_GpuINTERNAL_TrimRenderGraphPool(SDL_GpuRenderGraph *graph)
+{
+	Uint32 i = 0;
+
+	while (i < graph->poolCount)
+	{
+		RenderGraphPoolEntry *entry = &graph->pool[i];
+
+		if (!entry->assigned)
+		{
+			entry->idleFrames += 1;
+		}
+
+		if (entry->idleFrames > RENDERGRAPH_POOL_MAX_IDLE_FRAMES)
+		{
+			if (entry->texture != NULL)
+			{
+				SDL_GpuReleaseTexture(graph->device, entry->texture);
+			}
+			if (entry->buffer != NULL)
+			{
+				SDL_GpuReleaseBuffer(graph->device, entry->buffer);
+			}
+
+			graph->poolCount -= 1;
+			graph->pool[i] = graph->pool[graph->poolCount];
+		}
+		else
+		{
+			entry->assigned = SDL_FALSE;
+			i += 1;
+		}
+	}
+}
+
+/* Recording */
+
+static void SDL_GpuINTERNAL_RecordRenderGraphPass(
+	SDL_GpuRenderGraph *graph,
+	RenderGraphPass *pass,
+	SDL_GpuCommandBuffer *commandBuffer,
+	SDL_GpuCopyPass **pCopyPass
+) {
+	SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachment = NULL;
+	SDL_GpuRenderPass *renderPass;
+	SDL_GpuComputePass *computePass;
+	RenderGraphResource *resource;
+	Uint32 i;
+
+	if (pass->type != SDL_GPU_PASSTYPE_COPY && *pCopyPass != NULL)
+	{
+		SDL_GpuEndCopyPass(*pCopyPass);
+		*pCopyPass = NULL;
+	}
+
+	/* Only the first write of a frame may cycle, later ones would discard earlier passes' work */
+	if (pass->type == SDL_GPU_PASSTYPE_RENDER)
+	{
+		for (i = 0; i < pass->colorAttachmentCount; i += 1)
+		{
+			resource = &graph->resources[pass->colorAttachmentResources[i]];
+			pass->colorAttachments[i].textureSlice.texture = resource->texture;
+			pass->colorAttachments[i].cycle &= resource->imported && !resource->written;
+		}
+
+		if (pass->depthStencilResource != 0)
+		{
+			resource = &graph->resources[pass->depthStencilResource - 1];
+			depthStencilAttachment = &pass->depthStencilAttachment;
+			depthStencilAttachment->textureSlice.texture = resource->texture;
+			depthStencilAttachment->cycle &= resource->imported && !resource->written;
+		}
+
+		renderPass = SDL_GpuBeginRenderPass(
+			commandBuffer,
+			pass->colorAttachments,
+			pass->colorAttachmentCount,
+			depthStencilAttachment
+		);
+		pass->renderFunc(graph, renderPass, pass->userdata);
+		SDL_GpuEndRenderPass(renderPass);
+	}
+	else if (pass->type == SDL_GPU_PASSTYPE_COMPUTE)
+	{
+		for (i = 0; i < pass->storageTextureCount; i += 1)
+		{
+			resource = &graph->resources[pass->storageTextureResources[i]];
+			pass->storageTextures[i].textureSlice.texture = resource->texture;
+			pass->storageTextures[i].cycle &= resource->imported && !resource->written;
+		}
+
+		for (i = 0; i < pass->storageBufferCount; i += 1)
+		{
+			resource = &graph->resources[pass->storageBufferResources[i]];
+			pass->storageBuffers[i].buffer = resource->buffer;
+			pass->storageBuffers[i].cycle &= resource->imported && !resource->written;
+		}
+
+		computePass = SDL_GpuBeginComputePass(
+			commandBuffer,
+			pass->storageTextures,
+			pass->storageTextureCount,
+			pass->storageBuffers,
+			pass->storageBufferCount
+		);
+		pass->computeFunc(graph, computePass, pass->userdata);
+		SDL_GpuEndComputePass(computePass);
+	}
+	else
+	{
+		if (*pCopyPass == NULL)
+		{
+			*pCopyPass = SDL_GpuBeginCopyPass(commandBuffer);
+		}
+		pass->copyFunc(graph, *pCopyPass, pass->userdata);
+	}
+
+	for (i = 0; i < pass->accessCount; i += 1)
+	{
+		if (pass->accesses[i].write)
+		{
+			graph->resources[pass->accesses[i].resource].written = SDL_TRUE;
+		}
+	}
+}
+
+static void SDL_GpuINTERNAL_DiscardRenderGraphTextures(
+	SDL_GpuRenderGraph *graph,
+	RenderGraphPass *pass,
+	Uint32 position,
+	SDL_GpuCommandBuffer *commandBuffer,
+	SDL_GpuCopyPass **pCopyPass
+) {
+	Uint32 i;
+
+	for (i = 0; i < pass->accessCount; i += 1)
+	{
+		RenderGraphResource *resource = &graph->resources[pass->accesses[i].resource];
+
+		if (	resource->imported ||
+			resource->type != RENDERGRAPH_RESOURCE_TEXTURE ||
+			resource->lastUse != position ||
+			resource->texture == NULL	)
+		{
+			continue;
+		}
+
+		/* Discarding is not allowed inside a pass, so this ends any run of copies */
+		if (*pCopyPass != NULL)
+		{
+			SDL_GpuEndCopyPass(*pCopyPass);
+			*pCopyPass = NULL;
+		}
+
+		SDL_GpuDiscardTransientTexture(commandBuffer, resource->texture);
+
+		/* Nothing records with it after this, and a pass may access it more than once */
+		resource->texture = NULL;
+	}
+}
+
+static void SDL_GpuINTERNAL_ResetRenderGraph(SDL_GpuRenderGraph *graph)
+{
+	graph->resourceCount = 0;
+	graph->passCount = 0;
+}
+
+/* Public API */
+
+SDL_GpuRenderGraph* SDL_GpuCreateRenderGraph(SDL_GpuDevice *device)
+{
+	SDL_GpuRenderGraph *graph;
+
+	SDL_assert(device != NULL);
+
+	graph = (SDL_GpuRenderGraph*) SDL_calloc(1, sizeof(SDL_GpuRenderGraph));
+	graph->device = device;
+
+	return graph;
+}
+
+void SDL_GpuDestroyRenderGraph(SDL_GpuRenderGraph *graph)
+{
+	Uint32 i;
+
+	if (graph == NULL)
+	{
+		return;
+	}
+
+	for (i = 0; i < graph->poolCount; i += 1)
+	{
+		if (graph->pool[i].texture != NULL)
+		{
+			SDL_GpuReleaseTexture(graph->device, graph->pool[i].texture);
+		}
+		if (graph->pool[i].buffer != NULL)
+		{
+			SDL_GpuReleaseBuffer(graph->device, graph->pool[i].buffer);
+		}
+	}
+	SDL_free(graph->pool);
+
+	for (i = 0; i < graph->resourceCapacity; i += 1)
+	{
+		SDL_free(graph->resources[i].readers);
+	}
+	SDL_free(graph->resources);
+
+	for (i = 0; i < graph->passCapacity; i += 1)
+	{
+		SDL_free(graph->passes[i].accesses);
+		SDL_free(graph->passes[i].dependencies);
+	}
+	SDL_free(graph->passes);
+
+	SDL_free(graph->schedule);
+	SDL_free(graph);
+}
+
+SDL_GpuRenderGraphResource SDL_GpuImportRenderGraphTexture(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuTexture *texture
+) {
+	SDL_GpuRenderGraphResource handle;
+
+	SDL_assert(graph != NULL);
+
+	if (texture == NULL)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot import a NULL texture into a render graph!");
+		return 0;
+	}
+
+	handle = SDL_GpuINTERNAL_NewRenderGraphResource(graph, RENDERGRAPH_RESOURCE_TEXTURE, SDL_TRUE);
+	graph->resources[handle - 1].texture = texture;
+
+	return handle;
+}
+
+SDL_GpuRenderGraphResource SDL_GpuImportRenderGraphBuffer(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuBuffer *buffer
+) {
+	SDL_GpuRenderGraphResource handle;
+
+	SDL_assert(graph != NULL);
+
+	if (buffer == NULL)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot import a NULL buffer into a render graph!");
+		return 0;
+	}
+
+	handle = SDL_GpuINTERNAL_NewRenderGraphResource(graph, RENDERGRAPH_RESOURCE_BUFFER, SDL_TRUE);
+	graph->resources[handle - 1].buffer = buffer;
+
+	return handle;
+}
+
+SDL_GpuRenderGraphResource SDL_GpuCreateRenderGraphTexture(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuTextureCreateInfo *textureCreateInfo
+) {
+	SDL_GpuRenderGraphResource handle;
+	RenderGraphResource *resource;
+
+	SDL_assert(graph != NULL);
+	SDL_assert(textureCreateInfo != NULL);
+
+	handle = SDL_GpuINTERNAL_NewRenderGraphResource(graph, RENDERGRAPH_RESOURCE_TEXTURE, SDL_FALSE);
+	resource = &graph->resources[handle - 1];
+	resource->textureCreateInfo = *textureCreateInfo;
+	resource->textureCreateInfo.usageFlags |= SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT;
+
+	return handle;
+}
+
+SDL_GpuRenderGraphResource SDL_GpuCreateRenderGraphBuffer(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuBufferUsageFlags usageFlags,
+	Uint32 sizeInBytes
+) {
+	SDL_GpuRenderGraphResource handle;
+	RenderGraphResource *resource;
+
+	SDL_assert(graph != NULL);
+
+	if (sizeInBytes == 0)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Render graph buffer size must be greater than 0!");
+		return 0;
+	}
+
+	handle = SDL_GpuINTERNAL_NewRenderGraphResource(graph, RENDERGRAPH_RESOURCE_BUFFER, SDL_FALSE);
+	resource = &graph->resources[handle - 1];
+	resource->bufferUsageFlags = usageFlags;
+	resource->bufferSizeInBytes = sizeInBytes;
+
+	return handle;
+}
+
+SDL_GpuRenderGraphPass SDL_GpuAddRenderGraphRenderPass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphRenderFunc callback,
+	void *userdata,
+	SDL_GpuRenderGraphPassFlags flags
+) {
+	SDL_GpuRenderGraphPass handle;
+
+	SDL_assert(graph != NULL);
+	SDL_assert(callback != NULL);
+
+	handle = SDL_GpuINTERNAL_NewRenderGraphPass(graph, SDL_GPU_PASSTYPE_RENDER, flags, userdata);
+	graph->passes[handle - 1].renderFunc = callback;
+
+	return handle;
+}
+
+SDL_GpuRenderGraphPass SDL_GpuAddRenderGraphComputePass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphComputeFunc callback,
+	void *userdata,
+	SDL_GpuRenderGraphPassFlags flags
+) {
+	SDL_GpuRenderGraphPass handle;
+
+	SDL_assert(graph != NULL);
+	SDL_assert(callback != NULL);
+
+	handle = SDL_GpuINTERNAL_NewRenderGraphPass(graph, SDL_GPU_PASSTYPE_COMPUTE, flags, userdata);
+	graph->passes[handle - 1].computeFunc = callback;
+
+	return handle;
+}
+
+SDL_GpuRenderGraphPass SDL_GpuAddRenderGraphCopyPass(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphCopyFunc callback,
+	void *userdata,
+	SDL_GpuRenderGraphPassFlags flags
+) {
+	SDL_GpuRenderGraphPass handle;
+
+	SDL_assert(graph != NULL);
+	SDL_assert(callback != NULL);
+
+	handle = SDL_GpuINTERNAL_NewRenderGraphPass(graph, SDL_GPU_PASSTYPE_COPY, flags, userdata);
+	graph->passes[handle - 1].copyFunc = callback;
+
+	return handle;
+}
+
+void SDL_GpuAddRenderGraphColorAttachment(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource texture,
+	SDL_GpuColorAttachmentInfo *colorAttachmentInfo
+) {
+	RenderGraphPass *graphPass;
+	RenderGraphResource *resource;
+
+	SDL_assert(graph != NULL);
+	SDL_assert(colorAttachmentInfo != NULL);
+
+	graphPass = SDL_GpuINTERNAL_FetchRenderGraphPass(graph, pass);
+	resource = SDL_GpuINTERNAL_FetchRenderGraphResource(graph, texture);
+	if (graphPass == NULL || resource == NULL)
+	{
+		return;
+	}
+
+	if (graphPass->type != SDL_GPU_PASSTYPE_RENDER || resource->type != RENDERGRAPH_RESOURCE_TEXTURE)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Color attachments need a render pass and a texture!");
+		return;
+	}
+
+	if (graphPass->colorAttachmentCount == MAX_COLOR_TARGET_BINDINGS)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Render pass has too many color attachments!");
+		return;
+	}
+
+	graphPass->colorAttachments[graphPass->colorAttachmentCount] = *colorAttachmentInfo;
+	graphPass->colorAttachmentResources[graphPass->colorAttachmentCount] = texture - 1;
+	graphPass->colorAttachmentCount += 1;
+
+	if (colorAttachmentInfo->loadOp == SDL_GPU_LOADOP_LOAD)
+	{
+		SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, texture - 1, SDL_FALSE);
+	}
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, texture - 1, SDL_TRUE);
+}
+
+void SDL_GpuSetRenderGraphDepthStencilAttachment(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource texture,
+	SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+) {
+	RenderGraphPass *graphPass;
+	RenderGraphResource *resource;
+
+	SDL_assert(graph != NULL);
+	SDL_assert(depthStencilAttachmentInfo != NULL);
+
+	graphPass = SDL_GpuINTERNAL_FetchRenderGraphPass(graph, pass);
+	resource = SDL_GpuINTERNAL_FetchRenderGraphResource(graph, texture);
+	if (graphPass == NULL || resource == NULL)
+	{
+		return;
+	}
+
+	if (graphPass->type != SDL_GPU_PASSTYPE_RENDER || resource->type != RENDERGRAPH_RESOURCE_TEXTURE)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Depth stencil attachments need a render pass and a texture!");
+		return;
+	}
+
+	if (graphPass->depthStencilResource != 0)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Render pass already has a depth stencil attachment!");
+		return;
+	}
+
+	graphPass->depthStencilAttachment = *depthStencilAttachmentInfo;
+	graphPass->depthStencilResource = texture;
+
+	if (	depthStencilAttachmentInfo->loadOp == SDL_GPU_LOADOP_LOAD ||
+		depthStencilAttachmentInfo->stencilLoadOp == SDL_GPU_LOADOP_LOAD	)
+	{
+		SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, texture - 1, SDL_FALSE);
+	}
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, texture - 1, SDL_TRUE);
+}
+
+void SDL_GpuAddRenderGraphStorageTextureWrite(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource texture,
+	Uint32 mipLevel,
+	Uint32 layer,
+	SDL_bool cycle
+) {
+	RenderGraphPass *graphPass;
+	RenderGraphResource *resource;
+	SDL_GpuStorageTextureReadWriteBinding *binding;
+
+	SDL_assert(graph != NULL);
+
+	graphPass = SDL_GpuINTERNAL_FetchRenderGraphPass(graph, pass);
+	resource = SDL_GpuINTERNAL_FetchRenderGraphResource(graph, texture);
+	if (graphPass == NULL || resource == NULL)
+	{
+		return;
+	}
+
+	if (graphPass->type != SDL_GPU_PASSTYPE_COMPUTE || resource->type != RENDERGRAPH_RESOURCE_TEXTURE)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Storage texture writes need a compute pass and a texture!");
+		return;
+	}
+
+	if (graphPass->storageTextureCount == MAX_STORAGE_TEXTURES_PER_STAGE)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Compute pass has too many storage texture writes!");
+		return;
+	}
+
+	binding = &graphPass->storageTextures[graphPass->storageTextureCount];
+	binding->textureSlice.texture = NULL;
+	binding->textureSlice.mipLevel = mipLevel;
+	binding->textureSlice.layer = layer;
+	binding->cycle = cycle;
+	graphPass->storageTextureResources[graphPass->storageTextureCount] = texture - 1;
+	graphPass->storageTextureCount += 1;
+
+	/* A read-write binding may read what was there before */
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, texture - 1, SDL_FALSE);
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, texture - 1, SDL_TRUE);
+}
+
+void SDL_GpuAddRenderGraphStorageBufferWrite(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource buffer,
+	SDL_bool cycle
+) {
+	RenderGraphPass *graphPass;
+	RenderGraphResource *resource;
+	SDL_GpuStorageBufferReadWriteBinding *binding;
+
+	SDL_assert(graph != NULL);
+
+	graphPass = SDL_GpuINTERNAL_FetchRenderGraphPass(graph, pass);
+	resource = SDL_GpuINTERNAL_FetchRenderGraphResource(graph, buffer);
+	if (graphPass == NULL || resource == NULL)
+	{
+		return;
+	}
+
+	if (graphPass->type != SDL_GPU_PASSTYPE_COMPUTE || resource->type != RENDERGRAPH_RESOURCE_BUFFER)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Storage buffer writes need a compute pass and a buffer!");
+		return;
+	}
+
+	if (graphPass->storageBufferCount == MAX_STORAGE_BUFFERS_PER_STAGE)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Compute pass has too many storage buffer writes!");
+		return;
+	}
+
+	binding = &graphPass->storageBuffers[graphPass->storageBufferCount];
+	binding->buffer = NULL;
+	binding->cycle = cycle;
+	graphPass->storageBufferResources[graphPass->storageBufferCount] = buffer - 1;
+	graphPass->storageBufferCount += 1;
+
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, buffer - 1, SDL_FALSE);
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, buffer - 1, SDL_TRUE);
+}
+
+void SDL_GpuReadRenderGraphResource(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource resource
+) {
+	RenderGraphPass *graphPass;
+
+	SDL_assert(graph != NULL);
+
+	graphPass = SDL_GpuINTERNAL_FetchRenderGraphPass(graph, pass);
+	if (graphPass == NULL || SDL_GpuINTERNAL_FetchRenderGraphResource(graph, resource) == NULL)
+	{
+		return;
+	}
+
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, resource - 1, SDL_FALSE);
+}
+
+void SDL_GpuWriteRenderGraphResource(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphPass pass,
+	SDL_GpuRenderGraphResource resource
+) {
+	RenderGraphPass *graphPass;
+
+	SDL_assert(graph != NULL);
+
+	graphPass = SDL_GpuINTERNAL_FetchRenderGraphPass(graph, pass);
+	if (graphPass == NULL || SDL_GpuINTERNAL_FetchRenderGraphResource(graph, resource) == NULL)
+	{
+		return;
+	}
+
+	SDL_GpuINTERNAL_AddRenderGraphAccess(graphPass, resource - 1, SDL_TRUE);
+}
+
+SDL_GpuTexture* SDL_GpuGetRenderGraphTexture(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphResource texture
+) {
+	RenderGraphResource *resource;
+
+	SDL_assert(graph != NULL);
+
+	resource = SDL_GpuINTERNAL_FetchRenderGraphResource(graph, texture);
+	if (resource == NULL)
+	{
+		return NULL;
+	}
+
+	return resource->texture;
+}
+
+SDL_GpuBuffer* SDL_GpuGetRenderGraphBuffer(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuRenderGraphResource buffer
+) {
+	RenderGraphResource *resource;
+
+	SDL_assert(graph != NULL);
+
+	resource = SDL_GpuINTERNAL_FetchRenderGraphResource(graph, buffer);
+	if (resource == NULL)
+	{
+		return NULL;
+	}
+
+	return resource->buffer;
+}
+
+Uint32 SDL_GpuExecuteRenderGraph(
+	SDL_GpuRenderGraph *graph,
+	SDL_GpuCommandBuffer *commandBuffer
+) {
+	SDL_GpuCommandBuffer *queueCommandBuffer;
+	SDL_GpuCopyPass *copyPass;
+	Uint32 *graphicsSchedule;
+	Uint32 graphicsSlot = SDL_GpuINTERNAL_GetRenderGraphQueueSlot(SDL_GPU_COMMANDQUEUE_GRAPHICS);
+	Uint32 scheduleStart = 0;
+	Uint32 passesRecorded = 0;
+	Uint32 slot, i;
+
+	SDL_assert(graph != NULL);
+	SDL_assert(commandBuffer != NULL);
+
+	if (graph->passCount == 0)
+	{
+		SDL_GpuINTERNAL_TrimRenderGraphPool(graph);
+		return 0;
+	}
+
+	SDL_GpuINTERNAL_BuildRenderGraphDependencies(graph);
+	SDL_GpuINTERNAL_CullRenderGraphPasses(graph);
+	SDL_GpuINTERNAL_AssignRenderGraphQueues(graph);
+	SDL_GpuINTERNAL_ScheduleRenderGraphPasses(graph);
+
+	for (slot = 0; slot < graphicsSlot; slot += 1)
+	{
+		scheduleStart += graph->scheduleCounts[slot];
+	}
+	graphicsSchedule = graph->schedule + scheduleStart;
+
+	SDL_GpuINTERNAL_ComputeRenderGraphLifetimes(graph, graphicsSchedule, graph->scheduleCounts[graphicsSlot]);
+
+	if (!SDL_GpuINTERNAL_AssignRenderGraphResources(graph, graphicsSchedule, graph->scheduleCounts[graphicsSlot]))
+	{
+		SDL_GpuINTERNAL_TrimRenderGraphPool(graph);
+		SDL_GpuINTERNAL_ResetRenderGraph(graph);
+		return 0;
+	}
+
+	scheduleStart = 0;
+	for (slot = 0; slot < RENDERGRAPH_QUEUE_COUNT; slot += 1)
+	{
+		if (graph->scheduleCounts[slot] == 0)
+		{
+			continue;
+		}
+
+		queueCommandBuffer = commandBuffer;
+		if (RenderGraphSubmitOrder[slot] != SDL_GPU_COMMANDQUEUE_GRAPHICS)
+		{
+			queueCommandBuffer = SDL_GpuAcquireCommandBufferForQueue(
+				graph->device,
+				RenderGraphSubmitOrder[slot]
+			);
+
+			/* Recording ahead of the graphics passes keeps every dependency intact */
+			if (queueCommandBuffer == NULL)
+			{
+				queueCommandBuffer = commandBuffer;
+			}
+		}
+
+		copyPass = NULL;
+		for (i = 0; i < graph->scheduleCounts[slot]; i += 1)
+		{
+			RenderGraphPass *pass = &graph->passes[graph->schedule[scheduleStart + i]];
+
+			SDL_GpuINTERNAL_RecordRenderGraphPass(graph, pass, queueCommandBuffer, &copyPass);
+
+			if (RenderGraphSubmitOrder[slot] == SDL_GPU_COMMANDQUEUE_GRAPHICS)
+			{
+				SDL_GpuINTERNAL_DiscardRenderGraphTextures(graph, pass, i, queueCommandBuffer, &copyPass);
+			}
+
+			passesRecorded += 1;
+		}
+
+		if (copyPass != NULL)
+		{
+			SDL_GpuEndCopyPass(copyPass);
+		}
+
+		if (queueCommandBuffer != commandBuffer)
+		{
+			SDL_GpuSubmit(queueCommandBuffer);
+		}
+
+		scheduleStart += graph->scheduleCounts[slot];
+	}
+
+	SDL_GpuINTERNAL_TrimRenderGraphPool(graph);
+	SDL_GpuINTERNAL_ResetRenderGraph(graph);
+
+	return passesRecorded;
+}
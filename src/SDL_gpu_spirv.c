@@ -35,9 +35,12 @@
 	SDL_SetError(#func " failed: %s", SDL_spvc_context_get_last_error_string(context))
 
 static void* spirvcross_dll = NULL;
+static SDL_SpinLock spirvcross_lock = 0;
+static SDL_TLSID spirvcross_context_tls = 0;
 
 typedef spvc_result (*pfn_spvc_context_create)(spvc_context *context);
 typedef void (*pfn_spvc_context_destroy)(spvc_context);
+typedef void (*pfn_spvc_context_release_allocations)(spvc_context);
 typedef spvc_result (*pfn_spvc_context_parse_spirv)(spvc_context, const SpvId*, size_t, spvc_parsed_ir*);
 typedef spvc_result (*pfn_spvc_context_create_compiler)(spvc_context, spvc_backend, spvc_parsed_ir, spvc_capture_mode, spvc_compiler*);
 typedef spvc_result (*pfn_spvc_compiler_create_compiler_options)(spvc_compiler, spvc_compiler_options*);
@@ -48,6 +51,7 @@ typedef const char *(*pfn_spvc_context_get_last_error_string)(spvc_context);
 
 static pfn_spvc_context_create SDL_spvc_context_create = NULL;
 static pfn_spvc_context_destroy SDL_spvc_context_destroy = NULL;
+static pfn_spvc_context_release_allocations SDL_spvc_context_release_allocations = NULL;
 static pfn_spvc_context_parse_spirv SDL_spvc_context_parse_spirv = NULL;
 static pfn_spvc_context_create_compiler SDL_spvc_context_create_compiler = NULL;
 static pfn_spvc_compiler_create_compiler_options SDL_spvc_compiler_create_compiler_options = NULL;
@@ -56,31 +60,322 @@ static pfn_spvc_compiler_install_compiler_options SDL_spvc_compiler_install_comp
 static pfn_spvc_compiler_compile SDL_spvc_compiler_compile = NULL;
 static pfn_spvc_context_get_last_error_string SDL_spvc_context_get_last_error_string = NULL;
 
-SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCreateInfo *createInfo)
+/* Translated Source Cache */
+
+/* Translation only depends on the backend, stage and SPIR-V, so the output
+ * is cached per device. Entries are keyed by the FNV-1a hash of all three,
+ * and a hit must also match the SPIR-V length and a second, unrelated hash
+ * of the same input, so a single hash collision cannot hand back another
+ * shader's source. If a directory has been set, entries are also written
+ * there as a SPIRVCacheFileHeader followed by the source, so that the next
+ * run can skip SPIRV-Cross entirely. D3D11 additionally caches the DXBC it
+ * compiles from this source, see SDL_GpuGetPipelineCacheData.
+ */
+
+#define NUM_SPIRV_CACHE_BUCKETS 251
+
+#define SPIRV_CACHE_MAGIC   0x43565053 /* "SPVC" */
+#define SPIRV_CACHE_VERSION 2
+
+typedef struct SPIRVCacheKey
 {
-	SDL_GpuShader *shader;
-	spvc_result result;
-	spvc_backend backend;
-	spvc_context context = NULL;
-	spvc_parsed_ir ir = NULL;
-	spvc_compiler compiler = NULL;
-	spvc_compiler_options options = NULL;
-	const char* translated = NULL;
+	Uint64 hash;
+	Uint64 checkHash;
+	Uint64 codeSize;
+} SPIRVCacheKey;
 
-	switch (SDL_GpuGetBackend(device))
+typedef struct SPIRVCacheEntry
+{
+	SPIRVCacheKey key;
+	char *source;
+} SPIRVCacheEntry;
+
+typedef struct SPIRVCacheBucket
+{
+	SPIRVCacheEntry *elements;
+	Uint32 count;
+	Uint32 capacity;
+} SPIRVCacheBucket;
+
+/* The source must be exactly sourceLength bytes and hash to sourceHash,
+ * so truncated, corrupt and stale files are all rejected.
+ */
+typedef struct SPIRVCacheFileHeader
+{
+	Uint32 magic;
+	Uint32 version;
+	SPIRVCacheKey key;
+	Uint64 sourceLength;
+	Uint64 sourceHash;
+} SPIRVCacheFileHeader;
+
+struct SDL_GpuSPIRVCache
+{
+	SDL_mutex *lock;
+	SPIRVCacheBucket buckets[NUM_SPIRV_CACHE_BUCKETS];
+	char *directory;
+};
+
+/* Word-at-a-time multiply-xorshift, so it shares no structure with FNV-1a */
+static Uint64 SDL_INTERNAL_CheckHashBytes(
+	const void *data,
+	size_t size,
+	Uint64 seed
+) {
+	const Uint8 *bytes = (const Uint8*) data;
+	Uint64 hash = seed ^ (size * 0x9E3779B97F4A7C15ULL);
+	Uint64 word;
+	size_t i;
+
+	for (i = 0; i < size; i += sizeof(Uint64))
 	{
-	case SDL_GPU_BACKEND_D3D11: backend = SPVC_BACKEND_HLSL; break;
-	case SDL_GPU_BACKEND_METAL: backend = SPVC_BACKEND_MSL; break;
-	default:
-		SDL_SetError("SDL_CreateShaderFromSPIRV: Unexpected SDL_GpuBackend");
-		return NULL;
+		word = 0;
+		SDL_memcpy(&word, bytes + i, SDL_min(sizeof(Uint64), size - i));
+
+		hash ^= word;
+		hash *= 0xBF58476D1CE4E5B9ULL;
+		hash ^= hash >> 31;
 	}
 
+	hash ^= hash >> 33;
+	hash *= 0x94D049BB133111EBULL;
+	hash ^= hash >> 29;
+
+	return hash;
+}
+
+SDL_GpuSPIRVCache* SDL_CreateSPIRVCache(void)
+{
+	SDL_GpuSPIRVCache *cache = (SDL_GpuSPIRVCache*) SDL_calloc(1, sizeof(SDL_GpuSPIRVCache));
+	cache->lock = SDL_CreateMutex();
+	return cache;
+}
+
+void SDL_DestroySPIRVCache(SDL_GpuSPIRVCache *cache)
+{
+	Uint32 i, j;
+
+	for (i = 0; i < NUM_SPIRV_CACHE_BUCKETS; i += 1)
+	{
+		for (j = 0; j < cache->buckets[i].count; j += 1)
+		{
+			SDL_free(cache->buckets[i].elements[j].source);
+		}
+		SDL_free(cache->buckets[i].elements);
+	}
+	SDL_free(cache->directory);
+	SDL_DestroyMutex(cache->lock);
+	SDL_free(cache);
+}
+
+void SDL_GpuSetShaderCacheDirectory(SDL_GpuDevice *device, const char *directory)
+{
+	SDL_GpuSPIRVCache *cache = device->spirvCache;
+
+	SDL_LockMutex(cache->lock);
+	SDL_free(cache->directory);
+	cache->directory = (directory != NULL) ? SDL_strdup(directory) : NULL;
+	SDL_UnlockMutex(cache->lock);
+}
+
+static const char* SDL_INTERNAL_LookupSPIRVCacheEntry(
+	SDL_GpuSPIRVCache *cache,
+	const SPIRVCacheKey *key
+) {
+	SPIRVCacheBucket *bucket = &cache->buckets[key->hash % NUM_SPIRV_CACHE_BUCKETS];
+	Uint32 i;
+
+	for (i = 0; i < bucket->count; i += 1)
+	{
+		const SPIRVCacheKey *e = &bucket->elements[i].key;
+		if (	key->hash == e->hash &&
+			key->checkHash == e->checkHash &&
+			key->codeSize == e->codeSize	)
+		{
+			return bucket->elements[i].source;
+		}
+	}
+
+	return NULL;
+}
+
+/* Entries are never removed, so the returned string lives as long as the cache */
+static const char* SDL_INTERNAL_AddSPIRVCacheEntry(
+	SDL_GpuSPIRVCache *cache,
+	const SPIRVCacheKey *key,
+	const char *source,
+	size_t length
+) {
+	SPIRVCacheBucket *bucket;
+	SPIRVCacheEntry *entry;
+	const char *existing;
+
+	existing = SDL_INTERNAL_LookupSPIRVCacheEntry(cache, key);
+	if (existing != NULL)
+	{
+		return existing;
+	}
+
+	bucket = &cache->buckets[key->hash % NUM_SPIRV_CACHE_BUCKETS];
+	if (bucket->count == bucket->capacity)
+	{
+		bucket->capacity = SDL_max(bucket->capacity * 2, 4);
+		bucket->elements = (SPIRVCacheEntry*) SDL_realloc(
+			bucket->elements,
+			sizeof(SPIRVCacheEntry) * bucket->capacity
+		);
+	}
+
+	entry = &bucket->elements[bucket->count];
+	entry->key = *key;
+	entry->source = (char*) SDL_malloc(length + 1);
+	SDL_memcpy(entry->source, source, length);
+	entry->source[length] = '\0';
+	bucket->count += 1;
+
+	return entry->source;
+}
+
+static void SDL_INTERNAL_GetSPIRVCachePath(
+	SDL_GpuSPIRVCache *cache,
+	const SPIRVCacheKey *key,
+	const char *extension,
+	char *path,
+	size_t pathSize
+) {
+	SDL_snprintf(
+		path,
+		pathSize,
+		"%s/%016" SDL_PRIx64 "%016" SDL_PRIx64 ".%s",
+		cache->directory,
+		key->hash,
+		key->checkHash,
+		extension
+	);
+}
+
+static const char* SDL_INTERNAL_FetchSPIRVCacheEntry(
+	SDL_GpuSPIRVCache *cache,
+	const SPIRVCacheKey *key,
+	const char *extension
+) {
+	const char *source;
+	char path[4096];
+	Uint8 *fileData;
+	size_t fileSize;
+	SPIRVCacheFileHeader header;
+	const char *fileSource;
+
+	SDL_LockMutex(cache->lock);
+
+	source = SDL_INTERNAL_LookupSPIRVCacheEntry(cache, key);
+
+	if (source == NULL && cache->directory != NULL)
+	{
+		SDL_INTERNAL_GetSPIRVCachePath(cache, key, extension, path, sizeof(path));
+
+		fileData = (Uint8*) SDL_LoadFile(path, &fileSize);
+		if (fileData != NULL)
+		{
+			/* Ignore anything truncated, corrupt or mismatched, it will just be rewritten */
+			if (fileSize >= sizeof(SPIRVCacheFileHeader))
+			{
+				SDL_memcpy(&header, fileData, sizeof(SPIRVCacheFileHeader));
+				fileSource = (const char*) fileData + sizeof(SPIRVCacheFileHeader);
+
+				if (	header.magic == SPIRV_CACHE_MAGIC &&
+					header.version == SPIRV_CACHE_VERSION &&
+					header.key.hash == key->hash &&
+					header.key.checkHash == key->checkHash &&
+					header.key.codeSize == key->codeSize &&
+					header.sourceLength == fileSize - sizeof(SPIRVCacheFileHeader) &&
+					header.sourceHash == HashBytes(fileSource, (size_t) header.sourceLength, HASH_SEED)	)
+				{
+					source = SDL_INTERNAL_AddSPIRVCacheEntry(
+						cache,
+						key,
+						fileSource,
+						(size_t) header.sourceLength
+					);
+				}
+				else
+				{
+					SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Shader cache file %s is stale or invalid, ignoring", path);
+				}
+			}
+			SDL_free(fileData);
+		}
+	}
+
+	SDL_UnlockMutex(cache->lock);
+
+	return source;
+}
+
+static const char* SDL_INTERNAL_StoreSPIRVCacheEntry(
+	SDL_GpuSPIRVCache *cache,
+	const SPIRVCacheKey *key,
+	const char *extension,
+	const char *translated
+) {
+	const char *source;
+	char path[4096];
+	SDL_RWops *file;
+	SPIRVCacheFileHeader header;
+	size_t length = SDL_strlen(translated);
+
+	SDL_LockMutex(cache->lock);
+
+	source = SDL_INTERNAL_AddSPIRVCacheEntry(cache, key, translated, length);
+
+	if (cache->directory != NULL)
+	{
+		SDL_INTERNAL_GetSPIRVCachePath(cache, key, extension, path, sizeof(path));
+
+		SDL_zero(header);
+		header.magic = SPIRV_CACHE_MAGIC;
+		header.version = SPIRV_CACHE_VERSION;
+		header.key = *key;
+		header.sourceLength = length;
+		header.sourceHash = HashBytes(translated, length, HASH_SEED);
+
+		file = SDL_RWFromFile(path, "wb");
+		if (file != NULL)
+		{
+			SDL_RWwrite(file, &header, sizeof(SPIRVCacheFileHeader), 1);
+			SDL_RWwrite(file, translated, length, 1);
+			SDL_RWclose(file);
+		}
+		else
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Could not write shader cache file %s: %s", path, SDL_GetError());
+		}
+	}
+
+	SDL_UnlockMutex(cache->lock);
+
+	return source;
+}
+
+/* SPIRV-Cross Loading */
+
+static void SDL_INTERNAL_DestroySPVCContext(void *context)
+{
+	SDL_spvc_context_destroy((spvc_context) context);
+}
+
+static SDL_bool SDL_INTERNAL_LoadSPIRVCross(void)
+{
+	SDL_bool success = SDL_FALSE;
+
+	/* This can be reached from several compile threads at once */
+	SDL_AtomicLock(&spirvcross_lock);
+
 	/* FIXME: spirv-cross could probably be loaded in a better spot */
 	if (spirvcross_dll == NULL) {
 		spirvcross_dll = SDL_LoadObject(SPIRV_CROSS_DLL);
 		if (spirvcross_dll == NULL) {
-			return NULL;
+			goto done;
 		}
 	}
 
@@ -88,11 +383,12 @@ SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCre
 		if (SDL_##func == NULL) { \
 			SDL_##func = (pfn_##func) SDL_LoadFunction(spirvcross_dll, #func); \
 			if (SDL_##func == NULL) { \
-				return NULL; \
+				goto done; \
 			} \
 		}
 	CHECK_FUNC(spvc_context_create)
 	CHECK_FUNC(spvc_context_destroy)
+	CHECK_FUNC(spvc_context_release_allocations)
 	CHECK_FUNC(spvc_context_parse_spirv)
 	CHECK_FUNC(spvc_context_create_compiler)
 	CHECK_FUNC(spvc_compiler_create_compiler_options)
@@ -102,10 +398,79 @@ SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCre
 	CHECK_FUNC(spvc_context_get_last_error_string)
 	#undef CHECK_FUNC
 
-	/* Create the SPIRV-Cross context */
-	result = SDL_spvc_context_create(&context);
-	if (result < 0) {
-		SDL_SetError("spvc_context_create failed: %X", result);
+	if (spirvcross_context_tls == 0) {
+		spirvcross_context_tls = SDL_TLSCreate();
+	}
+
+	success = SDL_TRUE;
+
+done:
+	SDL_AtomicUnlock(&spirvcross_lock);
+	return success;
+}
+
+/* Each thread keeps its own context, reset between shaders instead of recreated */
+static spvc_context SDL_INTERNAL_FetchSPVCContext(void)
+{
+	spvc_context context = (spvc_context) SDL_TLSGet(spirvcross_context_tls);
+	spvc_result result;
+
+	if (context == NULL) {
+		result = SDL_spvc_context_create(&context);
+		if (result < 0) {
+			SDL_SetError("spvc_context_create failed: %X", result);
+			return NULL;
+		}
+		SDL_TLSSet(spirvcross_context_tls, context, SDL_INTERNAL_DestroySPVCContext);
+	}
+
+	return context;
+}
+
+SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCreateInfo *createInfo)
+{
+	SDL_GpuShader *shader;
+	spvc_result result;
+	spvc_backend backend;
+	spvc_context context = NULL;
+	spvc_parsed_ir ir = NULL;
+	spvc_compiler compiler = NULL;
+	spvc_compiler_options options = NULL;
+	const char* translated = NULL;
+	const char* extension;
+	const char* source;
+	SPIRVCacheKey key;
+
+	switch (SDL_GpuGetBackend(device))
+	{
+	case SDL_GPU_BACKEND_D3D11: backend = SPVC_BACKEND_HLSL; extension = "hlsl"; break;
+	case SDL_GPU_BACKEND_METAL: backend = SPVC_BACKEND_MSL; extension = "msl"; break;
+	default:
+		SDL_SetError("SDL_CreateShaderFromSPIRV: Unexpected SDL_GpuBackend");
+		return NULL;
+	}
+
+	/* Check the cache before going anywhere near SPIRV-Cross */
+	key.hash = HashBytes(&backend, sizeof(backend), HASH_SEED);
+	key.hash = HashBytes(&createInfo->stage, sizeof(createInfo->stage), key.hash);
+	key.hash = HashBytes(createInfo->code, createInfo->codeSize, key.hash);
+	key.checkHash = SDL_INTERNAL_CheckHashBytes(&backend, sizeof(backend), 0);
+	key.checkHash = SDL_INTERNAL_CheckHashBytes(&createInfo->stage, sizeof(createInfo->stage), key.checkHash);
+	key.checkHash = SDL_INTERNAL_CheckHashBytes(createInfo->code, createInfo->codeSize, key.checkHash);
+	key.codeSize = createInfo->codeSize;
+
+	source = SDL_INTERNAL_FetchSPIRVCacheEntry(device->spirvCache, &key, extension);
+	if (source != NULL) {
+		return device->CompileFromSPIRVCross(device->driverData, createInfo->stage, createInfo->entryPointName, source);
+	}
+
+	if (!SDL_INTERNAL_LoadSPIRVCross()) {
+		return NULL;
+	}
+
+	/* Grab this thread's SPIRV-Cross context */
+	context = SDL_INTERNAL_FetchSPVCContext();
+	if (context == NULL) {
 		return NULL;
 	}
 
@@ -113,7 +478,7 @@ SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCre
 	result = SDL_spvc_context_parse_spirv(context, (const SpvId*) createInfo->code, createInfo->codeSize / sizeof(SpvId), &ir);
 	if (result < 0) {
 		SPVC_ERROR(spvc_context_parse_spirv);
-		SDL_spvc_context_destroy(context);
+		SDL_spvc_context_release_allocations(context);
 		return NULL;
 	}
 
@@ -121,7 +486,7 @@ SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCre
 	result = SDL_spvc_context_create_compiler(context, backend, ir, SPVC_CAPTURE_MODE_TAKE_OWNERSHIP, &compiler);
 	if (result < 0) {
 		SPVC_ERROR(spvc_context_create_compiler);
-		SDL_spvc_context_destroy(context);
+		SDL_spvc_context_release_allocations(context);
 		return NULL;
 	}
 
@@ -129,7 +494,7 @@ SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCre
 	result = SDL_spvc_compiler_create_compiler_options(compiler, &options);
 	if (result < 0) {
 		SPVC_ERROR(spvc_compiler_create_compiler_options);
-		SDL_spvc_context_destroy(context);
+		SDL_spvc_context_release_allocations(context);
 		return NULL;
 	}
 
@@ -141,7 +506,7 @@ SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCre
 	result = SDL_spvc_compiler_install_compiler_options(compiler, options);
 	if (result < 0) {
 		SPVC_ERROR(spvc_compiler_install_compiler_options);
-		SDL_spvc_context_destroy(context);
+		SDL_spvc_context_release_allocations(context);
 		return NULL;
 	}
 
@@ -149,15 +514,16 @@ SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device, SDL_GpuShaderCre
 	result = SDL_spvc_compiler_compile(compiler, &translated);
 	if (result < 0) {
 		SPVC_ERROR(spvc_compiler_compile);
-		SDL_spvc_context_destroy(context);
+		SDL_spvc_context_release_allocations(context);
 		return NULL;
 	}
 
-	/* Compile the shader */
-	shader = device->CompileFromSPIRVCross(device->driverData, createInfo->stage, createInfo->entryPointName, translated);
+	/* The translated string belongs to the context, so copy it into the cache first */
+	source = SDL_INTERNAL_StoreSPIRVCacheEntry(device->spirvCache, &key, extension, translated);
+	SDL_spvc_context_release_allocations(context);
 
-	/* Clean up */
-	SDL_spvc_context_destroy(context);
+	/* Compile the shader */
+	shader = device->CompileFromSPIRVCross(device->driverData, createInfo->stage, createInfo->entryPointName, source);
 
 	return shader;
 }
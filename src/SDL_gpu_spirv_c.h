@@ -22,3 +22,6 @@
 
 extern SDL_GpuShader* SDL_CreateShaderFromSPIRV(SDL_GpuDevice *device,
                                                 SDL_GpuShaderCreateInfo *createInfo);
+
+extern SDL_GpuSPIRVCache* SDL_CreateSPIRVCache(void);
+extern void SDL_DestroySPIRVCache(SDL_GpuSPIRVCache *cache);
@@ -0,0 +1,615 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "SDL_gpu_driver.h"
+
+/* The texture streamer sits entirely on top of the public copy pass API.
+ * Requests are copied into the streamer when they are queued, so any thread
+ * may queue them. Once per frame SDL_GpuSubmitTextureStreamer sorts what is
+ * pending, writes as much of it as the frame budget and the staging ring
+ * allow into one persistently mapped transfer buffer, and records all of it
+ * in a single copy pass on the transfer queue.
+ *
+ * The ring is reclaimed in submission order: each batch remembers how many
+ * bytes it consumed and gives them back once its fence has signaled.
+ *
+ * Submissions are serialized by their own lock, so the ring is only ever
+ * allocated by one thread. The request lock is only held while requests are
+ * taken out of the queue and batches are updated, never across a GPU call,
+ * so queueing from other threads does not wait on recording or fences.
+ */
+
+/* Satisfies the buffer offset alignment of every texel block size */
+#define STREAM_RING_ALIGNMENT 16
+
+typedef struct StreamRequest
+{
+	Uint64 ticket;
+	SDL_GpuTextureRegion textureRegion;
+	Uint8 *data;
+	Uint32 sizeInBytes;
+} StreamRequest;
+
+typedef struct StreamBatch
+{
+	SDL_GpuFence *fence; /* NULL while the batch is being recorded */
+	Uint32 waiterCount;  /* threads waiting on the fence, which keep it from being released */
+	Uint32 ringBytes; /* including any padding skipped at the end of the ring */
+	Uint64 *tickets;
+	Uint32 ticketCount;
+} StreamBatch;
+
+struct SDL_GpuTextureStreamer
+{
+	SDL_GpuDevice *device;
+
+	SDL_GpuTransferBuffer *stagingBuffer;
+	Uint8 *stagingData;
+	Uint32 stagingSize;
+	Uint32 ringHead;
+	Uint32 ringUsed;
+
+	Uint32 bytesPerFrame;
+
+	/* Held for the whole of SDL_GpuSubmitTextureStreamer, protects the ring head */
+	SDL_mutex *submitLock;
+
+	/* Everything below is protected by the lock */
+	SDL_mutex *lock;
+
+	StreamRequest *pending;
+	Uint32 pendingCount;
+	Uint32 pendingCapacity;
+
+	/* Oldest first */
+	StreamBatch *batches;
+	Uint32 batchCount;
+	Uint32 batchCapacity;
+
+	Uint64 nextTicket;
+};
+
+/* Ring */
+
+static Uint32 SDL_GpuINTERNAL_AlignStreamSize(Uint32 size)
+{
+	return (size + STREAM_RING_ALIGNMENT - 1) & ~(STREAM_RING_ALIGNMENT - 1);
+}
+
+static SDL_bool SDL_GpuINTERNAL_StreamRangeFits(
+	SDL_GpuTextureStreamer *streamer,
+	Uint32 sizeInBytes
+) {
+	Uint32 size = SDL_GpuINTERNAL_AlignStreamSize(sizeInBytes);
+	Uint32 head = (streamer->ringUsed == 0) ? 0 : streamer->ringHead;
+	Uint32 padding = 0;
+
+	if (head + size > streamer->stagingSize)
+	{
+		padding = streamer->stagingSize - head;
+	}
+
+	return streamer->ringUsed + padding + size <= streamer->stagingSize;
+}
+
+static SDL_bool SDL_GpuINTERNAL_AllocateStreamRange(
+	SDL_GpuTextureStreamer *streamer,
+	Uint32 sizeInBytes,
+	Uint32 *pOffset,
+	Uint32 *pRingBytes
+) {
+	Uint32 size = SDL_GpuINTERNAL_AlignStreamSize(sizeInBytes);
+	Uint32 padding = 0;
+
+	if (streamer->ringUsed == 0)
+	{
+		streamer->ringHead = 0;
+	}
+
+	if (streamer->ringHead + size > streamer->stagingSize)
+	{
+		/* Skip the tail of the ring so the range stays contiguous */
+		padding = streamer->stagingSize - streamer->ringHead;
+	}
+
+	if (streamer->ringUsed + padding + size > streamer->stagingSize)
+	{
+		return SDL_FALSE;
+	}
+
+	if (padding > 0)
+	{
+		streamer->ringHead = 0;
+	}
+
+	*pOffset = streamer->ringHead;
+	*pRingBytes = padding + size;
+
+	streamer->ringHead += size;
+	if (streamer->ringHead == streamer->stagingSize)
+	{
+		streamer->ringHead = 0;
+	}
+	streamer->ringUsed += padding + size;
+
+	return SDL_TRUE;
+}
+
+/* Batches */
+
+static void SDL_GpuINTERNAL_RetireStreamBatches(
+	SDL_GpuTextureStreamer *streamer,
+	SDL_bool wait
+) {
+	Uint32 retired = 0;
+	Uint32 i;
+
+	while (retired < streamer->batchCount)
+	{
+		StreamBatch *batch = &streamer->batches[retired];
+
+		/* Later batches cannot have freed ring space before this one */
+		if (batch->fence == NULL || (!wait && batch->waiterCount > 0))
+		{
+			break;
+		}
+
+		if (wait)
+		{
+			SDL_GpuWaitForFences(streamer->device, SDL_TRUE, 1, &batch->fence);
+		}
+		else if (!SDL_GpuQueryFence(streamer->device, batch->fence))
+		{
+			break;
+		}
+
+		SDL_GpuReleaseFence(streamer->device, batch->fence);
+		SDL_free(batch->tickets);
+		streamer->ringUsed -= batch->ringBytes;
+		retired += 1;
+	}
+
+	if (retired > 0)
+	{
+		streamer->batchCount -= retired;
+		for (i = 0; i < streamer->batchCount; i += 1)
+		{
+			streamer->batches[i] = streamer->batches[i + retired];
+		}
+	}
+}
+
+static StreamBatch* SDL_GpuINTERNAL_FindStreamBatch(
+	SDL_GpuTextureStreamer *streamer,
+	Uint64 ticket
+) {
+	Uint32 i, j;
+
+	for (i = 0; i < streamer->batchCount; i += 1)
+	{
+		for (j = 0; j < streamer->batches[i].ticketCount; j += 1)
+		{
+			if (streamer->batches[i].tickets[j] == ticket)
+			{
+				return &streamer->batches[i];
+			}
+		}
+	}
+
+	return NULL;
+}
+
+static SDL_bool SDL_GpuINTERNAL_IsStreamRequestPending(
+	SDL_GpuTextureStreamer *streamer,
+	Uint64 ticket
+) {
+	Uint32 i;
+
+	for (i = 0; i < streamer->pendingCount; i += 1)
+	{
+		if (streamer->pending[i].ticket == ticket)
+		{
+			return SDL_TRUE;
+		}
+	}
+
+	return SDL_FALSE;
+}
+
+/* Smallest mips first, so a texture becomes usable at low detail as early as
+ * possible, then in the order the requests were queued.
+ */
+static int SDLCALL SDL_GpuINTERNAL_CompareStreamRequests(const void *a, const void *b)
+{
+	const StreamRequest *left = (const StreamRequest*) a;
+	const StreamRequest *right = (const StreamRequest*) b;
+
+	if (left->textureRegion.textureSlice.mipLevel != right->textureRegion.textureSlice.mipLevel)
+	{
+		return left->textureRegion.textureSlice.mipLevel > right->textureRegion.textureSlice.mipLevel ? -1 : 1;
+	}
+
+	if (left->ticket != right->ticket)
+	{
+		return left->ticket < right->ticket ? -1 : 1;
+	}
+
+	return 0;
+}
+
+/* Public API */
+
+SDL_GpuTextureStreamer* SDL_GpuCreateTextureStreamer(
+	SDL_GpuDevice *device,
+	Uint32 stagingSizeInBytes,
+	Uint32 bytesPerFrame
+) {
+	SDL_GpuTextureStreamer *streamer;
+	void *mapped;
+
+	SDL_assert(device != NULL);
+
+	if (stagingSizeInBytes < STREAM_RING_ALIGNMENT)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Texture streamer staging size is too small!");
+		return NULL;
+	}
+
+	streamer = (SDL_GpuTextureStreamer*) SDL_calloc(1, sizeof(SDL_GpuTextureStreamer));
+	streamer->device = device;
+	streamer->stagingSize = stagingSizeInBytes & ~(STREAM_RING_ALIGNMENT - 1);
+	streamer->bytesPerFrame = bytesPerFrame;
+	streamer->nextTicket = 1;
+
+	streamer->stagingBuffer = SDL_GpuCreateTransferBuffer(
+		device,
+		SDL_GPU_TRANSFERUSAGE_TEXTURE,
+		SDL_GPU_TRANSFER_MAP_WRITE | SDL_GPU_TRANSFER_MAP_PERSISTENT,
+		streamer->stagingSize
+	);
+	if (streamer->stagingBuffer == NULL)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create texture streamer staging buffer!");
+		SDL_free(streamer);
+		return NULL;
+	}
+
+	SDL_GpuMapTransferBuffer(device, streamer->stagingBuffer, SDL_FALSE, &mapped);
+	streamer->stagingData = (Uint8*) mapped;
+	if (streamer->stagingData == NULL)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to map texture streamer staging buffer!");
+		SDL_GpuReleaseTransferBuffer(device, streamer->stagingBuffer);
+		SDL_free(streamer);
+		return NULL;
+	}
+
+	streamer->submitLock = SDL_CreateMutex();
+	streamer->lock = SDL_CreateMutex();
+
+	return streamer;
+}
+
+void SDL_GpuDestroyTextureStreamer(SDL_GpuTextureStreamer *streamer)
+{
+	Uint32 i;
+
+	if (streamer == NULL)
+	{
+		return;
+	}
+
+	SDL_GpuINTERNAL_RetireStreamBatches(streamer, SDL_TRUE);
+
+	for (i = 0; i < streamer->pendingCount; i += 1)
+	{
+		SDL_free(streamer->pending[i].data);
+	}
+	SDL_free(streamer->pending);
+	SDL_free(streamer->batches);
+
+	SDL_GpuUnmapTransferBuffer(streamer->device, streamer->stagingBuffer);
+	SDL_GpuReleaseTransferBuffer(streamer->device, streamer->stagingBuffer);
+
+	SDL_DestroyMutex(streamer->submitLock);
+	SDL_DestroyMutex(streamer->lock);
+	SDL_free(streamer);
+}
+
+Uint64 SDL_GpuQueueTextureUpload(
+	SDL_GpuTextureStreamer *streamer,
+	SDL_GpuTextureRegion *textureRegion,
+	const void *data,
+	Uint32 sizeInBytes
+) {
+	StreamRequest *request;
+	Uint64 ticket;
+
+	SDL_assert(streamer != NULL);
+	SDL_assert(textureRegion != NULL);
+	SDL_assert(data != NULL);
+
+	if (sizeInBytes == 0)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Texture upload has no data!");
+		return 0;
+	}
+
+	if (SDL_GpuINTERNAL_AlignStreamSize(sizeInBytes) > streamer->stagingSize)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Texture upload is larger than the streamer staging ring!");
+		return 0;
+	}
+
+	SDL_LockMutex(streamer->lock);
+
+	if (streamer->pendingCount == streamer->pendingCapacity)
+	{
+		streamer->pendingCapacity = SDL_max(streamer->pendingCapacity * 2, 16);
+		streamer->pending = (StreamRequest*) SDL_realloc(
+			streamer->pending,
+			sizeof(StreamRequest) * streamer->pendingCapacity
+		);
+	}
+
+	ticket = streamer->nextTicket;
+	streamer->nextTicket += 1;
+
+	request = &streamer->pending[streamer->pendingCount];
+	request->ticket = ticket;
+	request->textureRegion = *textureRegion;
+	request->data = (Uint8*) SDL_malloc(sizeInBytes);
+	request->sizeInBytes = sizeInBytes;
+	SDL_memcpy(request->data, data, sizeInBytes);
+	streamer->pendingCount += 1;
+
+	SDL_UnlockMutex(streamer->lock);
+
+	return ticket;
+}
+
+Uint32 SDL_GpuSubmitTextureStreamer(SDL_GpuTextureStreamer *streamer)
+{
+	SDL_GpuCommandBuffer *commandBuffer;
+	SDL_GpuCopyPass *copyPass;
+	SDL_GpuBufferImageCopy copyParams;
+	StreamRequest *requests;
+	Uint32 *offsets;
+	StreamBatch *batch;
+	Uint64 *tickets;
+	Uint32 frameBytes = 0;
+	Uint32 batchRingBytes = 0;
+	Uint32 uploadCount = 0;
+	Uint32 ringBytes;
+	Uint32 i;
+
+	SDL_assert(streamer != NULL);
+
+	SDL_LockMutex(streamer->submitLock);
+	SDL_LockMutex(streamer->lock);
+
+	SDL_GpuINTERNAL_RetireStreamBatches(streamer, SDL_FALSE);
+
+	if (streamer->pendingCount == 0)
+	{
+		SDL_UnlockMutex(streamer->lock);
+		SDL_UnlockMutex(streamer->submitLock);
+		return 0;
+	}
+
+	SDL_qsort(
+		streamer->pending,
+		streamer->pendingCount,
+		sizeof(StreamRequest),
+		SDL_GpuINTERNAL_CompareStreamRequests
+	);
+
+	/* The budget always admits the first request, so only the ring can hold everything back */
+	if (!SDL_GpuINTERNAL_StreamRangeFits(streamer, streamer->pending[0].sizeInBytes))
+	{
+		/* The ring is full of in-flight data, try again next frame */
+		SDL_UnlockMutex(streamer->lock);
+		SDL_UnlockMutex(streamer->submitLock);
+		return 0;
+	}
+
+	SDL_UnlockMutex(streamer->lock);
+
+	commandBuffer = SDL_GpuAcquireCommandBufferForQueue(
+		streamer->device,
+		SDL_GPU_COMMANDQUEUE_TRANSFER
+	);
+	if (commandBuffer == NULL)
+	{
+		SDL_UnlockMutex(streamer->submitLock);
+		return 0;
+	}
+
+	/* New requests only ever go to the back of the queue and only this thread
+	 * allocates from the ring, so the first request still fits.
+	 */
+	SDL_LockMutex(streamer->lock);
+
+	requests = (StreamRequest*) SDL_malloc(sizeof(StreamRequest) * streamer->pendingCount);
+	offsets = (Uint32*) SDL_malloc(sizeof(Uint32) * streamer->pendingCount);
+	tickets = (Uint64*) SDL_malloc(sizeof(Uint64) * streamer->pendingCount);
+
+	for (i = 0; i < streamer->pendingCount; i += 1)
+	{
+		StreamRequest *request = &streamer->pending[i];
+
+		/* The first request always fits, so an oversized one cannot stall the queue */
+		if (	uploadCount > 0 &&
+			streamer->bytesPerFrame > 0 &&
+			frameBytes + request->sizeInBytes > streamer->bytesPerFrame	)
+		{
+			break;
+		}
+
+		if (!SDL_GpuINTERNAL_AllocateStreamRange(streamer, request->sizeInBytes, &offsets[uploadCount], &ringBytes))
+		{
+			break;
+		}
+
+		requests[uploadCount] = *request;
+		tickets[uploadCount] = request->ticket;
+		frameBytes += request->sizeInBytes;
+		batchRingBytes += ringBytes;
+		uploadCount += 1;
+	}
+
+	streamer->pendingCount -= uploadCount;
+	SDL_memmove(
+		streamer->pending,
+		streamer->pending + uploadCount,
+		sizeof(StreamRequest) * streamer->pendingCount
+	);
+
+	if (streamer->batchCount == streamer->batchCapacity)
+	{
+		streamer->batchCapacity = SDL_max(streamer->batchCapacity * 2, 4);
+		streamer->batches = (StreamBatch*) SDL_realloc(
+			streamer->batches,
+			sizeof(StreamBatch) * streamer->batchCapacity
+		);
+	}
+
+	/* Published without a fence so the uploads do not look complete while recording */
+	batch = &streamer->batches[streamer->batchCount];
+	batch->fence = NULL;
+	batch->waiterCount = 0;
+	batch->ringBytes = batchRingBytes;
+	batch->tickets = tickets;
+	batch->ticketCount = uploadCount;
+	streamer->batchCount += 1;
+
+	SDL_UnlockMutex(streamer->lock);
+
+	copyPass = SDL_GpuBeginCopyPass(commandBuffer);
+
+	copyParams.bufferStride = 0;
+	copyParams.bufferImageHeight = 0;
+
+	for (i = 0; i < uploadCount; i += 1)
+	{
+		SDL_memcpy(streamer->stagingData + offsets[i], requests[i].data, requests[i].sizeInBytes);
+		SDL_GpuFlushTransferBuffer(streamer->device, streamer->stagingBuffer, offsets[i], requests[i].sizeInBytes);
+
+		copyParams.bufferOffset = offsets[i];
+		SDL_GpuUploadToTexture(
+			copyPass,
+			streamer->stagingBuffer,
+			&requests[i].textureRegion,
+			&copyParams,
+			SDL_FALSE
+		);
+
+		SDL_free(requests[i].data);
+	}
+
+	SDL_GpuEndCopyPass(copyPass);
+
+	SDL_free(requests);
+	SDL_free(offsets);
+
+	/* Batches are only retired once fenced, so ours is still the newest */
+	SDL_LockMutex(streamer->lock);
+	streamer->batches[streamer->batchCount - 1].fence = SDL_GpuSubmitAndAcquireFence(commandBuffer);
+	SDL_UnlockMutex(streamer->lock);
+
+	SDL_UnlockMutex(streamer->submitLock);
+
+	return uploadCount;
+}
+
+SDL_bool SDL_GpuQueryTextureUpload(
+	SDL_GpuTextureStreamer *streamer,
+	Uint64 ticket
+) {
+	SDL_bool complete;
+
+	SDL_assert(streamer != NULL);
+
+	SDL_LockMutex(streamer->lock);
+
+	SDL_GpuINTERNAL_RetireStreamBatches(streamer, SDL_FALSE);
+
+	complete = (
+		ticket != 0 &&
+		ticket < streamer->nextTicket &&
+		!SDL_GpuINTERNAL_IsStreamRequestPending(streamer, ticket) &&
+		SDL_GpuINTERNAL_FindStreamBatch(streamer, ticket) == NULL
+	);
+
+	SDL_UnlockMutex(streamer->lock);
+
+	return complete;
+}
+
+SDL_bool SDL_GpuWaitForTextureUpload(
+	SDL_GpuTextureStreamer *streamer,
+	Uint64 ticket
+) {
+	StreamBatch *batch;
+	SDL_GpuFence *fence;
+
+	SDL_assert(streamer != NULL);
+
+	SDL_LockMutex(streamer->lock);
+
+	if (SDL_GpuINTERNAL_IsStreamRequestPending(streamer, ticket))
+	{
+		SDL_UnlockMutex(streamer->lock);
+		return SDL_FALSE;
+	}
+
+	batch = SDL_GpuINTERNAL_FindStreamBatch(streamer, ticket);
+	while (batch != NULL && batch->fence == NULL)
+	{
+		/* Still being recorded, the submit lock is released once it has a fence */
+		SDL_UnlockMutex(streamer->lock);
+		SDL_LockMutex(streamer->submitLock);
+		SDL_UnlockMutex(streamer->submitLock);
+		SDL_LockMutex(streamer->lock);
+
+		batch = SDL_GpuINTERNAL_FindStreamBatch(streamer, ticket);
+	}
+
+	if (batch != NULL)
+	{
+		/* Waiters keep the batch, and its fence, from being retired */
+		fence = batch->fence;
+		batch->waiterCount += 1;
+
+		SDL_UnlockMutex(streamer->lock);
+		SDL_GpuWaitForFences(streamer->device, SDL_TRUE, 1, &fence);
+		SDL_LockMutex(streamer->lock);
+
+		batch = SDL_GpuINTERNAL_FindStreamBatch(streamer, ticket);
+		batch->waiterCount -= 1;
+	}
+
+	SDL_GpuINTERNAL_RetireStreamBatches(streamer, SDL_FALSE);
+
+	SDL_UnlockMutex(streamer->lock);
+
+	return SDL_TRUE;
+}
@@ -49,6 +49,8 @@ static const IID D3D_IID_IDXGIFactory4 = { 0x1bc6ea02,0xef36,0x464f,{0xbf,0x0c,0
 static const IID D3D_IID_IDXGIFactory5 = { 0x7632e1f5,0xee65,0x4dca,{0x87,0xfd,0x84,0xcd,0x75,0xf8,0x83,0x8d} };
 static const IID D3D_IID_IDXGIFactory6 = { 0xc1b6694f,0xff09,0x44a9,{0xb0,0x3c,0x77,0x90,0x0a,0x0a,0x1d,0x17} };
 static const IID D3D_IID_IDXGIAdapter1 = { 0x29038f61,0x3839,0x4626,{0x91,0xfd,0x08,0x68,0x79,0x01,0x1a,0x05} };
+static const IID D3D_IID_IDXGIAdapter3 = { 0x645967a4,0x1392,0x4310,{0xa7,0x98,0x80,0x53,0xce,0x3e,0x93,0xfd} };
+static const IID D3D_IID_IDXGIDevice = { 0x54ec77fa,0x1377,0x44e6,{0x8c,0x32,0x88,0xfd,0x5f,0x44,0xc8,0x4c} };
 static const IID D3D_IID_IDXGISwapChain3 = { 0x94d99bdb,0xf1f8,0x4ab0,{0xb2,0x36,0x7d,0xa0,0x17,0x0e,0xda,0xb1} };
 static const IID D3D_IID_ID3D11Texture2D = { 0x6f15aaf2,0xd208,0x4e89,{0x9a,0xb4,0x48,0x95,0x35,0xd3,0x4f,0x9c} };
 static const IID D3D_IID_ID3DUserDefinedAnnotation = { 0xb2daad8b,0x03d4,0x4dbf,{0x95,0xeb,0x32,0xab,0x4b,0x63,0xd0,0xab} };
@@ -83,6 +85,8 @@ static const GUID D3D_IID_DXGI_DEBUG_ALL = { 0xe48ae283,0xda80,0x490b,{0x87,0xe6
 #define WINDOW_PROPERTY_DATA "SDL_GpuD3D11WindowPropertyData"
 
 #define UNIFORM_BUFFER_SIZE 1048576 /* 1 MiB */
+#define UPLOAD_BUFFER_MIN_SIZE 1048576 /* 1 MiB */
+#define BATCH_UNIFORM_UPLOAD_DRAW_COUNT 256
 
 #ifdef _WIN32
 #define HRESULT_FMT "(0x%08lX)"
@@ -160,6 +164,19 @@ static void D3D11_UnclaimWindow(
 	SDL_Window *window
 );
 static void D3D11_INTERNAL_DestroyBlitPipelines(SDL_GpuRenderer *driverData);
+static void D3D11_ReleaseShader(
+	SDL_GpuRenderer *driverData,
+	SDL_GpuShader *shader
+);
+
+/* SPIR-V Cross Interop */
+
+extern SDL_GpuShader* D3D11_CompileFromSPIRVCross(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuShaderStage shader_stage,
+    const char *entryPointName,
+    const char *source
+);
 
  /* Conversions */
 
@@ -493,6 +510,10 @@ typedef struct D3D11Fence
 {
 	ID3D11Query *handle;
     SDL_atomic_t referenceCount;
+
+	/* Filled in when the command buffer is cleaned, see SDL_GpuGetPassTimings */
+	SDL_GpuPassTiming passTimings[SDL_GPU_MAX_TIMED_PASSES];
+	Uint32 passTimingCount;
 } D3D11Fence;
 
 typedef struct D3D11WindowData
@@ -585,7 +606,15 @@ typedef struct D3D11BufferContainer
 
 typedef struct D3D11BufferTransfer
 {
+	/* Only created for readable transfer buffers, since mapping it needs the immediate context.
+	 * Write-only transfer buffers get one on their first download.
+	 */
 	ID3D11Buffer *stagingBuffer;
+
+	/* Write-only transfer buffers live in CPU memory and are copied into the command buffer's upload buffer.
+	 * Once they have a staging buffer this is a shadow of it, refreshed on map or invalidate.
+	 */
+	Uint8 *data;
 } D3D11BufferTransfer;
 
 typedef struct D3D11TextureTransfer
@@ -663,6 +692,20 @@ typedef struct D3D11CommandBuffer
 	Uint32 colorTargetResolveSubresourceIndex[MAX_COLOR_TARGET_BINDINGS];
 	ID3D11Resource *colorTargetMsaaHandle[MAX_COLOR_TARGET_BINDINGS];
 
+	/* Render Pass targets and default viewport state, rebound on sub pass contexts */
+	ID3D11RenderTargetView *colorTargetViews[MAX_COLOR_TARGET_BINDINGS];
+	Uint32 colorTargetViewCount;
+	ID3D11DepthStencilView *depthStencilTargetView;
+	D3D11_VIEWPORT defaultViewport;
+	D3D11_RECT defaultScissorRect;
+
+	/* Parallel Render Pass, sub passes are executed in this order */
+	struct D3D11CommandBuffer **subPassCommandBuffers;
+	Uint32 subPassCommandBufferCount;
+	Uint32 subPassCommandBufferCapacity;
+	Uint32 firstSubPassIndex; /* where the current parallel render pass starts */
+	ID3D11CommandList *subPassCommandList; /* sub passes only, set when the sub pass ends */
+
 	/* Compute Pass */
 	D3D11ComputePipeline *computePipeline;
 
@@ -713,10 +756,30 @@ typedef struct D3D11CommandBuffer
     Uint32 initializedFragmentUniformBufferCount;
     Uint32 initializedComputeUniformBufferCount;
 
+    /* Indirect count emulation scratch, see D3D11_INTERNAL_PrepareIndirectCountArgs */
+    D3D11Buffer *indirectCountBuffer;
+    ID3D11Buffer *indirectCountParams;
+
+    /* Linear upload allocator for write-only transfer buffers, mapped on the deferred context */
+    ID3D11Buffer *uploadBuffer;
+    Uint32 uploadBufferSize;
+    Uint32 uploadBufferOffset;
+
 	/* Fences */
 	D3D11Fence *fence;
 	Uint8 autoReleaseFence;
 
+	/* Pass timing, queries are created the first time timing is enabled */
+	ID3D11Query *passTimingDisjointQuery;
+	ID3D11Query *passTimingQueries[SDL_GPU_MAX_TIMED_PASSES * 2];
+	SDL_GpuPassType passTimingTypes[SDL_GPU_MAX_TIMED_PASSES];
+	Uint32 passTimingCount;
+	Uint8 passTimingEnabled;
+
+	/* Pipeline statistics, created the first time they are enabled */
+	ID3D11Query *pipelineStatisticsQuery;
+	Uint8 pipelineStatisticsEnabled;
+
 	/* Reference Counting */
 	D3D11Buffer **usedBuffers;
 	Uint32 usedBufferCount;
@@ -741,6 +804,19 @@ typedef struct D3D11OcclusionQuery
 	ID3D11Query *handle;
 } D3D11OcclusionQuery;
 
+typedef struct D3D11TimestampQuery
+{
+	ID3D11Query *handle;
+	ID3D11Query *disjoint; /* Provides the tick frequency */
+} D3D11TimestampQuery;
+
+typedef struct D3D11CachedBytecode
+{
+	Uint64 hash;
+	size_t size;
+	void *code;
+} D3D11CachedBytecode;
+
 struct D3D11Renderer
 {
 	ID3D11Device1 *device;
@@ -771,6 +847,9 @@ struct D3D11Renderer
     SDL_GpuSampler *blitNearestSampler;
     SDL_GpuSampler *blitLinearSampler;
 
+    /* Indirect count emulation, compiled on first use */
+    SDL_GpuShader *indirectCountShader;
+
     /* Resource Tracking */
 	D3D11WindowData **claimedWindows;
 	Uint32 claimedWindowCount;
@@ -800,10 +879,36 @@ struct D3D11Renderer
     Uint32 textureContainersToDestroyCount;
     Uint32 textureContainersToDestroyCapacity;
 
+    /* Reported by SDL_GpuGetMemoryStats */
+    SDL_atomic_t liveBufferCount;
+    SDL_atomic_t liveTextureCount;
+
+    /* Pipeline statistics resolved at cleanup, guarded by contextLock */
+    SDL_GpuFrameStats frameStats;
+
+	/* Compiled DXBC, seeded from and exported to SDL_GpuGetPipelineCacheData blobs */
+	D3D11CachedBytecode *cachedBytecodes;
+	Uint32 cachedBytecodeCount;
+	Uint32 cachedBytecodeCapacity;
+	PipelineCacheHeader pipelineCacheIdentity;
+
+	/* Threading model:
+	 * Each command buffer records into its own deferred context, so command buffers
+	 * acquired on different threads can be recorded in parallel. Recording never
+	 * touches the immediate context; only submission, fence and query readback,
+	 * swapchain teardown and CPU access to readable transfer buffers take
+	 * contextLock. A transfer buffer is readable if it was created with
+	 * SDL_GPU_TRANSFER_MAP_READ or has been downloaded into, and CPU access
+	 * means map, invalidate, SetTransferData and GetTransferData.
+	 * disposeLock guards the deferred release queues, so releasing resources
+	 * mid-recording does not contend with submission.
+	 */
 	SDL_mutex *contextLock;
+	SDL_mutex *disposeLock;
 	SDL_mutex *acquireCommandBufferLock;
 	SDL_mutex *fenceLock;
 	SDL_mutex *windowLock;
+	SDL_mutex *shaderCacheLock;
 };
 
 /* Null arrays for resetting shader resource slots */
@@ -989,6 +1094,12 @@ static void D3D11_DestroyDevice(
 	/* Release the blit resources */
 	D3D11_INTERNAL_DestroyBlitPipelines(device->driverData);
 
+	/* Release the indirect count shader, if it was ever needed */
+	if (renderer->indirectCountShader != NULL)
+	{
+		D3D11_ReleaseShader(device->driverData, renderer->indirectCountShader);
+	}
+
 	/* Release command buffer infrastructure */
 	for (Uint32 i = 0; i < renderer->availableCommandBufferCount; i += 1)
 	{
@@ -1021,6 +1132,40 @@ static void D3D11_DestroyDevice(
             SDL_free(commandBuffer->computeUniformBuffers[j]);
         }
 
+        if (commandBuffer->indirectCountBuffer != NULL)
+        {
+            ID3D11UnorderedAccessView_Release(commandBuffer->indirectCountBuffer->uav);
+            ID3D11ShaderResourceView_Release(commandBuffer->indirectCountBuffer->srv);
+            ID3D11Buffer_Release(commandBuffer->indirectCountBuffer->handle);
+            SDL_free(commandBuffer->indirectCountBuffer);
+        }
+
+        if (commandBuffer->indirectCountParams != NULL)
+        {
+            ID3D11Buffer_Release(commandBuffer->indirectCountParams);
+        }
+
+        if (commandBuffer->uploadBuffer != NULL)
+        {
+            ID3D11Buffer_Release(commandBuffer->uploadBuffer);
+        }
+
+        if (commandBuffer->passTimingDisjointQuery != NULL)
+        {
+            ID3D11Query_Release(commandBuffer->passTimingDisjointQuery);
+            for (Uint32 j = 0; j < SDL_GPU_MAX_TIMED_PASSES * 2; j += 1)
+            {
+                ID3D11Query_Release(commandBuffer->passTimingQueries[j]);
+            }
+        }
+
+        if (commandBuffer->pipelineStatisticsQuery != NULL)
+        {
+            ID3D11Query_Release(commandBuffer->pipelineStatisticsQuery);
+        }
+
+        SDL_free(commandBuffer->subPassCommandBuffers);
+
 		SDL_free(commandBuffer);
 	}
 	SDL_free(renderer->availableCommandBuffers);
@@ -1035,6 +1180,13 @@ static void D3D11_DestroyDevice(
 	}
 	SDL_free(renderer->availableFences);
 
+	/* Release the bytecode cache */
+	for (Uint32 i = 0; i < renderer->cachedBytecodeCount; i += 1)
+	{
+		SDL_free(renderer->cachedBytecodes[i].code);
+	}
+	SDL_free(renderer->cachedBytecodes);
+
     /* Release the annotation/iconv, if applicable */
 	if (renderer->annotation != NULL)
 	{
@@ -1048,8 +1200,10 @@ static void D3D11_DestroyDevice(
 	/* Release the mutexes */
 	SDL_DestroyMutex(renderer->acquireCommandBufferLock);
 	SDL_DestroyMutex(renderer->contextLock);
+	SDL_DestroyMutex(renderer->disposeLock);
 	SDL_DestroyMutex(renderer->fenceLock);
 	SDL_DestroyMutex(renderer->windowLock);
+	SDL_DestroyMutex(renderer->shaderCacheLock);
 
 	/* Release the device and associated objects */
 	ID3D11DeviceContext_Release(renderer->immediateContext);
@@ -1191,7 +1345,7 @@ static void D3D11_ReleaseTexture(
     D3D11Renderer *renderer = (D3D11Renderer*) driverData;
 	D3D11TextureContainer *container = (D3D11TextureContainer*) texture;
 
-    SDL_LockMutex(renderer->contextLock);
+    SDL_LockMutex(renderer->disposeLock);
 
     EXPAND_ARRAY_IF_NEEDED(
         renderer->textureContainersToDestroy,
@@ -1206,7 +1360,7 @@ static void D3D11_ReleaseTexture(
     ] = container;
     renderer->textureContainersToDestroyCount += 1;
 
-    SDL_UnlockMutex(renderer->contextLock);
+    SDL_UnlockMutex(renderer->disposeLock);
 }
 
 static void D3D11_ReleaseSampler(
@@ -1226,7 +1380,7 @@ static void D3D11_ReleaseBuffer(
     D3D11Renderer *renderer = (D3D11Renderer*) driverData;
 	D3D11BufferContainer *container = (D3D11BufferContainer*) buffer;
 
-    SDL_LockMutex(renderer->contextLock);
+    SDL_LockMutex(renderer->disposeLock);
 
     EXPAND_ARRAY_IF_NEEDED(
         renderer->bufferContainersToDestroy,
@@ -1241,7 +1395,7 @@ static void D3D11_ReleaseBuffer(
     ] = container;
     renderer->bufferContainersToDestroyCount += 1;
 
-    SDL_UnlockMutex(renderer->contextLock);
+    SDL_UnlockMutex(renderer->disposeLock);
 }
 
 static void D3D11_ReleaseTransferBuffer(
@@ -1250,7 +1404,7 @@ static void D3D11_ReleaseTransferBuffer(
 ) {
 	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
 
-	SDL_LockMutex(renderer->contextLock);
+	SDL_LockMutex(renderer->disposeLock);
 
 	EXPAND_ARRAY_IF_NEEDED(
 		renderer->transferBufferContainersToDestroy,
@@ -1265,7 +1419,7 @@ static void D3D11_ReleaseTransferBuffer(
 	] = (D3D11TransferBufferContainer*) transferBuffer;
 	renderer->transferBufferContainersToDestroyCount += 1;
 
-	SDL_UnlockMutex(renderer->contextLock);
+	SDL_UnlockMutex(renderer->disposeLock);
 }
 
 static void D3D11_INTERNAL_DestroyTransferBufferContainer(
@@ -1275,7 +1429,11 @@ static void D3D11_INTERNAL_DestroyTransferBufferContainer(
 	{
 		if (transferBufferContainer->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
 		{
-			ID3D11Buffer_Release(transferBufferContainer->buffers[i]->bufferTransfer.stagingBuffer);
+			if (transferBufferContainer->buffers[i]->bufferTransfer.stagingBuffer != NULL)
+			{
+				ID3D11Buffer_Release(transferBufferContainer->buffers[i]->bufferTransfer.stagingBuffer);
+			}
+			SDL_free(transferBufferContainer->buffers[i]->bufferTransfer.data);
 		}
 		else /* TEXTURE */
 		{
@@ -1360,6 +1518,16 @@ static void D3D11_ReleaseOcclusionQuery(
     SDL_free(query);
 }
 
+static void D3D11_ReleaseTimestampQuery(
+    SDL_GpuRenderer *renderer,
+    SDL_GpuTimestampQuery *query
+) {
+    D3D11TimestampQuery *d3dQuery = (D3D11TimestampQuery*) query;
+    ID3D11Query_Release(d3dQuery->handle);
+    ID3D11Query_Release(d3dQuery->disjoint);
+    SDL_free(query);
+}
+
 /* State Creation */
 
 static ID3D11BlendState* D3D11_INTERNAL_FetchBlendState(
@@ -1593,7 +1761,15 @@ static SDL_GpuComputePipeline* D3D11_CreateComputePipeline(
 ) {
 	(void) driverData; /* used by other backends */
 	D3D11Shader *shader = (D3D11Shader*) pipelineCreateInfo->computeShader;
-	D3D11ComputePipeline *pipeline = SDL_malloc(sizeof(D3D11ComputePipeline));
+	D3D11ComputePipeline *pipeline;
+
+	if (pipelineCreateInfo->useBindlessTable)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless tables are not supported on D3D11!");
+		return NULL;
+	}
+
+	pipeline = SDL_malloc(sizeof(D3D11ComputePipeline));
 
 	pipeline->computeShader = (ID3D11ComputeShader*) shader->shader;
     ID3D11ComputeShader_AddRef(pipeline->computeShader);
@@ -1614,9 +1790,17 @@ static SDL_GpuGraphicsPipeline* D3D11_CreateGraphicsPipeline(
 	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
 	D3D11Shader *vertShader = (D3D11Shader*) pipelineCreateInfo->vertexShader;
 	D3D11Shader *fragShader = (D3D11Shader*) pipelineCreateInfo->fragmentShader;
-	D3D11GraphicsPipeline *pipeline = SDL_malloc(sizeof(D3D11GraphicsPipeline));
+	D3D11GraphicsPipeline *pipeline;
     Uint32 i;
 
+	if (pipelineCreateInfo->useBindlessTable)
+	{
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless tables are not supported on D3D11!");
+		return NULL;
+	}
+
+	pipeline = SDL_malloc(sizeof(D3D11GraphicsPipeline));
+
 	/* Blend */
 
 	pipeline->colorAttachmentBlendState = D3D11_INTERNAL_FetchBlendState(
@@ -1986,6 +2170,113 @@ SDL_GpuShader* D3D11_CreateShader(
 	return (SDL_GpuShader*) shaderModule;
 }
 
+/* Bytecode Cache */
+
+/* These are called from the d3dcompiler path, keyed by a hash of the HLSL
+ * source and profile. Entries live until the device is destroyed, so the
+ * returned pointer stays valid for the lifetime of the renderer.
+ */
+
+void* D3D11_INTERNAL_FetchCachedBytecode(
+	SDL_GpuRenderer *driverData,
+	Uint64 hash,
+	size_t *size
+) {
+	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+	void *code = NULL;
+
+	SDL_LockMutex(renderer->shaderCacheLock);
+
+	for (Uint32 i = 0; i < renderer->cachedBytecodeCount; i += 1)
+	{
+		if (renderer->cachedBytecodes[i].hash == hash)
+		{
+			*size = renderer->cachedBytecodes[i].size;
+			code = renderer->cachedBytecodes[i].code;
+			break;
+		}
+	}
+
+	SDL_UnlockMutex(renderer->shaderCacheLock);
+
+	return code;
+}
+
+static void D3D11_INTERNAL_CacheBytecodeUnlocked(
+	D3D11Renderer *renderer,
+	Uint64 hash,
+	const void *code,
+	size_t size
+) {
+	D3D11CachedBytecode *entry;
+
+	for (Uint32 i = 0; i < renderer->cachedBytecodeCount; i += 1)
+	{
+		if (renderer->cachedBytecodes[i].hash == hash)
+		{
+			return;
+		}
+	}
+
+	EXPAND_ARRAY_IF_NEEDED(
+		renderer->cachedBytecodes,
+		D3D11CachedBytecode,
+		renderer->cachedBytecodeCount + 1,
+		renderer->cachedBytecodeCapacity,
+		renderer->cachedBytecodeCapacity * 2 + 1
+	);
+
+	entry = &renderer->cachedBytecodes[renderer->cachedBytecodeCount];
+	entry->hash = hash;
+	entry->size = size;
+	entry->code = SDL_malloc(size);
+	SDL_memcpy(entry->code, code, size);
+
+	renderer->cachedBytecodeCount += 1;
+}
+
+void D3D11_INTERNAL_CacheBytecode(
+	SDL_GpuRenderer *driverData,
+	Uint64 hash,
+	const void *code,
+	size_t size
+) {
+	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+
+	SDL_LockMutex(renderer->shaderCacheLock);
+	D3D11_INTERNAL_CacheBytecodeUnlocked(renderer, hash, code, size);
+	SDL_UnlockMutex(renderer->shaderCacheLock);
+}
+
+/* The payload is a flat list of [Uint64 hash][Uint64 size][size bytes] */
+
+static void D3D11_INTERNAL_LoadBytecodeCache(
+	D3D11Renderer *renderer,
+	const void *data,
+	size_t dataSize
+) {
+	const Uint8 *cursor = (const Uint8*) data;
+	const Uint8 *end = cursor + dataSize;
+	Uint64 hash;
+	Uint64 size;
+
+	while ((size_t) (end - cursor) >= sizeof(Uint64) * 2)
+	{
+		SDL_memcpy(&hash, cursor, sizeof(Uint64));
+		SDL_memcpy(&size, cursor + sizeof(Uint64), sizeof(Uint64));
+		cursor += sizeof(Uint64) * 2;
+
+		if (size > (Uint64) (end - cursor))
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Truncated shader bytecode cache entry, ignoring the rest");
+			return;
+		}
+
+		D3D11_INTERNAL_CacheBytecodeUnlocked(renderer, hash, cursor, (size_t) size);
+		cursor += size;
+	}
+}
+
 static D3D11Texture* D3D11_INTERNAL_CreateTexture(
 	D3D11Renderer *renderer,
 	SDL_GpuTextureCreateInfo *textureCreateInfo
@@ -2401,7 +2692,7 @@ static SDL_GpuTexture* D3D11_CreateTexture(
 	}
 
 	container = SDL_malloc(sizeof(D3D11TextureContainer));
-    container->canBeCycled = 1;
+    container->canBeCycled = !(textureCreateInfo->usageFlags & SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT);
 	container->createInfo = *textureCreateInfo;
 	container->activeTexture = texture;
 	container->textureCapacity = 1;
@@ -2412,6 +2703,8 @@ static SDL_GpuTexture* D3D11_CreateTexture(
 	container->textures[0] = texture;
 	container->debugName = NULL;
 
+	SDL_AtomicIncRef(&renderer->liveTextureCount);
+
 	return (SDL_GpuTexture*) container;
 }
 
@@ -2447,6 +2740,7 @@ static void D3D11_INTERNAL_CycleActiveTexture(
 		&container->createInfo
 	);
 	container->textureCount += 1;
+	SDL_AtomicIncRef(&renderer->liveTextureCount);
 
 	container->activeTexture = container->textures[container->textureCount - 1];
 
@@ -2654,6 +2948,8 @@ static SDL_GpuBuffer* D3D11_CreateBuffer(
     container->bufferDesc = bufferDesc;
 	container->debugName = NULL;
 
+	SDL_AtomicIncRef(&renderer->liveBufferCount);
+
 	return (SDL_GpuBuffer*) container;
 }
 
@@ -2733,6 +3029,7 @@ static void D3D11_INTERNAL_CycleActiveBuffer(
 		size
 	);
 	container->bufferCount += 1;
+	SDL_AtomicIncRef(&renderer->liveBufferCount);
 
 	container->activeBuffer = container->buffers[container->bufferCount - 1];
 
@@ -2786,11 +3083,23 @@ static D3D11TransferBuffer* D3D11_INTERNAL_CreateTransferBuffer(
         cpuAccessFlags |= D3D11_CPU_ACCESS_WRITE;
     }
 
-	if (usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
+	if (usage == SDL_GPU_TRANSFERUSAGE_BUFFER && !(mapFlags & SDL_GPU_TRANSFER_MAP_READ))
+	{
+		transferBuffer->bufferTransfer.stagingBuffer = NULL;
+		transferBuffer->bufferTransfer.data = (Uint8*) SDL_malloc(sizeInBytes);
+	}
+	else if (usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
 	{
 		D3D11_BUFFER_DESC stagingBufferDesc;
 		HRESULT res;
 
+		/* Staging buffers cannot stay mapped while the GPU copies into them,
+		 * so persistent readback goes through a shadow refreshed on invalidate.
+		 */
+		transferBuffer->bufferTransfer.data = (mapFlags & SDL_GPU_TRANSFER_MAP_PERSISTENT) ?
+			(Uint8*) SDL_malloc(sizeInBytes) :
+			NULL;
+
 		stagingBufferDesc.ByteWidth = sizeInBytes;
 		stagingBufferDesc.Usage = D3D11_USAGE_STAGING;
 		stagingBufferDesc.BindFlags = 0;
@@ -2905,7 +3214,24 @@ static void D3D11_MapTransferBuffer(
 		buffer = container->activeBuffer;
 	}
 
-    if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
+    if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER && buffer->bufferTransfer.data != NULL)
+    {
+        /* Write-only buffers that have been downloaded into read back on map, persistent ones on invalidate */
+        if (
+            buffer->bufferTransfer.stagingBuffer != NULL &&
+            !(container->mapFlags & SDL_GPU_TRANSFER_MAP_PERSISTENT)
+        ) {
+            D3D11_INTERNAL_RefreshTransferShadow(
+                renderer,
+                buffer,
+                0,
+                buffer->size
+            );
+        }
+
+        *ppData = buffer->bufferTransfer.data;
+    }
+    else if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
     {
         SDL_LockMutex(renderer->contextLock);
 		res = ID3D11DeviceContext_Map(
@@ -2936,8 +3262,10 @@ static void D3D11_UnmapTransferBuffer(
 	D3D11TransferBufferContainer *container = (D3D11TransferBufferContainer*) transferBuffer;
 	D3D11TransferBuffer *buffer = container->activeBuffer;
 
-    if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
-    {
+    if (
+        container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER &&
+        buffer->bufferTransfer.data == NULL
+    ) {
         SDL_LockMutex(renderer->contextLock);
 		ID3D11DeviceContext_Unmap(
 			renderer->immediateContext,
@@ -2947,7 +3275,92 @@ static void D3D11_UnmapTransferBuffer(
         SDL_UnlockMutex(renderer->contextLock);
     }
 
-    /* TEXTURE unmap is a no-op */
+    /* TEXTURE, write-only and persistent BUFFER unmap is a no-op */
+}
+
+static void D3D11_FlushTransferBuffer(
+	SDL_GpuRenderer *driverData,
+	SDL_GpuTransferBuffer *transferBuffer,
+	Uint32 offsetInBytes,
+	Uint32 sizeInBytes
+) {
+	/* Persistent pointers are always system memory, and uploads read them directly */
+	(void) driverData;
+	(void) transferBuffer;
+	(void) offsetInBytes;
+	(void) sizeInBytes;
+}
+
+static void D3D11_INTERNAL_RefreshTransferShadow(
+	D3D11Renderer *renderer,
+	D3D11TransferBuffer *buffer,
+	Uint32 offsetInBytes,
+	Uint32 sizeInBytes
+) {
+	D3D11_MAPPED_SUBRESOURCE subresource;
+	HRESULT res;
+
+	if (offsetInBytes >= buffer->size)
+	{
+		return;
+	}
+
+	sizeInBytes = SDL_min(sizeInBytes, buffer->size - offsetInBytes);
+
+	SDL_LockMutex(renderer->contextLock);
+	res = ID3D11DeviceContext_Map(
+		renderer->immediateContext,
+		(ID3D11Resource*) buffer->bufferTransfer.stagingBuffer,
+		0,
+		D3D11_MAP_READ,
+		0,
+		&subresource
+	);
+
+	if (SUCCEEDED(res))
+	{
+		SDL_memcpy(
+			buffer->bufferTransfer.data + offsetInBytes,
+			((Uint8*) subresource.pData) + offsetInBytes,
+			sizeInBytes
+		);
+
+		ID3D11DeviceContext_Unmap(
+			renderer->immediateContext,
+			(ID3D11Resource*) buffer->bufferTransfer.stagingBuffer,
+			0
+		);
+	}
+	SDL_UnlockMutex(renderer->contextLock);
+
+	ERROR_CHECK_RETURN("Failed to map staging buffer", );
+}
+
+static void D3D11_InvalidateTransferBuffer(
+	SDL_GpuRenderer *driverData,
+	SDL_GpuTransferBuffer *transferBuffer,
+	Uint32 offsetInBytes,
+	Uint32 sizeInBytes
+) {
+	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+	D3D11TransferBufferContainer *container = (D3D11TransferBufferContainer*) transferBuffer;
+	D3D11TransferBuffer *buffer = container->activeBuffer;
+
+	/* Only buffers with a staging buffer behind a shadow have anything to refresh */
+	if (
+		container->usage != SDL_GPU_TRANSFERUSAGE_BUFFER ||
+		buffer->bufferTransfer.data == NULL ||
+		buffer->bufferTransfer.stagingBuffer == NULL
+	) {
+		return;
+	}
+
+	D3D11_INTERNAL_RefreshTransferShadow(
+		renderer,
+		buffer,
+		offsetInBytes,
+		sizeInBytes
+	);
 }
 
 static void D3D11_SetTransferData(
@@ -2974,7 +3387,15 @@ static void D3D11_SetTransferData(
 		buffer = container->activeBuffer;
 	}
 
-	if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
+	if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER && buffer->bufferTransfer.data != NULL)
+	{
+		SDL_memcpy(
+			buffer->bufferTransfer.data + copyParams->dstOffset,
+			((Uint8*) data) + copyParams->srcOffset,
+			copyParams->size
+		);
+	}
+	else if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
 	{
 		D3D11_MAPPED_SUBRESOURCE mappedSubresource;
 
@@ -3027,7 +3448,18 @@ static void D3D11_GetTransferData(
     Uint32 depth, row, copySize;
 	HRESULT res;
 
-	if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
+	if (
+		container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER &&
+		buffer->bufferTransfer.data != NULL &&
+		buffer->bufferTransfer.stagingBuffer == NULL
+	) {
+		SDL_memcpy(
+			((Uint8*) data) + copyParams->dstOffset,
+			buffer->bufferTransfer.data + copyParams->srcOffset,
+			copyParams->size
+		);
+	}
+	else if (container->usage == SDL_GPU_TRANSFERUSAGE_BUFFER)
 	{
 		SDL_LockMutex(renderer->contextLock);
 		res = ID3D11DeviceContext_Map(
@@ -3113,12 +3545,54 @@ static void D3D11_GetTransferData(
 	}
 }
 
+/* Pass Timing */
+
+static void D3D11_INTERNAL_BeginPassTiming(
+	D3D11CommandBuffer *commandBuffer,
+	SDL_GpuPassType passType
+) {
+	if (
+		!commandBuffer->passTimingEnabled ||
+		commandBuffer->passTimingCount == SDL_GPU_MAX_TIMED_PASSES
+	) {
+		return;
+	}
+
+	commandBuffer->passTimingTypes[commandBuffer->passTimingCount] = passType;
+
+	ID3D11DeviceContext_End(
+		commandBuffer->context,
+		(ID3D11Asynchronous*) commandBuffer->passTimingQueries[commandBuffer->passTimingCount * 2]
+	);
+}
+
+static void D3D11_INTERNAL_EndPassTiming(
+	D3D11CommandBuffer *commandBuffer
+) {
+	if (
+		!commandBuffer->passTimingEnabled ||
+		commandBuffer->passTimingCount == SDL_GPU_MAX_TIMED_PASSES
+	) {
+		return;
+	}
+
+	ID3D11DeviceContext_End(
+		commandBuffer->context,
+		(ID3D11Asynchronous*) commandBuffer->passTimingQueries[commandBuffer->passTimingCount * 2 + 1]
+	);
+
+	commandBuffer->passTimingCount += 1;
+}
+
 /* Copy Pass */
 
 static void D3D11_BeginCopyPass(
 	SDL_GpuCommandBuffer *commandBuffer
 ) {
-	/* no-op */
+	D3D11_INTERNAL_BeginPassTiming(
+		(D3D11CommandBuffer*) commandBuffer,
+		SDL_GPU_PASSTYPE_COPY
+	);
 }
 
 static void D3D11_UploadToTexture(
@@ -3137,8 +3611,9 @@ static void D3D11_UploadToTexture(
 	Uint32 bufferImageHeight = copyParams->bufferImageHeight;
 	Sint32 w = textureRegion->w;
 	Sint32 h = textureRegion->h;
-    D3D11TextureContainer *stagingTexture;
-    SDL_GpuTextureCreateInfo stagingTextureCreateInfo;
+    ID3D11Resource *stagingTexture;
+    D3D11_SUBRESOURCE_DATA initialData;
+    HRESULT res;
 
     D3D11TextureSubresource *textureSubresource = D3D11_INTERNAL_PrepareTextureSubresourceForWrite(
         renderer,
@@ -3169,63 +3644,166 @@ static void D3D11_UploadToTexture(
 
     /* UpdateSubresource1 is completely busted on AMD, it truncates after X bytes.
      * So we get to do this Fun (Tm) workaround where we create a staging texture
-     * and upload to it in the immediate context before using a copy command.
+     * and copy from it. The staging texture is created with its contents as
+     * initial data, which only needs the free-threaded device, so recording
+     * never has to wait on the immediate context.
      */
 
-    stagingTextureCreateInfo.width = w;
-    stagingTextureCreateInfo.height = h;
-    stagingTextureCreateInfo.depth = textureRegion->d;
-    stagingTextureCreateInfo.layerCount = 1;
-    stagingTextureCreateInfo.levelCount = 1;
-    stagingTextureCreateInfo.isCube = 0;
-    stagingTextureCreateInfo.usageFlags = 0;
-    stagingTextureCreateInfo.sampleCount = SDL_GPU_SAMPLECOUNT_1;
-    stagingTextureCreateInfo.format = ((D3D11TextureContainer *)textureRegion->textureSlice.texture)->createInfo.format;
-
-    stagingTexture = (D3D11TextureContainer*) D3D11_CreateTexture(
-        (SDL_GpuRenderer*) d3d11CommandBuffer->renderer,
-        &stagingTextureCreateInfo
-    );
+    initialData.pSysMem = (Uint8*) d3d11TransferBuffer->textureTransfer.data + copyParams->bufferOffset;
+    initialData.SysMemPitch = bufferStride;
+    initialData.SysMemSlicePitch = bufferStride * bufferImageHeight;
 
-    if (stagingTexture == NULL)
+    if (textureRegion->d <= 1)
     {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Staging texture creation failed");
-    }
-
-    SDL_LockMutex(renderer->contextLock);
-    ID3D11DeviceContext_UpdateSubresource(
-        renderer->immediateContext,
-        stagingTexture->activeTexture->handle,
-        0,
-        &stagingTextureBox,
-        (Uint8*) d3d11TransferBuffer->textureTransfer.data + copyParams->bufferOffset,
-        bufferStride,
-        bufferStride * bufferImageHeight
-    );
-    SDL_UnlockMutex(renderer->contextLock);
+        D3D11_TEXTURE2D_DESC stagingDesc2D;
 
-    ID3D11DeviceContext1_CopySubresourceRegion1(
-        d3d11CommandBuffer->context,
+        stagingDesc2D.Width = w;
+        stagingDesc2D.Height = h;
+        stagingDesc2D.MipLevels = 1;
+        stagingDesc2D.ArraySize = 1;
+        stagingDesc2D.Format = SDLToD3D11_TextureFormat[textureSubresource->parent->format];
+        stagingDesc2D.SampleDesc.Count = 1;
+        stagingDesc2D.SampleDesc.Quality = 0;
+        stagingDesc2D.Usage = D3D11_USAGE_DEFAULT;
+        stagingDesc2D.BindFlags = 0;
+        stagingDesc2D.CPUAccessFlags = 0;
+        stagingDesc2D.MiscFlags = 0;
+
+        res = ID3D11Device_CreateTexture2D(
+            renderer->device,
+            &stagingDesc2D,
+            &initialData,
+            (ID3D11Texture2D**) &stagingTexture
+        );
+    }
+    else
+    {
+        D3D11_TEXTURE3D_DESC stagingDesc3D;
+
+        stagingDesc3D.Width = w;
+        stagingDesc3D.Height = h;
+        stagingDesc3D.Depth = textureRegion->d;
+        stagingDesc3D.MipLevels = 1;
+        stagingDesc3D.Format = SDLToD3D11_TextureFormat[textureSubresource->parent->format];
+        stagingDesc3D.Usage = D3D11_USAGE_DEFAULT;
+        stagingDesc3D.BindFlags = 0;
+        stagingDesc3D.CPUAccessFlags = 0;
+        stagingDesc3D.MiscFlags = 0;
+
+        res = ID3D11Device_CreateTexture3D(
+            renderer->device,
+            &stagingDesc3D,
+            &initialData,
+            (ID3D11Texture3D**) &stagingTexture
+        );
+    }
+    ERROR_CHECK_RETURN("Staging texture creation failed",)
+
+    ID3D11DeviceContext1_CopySubresourceRegion1(
+        d3d11CommandBuffer->context,
         textureSubresource->parent->handle,
         textureSubresource->index,
         textureRegion->x,
         textureRegion->y,
         textureRegion->z,
-        stagingTexture->activeTexture->handle,
+        stagingTexture,
         0,
         &stagingTextureBox,
         D3D11_COPY_NO_OVERWRITE
     );
 
-	/* Clean up the staging texture */
-    D3D11_ReleaseTexture(
-        (SDL_GpuRenderer*) d3d11CommandBuffer->renderer,
-        (SDL_GpuTexture *)stagingTexture
-    );
+    /* The deferred context keeps the staging texture alive for the recorded copy */
+    ID3D11Resource_Release(stagingTexture);
 
-    D3D11_INTERNAL_TrackTextureSubresource(d3d11CommandBuffer, &stagingTexture->activeTexture->subresources[0]);
     D3D11_INTERNAL_TrackTextureSubresource(d3d11CommandBuffer, textureSubresource);
     D3D11_INTERNAL_TrackTransferBuffer(d3d11CommandBuffer, d3d11TransferBuffer);
+
+    d3d11CommandBuffer->common.stats.bytesUploaded +=
+        (Uint64) BytesPerImage(textureRegion->w, textureRegion->h, textureSubresource->parent->format) * textureRegion->d;
+}
+
+/* Copies data into the command buffer's upload buffer and returns the offset it landed at.
+ * The buffer is mapped on the deferred context, so this never touches the immediate context.
+ */
+static ID3D11Buffer* D3D11_INTERNAL_WriteUploadData(
+	D3D11Renderer *renderer,
+	D3D11CommandBuffer *commandBuffer,
+	void *data,
+	Uint32 size,
+	Uint32 *pOffset
+) {
+	D3D11_BUFFER_DESC bufferDesc;
+	D3D11_MAPPED_SUBRESOURCE subres;
+	Uint32 newSize;
+	HRESULT res;
+
+	if (size > commandBuffer->uploadBufferSize)
+	{
+		/* The deferred context keeps the old buffer alive for commands already recorded */
+		if (commandBuffer->uploadBuffer != NULL)
+		{
+			ID3D11Buffer_Release(commandBuffer->uploadBuffer);
+			commandBuffer->uploadBuffer = NULL;
+		}
+
+		newSize = SDL_max(UPLOAD_BUFFER_MIN_SIZE, commandBuffer->uploadBufferSize * 2);
+		while (newSize < size)
+		{
+			newSize *= 2;
+		}
+
+		/* Dynamic buffers need a bind flag; vertex buffers can be mapped with NO_OVERWRITE on deferred contexts */
+		bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		bufferDesc.ByteWidth = newSize;
+		bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+		bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		bufferDesc.MiscFlags = 0;
+		bufferDesc.StructureByteStride = 0;
+
+		commandBuffer->uploadBufferSize = 0;
+		res = ID3D11Device_CreateBuffer(
+			renderer->device,
+			&bufferDesc,
+			NULL,
+			&commandBuffer->uploadBuffer
+		);
+		ERROR_CHECK_RETURN("Could not create upload buffer", NULL);
+
+		commandBuffer->uploadBufferSize = newSize;
+		commandBuffer->uploadBufferOffset = 0;
+	}
+	else if (commandBuffer->uploadBufferOffset + size > commandBuffer->uploadBufferSize)
+	{
+		/* Wrap around, the discard below renames the buffer */
+		commandBuffer->uploadBufferOffset = 0;
+	}
+
+	res = ID3D11DeviceContext_Map(
+		commandBuffer->context,
+		(ID3D11Resource*) commandBuffer->uploadBuffer,
+		0,
+		commandBuffer->uploadBufferOffset == 0 ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE,
+		0,
+		&subres
+	);
+	ERROR_CHECK_RETURN("Could not map upload buffer", NULL);
+
+	SDL_memcpy(
+		(Uint8*) subres.pData + commandBuffer->uploadBufferOffset,
+		data,
+		size
+	);
+
+	ID3D11DeviceContext_Unmap(
+		commandBuffer->context,
+		(ID3D11Resource*) commandBuffer->uploadBuffer,
+		0
+	);
+
+	*pOffset = commandBuffer->uploadBufferOffset;
+	commandBuffer->uploadBufferOffset += D3D11_INTERNAL_NextHighestAlignment(size, 16);
+
+	return commandBuffer->uploadBuffer;
 }
 
 static void D3D11_UploadToBuffer(
@@ -3242,12 +3820,34 @@ static void D3D11_UploadToBuffer(
 	D3D11BufferContainer *bufferContainer = (D3D11BufferContainer*) buffer;
 	D3D11_BOX srcBox = { copyParams->srcOffset, 0, 0, copyParams->srcOffset + copyParams->size, 1, 1 };
 
+	ID3D11Buffer *srcBuffer = d3d11TransferBuffer->bufferTransfer.stagingBuffer;
+	Uint32 uploadOffset;
+
 	D3D11Buffer *d3d11Buffer = D3D11_INTERNAL_PrepareBufferForWrite(
 		renderer,
 		bufferContainer,
 		cycle
 	);
 
+	if (d3d11TransferBuffer->bufferTransfer.data != NULL)
+	{
+		srcBuffer = D3D11_INTERNAL_WriteUploadData(
+			renderer,
+			d3d11CommandBuffer,
+			d3d11TransferBuffer->bufferTransfer.data + copyParams->srcOffset,
+			copyParams->size,
+			&uploadOffset
+		);
+
+		if (srcBuffer == NULL)
+		{
+			return;
+		}
+
+		srcBox.left = uploadOffset;
+		srcBox.right = uploadOffset + copyParams->size;
+	}
+
 	ID3D11DeviceContext1_CopySubresourceRegion1(
 		d3d11CommandBuffer->context,
 		(ID3D11Resource*) d3d11Buffer->handle,
@@ -3255,7 +3855,7 @@ static void D3D11_UploadToBuffer(
 		copyParams->dstOffset,
 		0,
 		0,
-		(ID3D11Resource*) d3d11TransferBuffer->bufferTransfer.stagingBuffer,
+		(ID3D11Resource*) srcBuffer,
 		0,
 		&srcBox,
 		D3D11_COPY_NO_OVERWRITE /* always no overwrite because we manually discard */
@@ -3364,6 +3964,9 @@ static void D3D11_DownloadFromTexture(
 		&srcBox,
         D3D11_COPY_NO_OVERWRITE
 	);
+
+	d3d11CommandBuffer->common.stats.bytesDownloaded +=
+		(Uint64) BytesPerImage(textureRegion->w, textureRegion->h, textureSubresource->parent->format) * textureRegion->d;
 }
 
 static void D3D11_DownloadFromBuffer(
@@ -3373,10 +3976,34 @@ static void D3D11_DownloadFromBuffer(
 	SDL_GpuBufferCopy *copyParams
 ) {
     D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+	D3D11Renderer *renderer = (D3D11Renderer*) d3d11CommandBuffer->renderer;
 	D3D11TransferBufferContainer *container = (D3D11TransferBufferContainer*) transferBuffer;
 	D3D11TransferBuffer *d3d11TransferBuffer = container->activeBuffer;
 	D3D11BufferContainer *d3d11BufferContainer = (D3D11BufferContainer*) buffer;
 	D3D11_BOX srcBox = { copyParams->srcOffset, 0, 0, copyParams->size, 1, 1 };
+	D3D11_BUFFER_DESC stagingBufferDesc;
+	HRESULT res;
+
+	if (d3d11TransferBuffer->bufferTransfer.stagingBuffer == NULL)
+	{
+		/* Write-only transfer buffer, give it a staging buffer behind its CPU memory.
+		 * The device is free-threaded, so this does not need the immediate context.
+		 */
+		stagingBufferDesc.ByteWidth = d3d11TransferBuffer->size;
+		stagingBufferDesc.Usage = D3D11_USAGE_STAGING;
+		stagingBufferDesc.BindFlags = 0;
+		stagingBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+		stagingBufferDesc.MiscFlags = 0;
+		stagingBufferDesc.StructureByteStride = 0;
+
+		res = ID3D11Device_CreateBuffer(
+			renderer->device,
+			&stagingBufferDesc,
+			NULL,
+			&d3d11TransferBuffer->bufferTransfer.stagingBuffer
+		);
+		ERROR_CHECK_RETURN("Could not create staging buffer", );
+	}
 
 	ID3D11DeviceContext1_CopySubresourceRegion1(
 		d3d11CommandBuffer->context,
@@ -3497,7 +4124,7 @@ static void D3D11_GenerateMipmaps(
 static void D3D11_EndCopyPass(
 	SDL_GpuCommandBuffer *commandBuffer
 ) {
-	/* no-op */
+	D3D11_INTERNAL_EndPassTiming((D3D11CommandBuffer*) commandBuffer);
 }
 
 /* Uniforms */
@@ -3569,6 +4196,31 @@ static void D3D11_INTERNAL_AllocateCommandBuffers(
         commandBuffer->initializedFragmentUniformBufferCount = 0;
         commandBuffer->initializedComputeUniformBufferCount = 0;
 
+        commandBuffer->indirectCountBuffer = NULL;
+        commandBuffer->indirectCountParams = NULL;
+
+        commandBuffer->uploadBuffer = NULL;
+        commandBuffer->uploadBufferSize = 0;
+        commandBuffer->uploadBufferOffset = 0;
+
+        commandBuffer->passTimingDisjointQuery = NULL;
+        commandBuffer->passTimingCount = 0;
+        commandBuffer->passTimingEnabled = 0;
+
+        commandBuffer->pipelineStatisticsQuery = NULL;
+        commandBuffer->pipelineStatisticsEnabled = 0;
+
+        commandBuffer->colorTargetViewCount = 0;
+        commandBuffer->depthStencilTargetView = NULL;
+
+        commandBuffer->subPassCommandBufferCapacity = 4;
+        commandBuffer->subPassCommandBufferCount = 0;
+        commandBuffer->firstSubPassIndex = 0;
+        commandBuffer->subPassCommandBuffers = SDL_malloc(
+            commandBuffer->subPassCommandBufferCapacity * sizeof(D3D11CommandBuffer*)
+        );
+        commandBuffer->subPassCommandList = NULL;
+
         commandBuffer->windowDataCapacity = 1;
         commandBuffer->windowDataCount = 0;
         commandBuffer->windowDatas = SDL_malloc(
@@ -3638,6 +4290,7 @@ static Uint8 D3D11_INTERNAL_CreateFence(
 	fence = SDL_malloc(sizeof(D3D11Fence));
 	fence->handle = queryHandle;
     SDL_AtomicSet(&fence->referenceCount, 0);
+	fence->passTimingCount = 0;
 
 	/* Add it to the available pool */
 	if (renderer->availableFenceCount >= renderer->availableFenceCapacity)
@@ -3682,21 +4335,17 @@ static Uint8 D3D11_INTERNAL_AcquireFence(
 
 	/* Associate the fence with the command buffer */
 	commandBuffer->fence = fence;
+	fence->passTimingCount = 0;
     (void)SDL_AtomicIncRef(&commandBuffer->fence->referenceCount);
 
 	return 1;
 }
 
-static SDL_GpuCommandBuffer* D3D11_AcquireCommandBuffer(
-	SDL_GpuRenderer *driverData
+static void D3D11_INTERNAL_ResetCommandBuffer(
+	D3D11CommandBuffer *commandBuffer
 ) {
-	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
-	D3D11CommandBuffer *commandBuffer;
     Uint32 i;
 
-	SDL_LockMutex(renderer->acquireCommandBufferLock);
-
-	commandBuffer = D3D11_INTERNAL_GetInactiveCommandBufferFromPool(renderer);
 	commandBuffer->graphicsPipeline = NULL;
 	commandBuffer->computePipeline = NULL;
 	for (i = 0; i < MAX_COLOR_TARGET_BINDINGS; i += 1)
@@ -3727,6 +4376,23 @@ static SDL_GpuCommandBuffer* D3D11_AcquireCommandBuffer(
     SDL_zeroa(commandBuffer->computeShaderResourceViews);
     SDL_zeroa(commandBuffer->computeUnorderedAccessViews);
 
+    /* Start a fresh discard on the first upload */
+    commandBuffer->uploadBufferOffset = 0;
+}
+
+/* D3D11 has a single immediate context, every queue maps to it */
+static SDL_GpuCommandBuffer* D3D11_AcquireCommandBuffer(
+	SDL_GpuRenderer *driverData,
+	SDL_GpuCommandQueue queue
+) {
+	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+	D3D11CommandBuffer *commandBuffer;
+
+	SDL_LockMutex(renderer->acquireCommandBufferLock);
+
+	commandBuffer = D3D11_INTERNAL_GetInactiveCommandBufferFromPool(renderer);
+	D3D11_INTERNAL_ResetCommandBuffer(commandBuffer);
+
 	D3D11_INTERNAL_AcquireFence(commandBuffer);
 	commandBuffer->autoReleaseFence = 1;
 
@@ -3735,70 +4401,15 @@ static SDL_GpuCommandBuffer* D3D11_AcquireCommandBuffer(
 	return (SDL_GpuCommandBuffer*) commandBuffer;
 }
 
-static void D3D11_INTERNAL_PushUniformData(
+static void D3D11_INTERNAL_BindUniformBufferRange(
     D3D11CommandBuffer *d3d11CommandBuffer,
     SDL_GpuShaderStage shaderStage,
     Uint32 slotIndex,
-    void *data,
-    Uint32 dataLengthInBytes
+    D3D11UniformBuffer *d3d11UniformBuffer,
+    Uint32 drawOffset
 ) {
-    D3D11Renderer *renderer = d3d11CommandBuffer->renderer;
-    D3D11UniformBuffer *d3d11UniformBuffer;
     ID3D11Buffer *nullBuf = NULL;
     Uint32 offsetInConstants, blockSizeInConstants;
-    Uint32 drawOffset;
-
-    if (shaderStage == SDL_GPU_SHADERSTAGE_VERTEX)
-    {
-        d3d11UniformBuffer = d3d11CommandBuffer->vertexUniformBuffers[slotIndex];
-    }
-    else if (shaderStage == SDL_GPU_SHADERSTAGE_FRAGMENT)
-    {
-        d3d11UniformBuffer = d3d11CommandBuffer->fragmentUniformBuffers[slotIndex];
-    }
-    else if (shaderStage == SDL_GPU_SHADERSTAGE_COMPUTE)
-    {
-        d3d11UniformBuffer = d3d11CommandBuffer->computeUniformBuffers[slotIndex];
-    }
-    else
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unrecognized shader stage!");
-        return;
-    }
-
-    d3d11UniformBuffer->currentBlockSize =
-        D3D11_INTERNAL_NextHighestAlignment(
-            dataLengthInBytes,
-            256
-        );
-
-    if (d3d11UniformBuffer->offset + d3d11UniformBuffer->currentBlockSize >= d3d11UniformBuffer->bufferContainer->activeBuffer->size)
-    {
-        D3D11_INTERNAL_CycleActiveBuffer(
-            renderer,
-            d3d11UniformBuffer->bufferContainer
-        );
-
-        d3d11UniformBuffer->offset = 0;
-
-        D3D11_INTERNAL_TrackBuffer(
-            d3d11CommandBuffer,
-            d3d11UniformBuffer->bufferContainer->activeBuffer
-        );
-    }
-
-    drawOffset = d3d11UniformBuffer->offset;
-
-    D3D11_INTERNAL_SetUniformBufferData(
-        renderer,
-        d3d11CommandBuffer,
-        d3d11UniformBuffer->bufferContainer->activeBuffer,
-        d3d11UniformBuffer->offset,
-        data,
-        dataLengthInBytes
-    );
-
-    d3d11UniformBuffer->offset += d3d11UniformBuffer->currentBlockSize;
 
     offsetInConstants = drawOffset / 16;
     blockSizeInConstants = d3d11UniformBuffer->currentBlockSize / 16;
@@ -3872,6 +4483,78 @@ static void D3D11_INTERNAL_PushUniformData(
     }
 }
 
+static void D3D11_INTERNAL_PushUniformData(
+    D3D11CommandBuffer *d3d11CommandBuffer,
+    SDL_GpuShaderStage shaderStage,
+    Uint32 slotIndex,
+    void *data,
+    Uint32 dataLengthInBytes
+) {
+    D3D11Renderer *renderer = d3d11CommandBuffer->renderer;
+    D3D11UniformBuffer *d3d11UniformBuffer;
+    Uint32 drawOffset;
+
+    if (shaderStage == SDL_GPU_SHADERSTAGE_VERTEX)
+    {
+        d3d11UniformBuffer = d3d11CommandBuffer->vertexUniformBuffers[slotIndex];
+    }
+    else if (shaderStage == SDL_GPU_SHADERSTAGE_FRAGMENT)
+    {
+        d3d11UniformBuffer = d3d11CommandBuffer->fragmentUniformBuffers[slotIndex];
+    }
+    else if (shaderStage == SDL_GPU_SHADERSTAGE_COMPUTE)
+    {
+        d3d11UniformBuffer = d3d11CommandBuffer->computeUniformBuffers[slotIndex];
+    }
+    else
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unrecognized shader stage!");
+        return;
+    }
+
+    d3d11UniformBuffer->currentBlockSize =
+        D3D11_INTERNAL_NextHighestAlignment(
+            dataLengthInBytes,
+            256
+        );
+
+    if (d3d11UniformBuffer->offset + d3d11UniformBuffer->currentBlockSize >= d3d11UniformBuffer->bufferContainer->activeBuffer->size)
+    {
+        D3D11_INTERNAL_CycleActiveBuffer(
+            renderer,
+            d3d11UniformBuffer->bufferContainer
+        );
+
+        d3d11UniformBuffer->offset = 0;
+
+        D3D11_INTERNAL_TrackBuffer(
+            d3d11CommandBuffer,
+            d3d11UniformBuffer->bufferContainer->activeBuffer
+        );
+    }
+
+    drawOffset = d3d11UniformBuffer->offset;
+
+    D3D11_INTERNAL_SetUniformBufferData(
+        renderer,
+        d3d11CommandBuffer,
+        d3d11UniformBuffer->bufferContainer->activeBuffer,
+        d3d11UniformBuffer->offset,
+        data,
+        dataLengthInBytes
+    );
+
+    d3d11UniformBuffer->offset += d3d11UniformBuffer->currentBlockSize;
+
+    D3D11_INTERNAL_BindUniformBufferRange(
+        d3d11CommandBuffer,
+        shaderStage,
+        slotIndex,
+        d3d11UniformBuffer,
+        drawOffset
+    );
+}
+
 static void D3D11_BeginRenderPass(
 	SDL_GpuCommandBuffer *commandBuffer,
 	SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
@@ -3887,6 +4570,8 @@ static void D3D11_BeginRenderPass(
 	D3D11_VIEWPORT viewport;
 	D3D11_RECT scissorRect;
 
+	D3D11_INTERNAL_BeginPassTiming(d3d11CommandBuffer, SDL_GPU_PASSTYPE_RENDER);
+
     d3d11CommandBuffer->needVertexSamplerBind = SDL_TRUE;
     d3d11CommandBuffer->needVertexResourceBind = SDL_TRUE;
     d3d11CommandBuffer->needFragmentSamplerBind = SDL_TRUE;
@@ -4062,6 +4747,16 @@ static void D3D11_BeginRenderPass(
 		1,
 		&scissorRect
 	);
+
+	/* Remember the pass setup in case sub passes need it */
+	for (Uint32 i = 0; i < colorAttachmentCount; i += 1)
+	{
+		d3d11CommandBuffer->colorTargetViews[i] = rtvs[i];
+	}
+	d3d11CommandBuffer->colorTargetViewCount = colorAttachmentCount;
+	d3d11CommandBuffer->depthStencilTargetView = dsv;
+	d3d11CommandBuffer->defaultViewport = viewport;
+	d3d11CommandBuffer->defaultScissorRect = scissorRect;
 }
 
 static void D3D11_BindGraphicsPipeline(
@@ -4498,6 +5193,15 @@ static void D3D11_BindFragmentStorageBuffers(
     d3d11CommandBuffer->needFragmentResourceBind = SDL_TRUE;
 }
 
+static void D3D11_BindGraphicsBindlessTable(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    /* CreateBindlessTable never succeeds on D3D11 */
+    (void) commandBuffer;
+    (void) bindlessTable;
+}
+
 static void D3D11_INTERNAL_BindGraphicsResources(
     D3D11CommandBuffer *commandBuffer
 ) {
@@ -4663,6 +5367,329 @@ static void D3D11_DrawIndexedPrimitivesIndirect(
     D3D11_INTERNAL_TrackBuffer(d3d11CommandBuffer, d3d11Buffer);
 }
 
+/* D3D11 has no DrawIndirectCount, so we copy the arguments into a scratch
+ * buffer and let a tiny compute shader zero the instance count of every draw
+ * past the GPU-side count. The CPU then issues maxDrawCount indirect draws,
+ * the surplus ones simply draw nothing.
+ */
+
+#define INDIRECT_COUNT_ARGS_OFFSET 16
+
+static const char *IndirectCountShaderSource =
+    "cbuffer IndirectCountParams : register(b0)\n"
+    "{\n"
+    "    uint DrawStride;\n"
+    "    uint MaxDrawCount;\n"
+    "    uint ArgsOffset;\n"
+    "    uint Padding;\n"
+    "};\n"
+    "RWByteAddressBuffer Args : register(u0);\n"
+    "[numthreads(64, 1, 1)]\n"
+    "void main(uint3 id : SV_DispatchThreadID)\n"
+    "{\n"
+    "    if (id.x < MaxDrawCount && id.x >= Args.Load(0))\n"
+    "    {\n"
+    "        Args.Store(ArgsOffset + (id.x * DrawStride) + 4, 0);\n"
+    "    }\n"
+    "}\n";
+
+static D3D11Shader* D3D11_INTERNAL_FetchIndirectCountShader(
+    D3D11Renderer *renderer
+) {
+    SDL_GpuShader *shader = (SDL_GpuShader*) SDL_AtomicGetPtr((void**) &renderer->indirectCountShader);
+
+    if (shader == NULL)
+    {
+        shader = D3D11_CompileFromSPIRVCross(
+            (SDL_GpuRenderer*) renderer,
+            SDL_GPU_SHADERSTAGE_COMPUTE,
+            "main",
+            IndirectCountShaderSource
+        );
+        if (shader == NULL)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to compile indirect count shader: %s", SDL_GetError());
+            return NULL;
+        }
+
+        /* Another command buffer may have beaten us to it */
+        if (!SDL_AtomicCASPtr((void**) &renderer->indirectCountShader, NULL, shader))
+        {
+            D3D11_ReleaseShader((SDL_GpuRenderer*) renderer, shader);
+            shader = (SDL_GpuShader*) SDL_AtomicGetPtr((void**) &renderer->indirectCountShader);
+        }
+    }
+
+    return (D3D11Shader*) shader;
+}
+
+static D3D11Buffer* D3D11_INTERNAL_PrepareIndirectCountArgs(
+    D3D11CommandBuffer *d3d11CommandBuffer,
+    D3D11Buffer *argsBuffer,
+    Uint32 offsetInBytes,
+    D3D11Buffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride,
+    Uint32 argsSize
+) {
+    D3D11Renderer *renderer = d3d11CommandBuffer->renderer;
+    D3D11Shader *shader;
+    D3D11_BUFFER_DESC bufferDesc;
+    D3D11_BOX srcBox;
+    Uint32 argsRange = ((maxDrawCount - 1) * stride) + argsSize;
+    Uint32 requiredSize = INDIRECT_COUNT_ARGS_OFFSET + argsRange;
+    Uint32 params[4];
+    HRESULT res;
+
+    shader = D3D11_INTERNAL_FetchIndirectCountShader(renderer);
+    if (shader == NULL)
+    {
+        return NULL;
+    }
+
+    if (d3d11CommandBuffer->indirectCountParams == NULL)
+    {
+        bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        bufferDesc.ByteWidth = sizeof(params);
+        bufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        bufferDesc.CPUAccessFlags = 0;
+        bufferDesc.MiscFlags = 0;
+        bufferDesc.StructureByteStride = 0;
+
+        res = ID3D11Device_CreateBuffer(
+            renderer->device,
+            &bufferDesc,
+            NULL,
+            &d3d11CommandBuffer->indirectCountParams
+        );
+        ERROR_CHECK_RETURN("Could not create indirect count parameter buffer", NULL);
+    }
+
+    if (    d3d11CommandBuffer->indirectCountBuffer == NULL ||
+            d3d11CommandBuffer->indirectCountBuffer->size < requiredSize    )
+    {
+        /* The deferred context keeps the old buffer alive for commands already recorded */
+        if (d3d11CommandBuffer->indirectCountBuffer != NULL)
+        {
+            ID3D11UnorderedAccessView_Release(d3d11CommandBuffer->indirectCountBuffer->uav);
+            ID3D11ShaderResourceView_Release(d3d11CommandBuffer->indirectCountBuffer->srv);
+            ID3D11Buffer_Release(d3d11CommandBuffer->indirectCountBuffer->handle);
+            SDL_free(d3d11CommandBuffer->indirectCountBuffer);
+        }
+
+        bufferDesc.BindFlags = D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE;
+        bufferDesc.ByteWidth = D3D11_INTERNAL_NextHighestAlignment(requiredSize, 4);
+        bufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        bufferDesc.CPUAccessFlags = 0;
+        bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_DRAWINDIRECT_ARGS | D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+        bufferDesc.StructureByteStride = 0;
+
+        d3d11CommandBuffer->indirectCountBuffer = D3D11_INTERNAL_CreateBuffer(
+            renderer,
+            &bufferDesc,
+            bufferDesc.ByteWidth
+        );
+        if (d3d11CommandBuffer->indirectCountBuffer == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    /* Count goes at the front, the arguments follow */
+    srcBox.left = countOffsetInBytes;
+    srcBox.right = countOffsetInBytes + sizeof(Uint32);
+    srcBox.top = 0;
+    srcBox.bottom = 1;
+    srcBox.front = 0;
+    srcBox.back = 1;
+
+    ID3D11DeviceContext1_CopySubresourceRegion1(
+        d3d11CommandBuffer->context,
+        (ID3D11Resource*) d3d11CommandBuffer->indirectCountBuffer->handle,
+        0,
+        0,
+        0,
+        0,
+        (ID3D11Resource*) countBuffer->handle,
+        0,
+        &srcBox,
+        0
+    );
+
+    srcBox.left = offsetInBytes;
+    srcBox.right = offsetInBytes + argsRange;
+
+    ID3D11DeviceContext1_CopySubresourceRegion1(
+        d3d11CommandBuffer->context,
+        (ID3D11Resource*) d3d11CommandBuffer->indirectCountBuffer->handle,
+        0,
+        INDIRECT_COUNT_ARGS_OFFSET,
+        0,
+        0,
+        (ID3D11Resource*) argsBuffer->handle,
+        0,
+        &srcBox,
+        0
+    );
+
+    params[0] = stride;
+    params[1] = maxDrawCount;
+    params[2] = INDIRECT_COUNT_ARGS_OFFSET;
+    params[3] = 0;
+
+    ID3D11DeviceContext_UpdateSubresource(
+        d3d11CommandBuffer->context,
+        (ID3D11Resource*) d3d11CommandBuffer->indirectCountParams,
+        0,
+        NULL,
+        params,
+        0,
+        0
+    );
+
+    ID3D11DeviceContext_CSSetShader(
+        d3d11CommandBuffer->context,
+        (ID3D11ComputeShader*) shader->shader,
+        NULL,
+        0
+    );
+
+    ID3D11DeviceContext_CSSetConstantBuffers(
+        d3d11CommandBuffer->context,
+        0,
+        1,
+        &d3d11CommandBuffer->indirectCountParams
+    );
+
+    ID3D11DeviceContext_CSSetUnorderedAccessViews(
+        d3d11CommandBuffer->context,
+        0,
+        1,
+        &d3d11CommandBuffer->indirectCountBuffer->uav,
+        NULL
+    );
+
+    ID3D11DeviceContext_Dispatch(
+        d3d11CommandBuffer->context,
+        (maxDrawCount + 63) / 64,
+        1,
+        1
+    );
+
+    /* The buffer can't be bound as a UAV while it's consumed as indirect args */
+    ID3D11DeviceContext_CSSetUnorderedAccessViews(
+        d3d11CommandBuffer->context,
+        0,
+        1,
+        nullUAVs,
+        NULL
+    );
+
+    /* We clobbered compute state, make sure the next compute pass rebinds it */
+    d3d11CommandBuffer->needComputeUAVBind = SDL_TRUE;
+
+    return d3d11CommandBuffer->indirectCountBuffer;
+}
+
+static void D3D11_DrawPrimitivesIndirectCount(
+	SDL_GpuCommandBuffer *commandBuffer,
+	SDL_GpuBuffer *buffer,
+	Uint32 offsetInBytes,
+	SDL_GpuBuffer *countBuffer,
+	Uint32 countOffsetInBytes,
+	Uint32 maxDrawCount,
+	Uint32 stride
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+	D3D11Buffer *d3d11Buffer = ((D3D11BufferContainer*) buffer)->activeBuffer;
+	D3D11Buffer *d3d11CountBuffer = ((D3D11BufferContainer*) countBuffer)->activeBuffer;
+	D3D11Buffer *argsBuffer;
+
+	if (maxDrawCount == 0)
+	{
+		return;
+	}
+
+	argsBuffer = D3D11_INTERNAL_PrepareIndirectCountArgs(
+		d3d11CommandBuffer,
+		d3d11Buffer,
+		offsetInBytes,
+		d3d11CountBuffer,
+		countOffsetInBytes,
+		maxDrawCount,
+		stride,
+		sizeof(Uint32) * 4
+	);
+	if (argsBuffer == NULL)
+	{
+		return;
+	}
+
+    D3D11_INTERNAL_BindGraphicsResources(d3d11CommandBuffer);
+
+	for (Uint32 i = 0; i < maxDrawCount; i += 1)
+	{
+		ID3D11DeviceContext_DrawInstancedIndirect(
+			d3d11CommandBuffer->context,
+			argsBuffer->handle,
+			INDIRECT_COUNT_ARGS_OFFSET + (stride * i)
+		);
+	}
+
+	D3D11_INTERNAL_TrackBuffer(d3d11CommandBuffer, d3d11Buffer);
+	D3D11_INTERNAL_TrackBuffer(d3d11CommandBuffer, d3d11CountBuffer);
+}
+
+static void D3D11_DrawIndexedPrimitivesIndirectCount(
+	SDL_GpuCommandBuffer *commandBuffer,
+	SDL_GpuBuffer *buffer,
+	Uint32 offsetInBytes,
+	SDL_GpuBuffer *countBuffer,
+	Uint32 countOffsetInBytes,
+	Uint32 maxDrawCount,
+	Uint32 stride
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+	D3D11Buffer *d3d11Buffer = ((D3D11BufferContainer*) buffer)->activeBuffer;
+	D3D11Buffer *d3d11CountBuffer = ((D3D11BufferContainer*) countBuffer)->activeBuffer;
+	D3D11Buffer *argsBuffer;
+
+	if (maxDrawCount == 0)
+	{
+		return;
+	}
+
+	argsBuffer = D3D11_INTERNAL_PrepareIndirectCountArgs(
+		d3d11CommandBuffer,
+		d3d11Buffer,
+		offsetInBytes,
+		d3d11CountBuffer,
+		countOffsetInBytes,
+		maxDrawCount,
+		stride,
+		sizeof(Uint32) * 5
+	);
+	if (argsBuffer == NULL)
+	{
+		return;
+	}
+
+    D3D11_INTERNAL_BindGraphicsResources(d3d11CommandBuffer);
+
+	for (Uint32 i = 0; i < maxDrawCount; i += 1)
+	{
+		ID3D11DeviceContext_DrawIndexedInstancedIndirect(
+			d3d11CommandBuffer->context,
+			argsBuffer->handle,
+			INDIRECT_COUNT_ARGS_OFFSET + (stride * i)
+		);
+	}
+
+	D3D11_INTERNAL_TrackBuffer(d3d11CommandBuffer, d3d11Buffer);
+	D3D11_INTERNAL_TrackBuffer(d3d11CommandBuffer, d3d11CountBuffer);
+}
+
 static void D3D11_EndRenderPass(
 	SDL_GpuCommandBuffer *commandBuffer
 ) {
@@ -4693,6 +5720,141 @@ static void D3D11_EndRenderPass(
 			);
 		}
 	}
+
+	D3D11_INTERNAL_EndPassTiming(d3d11CommandBuffer);
+}
+
+/* Parallel Render Pass */
+
+static void D3D11_BeginParallelRenderPass(
+	SDL_GpuCommandBuffer *commandBuffer,
+	SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+	Uint32 colorAttachmentCount,
+	SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+
+	/* Earlier parallel passes keep their sub passes until the command buffer is cleaned */
+	d3d11CommandBuffer->firstSubPassIndex = d3d11CommandBuffer->subPassCommandBufferCount;
+
+	/* Load ops are performed here, sub passes only draw */
+	D3D11_BeginRenderPass(
+		commandBuffer,
+		colorAttachmentInfos,
+		colorAttachmentCount,
+		depthStencilAttachmentInfo
+	);
+}
+
+static SDL_GpuCommandBuffer* D3D11_AcquireRenderSubPass(
+	SDL_GpuCommandBuffer *commandBuffer
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+	D3D11Renderer *renderer = d3d11CommandBuffer->renderer;
+	D3D11CommandBuffer *subPassCommandBuffer;
+
+	SDL_LockMutex(renderer->acquireCommandBufferLock);
+
+	subPassCommandBuffer = D3D11_INTERNAL_GetInactiveCommandBufferFromPool(renderer);
+
+	EXPAND_ARRAY_IF_NEEDED(
+		d3d11CommandBuffer->subPassCommandBuffers,
+		D3D11CommandBuffer*,
+		d3d11CommandBuffer->subPassCommandBufferCount + 1,
+		d3d11CommandBuffer->subPassCommandBufferCapacity,
+		d3d11CommandBuffer->subPassCommandBufferCapacity * 2
+	);
+
+	d3d11CommandBuffer->subPassCommandBuffers[
+		d3d11CommandBuffer->subPassCommandBufferCount
+	] = subPassCommandBuffer;
+	d3d11CommandBuffer->subPassCommandBufferCount += 1;
+
+	SDL_UnlockMutex(renderer->acquireCommandBufferLock);
+
+	D3D11_INTERNAL_ResetCommandBuffer(subPassCommandBuffer);
+
+	/* The primary command buffer owns the fence */
+	subPassCommandBuffer->fence = NULL;
+	subPassCommandBuffer->autoReleaseFence = 0;
+	subPassCommandBuffer->subPassCommandList = NULL;
+
+	/* Each deferred context starts from default state */
+	ID3D11DeviceContext_OMSetRenderTargets(
+		subPassCommandBuffer->context,
+		d3d11CommandBuffer->colorTargetViewCount,
+		d3d11CommandBuffer->colorTargetViewCount > 0 ? d3d11CommandBuffer->colorTargetViews : NULL,
+		d3d11CommandBuffer->depthStencilTargetView
+	);
+
+	ID3D11DeviceContext_RSSetViewports(
+		subPassCommandBuffer->context,
+		1,
+		&d3d11CommandBuffer->defaultViewport
+	);
+
+	ID3D11DeviceContext_RSSetScissorRects(
+		subPassCommandBuffer->context,
+		1,
+		&d3d11CommandBuffer->defaultScissorRect
+	);
+
+	return (SDL_GpuCommandBuffer*) subPassCommandBuffer;
+}
+
+static void D3D11_EndRenderSubPass(
+	SDL_GpuCommandBuffer *subPassCommandBuffer
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) subPassCommandBuffer;
+	D3D11Renderer *renderer = d3d11CommandBuffer->renderer;
+	HRESULT res;
+
+	d3d11CommandBuffer->graphicsPipeline = NULL;
+
+	res = ID3D11DeviceContext_FinishCommandList(
+		d3d11CommandBuffer->context,
+		0,
+		&d3d11CommandBuffer->subPassCommandList
+	);
+	ERROR_CHECK("Could not finish sub pass command list!");
+}
+
+static void D3D11_EndParallelRenderPass(
+	SDL_GpuCommandBuffer *commandBuffer
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+	D3D11CommandBuffer *subPassCommandBuffer;
+	Uint32 i;
+
+	for (i = d3d11CommandBuffer->firstSubPassIndex; i < d3d11CommandBuffer->subPassCommandBufferCount; i += 1)
+	{
+		subPassCommandBuffer = d3d11CommandBuffer->subPassCommandBuffers[i];
+
+		if (subPassCommandBuffer->subPassCommandList == NULL)
+		{
+			SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Sub pass was not ended, skipping!");
+			continue;
+		}
+
+		/* The primary context holds its own reference to the list */
+		ID3D11DeviceContext_ExecuteCommandList(
+			d3d11CommandBuffer->context,
+			subPassCommandBuffer->subPassCommandList,
+			0
+		);
+		ID3D11CommandList_Release(subPassCommandBuffer->subPassCommandList);
+		subPassCommandBuffer->subPassCommandList = NULL;
+	}
+
+	/* Executing without restoring state leaves the primary context cleared */
+	d3d11CommandBuffer->needVertexSamplerBind = SDL_TRUE;
+	d3d11CommandBuffer->needVertexResourceBind = SDL_TRUE;
+	d3d11CommandBuffer->needFragmentSamplerBind = SDL_TRUE;
+	d3d11CommandBuffer->needFragmentResourceBind = SDL_TRUE;
+	d3d11CommandBuffer->needComputeUAVBind = SDL_TRUE;
+	d3d11CommandBuffer->needComputeSRVBind = SDL_TRUE;
+
+	D3D11_EndRenderPass(commandBuffer);
 }
 
 static void D3D11_PushVertexUniformData(
@@ -4741,131 +5903,411 @@ static void D3D11_PushFragmentUniformData(
     );
 }
 
-/* Blit */
-
-static void D3D11_Blit(
-    SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuTextureRegion *source,
-    SDL_GpuTextureRegion *destination,
-    SDL_GpuFilter filterMode,
-	SDL_bool cycle
+/* Writes as many of the draws' uniform blocks as fit with a single map, returns the draw count covered */
+static Uint32 D3D11_INTERNAL_PackBatchUniformData(
+    D3D11CommandBuffer *d3d11CommandBuffer,
+    SDL_GpuShaderStage shaderStage,
+    SDL_GpuIndexedDrawRecord *draws,
+    Uint32 drawCount,
+    Uint32 dataLengthInBytes,
+    Uint32 *drawOffsets
 ) {
-	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
-    D3D11Renderer *renderer = (D3D11Renderer*) d3d11CommandBuffer->renderer;
-    D3D11TextureContainer *sourceTextureContainer = (D3D11TextureContainer*) source->textureSlice.texture;
-    D3D11TextureContainer *destinationTextureContainer = (D3D11TextureContainer*) destination->textureSlice.texture;
-    SDL_GpuColorAttachmentInfo colorAttachmentInfo;
-    SDL_GpuViewport viewport;
-    SDL_GpuTextureSamplerBinding textureSamplerBinding;
-
-    if (destinationTextureContainer->activeTexture->depth > 1)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "3D blit destination not implemented!");
-        return;
-    }
-
-    /* Unused */
-    colorAttachmentInfo.clearColor.r = 0;
-    colorAttachmentInfo.clearColor.g = 0;
-    colorAttachmentInfo.clearColor.b = 0;
-    colorAttachmentInfo.clearColor.a = 0;
+    D3D11Renderer *renderer = d3d11CommandBuffer->renderer;
+    D3D11UniformBuffer *d3d11UniformBuffer;
+    D3D11_MAPPED_SUBRESOURCE subres;
+    void *data;
+    Uint32 i;
+    HRESULT res;
 
-    /* If the entire destination is blitted, we don't have to load */
-    if (
-        destinationTextureContainer->activeTexture->layerCount == 1 &&
-        destinationTextureContainer->activeTexture->levelCount == 1 &&
-        destination->w == destinationTextureContainer->activeTexture->width &&
-        destination->h == destinationTextureContainer->activeTexture->height &&
-        destination->d == destinationTextureContainer->activeTexture->depth
-    ) {
-        colorAttachmentInfo.loadOp = SDL_GPU_LOADOP_DONT_CARE;
+    if (shaderStage == SDL_GPU_SHADERSTAGE_VERTEX)
+    {
+        d3d11UniformBuffer = d3d11CommandBuffer->vertexUniformBuffers[0];
     }
     else
     {
-        colorAttachmentInfo.loadOp = SDL_GPU_LOADOP_LOAD;
+        d3d11UniformBuffer = d3d11CommandBuffer->fragmentUniformBuffers[0];
     }
 
-    colorAttachmentInfo.storeOp = SDL_GPU_STOREOP_STORE;
+    d3d11UniformBuffer->currentBlockSize =
+        D3D11_INTERNAL_NextHighestAlignment(
+            dataLengthInBytes,
+            256
+        );
 
-    colorAttachmentInfo.textureSlice = destination->textureSlice;
-    colorAttachmentInfo.cycle = cycle;
+    if (d3d11UniformBuffer->offset + d3d11UniformBuffer->currentBlockSize >= d3d11UniformBuffer->bufferContainer->activeBuffer->size)
+    {
+        D3D11_INTERNAL_CycleActiveBuffer(
+            renderer,
+            d3d11UniformBuffer->bufferContainer
+        );
 
-    D3D11_BeginRenderPass(
-        commandBuffer,
-        &colorAttachmentInfo,
-        1,
-        NULL
-    );
+        d3d11UniformBuffer->offset = 0;
 
-    viewport.x = (float) destination->x;
-    viewport.y = (float) destination->y;
-    viewport.w = (float) destination->w;
-    viewport.h = (float) destination->h;
-    viewport.minDepth = 0;
-    viewport.maxDepth = 1;
+        D3D11_INTERNAL_TrackBuffer(
+            d3d11CommandBuffer,
+            d3d11UniformBuffer->bufferContainer->activeBuffer
+        );
+    }
 
-    D3D11_SetViewport(
-        commandBuffer,
-        &viewport
+    res = ID3D11DeviceContext_Map(
+        d3d11CommandBuffer->context,
+        (ID3D11Resource*) d3d11UniformBuffer->bufferContainer->activeBuffer->handle,
+        0,
+        d3d11UniformBuffer->offset == 0 ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE,
+        0,
+        &subres
     );
+    ERROR_CHECK_RETURN("Could not map buffer for writing!", 0);
 
-    if (
-        sourceTextureContainer->activeTexture->layerCount == 1 &&
-        sourceTextureContainer->activeTexture->depth == 1
-    ) {
-        /* 2D source */
-        D3D11_BindGraphicsPipeline(
-            commandBuffer,
-            renderer->blitFrom2DPipeline
-        );
-    }
-    else if (
-        sourceTextureContainer->activeTexture->layerCount > 1
-    ) {
-        /* 2D array source */
-        D3D11_BindGraphicsPipeline(
-            commandBuffer,
-            renderer->blitFrom2DArrayPipeline
-        );
+    for (i = 0; i < drawCount; i += 1)
+    {
+        data = (shaderStage == SDL_GPU_SHADERSTAGE_VERTEX) ?
+            draws[i].vertexUniformData :
+            draws[i].fragmentUniformData;
 
-        D3D11_PushFragmentUniformData(
-            commandBuffer,
-            0,
-            &source->textureSlice.layer,
-            sizeof(Uint32)
+        if (data == NULL)
+        {
+            drawOffsets[i] = SDL_MAX_UINT32;
+            continue;
+        }
+
+        if (d3d11UniformBuffer->offset + d3d11UniformBuffer->currentBlockSize >= d3d11UniformBuffer->bufferContainer->activeBuffer->size)
+        {
+            break;
+        }
+
+        SDL_memcpy(
+            (Uint8*) subres.pData + d3d11UniformBuffer->offset,
+            data,
+            dataLengthInBytes
         );
+
+        drawOffsets[i] = d3d11UniformBuffer->offset;
+        d3d11UniformBuffer->offset += d3d11UniformBuffer->currentBlockSize;
     }
-    else
+
+    ID3D11DeviceContext_Unmap(
+        d3d11CommandBuffer->context,
+        (ID3D11Resource*) d3d11UniformBuffer->bufferContainer->activeBuffer->handle,
+        0
+    );
+
+    return i;
+}
+
+static void D3D11_DrawIndexedPrimitivesBatch(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuIndexedDrawRecord *draws,
+    Uint32 drawCount,
+    Uint32 vertexUniformDataLengthInBytes,
+    Uint32 fragmentUniformDataLengthInBytes
+) {
+    D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+    D3D11GraphicsPipeline *pipeline = d3d11CommandBuffer->graphicsPipeline;
+    SDL_bool hasVertexUniforms = pipeline->vertexUniformBufferCount > 0;
+    SDL_bool hasFragmentUniforms = pipeline->fragmentUniformBufferCount > 0;
+    Uint32 vertexOffsets[BATCH_UNIFORM_UPLOAD_DRAW_COUNT];
+    Uint32 fragmentOffsets[BATCH_UNIFORM_UPLOAD_DRAW_COUNT];
+    SDL_GpuIndexedDrawRecord *chunk;
+    Uint32 chunkStart, chunkCount, i;
+
+    D3D11_INTERNAL_BindGraphicsResources(d3d11CommandBuffer);
+
+    for (chunkStart = 0; chunkStart < drawCount; chunkStart += chunkCount)
     {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "3D blit source not implemented!");
-        return;
+        chunk = &draws[chunkStart];
+        chunkCount = SDL_min(drawCount - chunkStart, BATCH_UNIFORM_UPLOAD_DRAW_COUNT);
+
+        /* One map per stage per chunk instead of one per draw */
+        if (hasVertexUniforms)
+        {
+            chunkCount = D3D11_INTERNAL_PackBatchUniformData(
+                d3d11CommandBuffer,
+                SDL_GPU_SHADERSTAGE_VERTEX,
+                chunk,
+                chunkCount,
+                vertexUniformDataLengthInBytes,
+                vertexOffsets
+            );
+        }
+
+        if (hasFragmentUniforms && chunkCount > 0)
+        {
+            chunkCount = D3D11_INTERNAL_PackBatchUniformData(
+                d3d11CommandBuffer,
+                SDL_GPU_SHADERSTAGE_FRAGMENT,
+                chunk,
+                chunkCount,
+                fragmentUniformDataLengthInBytes,
+                fragmentOffsets
+            );
+        }
+
+        if (chunkCount == 0)
+        {
+            return;
+        }
+
+        for (i = 0; i < chunkCount; i += 1)
+        {
+            if (hasVertexUniforms && vertexOffsets[i] != SDL_MAX_UINT32)
+            {
+                D3D11_INTERNAL_BindUniformBufferRange(
+                    d3d11CommandBuffer,
+                    SDL_GPU_SHADERSTAGE_VERTEX,
+                    0,
+                    d3d11CommandBuffer->vertexUniformBuffers[0],
+                    vertexOffsets[i]
+                );
+            }
+
+            if (hasFragmentUniforms && fragmentOffsets[i] != SDL_MAX_UINT32)
+            {
+                D3D11_INTERNAL_BindUniformBufferRange(
+                    d3d11CommandBuffer,
+                    SDL_GPU_SHADERSTAGE_FRAGMENT,
+                    0,
+                    d3d11CommandBuffer->fragmentUniformBuffers[0],
+                    fragmentOffsets[i]
+                );
+            }
+
+            ID3D11DeviceContext_DrawIndexedInstanced(
+                d3d11CommandBuffer->context,
+                PrimitiveVerts(pipeline->primitiveType, chunk[i].primitiveCount),
+                chunk[i].instanceCount,
+                chunk[i].startIndex,
+                chunk[i].baseVertex,
+                chunk[i].firstInstance
+            );
+        }
     }
+}
+
+/* Blit */
+
+static SDL_bool D3D11_INTERNAL_SameTextureSlice(
+    SDL_GpuTextureSlice *a,
+    SDL_GpuTextureSlice *b
+) {
+    return (
+        a->texture == b->texture &&
+        a->layer == b->layer &&
+        a->mipLevel == b->mipLevel
+    );
+}
+
+static void D3D11_BlitBatch(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBlitRegion *blits,
+    Uint32 blitCount,
+    SDL_GpuFilter filterMode,
+    SDL_bool cycle
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+    D3D11Renderer *renderer = (D3D11Renderer*) d3d11CommandBuffer->renderer;
+    D3D11TextureContainer *sourceTextureContainer;
+    D3D11TextureContainer *destinationTextureContainer;
+    SDL_GpuTextureRegion *source;
+    SDL_GpuTextureRegion *destination;
+    SDL_GpuGraphicsPipeline *boundPipeline;
+    SDL_GpuColorAttachmentInfo colorAttachmentInfo;
+    SDL_GpuViewport viewport;
+    SDL_GpuTextureSamplerBinding textureSamplerBinding;
+    Uint32 runStart, runEnd;
+    Uint32 i, j;
+
+    /* Unused */
+    colorAttachmentInfo.clearColor.r = 0;
+    colorAttachmentInfo.clearColor.g = 0;
+    colorAttachmentInfo.clearColor.b = 0;
+    colorAttachmentInfo.clearColor.a = 0;
+
+    colorAttachmentInfo.storeOp = SDL_GPU_STOREOP_STORE;
+
+    viewport.minDepth = 0;
+    viewport.maxDepth = 1;
 
-    textureSamplerBinding.texture = source->textureSlice.texture;
     textureSamplerBinding.sampler =
         filterMode == SDL_GPU_FILTER_NEAREST ?
         renderer->blitNearestSampler :
         renderer->blitLinearSampler;
 
-    if (((D3D11TextureContainer*) textureSamplerBinding.texture)->activeTexture->shaderView == NULL)
+    /* Consecutive blits into the same destination slice share a render pass */
+    for (runStart = 0; runStart < blitCount; runStart = runEnd)
     {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Blit source texture must be created with SAMPLER bit!");
+        destination = &blits[runStart].destination;
+        destinationTextureContainer = (D3D11TextureContainer*) destination->textureSlice.texture;
+
+        runEnd = runStart + 1;
+        while (
+            runEnd < blitCount &&
+            D3D11_INTERNAL_SameTextureSlice(&blits[runEnd].destination.textureSlice, &destination->textureSlice)
+        ) {
+            runEnd += 1;
+        }
+
+        if (destinationTextureContainer->activeTexture->depth > 1)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "3D blit destination not implemented!");
+            continue;
+        }
+
+        /* If the entire destination is blitted, we don't have to load */
+        if (
+            runEnd - runStart == 1 &&
+            destinationTextureContainer->activeTexture->layerCount == 1 &&
+            destinationTextureContainer->activeTexture->levelCount == 1 &&
+            destination->w == destinationTextureContainer->activeTexture->width &&
+            destination->h == destinationTextureContainer->activeTexture->height &&
+            destination->d == destinationTextureContainer->activeTexture->depth
+        ) {
+            colorAttachmentInfo.loadOp = SDL_GPU_LOADOP_DONT_CARE;
+        }
+        else
+        {
+            colorAttachmentInfo.loadOp = SDL_GPU_LOADOP_LOAD;
+        }
+
+        /* Only the first write to a texture may cycle it, or later blits would discard earlier ones */
+        colorAttachmentInfo.textureSlice = destination->textureSlice;
+        colorAttachmentInfo.cycle = cycle;
+        for (j = 0; colorAttachmentInfo.cycle && j < runStart; j += 1)
+        {
+            if (blits[j].destination.textureSlice.texture == destination->textureSlice.texture)
+            {
+                colorAttachmentInfo.cycle = SDL_FALSE;
+            }
+        }
+
+        D3D11_BeginRenderPass(
+            commandBuffer,
+            &colorAttachmentInfo,
+            1,
+            NULL
+        );
+
+        boundPipeline = NULL;
+
+        for (i = runStart; i < runEnd; i += 1)
+        {
+            source = &blits[i].source;
+            destination = &blits[i].destination;
+            sourceTextureContainer = (D3D11TextureContainer*) source->textureSlice.texture;
+
+            if (
+                sourceTextureContainer->activeTexture->layerCount == 1 &&
+                sourceTextureContainer->activeTexture->depth == 1
+            ) {
+                /* 2D source */
+                if (boundPipeline != renderer->blitFrom2DPipeline)
+                {
+                    D3D11_BindGraphicsPipeline(
+                        commandBuffer,
+                        renderer->blitFrom2DPipeline
+                    );
+                    boundPipeline = renderer->blitFrom2DPipeline;
+                }
+            }
+            else if (
+                sourceTextureContainer->activeTexture->layerCount > 1
+            ) {
+                /* 2D array source */
+                if (boundPipeline != renderer->blitFrom2DArrayPipeline)
+                {
+                    D3D11_BindGraphicsPipeline(
+                        commandBuffer,
+                        renderer->blitFrom2DArrayPipeline
+                    );
+                    boundPipeline = renderer->blitFrom2DArrayPipeline;
+                }
+
+                D3D11_PushFragmentUniformData(
+                    commandBuffer,
+                    0,
+                    &source->textureSlice.layer,
+                    sizeof(Uint32)
+                );
+            }
+            else
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "3D blit source not implemented!");
+                continue;
+            }
+
+            if (sourceTextureContainer->activeTexture->shaderView == NULL)
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Blit source texture must be created with SAMPLER bit!");
+            }
+
+            viewport.x = (float) destination->x;
+            viewport.y = (float) destination->y;
+            viewport.w = (float) destination->w;
+            viewport.h = (float) destination->h;
+
+            D3D11_SetViewport(
+                commandBuffer,
+                &viewport
+            );
+
+            textureSamplerBinding.texture = source->textureSlice.texture;
+
+            D3D11_BindFragmentSamplers(
+                commandBuffer,
+                0,
+                &textureSamplerBinding,
+                1
+            );
+
+            D3D11_DrawPrimitives(
+                commandBuffer,
+                0,
+                1
+            );
+        }
+
+        D3D11_EndRenderPass(commandBuffer);
     }
+}
 
-    D3D11_BindFragmentSamplers(
-        commandBuffer,
-        0,
-        &textureSamplerBinding,
-        1
-    );
+static void D3D11_Blit(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTextureRegion *source,
+    SDL_GpuTextureRegion *destination,
+    SDL_GpuFilter filterMode,
+	SDL_bool cycle
+) {
+    SDL_GpuBlitRegion blit;
+    blit.source = *source;
+    blit.destination = *destination;
 
-    D3D11_DrawPrimitives(
+    D3D11_BlitBatch(
         commandBuffer,
-        0,
-        1
+        &blit,
+        1,
+        filterMode,
+        cycle
     );
+}
+
+static void D3D11_DiscardTransientTexture(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTexture *texture
+) {
+	D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+    D3D11TextureContainer *container = (D3D11TextureContainer*) texture;
 
-    D3D11_EndRenderPass(commandBuffer);
+    if (!(container->createInfo.usageFlags & SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only transient textures can be discarded!");
+        return;
+    }
+
+    /* The driver can skip preserving the contents, which mostly matters on tilers */
+    ID3D11DeviceContext1_DiscardResource(
+        d3d11CommandBuffer->context,
+        container->activeTexture->handle
+    );
 }
 
 /* Compute State */
@@ -4884,6 +6326,8 @@ static void D3D11_BeginComputePass(
     D3D11Buffer *buffer;
     Uint32 i;
 
+    D3D11_INTERNAL_BeginPassTiming(d3d11CommandBuffer, SDL_GPU_PASSTYPE_COMPUTE);
+
     for (i = 0; i < storageTextureBindingCount; i += 1)
     {
         textureContainer = (D3D11TextureContainer*) storageTextureBindings[i].textureSlice.texture;
@@ -5057,6 +6501,15 @@ static void D3D11_BindComputeStorageBuffers(
     d3d11CommandBuffer->needComputeSRVBind = SDL_TRUE;
 }
 
+static void D3D11_BindComputeBindlessTable(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    /* CreateBindlessTable never succeeds on D3D11 */
+    (void) commandBuffer;
+    (void) bindlessTable;
+}
+
 static void D3D11_PushComputeUniformData(
     SDL_GpuCommandBuffer *commandBuffer,
     Uint32 slotIndex,
@@ -5152,6 +6605,8 @@ static void D3D11_EndComputePass(
     );
 
     d3d11CommandBuffer->computePipeline = NULL;
+
+    D3D11_INTERNAL_EndPassTiming(d3d11CommandBuffer);
 }
 
 /* Fence Cleanup */
@@ -5191,12 +6646,200 @@ static void D3D11_ReleaseFence(
     }
 }
 
+/* Memory Management */
+
+static SDL_bool D3D11_Defragment(
+	SDL_GpuRenderer *driverData,
+	Uint32 maxBytes,
+	Uint32 maxMilliseconds
+) {
+	/* The D3D11 runtime owns resource placement, nothing to do here */
+	(void) driverData;
+	(void) maxBytes;
+	(void) maxMilliseconds;
+	return SDL_FALSE;
+}
+
+static void D3D11_GetFrameStats(
+	SDL_GpuRenderer *driverData,
+	SDL_GpuFrameStats *stats
+) {
+	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+
+	SDL_LockMutex(renderer->contextLock);
+	AccumulateFrameStats(stats, &renderer->frameStats);
+	SDL_zero(renderer->frameStats);
+	SDL_UnlockMutex(renderer->contextLock);
+}
+
+static void D3D11_GetMemoryStats(
+	SDL_GpuRenderer *driverData,
+	SDL_GpuMemoryStats *stats
+) {
+	D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+	IDXGIAdapter3 *adapter3;
+	DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo;
+	DXGI_ADAPTER_DESC1 adapterDesc;
+	HRESULT res;
+
+	/* Heap 0 is the local segment group (video memory), heap 1 is the non-local one */
+	IDXGIAdapter1_GetDesc1(renderer->adapter, &adapterDesc);
+
+	stats->heapCount = 2;
+	stats->heaps[0].deviceLocal = SDL_TRUE;
+	stats->heaps[0].budgetBytes = adapterDesc.DedicatedVideoMemory;
+	stats->heaps[1].deviceLocal = SDL_FALSE;
+	stats->heaps[1].budgetBytes = adapterDesc.SharedSystemMemory;
+
+	/* IDXGIAdapter3 needs Windows 10, older systems only get the static sizes */
+	res = IDXGIAdapter1_QueryInterface(
+		renderer->adapter,
+		&D3D_IID_IDXGIAdapter3,
+		(void**) &adapter3
+	);
+	if (SUCCEEDED(res))
+	{
+		for (Uint32 i = 0; i < stats->heapCount; i += 1)
+		{
+			res = IDXGIAdapter3_QueryVideoMemoryInfo(
+				adapter3,
+				0,
+				i == 0 ? DXGI_MEMORY_SEGMENT_GROUP_LOCAL : DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL,
+				&memoryInfo
+			);
+			if (SUCCEEDED(res))
+			{
+				stats->heaps[i].budgetBytes = memoryInfo.Budget;
+				stats->heaps[i].usageBytes = memoryInfo.CurrentUsage;
+			}
+		}
+
+		IDXGIAdapter3_Release(adapter3);
+	}
+
+	/* The runtime owns resource placement, so everything in use counts as allocated */
+	for (Uint32 i = 0; i < stats->heapCount; i += 1)
+	{
+		stats->heaps[i].allocatedBytes = stats->heaps[i].usageBytes;
+		stats->heaps[i].usedBytes = stats->heaps[i].usageBytes;
+	}
+
+	stats->bufferCount = (Uint32) SDL_AtomicGet(&renderer->liveBufferCount);
+	stats->textureCount = (Uint32) SDL_AtomicGet(&renderer->liveTextureCount);
+}
+
 /* Cleanup */
 
-static void D3D11_INTERNAL_CleanCommandBuffer(
-	D3D11Renderer *renderer,
-	D3D11CommandBuffer *commandBuffer
-) {
+/* Called with the context lock held once the command buffer has completed */
+static void D3D11_INTERNAL_ResolvePassTimings(
+	D3D11Renderer *renderer,
+	D3D11CommandBuffer *commandBuffer
+) {
+	D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+	Uint64 begin, end;
+	HRESULT res;
+
+	res = ID3D11DeviceContext_GetData(
+		renderer->immediateContext,
+		(ID3D11Asynchronous*) commandBuffer->passTimingDisjointQuery,
+		&disjointData,
+		sizeof(disjointData),
+		0
+	);
+
+	/* A disjoint interval means the clock changed mid-frame, so the ticks are meaningless */
+	if (res != S_OK || disjointData.Disjoint || disjointData.Frequency == 0)
+	{
+		return;
+	}
+
+	for (Uint32 i = 0; i < commandBuffer->passTimingCount; i += 1)
+	{
+		if (
+			ID3D11DeviceContext_GetData(
+				renderer->immediateContext,
+				(ID3D11Asynchronous*) commandBuffer->passTimingQueries[i * 2],
+				&begin,
+				sizeof(begin),
+				0
+			) != S_OK ||
+			ID3D11DeviceContext_GetData(
+				renderer->immediateContext,
+				(ID3D11Asynchronous*) commandBuffer->passTimingQueries[i * 2 + 1],
+				&end,
+				sizeof(end),
+				0
+			) != S_OK
+		) {
+			return;
+		}
+
+		commandBuffer->fence->passTimings[i].passType = commandBuffer->passTimingTypes[i];
+		commandBuffer->fence->passTimings[i].durationNanoseconds = (Uint64) (
+			(double) (end - begin) * 1000000000.0 / (double) disjointData.Frequency
+		);
+	}
+
+	commandBuffer->fence->passTimingCount = commandBuffer->passTimingCount;
+}
+
+/* Called with the context lock held once the command buffer has completed */
+static void D3D11_INTERNAL_ResolvePipelineStatistics(
+	D3D11Renderer *renderer,
+	D3D11CommandBuffer *commandBuffer
+) {
+	D3D11_QUERY_DATA_PIPELINE_STATISTICS statistics;
+
+	if (ID3D11DeviceContext_GetData(
+		renderer->immediateContext,
+		(ID3D11Asynchronous*) commandBuffer->pipelineStatisticsQuery,
+		&statistics,
+		sizeof(statistics),
+		0
+	) != S_OK) {
+		return;
+	}
+
+	renderer->frameStats.inputAssemblyVertices += statistics.IAVertices;
+	renderer->frameStats.vertexShaderInvocations += statistics.VSInvocations;
+	renderer->frameStats.clippingPrimitives += statistics.CInvocations;
+	renderer->frameStats.fragmentShaderInvocations += statistics.PSInvocations;
+	renderer->frameStats.computeShaderInvocations += statistics.CSInvocations;
+}
+
+static void D3D11_INTERNAL_CleanCommandBuffer(
+	D3D11Renderer *renderer,
+	D3D11CommandBuffer *commandBuffer
+) {
+	/* Sub passes hold their own references until the primary has finished executing */
+	for (Uint32 i = 0; i < commandBuffer->subPassCommandBufferCount; i += 1)
+	{
+		D3D11_INTERNAL_CleanCommandBuffer(
+			renderer,
+			commandBuffer->subPassCommandBuffers[i]
+		);
+	}
+	commandBuffer->subPassCommandBufferCount = 0;
+	commandBuffer->firstSubPassIndex = 0;
+
+	/* Nobody can read pass timings from an auto-released fence */
+	if (commandBuffer->passTimingEnabled)
+	{
+		if (!commandBuffer->autoReleaseFence)
+		{
+			D3D11_INTERNAL_ResolvePassTimings(renderer, commandBuffer);
+		}
+
+		commandBuffer->passTimingEnabled = 0;
+		commandBuffer->passTimingCount = 0;
+	}
+
+	if (commandBuffer->pipelineStatisticsEnabled)
+	{
+		D3D11_INTERNAL_ResolvePipelineStatistics(renderer, commandBuffer);
+		commandBuffer->pipelineStatisticsEnabled = 0;
+	}
+
 	/* Reference Counting */
 
 	for (Uint32 i = 0; i < commandBuffer->usedBufferCount; i += 1)
@@ -5261,6 +6904,8 @@ static void D3D11_INTERNAL_PerformPendingDestroys(
     Sint32 i;
     Uint32 j, k;
 
+	SDL_LockMutex(renderer->disposeLock);
+
 	for (i = renderer->transferBufferContainersToDestroyCount - 1; i >= 0; i -= 1)
 	{
         referenceCount = 0;
@@ -5290,6 +6935,11 @@ static void D3D11_INTERNAL_PerformPendingDestroys(
 
         if (referenceCount == 0)
         {
+            SDL_AtomicAdd(
+                &renderer->liveBufferCount,
+                -(int) renderer->bufferContainersToDestroy[i]->bufferCount
+            );
+
             D3D11_INTERNAL_DestroyBufferContainer(
                 renderer->bufferContainersToDestroy[i]
             );
@@ -5312,6 +6962,11 @@ static void D3D11_INTERNAL_PerformPendingDestroys(
 
         if (referenceCount == 0)
         {
+            SDL_AtomicAdd(
+                &renderer->liveTextureCount,
+                -(int) renderer->textureContainersToDestroy[i]->textureCount
+            );
+
             D3D11_INTERNAL_DestroyTextureContainer(
                 renderer->textureContainersToDestroy[i]
             );
@@ -5320,6 +6975,8 @@ static void D3D11_INTERNAL_PerformPendingDestroys(
             renderer->textureContainersToDestroyCount -= 1;
         }
     }
+
+	SDL_UnlockMutex(renderer->disposeLock);
 }
 
 /* Fences */
@@ -6128,6 +7785,22 @@ static void D3D11_Submit(
 		(ID3D11Asynchronous*) d3d11CommandBuffer->fence->handle
 	);
 
+	if (d3d11CommandBuffer->passTimingEnabled)
+	{
+		ID3D11DeviceContext_End(
+			d3d11CommandBuffer->context,
+			(ID3D11Asynchronous*) d3d11CommandBuffer->passTimingDisjointQuery
+		);
+	}
+
+	if (d3d11CommandBuffer->pipelineStatisticsEnabled)
+	{
+		ID3D11DeviceContext_End(
+			d3d11CommandBuffer->context,
+			(ID3D11Asynchronous*) d3d11CommandBuffer->pipelineStatisticsQuery
+		);
+	}
+
 	/* Serialize the commands into the command list */
 	res = ID3D11DeviceContext_FinishCommandList(
 		d3d11CommandBuffer->context,
@@ -6333,6 +8006,313 @@ static SDL_bool D3D11_OcclusionQueryPixelCount(
     return res == S_OK;
 }
 
+static SDL_GpuTimestampQuery* D3D11_CreateTimestampQuery(
+    SDL_GpuRenderer *driverData
+) {
+    D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+	D3D11TimestampQuery *query = (D3D11TimestampQuery*) SDL_malloc(sizeof(D3D11TimestampQuery));
+	D3D11_QUERY_DESC desc;
+	HRESULT res;
+
+    desc.Query = D3D11_QUERY_TIMESTAMP;
+    desc.MiscFlags = 0;
+
+    res = ID3D11Device_CreateQuery(
+        renderer->device,
+        &desc,
+        &query->handle
+    );
+    if (FAILED(res))
+    {
+        SDL_free(query);
+    }
+    ERROR_CHECK_RETURN("Query creation failed", NULL)
+
+    desc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+
+    res = ID3D11Device_CreateQuery(
+        renderer->device,
+        &desc,
+        &query->disjoint
+    );
+    if (FAILED(res))
+    {
+        ID3D11Query_Release(query->handle);
+        SDL_free(query);
+    }
+    ERROR_CHECK_RETURN("Query creation failed", NULL)
+
+    return (SDL_GpuTimestampQuery*) query;
+}
+
+/* Bindless Tables */
+
+/* Shader Model 5.0 has no unbounded resource arrays, so there is nothing to build these on */
+static SDL_GpuBindlessTable* D3D11_CreateBindlessTable(
+    SDL_GpuRenderer *driverData,
+    Uint32 capacity
+) {
+    (void) driverData;
+    (void) capacity;
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless tables are not supported on D3D11!");
+    return NULL;
+}
+
+static void D3D11_UpdateBindlessTable(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuBindlessTable *bindlessTable,
+    Uint32 firstIndex,
+    SDL_GpuTextureSamplerBinding *textureSamplerBindings,
+    Uint32 bindingCount
+) {
+    (void) driverData;
+    (void) bindlessTable;
+    (void) firstIndex;
+    (void) textureSamplerBindings;
+    (void) bindingCount;
+}
+
+static void D3D11_ReleaseBindlessTable(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    (void) driverData;
+    (void) bindlessTable;
+}
+
+static Uint32 D3D11_GetMaxBindlessTableSize(
+    SDL_GpuRenderer *driverData
+) {
+    (void) driverData;
+    return 0;
+}
+
+static SDL_bool D3D11_SupportsIndirectCount(
+    SDL_GpuRenderer *driverData
+) {
+    /* Emulated, see D3D11_INTERNAL_PrepareIndirectCountArgs */
+    (void) driverData;
+    return SDL_TRUE;
+}
+
+static void D3D11_WriteTimestamp(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTimestampQuery *query
+) {
+    D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+	D3D11TimestampQuery *d3dQuery = (D3D11TimestampQuery*) query;
+
+    /* Timestamps are only meaningful inside a disjoint interval */
+    ID3D11DeviceContext1_Begin(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous*) d3dQuery->disjoint
+    );
+    ID3D11DeviceContext1_End(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous*) d3dQuery->handle
+    );
+    ID3D11DeviceContext1_End(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous*) d3dQuery->disjoint
+    );
+}
+
+static SDL_bool D3D11_TimestampQueryResult(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTimestampQuery *query,
+    Uint64 *nanoseconds
+) {
+    D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+	D3D11TimestampQuery *d3dQuery = (D3D11TimestampQuery*) query;
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+    Uint64 ticks;
+    HRESULT res;
+
+    SDL_LockMutex(renderer->contextLock);
+    res = ID3D11DeviceContext_GetData(
+        renderer->immediateContext,
+        (ID3D11Asynchronous*) d3dQuery->disjoint,
+        &disjointData,
+        sizeof(disjointData),
+        0
+    );
+    if (res == S_OK)
+    {
+        res = ID3D11DeviceContext_GetData(
+            renderer->immediateContext,
+            (ID3D11Asynchronous*) d3dQuery->handle,
+            &ticks,
+            sizeof(ticks),
+            0
+        );
+    }
+    SDL_UnlockMutex(renderer->contextLock);
+
+    if (res != S_OK || disjointData.Disjoint || disjointData.Frequency == 0)
+    {
+        return SDL_FALSE;
+    }
+
+    *nanoseconds = (Uint64) (
+        (double) ticks * 1000000000.0 / (double) disjointData.Frequency
+    );
+    return SDL_TRUE;
+}
+
+static void D3D11_EnablePassTiming(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+    D3D11Renderer *renderer = (D3D11Renderer*) d3d11CommandBuffer->renderer;
+	D3D11_QUERY_DESC desc;
+	HRESULT res;
+
+    if (d3d11CommandBuffer->passTimingEnabled)
+    {
+        return;
+    }
+
+    /* Each command buffer owns its queries so recording threads never contend */
+    if (d3d11CommandBuffer->passTimingDisjointQuery == NULL)
+    {
+        desc.MiscFlags = 0;
+
+        for (Uint32 i = 0; i < SDL_GPU_MAX_TIMED_PASSES * 2; i += 1)
+        {
+            desc.Query = D3D11_QUERY_TIMESTAMP;
+            res = ID3D11Device_CreateQuery(
+                renderer->device,
+                &desc,
+                &d3d11CommandBuffer->passTimingQueries[i]
+            );
+            if (FAILED(res))
+            {
+                while (i > 0)
+                {
+                    i -= 1;
+                    ID3D11Query_Release(d3d11CommandBuffer->passTimingQueries[i]);
+                }
+            }
+            ERROR_CHECK_RETURN("Query creation failed", )
+        }
+
+        desc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+        res = ID3D11Device_CreateQuery(
+            renderer->device,
+            &desc,
+            &d3d11CommandBuffer->passTimingDisjointQuery
+        );
+        if (FAILED(res))
+        {
+            d3d11CommandBuffer->passTimingDisjointQuery = NULL;
+            for (Uint32 i = 0; i < SDL_GPU_MAX_TIMED_PASSES * 2; i += 1)
+            {
+                ID3D11Query_Release(d3d11CommandBuffer->passTimingQueries[i]);
+            }
+        }
+        ERROR_CHECK_RETURN("Query creation failed", )
+    }
+
+    /* Ended in D3D11_Submit */
+    ID3D11DeviceContext1_Begin(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous*) d3d11CommandBuffer->passTimingDisjointQuery
+    );
+
+    d3d11CommandBuffer->passTimingEnabled = 1;
+    d3d11CommandBuffer->passTimingCount = 0;
+}
+
+static void D3D11_EnablePipelineStatistics(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer*) commandBuffer;
+    D3D11Renderer *renderer = (D3D11Renderer*) d3d11CommandBuffer->renderer;
+	D3D11_QUERY_DESC desc;
+	HRESULT res;
+
+    if (d3d11CommandBuffer->pipelineStatisticsEnabled)
+    {
+        return;
+    }
+
+    /* Each command buffer owns its query so recording threads never contend */
+    if (d3d11CommandBuffer->pipelineStatisticsQuery == NULL)
+    {
+        desc.Query = D3D11_QUERY_PIPELINE_STATISTICS;
+        desc.MiscFlags = 0;
+
+        res = ID3D11Device_CreateQuery(
+            renderer->device,
+            &desc,
+            &d3d11CommandBuffer->pipelineStatisticsQuery
+        );
+        if (FAILED(res))
+        {
+            d3d11CommandBuffer->pipelineStatisticsQuery = NULL;
+        }
+        ERROR_CHECK_RETURN("Query creation failed", )
+    }
+
+    /* Ended in D3D11_Submit */
+    ID3D11DeviceContext1_Begin(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous*) d3d11CommandBuffer->pipelineStatisticsQuery
+    );
+
+    d3d11CommandBuffer->pipelineStatisticsEnabled = 1;
+}
+
+static Uint32 D3D11_GetPassTimings(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuFence *fence,
+    SDL_GpuPassTiming *timings,
+    Uint32 maxTimings
+) {
+    D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+    D3D11Fence *d3d11Fence = (D3D11Fence*) fence;
+    BOOL queryData;
+    Uint32 count;
+    HRESULT res;
+
+    if (!D3D11_QueryFence(driverData, fence))
+    {
+        return 0;
+    }
+
+    SDL_LockMutex(renderer->contextLock);
+
+    /* Timings are resolved when the command buffer is cleaned */
+	for (Sint32 i = renderer->submittedCommandBufferCount - 1; i >= 0; i -= 1)
+	{
+		res = ID3D11DeviceContext_GetData(
+			renderer->immediateContext,
+			(ID3D11Asynchronous*) renderer->submittedCommandBuffers[i]->fence->handle,
+			&queryData,
+			sizeof(queryData),
+			0
+		);
+		if (res == S_OK)
+		{
+			D3D11_INTERNAL_CleanCommandBuffer(
+				renderer,
+				renderer->submittedCommandBuffers[i]
+			);
+		}
+	}
+
+    count = SDL_min(d3d11Fence->passTimingCount, maxTimings);
+    SDL_memcpy(
+        timings,
+        d3d11Fence->passTimings,
+        sizeof(SDL_GpuPassTiming) * count
+    );
+
+    SDL_UnlockMutex(renderer->contextLock);
+
+    return count;
+}
+
 /* Format Info */
 
 static SDL_bool D3D11_IsTextureFormatSupported(
@@ -6437,14 +8417,60 @@ static SDL_GpuSampleCount D3D11_GetBestSampleCount(
     return (SDL_GpuSampleCount) SDL_min(maxSupported, desiredSampleCount);
 }
 
-/* SPIR-V Cross Interop */
+/* Pipeline Cache */
 
-extern SDL_GpuShader* D3D11_CompileFromSPIRVCross(
+static SDL_bool D3D11_GetPipelineCacheData(
     SDL_GpuRenderer *driverData,
-    SDL_GpuShaderStage shader_stage,
-    const char *entryPointName,
-    const char *source
-);
+    void *data,
+    size_t *dataSize
+) {
+    D3D11Renderer *renderer = (D3D11Renderer*) driverData;
+    size_t payloadSize = 0;
+    Uint8 *cursor;
+    Uint64 size;
+
+    SDL_LockMutex(renderer->shaderCacheLock);
+
+    for (Uint32 i = 0; i < renderer->cachedBytecodeCount; i += 1)
+    {
+        payloadSize += sizeof(Uint64) * 2 + renderer->cachedBytecodes[i].size;
+    }
+
+    if (data == NULL)
+    {
+        SDL_UnlockMutex(renderer->shaderCacheLock);
+        *dataSize = sizeof(PipelineCacheHeader) + payloadSize;
+        return SDL_TRUE;
+    }
+
+    if (*dataSize < sizeof(PipelineCacheHeader) + payloadSize)
+    {
+        SDL_UnlockMutex(renderer->shaderCacheLock);
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Pipeline cache data buffer is too small!");
+        return SDL_FALSE;
+    }
+
+    cursor = (Uint8*) PipelineCache_WriteHeader(
+        &renderer->pipelineCacheIdentity,
+        payloadSize,
+        data
+    );
+
+    for (Uint32 i = 0; i < renderer->cachedBytecodeCount; i += 1)
+    {
+        size = renderer->cachedBytecodes[i].size;
+        SDL_memcpy(cursor, &renderer->cachedBytecodes[i].hash, sizeof(Uint64));
+        SDL_memcpy(cursor + sizeof(Uint64), &size, sizeof(Uint64));
+        cursor += sizeof(Uint64) * 2;
+        SDL_memcpy(cursor, renderer->cachedBytecodes[i].code, renderer->cachedBytecodes[i].size);
+        cursor += renderer->cachedBytecodes[i].size;
+    }
+
+    SDL_UnlockMutex(renderer->shaderCacheLock);
+
+    *dataSize = sizeof(PipelineCacheHeader) + payloadSize;
+    return SDL_TRUE;
+}
 
 /* Device Creation */
 
@@ -6683,6 +8709,8 @@ static void D3D11_INTERNAL_InitBlitPipelines(
     blitPipelineCreateInfo.fragmentResourceInfo.storageBufferCount = 0;
     blitPipelineCreateInfo.fragmentResourceInfo.uniformBufferCount = 0;
 
+    blitPipelineCreateInfo.useBindlessTable = SDL_FALSE;
+
     renderer->blitFrom2DPipeline = D3D11_CreateGraphicsPipeline(
         (SDL_GpuRenderer*) renderer,
         &blitPipelineCreateInfo
@@ -6758,8 +8786,11 @@ static void D3D11_INTERNAL_DestroyBlitPipelines(
 	D3D11_ReleaseShader(driverData, renderer->blitFrom2DArrayPixelShader);
 }
 
-static SDL_GpuDevice* D3D11_CreateDevice(SDL_bool debugMode)
-{
+static SDL_GpuDevice* D3D11_CreateDevice(
+	SDL_bool debugMode,
+	const void *pipelineCacheData,
+	size_t pipelineCacheSize
+) {
 	D3D11Renderer *renderer;
 	PFN_CREATE_DXGI_FACTORY1 CreateDXGIFactoryFunc;
 	PFN_D3D11_CREATE_DEVICE D3D11CreateDeviceFunc;
@@ -6769,6 +8800,9 @@ static SDL_GpuDevice* D3D11_CreateDevice(SDL_bool debugMode)
 	IDXGIFactory6 *factory6;
 	Uint32 flags;
 	DXGI_ADAPTER_DESC1 adapterDesc;
+	LARGE_INTEGER umdVersion;
+	const void *bytecodeCacheData;
+	size_t bytecodeCacheSize;
 	HRESULT res;
 	SDL_GpuDevice* result;
 
@@ -6962,9 +8996,47 @@ tryCreateDevice:
 
 	/* Create mutexes */
 	renderer->contextLock = SDL_CreateMutex();
+	renderer->disposeLock = SDL_CreateMutex();
 	renderer->acquireCommandBufferLock = SDL_CreateMutex();
 	renderer->fenceLock = SDL_CreateMutex();
 	renderer->windowLock = SDL_CreateMutex();
+	renderer->shaderCacheLock = SDL_CreateMutex();
+
+	/* Seed the bytecode cache, if the blob came from this adapter and driver */
+	renderer->pipelineCacheIdentity.backend = SDL_GPU_BACKEND_D3D11;
+	renderer->pipelineCacheIdentity.vendorID = adapterDesc.VendorId;
+	renderer->pipelineCacheIdentity.deviceID = adapterDesc.DeviceId;
+	res = IDXGIAdapter1_CheckInterfaceSupport(
+		renderer->adapter,
+		&D3D_IID_IDXGIDevice,
+		&umdVersion
+	);
+	if (SUCCEEDED(res))
+	{
+		renderer->pipelineCacheIdentity.driverVersion = (Uint64) umdVersion.QuadPart;
+	}
+	/* DXGI has no device UUID, the subsystem and revision are the closest thing */
+	SDL_memcpy(
+		renderer->pipelineCacheIdentity.deviceUUID,
+		&adapterDesc.SubSysId,
+		sizeof(adapterDesc.SubSysId)
+	);
+	SDL_memcpy(
+		renderer->pipelineCacheIdentity.deviceUUID + sizeof(adapterDesc.SubSysId),
+		&adapterDesc.Revision,
+		sizeof(adapterDesc.Revision)
+	);
+
+	bytecodeCacheData = PipelineCache_GetPayload(
+		&renderer->pipelineCacheIdentity,
+		pipelineCacheData,
+		pipelineCacheSize,
+		&bytecodeCacheSize
+	);
+	if (bytecodeCacheData != NULL)
+	{
+		D3D11_INTERNAL_LoadBytecodeCache(renderer, bytecodeCacheData, bytecodeCacheSize);
+	}
 
 	/* Initialize miscellaneous renderer members */
 	renderer->debugMode = (flags & D3D11_CREATE_DEVICE_DEBUG);
@@ -114,6 +114,19 @@ extern SDL_GpuShader* D3D11_CreateShader(
 	SDL_GpuShaderCreateInfo *shaderCreateInfo
 );
 
+extern void* D3D11_INTERNAL_FetchCachedBytecode(
+	SDL_GpuRenderer *driverData,
+	Uint64 hash,
+	size_t *size
+);
+
+extern void D3D11_INTERNAL_CacheBytecode(
+	SDL_GpuRenderer *driverData,
+	Uint64 hash,
+	const void *code,
+	size_t size
+);
+
 SDL_GpuShader* D3D11_CompileFromSPIRVCross(
 	SDL_GpuRenderer *driverData,
 	SDL_GpuShaderStage shader_stage,
@@ -126,6 +139,44 @@ SDL_GpuShader* D3D11_CompileFromSPIRVCross(
 	SDL_GpuShaderCreateInfo createInfo;
 	SDL_GpuShader *shader;
 	const char *profile;
+	size_t sourceLength;
+	Uint64 hash;
+	void *cachedCode;
+	size_t cachedCodeSize;
+
+	if (shader_stage == SDL_GPU_SHADERSTAGE_VERTEX)
+	{
+		profile = "vs_5_0";
+	}
+	else if (shader_stage == SDL_GPU_SHADERSTAGE_FRAGMENT)
+	{
+		profile = "ps_5_0";
+	}
+	else if (shader_stage == SDL_GPU_SHADERSTAGE_COMPUTE)
+	{
+		profile = "cs_5_0";
+	}
+	else
+	{
+		SDL_SetError("%s", "Unrecognized shader stage!");
+		return NULL;
+	}
+
+	/* Skip the compiler entirely if we've seen this source before */
+	sourceLength = SDL_strlen(source);
+	hash = HashBytes(profile, SDL_strlen(profile), HASH_SEED);
+	hash = HashBytes(source, sourceLength, hash);
+
+	cachedCode = D3D11_INTERNAL_FetchCachedBytecode(driverData, hash, &cachedCodeSize);
+	if (cachedCode != NULL)
+	{
+		createInfo.code = cachedCode;
+		createInfo.codeSize = cachedCodeSize;
+		createInfo.format = SDL_GPU_SHADERFORMAT_DXBC;
+		createInfo.stage = shader_stage;
+		createInfo.entryPointName = entryPointName;
+		return D3D11_CreateShader(driverData, &createInfo);
+	}
 
 	/* FIXME: d3dcompiler could probably be loaded in a better spot */
 
@@ -147,28 +198,10 @@ SDL_GpuShader* D3D11_CompileFromSPIRVCross(
 		}
 	}
 
-	if (shader_stage == SDL_GPU_SHADERSTAGE_VERTEX)
-	{
-		profile = "vs_5_0";
-	}
-	else if (shader_stage == SDL_GPU_SHADERSTAGE_FRAGMENT)
-	{
-		profile = "ps_5_0";
-	}
-	else if (shader_stage == SDL_GPU_SHADERSTAGE_COMPUTE)
-	{
-		profile = "cs_5_0";
-	}
-	else
-	{
-		SDL_SetError("%s", "Unrecognized shader stage!");
-		return NULL;
-	}
-
 	/* Compile! */
 	result = D3DCompile_func(
 		source,
-		SDL_strlen(source),
+		sourceLength,
 		NULL,
 		NULL,
 		NULL,
@@ -193,6 +226,16 @@ SDL_GpuShader* D3D11_CompileFromSPIRVCross(
 	createInfo.entryPointName = entryPointName;
 	shader = D3D11_CreateShader(driverData, &createInfo);
 
+	if (shader != NULL)
+	{
+		D3D11_INTERNAL_CacheBytecode(
+			driverData,
+			hash,
+			createInfo.code,
+			createInfo.codeSize
+		);
+	}
+
 	/* Clean up */
 	ID3D10Blob_Release(blob);
 
@@ -29,8 +29,11 @@
  /* Defines */
 
 #define METAL_MAX_BUFFER_COUNT 31
+#define METAL_BINDLESS_BUFFER_INDEX (METAL_MAX_BUFFER_COUNT - 1 - MAX_BUFFER_BINDINGS)
+#define METAL_MAX_BINDLESS_TABLE_SIZE 2048 /* Tier 2 argument buffers allow 500000 textures, but only 2048 samplers */
 #define WINDOW_PROPERTY_DATA "SDL_GpuMetalWindowPropertyData"
 #define UBO_BUFFER_SIZE 1048576 /* 1 MiB */
+#define HEAP_SIZE 67108864 /* 64 MiB */
 
 #define NOT_IMPLEMENTED SDL_assert(0 && "Not implemented!");
 
@@ -70,6 +73,7 @@
 /* Forward Declarations */
 
 static void METAL_Wait(SDL_GpuRenderer *driverData);
+static void METAL_INTERNAL_DestroyHeap(struct MetalHeap *heap);
 static void METAL_UnclaimWindow(
     SDL_GpuRenderer *driverData,
     SDL_Window *window
@@ -340,6 +344,11 @@ typedef struct MetalTexture
 {
     id<MTLTexture> handle;
     SDL_AtomicInt referenceCount;
+
+    /* Transient textures only have memory while a command buffer is using them,
+     * taken from that command buffer's transient heap.
+     */
+    struct MetalCommandBuffer *transientOwner;
 } MetalTexture;
 
 typedef struct MetalTextureContainer
@@ -347,6 +356,7 @@ typedef struct MetalTextureContainer
     SDL_GpuTextureCreateInfo createInfo;
     MetalTexture *activeTexture;
     Uint8 canBeCycled;
+    Uint8 isTransient;
 
     Uint32 textureCapacity;
     Uint32 textureCount;
@@ -358,6 +368,10 @@ typedef struct MetalTextureContainer
 typedef struct MetalFence
 {
     SDL_AtomicInt complete;
+
+    /* Filled in when the command buffer is cleaned, see SDL_GpuGetPassTimings */
+    SDL_GpuPassTiming passTimings[SDL_GPU_MAX_TIMED_PASSES];
+    Uint32 passTimingCount;
 } MetalFence;
 
 typedef struct MetalWindowData
@@ -436,6 +450,11 @@ typedef struct MetalTransferBufferContainer
 
 typedef struct MetalRenderer MetalRenderer;
 
+typedef struct MetalHeap
+{
+    id<MTLHeap> handle;
+} MetalHeap;
+
 typedef struct MetalCommandBuffer
 {
     CommandBufferCommonHeader common;
@@ -454,6 +473,14 @@ typedef struct MetalCommandBuffer
     Uint32 indexBufferOffset;
     SDL_GpuIndexElementSize indexElementSize;
 
+    /* Parallel Render Pass, sub passes encode in the order they were acquired */
+    id<MTLParallelRenderCommandEncoder> parallelRenderEncoder;
+    MTLViewport defaultViewport;
+    MTLScissorRect defaultScissorRect;
+    struct MetalCommandBuffer **subPassCommandBuffers;
+    Uint32 subPassCommandBufferCount;
+    Uint32 subPassCommandBufferCapacity;
+
     /* Copy Pass */
     id<MTLBlitCommandEncoder> blitEncoder;
 
@@ -461,6 +488,12 @@ typedef struct MetalCommandBuffer
     MetalFence *fence;
     Uint8 autoReleaseFence;
 
+    /* Pass timing, this is an id<MTLCounterSampleBuffer> created on first use */
+    id passTimingSampleBuffer;
+    SDL_GpuPassType passTimingTypes[SDL_GPU_MAX_TIMED_PASSES];
+    Uint32 passTimingCount;
+    Uint8 passTimingEnabled;
+
     /* Reference Counting */
     MetalBuffer **usedBuffers;
     Uint32 usedBufferCount;
@@ -473,6 +506,19 @@ typedef struct MetalCommandBuffer
     MetalTexture **usedTextures;
     Uint32 usedTextureCount;
     Uint32 usedTextureCapacity;
+
+    struct MetalBindlessTable **usedBindlessTables;
+    Uint32 usedBindlessTableCount;
+    Uint32 usedBindlessTableCapacity;
+
+    /* Transient textures alias each other inside this heap, which is only
+     * reused once the command buffer has completed. It grows on demand.
+     */
+    MetalHeap *transientHeap;
+    NSUInteger transientHeapSize;
+    MetalTexture **transientTextures;
+    Uint32 transientTextureCount;
+    Uint32 transientTextureCapacity;
 } MetalCommandBuffer;
 
 typedef struct MetalSampler
@@ -480,6 +526,24 @@ typedef struct MetalSampler
     id<MTLSamplerState> handle;
 } MetalSampler;
 
+/* Argument buffer with "capacity" textures followed by "capacity" samplers.
+ * The table holds a reference on every texture it points to,
+ * but sampler states are not retained and must outlive the table.
+ */
+typedef struct MetalBindlessTable
+{
+    id<MTLArgumentEncoder> encoder;
+    id<MTLBuffer> argumentBuffer;
+    Uint32 capacity;
+    MetalTexture **textures;
+    SDL_AtomicInt referenceCount;
+} MetalBindlessTable;
+
+typedef struct MetalTimestampQuery
+{
+    id sampleBuffer; /* id<MTLCounterSampleBuffer> with a single sample */
+} MetalTimestampQuery;
+
 struct MetalRenderer
 {
     id<MTLDevice> device;
@@ -515,11 +579,43 @@ struct MetalRenderer
     Uint32 textureContainersToDestroyCount;
     Uint32 textureContainersToDestroyCapacity;
 
+    MetalBindlessTable **bindlessTablesToDestroy;
+    Uint32 bindlessTablesToDestroyCount;
+    Uint32 bindlessTablesToDestroyCapacity;
+
+    /* Private buffers and textures are sub-allocated from these.
+     * Heaps need tracked hazards to behave like device allocations,
+     * so this is unused before macOS 10.15 / iOS 13.
+     */
+    Uint8 useHeaps;
+    MetalHeap **heaps;
+    Uint32 heapCount;
+    Uint32 heapCapacity;
+
+    /* Reported by SDL_GpuGetMemoryStats */
+    SDL_AtomicInt liveBufferCount;
+    SDL_AtomicInt liveTextureCount;
+
+    /* Pipeline cache, seeded from and exported to SDL_GpuGetPipelineCacheData blobs.
+     * This is an id<MTLBinaryArchive>, or nil before macOS 11 / iOS 14.
+     */
+    id binaryArchive;
+    PipelineCacheHeader pipelineCacheIdentity;
+
+    /* Timestamp counters. This is an id<MTLCounterSet>, or nil if the device
+     * cannot sample timestamps at encoder boundaries.
+     * GPU ticks are converted to nanoseconds against the calibration pair.
+     */
+    id timestampCounterSet;
+    MTLTimestamp calibrationCpuTimestamp;
+    MTLTimestamp calibrationGpuTimestamp;
+
     SDL_Mutex *submitLock;
     SDL_Mutex *acquireCommandBufferLock;
     SDL_Mutex *disposeLock;
     SDL_Mutex *fenceLock;
     SDL_Mutex *windowLock;
+    SDL_Mutex *heapLock;
 };
 
 /* Helper Functions */
@@ -537,6 +633,12 @@ static inline Uint32 METAL_INTERNAL_NextHighestAlignment(
     return align * ((n + align - 1) / align);
 }
 
+static NSURL* METAL_INTERNAL_GetTemporaryArchiveURL(void)
+{
+    NSString *fileName = [NSString stringWithFormat:@"SDL_gpu_%@.metallib", [[NSUUID UUID] UUIDString]];
+    return [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:fileName]];
+}
+
 /* Quit */
 
 static void METAL_DestroyDevice(SDL_GpuDevice *device)
@@ -560,11 +662,24 @@ static void METAL_DestroyDevice(SDL_GpuDevice *device)
         SDL_free(commandBuffer->usedBuffers);
         SDL_free(commandBuffer->usedTransferBuffers);
         SDL_free(commandBuffer->usedTextures);
+        SDL_free(commandBuffer->usedBindlessTables);
+        SDL_free(commandBuffer->transientTextures);
+        METAL_INTERNAL_DestroyHeap(commandBuffer->transientHeap);
+        SDL_free(commandBuffer->subPassCommandBuffers);
         SDL_free(commandBuffer);
     }
     SDL_free(renderer->availableCommandBuffers);
     SDL_free(renderer->submittedCommandBuffers);
 
+    SDL_free(renderer->bindlessTablesToDestroy);
+
+    /* Release the heaps, everything allocated from them is gone by now */
+    for (Uint32 i = 0; i < renderer->heapCount; i += 1)
+    {
+        METAL_INTERNAL_DestroyHeap(renderer->heaps[i]);
+    }
+    SDL_free(renderer->heaps);
+
     /* Release fence infrastructure */
     for (Uint32 i = 0; i < renderer->availableFenceCount; i += 1)
     {
@@ -573,12 +688,16 @@ static void METAL_DestroyDevice(SDL_GpuDevice *device)
     }
     SDL_free(renderer->availableFences);
 
+    /* Release the pipeline cache */
+    renderer->binaryArchive = nil;
+
     /* Release the mutexes */
     SDL_DestroyMutex(renderer->submitLock);
     SDL_DestroyMutex(renderer->acquireCommandBufferLock);
     SDL_DestroyMutex(renderer->disposeLock);
     SDL_DestroyMutex(renderer->fenceLock);
     SDL_DestroyMutex(renderer->windowLock);
+    SDL_DestroyMutex(renderer->heapLock);
 
     /* Free the primary structures */
     SDL_free(renderer);
@@ -626,6 +745,19 @@ static void METAL_INTERNAL_TrackTexture(
     );
 }
 
+static void METAL_INTERNAL_TrackBindlessTable(
+    MetalCommandBuffer *commandBuffer,
+    MetalBindlessTable *bindlessTable
+) {
+    TRACK_RESOURCE(
+        bindlessTable,
+        MetalBindlessTable*,
+        usedBindlessTables,
+        usedBindlessTableCount,
+        usedBindlessTableCapacity
+    );
+}
+
 /* Disposal */
 
 static void METAL_INTERNAL_DestroyTextureContainer(
@@ -633,6 +765,8 @@ static void METAL_INTERNAL_DestroyTextureContainer(
 ) {
     for (Uint32 i = 0; i < container->textureCount; i += 1)
     {
+        /* Drop the texture now so its heap space is returned */
+        container->textures[i]->handle = nil;
         SDL_free(container->textures[i]);
     }
     SDL_free(container->textures);
@@ -673,12 +807,53 @@ static void METAL_ReleaseSampler(
     SDL_free(metalSampler);
 }
 
+static void METAL_INTERNAL_DestroyBindlessTable(
+    MetalBindlessTable *bindlessTable
+) {
+    for (Uint32 i = 0; i < bindlessTable->capacity; i += 1)
+    {
+        if (bindlessTable->textures[i] != NULL)
+        {
+            (void)SDL_AtomicDecRef(&bindlessTable->textures[i]->referenceCount);
+        }
+    }
+    bindlessTable->encoder = nil;
+    bindlessTable->argumentBuffer = nil;
+    SDL_free(bindlessTable->textures);
+    SDL_free(bindlessTable);
+}
+
+static void METAL_ReleaseBindlessTable(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+
+    SDL_LockMutex(renderer->disposeLock);
+
+    EXPAND_ARRAY_IF_NEEDED(
+        renderer->bindlessTablesToDestroy,
+        MetalBindlessTable*,
+        renderer->bindlessTablesToDestroyCount + 1,
+        renderer->bindlessTablesToDestroyCapacity,
+        renderer->bindlessTablesToDestroyCapacity + 1
+    );
+
+    renderer->bindlessTablesToDestroy[
+        renderer->bindlessTablesToDestroyCount
+    ] = (MetalBindlessTable*) bindlessTable;
+    renderer->bindlessTablesToDestroyCount += 1;
+
+    SDL_UnlockMutex(renderer->disposeLock);
+}
+
 static void METAL_INTERNAL_DestroyBufferContainer(
     MetalBufferContainer *container
 ) {
     for (Uint32 i = 0; i < container->bufferCount; i += 1)
     {
         MetalBuffer *buffer = container->buffers[i];
+        buffer->handle = nil;
         SDL_free(buffer);
     }
     SDL_free(container->buffers);
@@ -777,6 +952,15 @@ static void METAL_ReleaseOcclusionQuery(
     NOT_IMPLEMENTED
 }
 
+static void METAL_ReleaseTimestampQuery(
+    SDL_GpuRenderer *renderer,
+    SDL_GpuTimestampQuery *query
+) {
+    MetalTimestampQuery *metalQuery = (MetalTimestampQuery*) query;
+    metalQuery->sampleBuffer = nil;
+    SDL_free(metalQuery);
+}
+
 /* Pipeline Creation */
 
 static SDL_GpuComputePipeline* METAL_CreateComputePipeline(
@@ -899,6 +1083,26 @@ static SDL_GpuGraphicsPipeline* METAL_CreateGraphicsPipeline(
 
     /* FIXME */
 
+    /* Look up, or record, the compiled functions in the binary archive */
+
+    if (renderer->binaryArchive != nil)
+    {
+        if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *))
+        {
+            id<MTLBinaryArchive> archive = renderer->binaryArchive;
+
+            pipelineDescriptor.binaryArchives = @[archive];
+            if (![archive addRenderPipelineFunctionsWithDescriptor:pipelineDescriptor error:&error])
+            {
+                SDL_LogWarn(
+                    SDL_LOG_CATEGORY_APPLICATION,
+                    "Adding render pipeline to binary archive failed: %s", [[error description] UTF8String]
+                );
+                error = NULL;
+            }
+        }
+    }
+
     /* Create the graphics pipeline */
 
     pipelineState = [renderer->device newRenderPipelineStateWithDescriptor:pipelineDescriptor error:&error];
@@ -972,6 +1176,237 @@ static void METAL_SetStringMarker(
     NOT_IMPLEMENTED
 }
 
+/* Heaps */
+
+static void METAL_INTERNAL_DestroyHeap(
+    MetalHeap *heap
+) {
+    if (heap == NULL)
+    {
+        return;
+    }
+
+    heap->handle = nil;
+    SDL_free(heap);
+}
+
+static MetalHeap* METAL_INTERNAL_CreateHeap(
+    MetalRenderer *renderer,
+    NSUInteger sizeInBytes
+) {
+    MTLHeapDescriptor *heapDescriptor = [MTLHeapDescriptor new];
+    id<MTLHeap> handle;
+    MetalHeap *heap;
+
+    heapDescriptor.size = sizeInBytes;
+    heapDescriptor.storageMode = MTLStorageModePrivate;
+    heapDescriptor.cpuCacheMode = MTLCPUCacheModeDefaultCache;
+    if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, *))
+    {
+        /* A tracked heap is hazard tracked as a whole, which also orders aliased resources */
+        heapDescriptor.hazardTrackingMode = MTLHazardTrackingModeTracked;
+    }
+
+    handle = [renderer->device newHeapWithDescriptor:heapDescriptor];
+    if (handle == nil)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create MTLHeap!");
+        return NULL;
+    }
+
+    heap = (MetalHeap*) SDL_malloc(sizeof(MetalHeap));
+    heap->handle = handle;
+    return heap;
+}
+
+/* Returns a heap with room for the allocation, making a new one if needed.
+ * Call with heapLock held.
+ */
+static MetalHeap* METAL_INTERNAL_FindHeap(
+    MetalRenderer *renderer,
+    MTLSizeAndAlign sizeAndAlign
+) {
+    MetalHeap *heap;
+
+    for (Uint32 i = 0; i < renderer->heapCount; i += 1)
+    {
+        if ([renderer->heaps[i]->handle maxAvailableSizeWithAlignment:sizeAndAlign.align] >= sizeAndAlign.size)
+        {
+            return renderer->heaps[i];
+        }
+    }
+
+    heap = METAL_INTERNAL_CreateHeap(
+        renderer,
+        SDL_max((NSUInteger) HEAP_SIZE, sizeAndAlign.size)
+    );
+    if (heap == NULL)
+    {
+        return NULL;
+    }
+
+    EXPAND_ARRAY_IF_NEEDED(
+        renderer->heaps,
+        MetalHeap*,
+        renderer->heapCount + 1,
+        renderer->heapCapacity,
+        renderer->heapCapacity * 2
+    );
+
+    renderer->heaps[renderer->heapCount] = heap;
+    renderer->heapCount += 1;
+
+    return heap;
+}
+
+static id<MTLTexture> METAL_INTERNAL_AllocateTexture(
+    MetalRenderer *renderer,
+    MTLTextureDescriptor *textureDescriptor
+) {
+    id<MTLTexture> texture = nil;
+    MetalHeap *heap;
+
+    if (renderer->useHeaps)
+    {
+        SDL_LockMutex(renderer->heapLock);
+
+        heap = METAL_INTERNAL_FindHeap(
+            renderer,
+            [renderer->device heapTextureSizeAndAlignWithDescriptor:textureDescriptor]
+        );
+        if (heap != NULL)
+        {
+            texture = [heap->handle newTextureWithDescriptor:textureDescriptor];
+        }
+
+        SDL_UnlockMutex(renderer->heapLock);
+    }
+
+    /* Fragmentation can still defeat the heap, the device is always there */
+    if (texture == nil)
+    {
+        texture = [renderer->device newTextureWithDescriptor:textureDescriptor];
+    }
+
+    return texture;
+}
+
+static id<MTLBuffer> METAL_INTERNAL_AllocateBuffer(
+    MetalRenderer *renderer,
+    Uint32 sizeInBytes
+) {
+    id<MTLBuffer> buffer = nil;
+    MetalHeap *heap;
+
+    if (renderer->useHeaps)
+    {
+        SDL_LockMutex(renderer->heapLock);
+
+        heap = METAL_INTERNAL_FindHeap(
+            renderer,
+            [renderer->device heapBufferSizeAndAlignWithLength:sizeInBytes options:MTLResourceStorageModePrivate]
+        );
+        if (heap != NULL)
+        {
+            buffer = [heap->handle newBufferWithLength:sizeInBytes options:MTLResourceStorageModePrivate];
+        }
+
+        SDL_UnlockMutex(renderer->heapLock);
+    }
+
+    if (buffer == nil)
+    {
+        buffer = [renderer->device newBufferWithLength:sizeInBytes options:MTLResourceStorageModePrivate];
+    }
+
+    return buffer;
+}
+
+/* Gives a transient texture memory for the rest of this command buffer, unless it already has some */
+static void METAL_INTERNAL_AcquireTransientTexture(
+    MetalCommandBuffer *commandBuffer,
+    MetalTextureContainer *container
+) {
+    MetalRenderer *renderer = commandBuffer->renderer;
+    MetalTexture *texture = container->activeTexture;
+    MTLTextureDescriptor *textureDescriptor;
+    MTLSizeAndAlign sizeAndAlign;
+    id<MTLTexture> handle = nil;
+
+    if (!container->isTransient || texture->transientOwner == commandBuffer)
+    {
+        return;
+    }
+
+    textureDescriptor = METAL_INTERNAL_CreateTextureDescriptor(&container->createInfo);
+
+    if (renderer->useHeaps)
+    {
+        if (commandBuffer->transientHeap != NULL)
+        {
+            handle = [commandBuffer->transientHeap->handle newTextureWithDescriptor:textureDescriptor];
+        }
+
+        if (handle == nil)
+        {
+            /* Textures placed in the old heap keep it alive until they are dropped at cleanup */
+            sizeAndAlign = [renderer->device heapTextureSizeAndAlignWithDescriptor:textureDescriptor];
+            commandBuffer->transientHeapSize = SDL_max(
+                commandBuffer->transientHeapSize * 2,
+                commandBuffer->transientHeapSize + sizeAndAlign.size
+            );
+
+            METAL_INTERNAL_DestroyHeap(commandBuffer->transientHeap);
+            commandBuffer->transientHeap = METAL_INTERNAL_CreateHeap(
+                renderer,
+                commandBuffer->transientHeapSize
+            );
+
+            if (commandBuffer->transientHeap != NULL)
+            {
+                handle = [commandBuffer->transientHeap->handle newTextureWithDescriptor:textureDescriptor];
+            }
+        }
+    }
+
+    /* No aliasing, but still correct */
+    if (handle == nil)
+    {
+        handle = [renderer->device newTextureWithDescriptor:textureDescriptor];
+    }
+
+    texture->handle = handle;
+    texture->transientOwner = commandBuffer;
+
+    if (renderer->debugMode && container->debugName != NULL)
+    {
+        METAL_INTERNAL_SetTextureName(
+            renderer,
+            texture,
+            container->debugName
+        );
+    }
+
+    for (Uint32 i = 0; i < commandBuffer->transientTextureCount; i += 1)
+    {
+        if (commandBuffer->transientTextures[i] == texture)
+        {
+            return;
+        }
+    }
+
+    EXPAND_ARRAY_IF_NEEDED(
+        commandBuffer->transientTextures,
+        MetalTexture*,
+        commandBuffer->transientTextureCount + 1,
+        commandBuffer->transientTextureCapacity,
+        commandBuffer->transientTextureCapacity * 2
+    );
+
+    commandBuffer->transientTextures[commandBuffer->transientTextureCount] = texture;
+    commandBuffer->transientTextureCount += 1;
+}
+
 /* Resource Creation */
 
 static SDL_GpuSampler* METAL_CreateSampler(
@@ -994,6 +1429,7 @@ static SDL_GpuSampler* METAL_CreateSampler(
     samplerDesc.lodMaxClamp = samplerCreateInfo->maxLod;
     samplerDesc.maxAnisotropy = (samplerCreateInfo->anisotropyEnable) ? samplerCreateInfo->maxAnisotropy : 1;
     samplerDesc.compareFunction = (samplerCreateInfo->compareEnable) ? SDLToMetal_CompareOp[samplerCreateInfo->compareOp] : MTLCompareFunctionAlways;
+    samplerDesc.supportArgumentBuffers = YES; /* Any sampler may end up in a bindless table */
 
     sampler = [renderer->device newSamplerStateWithDescriptor:samplerDesc];
     if (sampler == NULL)
@@ -1067,13 +1503,10 @@ static SDL_GpuShader* METAL_CreateShader(
     return (SDL_GpuShader*) result;
 }
 
-static MetalTexture* METAL_INTERNAL_CreateTexture(
-  MetalRenderer *renderer,
-  SDL_GpuTextureCreateInfo *textureCreateInfo
+static MTLTextureDescriptor* METAL_INTERNAL_CreateTextureDescriptor(
+    SDL_GpuTextureCreateInfo *textureCreateInfo
 ) {
     MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor new];
-    id<MTLTexture> texture;
-    MetalTexture *metalTexture;
 
     /* FIXME: MSAA? */
     if (textureCreateInfo->depth > 1)
@@ -1114,15 +1547,34 @@ static MetalTexture* METAL_INTERNAL_CreateTexture(
     }
     /* FIXME: Other usages! */
 
-    texture = [renderer->device newTextureWithDescriptor:textureDescriptor];
-    if (texture == NULL)
+    return textureDescriptor;
+}
+
+static MetalTexture* METAL_INTERNAL_CreateTexture(
+  MetalRenderer *renderer,
+  SDL_GpuTextureCreateInfo *textureCreateInfo
+) {
+    id<MTLTexture> texture = nil;
+    MetalTexture *metalTexture;
+
+    /* Transient memory is assigned when a command buffer first uses the texture */
+    if (!(textureCreateInfo->usageFlags & SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT))
     {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create MTLTexture!");
-        return NULL;
+        texture = METAL_INTERNAL_AllocateTexture(
+            renderer,
+            METAL_INTERNAL_CreateTextureDescriptor(textureCreateInfo)
+        );
+        if (texture == NULL)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create MTLTexture!");
+            return NULL;
+        }
     }
 
     metalTexture = (MetalTexture*) SDL_malloc(sizeof(MetalTexture));
     metalTexture->handle = texture;
+    SDL_AtomicSet(&metalTexture->referenceCount, 0);
+    metalTexture->transientOwner = NULL;
     return metalTexture;
 }
 
@@ -1146,7 +1598,8 @@ static SDL_GpuTexture* METAL_CreateTexture(
     }
 
     container = SDL_malloc(sizeof(MetalTextureContainer));
-    container->canBeCycled = 1;
+    container->isTransient = (textureCreateInfo->usageFlags & SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT) != 0;
+    container->canBeCycled = !container->isTransient;
     container->createInfo = *textureCreateInfo;
     container->activeTexture = texture;
     container->textureCapacity = 1;
@@ -1157,6 +1610,8 @@ static SDL_GpuTexture* METAL_CreateTexture(
     container->textures[0] = texture;
     container->debugName = NULL;
 
+    SDL_AtomicIncRef(&renderer->liveTextureCount);
+
     return (SDL_GpuTexture*) container;
 }
 
@@ -1183,6 +1638,7 @@ static void METAL_INTERNAL_CycleActiveTexture(
         &container->createInfo
     );
     container->textureCount += 1;
+    SDL_AtomicIncRef(&renderer->liveTextureCount);
 
     container->activeTexture = container->textures[container->textureCount - 1];
 
@@ -1218,7 +1674,7 @@ static MetalBuffer* METAL_INTERNAL_CreateBuffer(
     /* Storage buffers have to be 4-aligned, so might as well align them all */
     sizeInBytes = METAL_INTERNAL_NextHighestAlignment(sizeInBytes, 4);
 
-    bufferHandle = [renderer->device newBufferWithLength:sizeInBytes options:MTLResourceStorageModePrivate];
+    bufferHandle = METAL_INTERNAL_AllocateBuffer(renderer, sizeInBytes);
     if (bufferHandle == NULL)
     {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create buffer");
@@ -1263,6 +1719,8 @@ static SDL_GpuBuffer* METAL_CreateBuffer(
     container->buffers[0] = container->activeBuffer;
     container->debugName = NULL;
 
+    SDL_AtomicIncRef(&renderer->liveBufferCount);
+
     return (SDL_GpuBuffer*) container;
 }
 
@@ -1294,6 +1752,7 @@ static void METAL_INTERNAL_CycleActiveBuffer(
         size
     );
     container->bufferCount += 1;
+    SDL_AtomicIncRef(&renderer->liveBufferCount);
 
     container->activeBuffer = container->buffers[container->bufferCount - 1];
 
@@ -1422,27 +1881,9 @@ static void METAL_MapTransferBuffer(
     SDL_GpuTransferBuffer *transferBuffer,
     SDL_bool cycle,
     void **ppData
-) {
-    NOT_IMPLEMENTED
-}
-
-static void METAL_UnmapTransferBuffer(
-    SDL_GpuRenderer *driverData,
-    SDL_GpuTransferBuffer *transferBuffer
-) {
-    NOT_IMPLEMENTED
-}
-
-static void METAL_SetTransferData(
-    SDL_GpuRenderer *driverData,
-    void* data,
-    SDL_GpuTransferBuffer *transferBuffer,
-    SDL_GpuBufferCopy *copyParams,
-    SDL_bool cycle
 ) {
     MetalRenderer *renderer = (MetalRenderer*) driverData;
     MetalTransferBufferContainer *container = (MetalTransferBufferContainer*) transferBuffer;
-    MetalTransferBuffer *buffer = container->activeBuffer;
 
     /* Rotate the transfer buffer if necessary */
     if (cycle && SDL_AtomicGet(&container->activeBuffer->referenceCount) > 0)
@@ -1451,24 +1892,104 @@ static void METAL_SetTransferData(
             renderer,
             container
         );
-        buffer = container->activeBuffer;
     }
 
-    SDL_memcpy(
-        ((Uint8*) buffer->stagingBuffer.contents) + copyParams->dstOffset,
-        ((Uint8*) data) + copyParams->srcOffset,
-        copyParams->size
-    );
+    /* Staging buffers are CPU-visible for their whole lifetime */
+    *ppData = container->activeBuffer->stagingBuffer.contents;
+}
+
+static void METAL_FlushTransferBuffer(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+) {
+    MetalTransferBufferContainer *container = (MetalTransferBufferContainer*) transferBuffer;
+    MetalTransferBuffer *buffer = container->activeBuffer;
+
+    (void) driverData;
+
+    if (offsetInBytes >= buffer->size)
+    {
+        return;
+    }
 
 #ifdef SDL_PLATFORM_MACOS
     if (buffer->stagingBuffer.storageMode == MTLStorageModeManaged)
     {
-        [buffer->stagingBuffer didModifyRange:NSMakeRange(copyParams->dstOffset, copyParams->size)];
+        [buffer->stagingBuffer didModifyRange:NSMakeRange(
+            offsetInBytes,
+            SDL_min(sizeInBytes, buffer->size - offsetInBytes)
+        )];
     }
+#else
+    (void) sizeInBytes;
 #endif
 }
 
-static void METAL_GetTransferData(
+static void METAL_InvalidateTransferBuffer(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+) {
+    /* Staging buffers use shared storage, which is coherent with the GPU */
+    (void) driverData;
+    (void) transferBuffer;
+    (void) offsetInBytes;
+    (void) sizeInBytes;
+}
+
+static void METAL_UnmapTransferBuffer(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTransferBuffer *transferBuffer
+) {
+    MetalTransferBufferContainer *container = (MetalTransferBufferContainer*) transferBuffer;
+
+    METAL_FlushTransferBuffer(
+        driverData,
+        transferBuffer,
+        0,
+        container->activeBuffer->size
+    );
+}
+
+static void METAL_SetTransferData(
+    SDL_GpuRenderer *driverData,
+    void* data,
+    SDL_GpuTransferBuffer *transferBuffer,
+    SDL_GpuBufferCopy *copyParams,
+    SDL_bool cycle
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+    MetalTransferBufferContainer *container = (MetalTransferBufferContainer*) transferBuffer;
+    MetalTransferBuffer *buffer = container->activeBuffer;
+
+    /* Rotate the transfer buffer if necessary */
+    if (cycle && SDL_AtomicGet(&container->activeBuffer->referenceCount) > 0)
+    {
+        METAL_INTERNAL_CycleActiveTransferBuffer(
+            renderer,
+            container
+        );
+        buffer = container->activeBuffer;
+    }
+
+    SDL_memcpy(
+        ((Uint8*) buffer->stagingBuffer.contents) + copyParams->dstOffset,
+        ((Uint8*) data) + copyParams->srcOffset,
+        copyParams->size
+    );
+
+#ifdef SDL_PLATFORM_MACOS
+    if (buffer->stagingBuffer.storageMode == MTLStorageModeManaged)
+    {
+        [buffer->stagingBuffer didModifyRange:NSMakeRange(copyParams->dstOffset, copyParams->size)];
+    }
+#endif
+}
+
+static void METAL_GetTransferData(
     SDL_GpuRenderer *driverData,
     SDL_GpuTransferBuffer *transferBuffer,
     void* data,
@@ -1477,12 +1998,140 @@ static void METAL_GetTransferData(
     NOT_IMPLEMENTED
 }
 
+/* Pass Timing */
+
+static id METAL_INTERNAL_CreateTimestampSampleBuffer(
+    MetalRenderer *renderer,
+    Uint32 sampleCount
+) {
+    if (@available(macOS 10.15, iOS 14.0, tvOS 14.0, *))
+    {
+        MTLCounterSampleBufferDescriptor *descriptor = [MTLCounterSampleBufferDescriptor new];
+        id<MTLCounterSampleBuffer> sampleBuffer;
+        NSError *error = NULL;
+
+        descriptor.counterSet = renderer->timestampCounterSet;
+        descriptor.storageMode = MTLStorageModeShared;
+        descriptor.sampleCount = sampleCount;
+
+        sampleBuffer = [renderer->device newCounterSampleBufferWithDescriptor:descriptor error:&error];
+        if (sampleBuffer == nil)
+        {
+            SDL_LogError(
+                SDL_LOG_CATEGORY_APPLICATION,
+                "Failed to create counter sample buffer: %s", [[error description] UTF8String]
+            );
+        }
+        return sampleBuffer;
+    }
+
+    return nil;
+}
+
+static Uint64 METAL_INTERNAL_GpuTicksToNanoseconds(
+    MetalRenderer *renderer,
+    MTLTimestamp ticks
+) {
+    MTLTimestamp cpuTimestamp;
+    MTLTimestamp gpuTimestamp;
+    double nanosecondsPerTick = 1.0;
+
+    /* Apple GPUs tick in nanoseconds already, other GPUs have to be calibrated */
+    if (@available(macOS 10.15, iOS 14.0, tvOS 14.0, *))
+    {
+        [renderer->device sampleTimestamps:&cpuTimestamp gpuTimestamp:&gpuTimestamp];
+        if (gpuTimestamp > renderer->calibrationGpuTimestamp)
+        {
+            nanosecondsPerTick =
+                (double) (cpuTimestamp - renderer->calibrationCpuTimestamp) /
+                (double) (gpuTimestamp - renderer->calibrationGpuTimestamp);
+        }
+    }
+
+    return (Uint64) ((double) ticks * nanosecondsPerTick);
+}
+
+/* Returns the first sample index for the pass, or -1 if the pass is not timed */
+static Sint32 METAL_INTERNAL_BeginPassTiming(
+    MetalCommandBuffer *commandBuffer,
+    SDL_GpuPassType passType
+) {
+    Sint32 sampleIndex;
+
+    if (
+        !commandBuffer->passTimingEnabled ||
+        commandBuffer->passTimingCount == SDL_GPU_MAX_TIMED_PASSES
+    ) {
+        return -1;
+    }
+
+    sampleIndex = (Sint32) commandBuffer->passTimingCount * 2;
+    commandBuffer->passTimingTypes[commandBuffer->passTimingCount] = passType;
+    commandBuffer->passTimingCount += 1;
+
+    return sampleIndex;
+}
+
+/* Called once the command buffer has completed */
+static void METAL_INTERNAL_ResolvePassTimings(
+    MetalRenderer *renderer,
+    MetalCommandBuffer *commandBuffer
+) {
+    if (commandBuffer->passTimingCount == 0)
+    {
+        return;
+    }
+
+    if (@available(macOS 10.15, iOS 14.0, tvOS 14.0, *))
+    {
+        id<MTLCounterSampleBuffer> sampleBuffer = commandBuffer->passTimingSampleBuffer;
+        NSData *data = [sampleBuffer resolveCounterRange:NSMakeRange(0, commandBuffer->passTimingCount * 2)];
+        const MTLCounterResultTimestamp *timestamps;
+        Uint32 i;
+
+        if (data == nil)
+        {
+            return;
+        }
+
+        timestamps = (const MTLCounterResultTimestamp*) data.bytes;
+        for (i = 0; i < commandBuffer->passTimingCount; i += 1)
+        {
+            MTLTimestamp begin = timestamps[i * 2].timestamp;
+            MTLTimestamp end = timestamps[i * 2 + 1].timestamp;
+
+            commandBuffer->fence->passTimings[i].passType = commandBuffer->passTimingTypes[i];
+            commandBuffer->fence->passTimings[i].durationNanoseconds =
+                (begin == MTLCounterErrorValue || end == MTLCounterErrorValue || end < begin) ?
+                    0 :
+                    METAL_INTERNAL_GpuTicksToNanoseconds(renderer, end - begin);
+        }
+
+        commandBuffer->fence->passTimingCount = commandBuffer->passTimingCount;
+    }
+}
+
 /* Copy Pass */
 
 static void METAL_BeginCopyPass(
     SDL_GpuCommandBuffer *commandBuffer
 ) {
     MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    Sint32 sampleIndex = METAL_INTERNAL_BeginPassTiming(metalCommandBuffer, SDL_GPU_PASSTYPE_COPY);
+
+    if (sampleIndex >= 0)
+    {
+        if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *))
+        {
+            MTLBlitPassDescriptor *passDescriptor = [MTLBlitPassDescriptor blitPassDescriptor];
+            passDescriptor.sampleBufferAttachments[0].sampleBuffer = metalCommandBuffer->passTimingSampleBuffer;
+            passDescriptor.sampleBufferAttachments[0].startOfEncoderSampleIndex = sampleIndex;
+            passDescriptor.sampleBufferAttachments[0].endOfEncoderSampleIndex = sampleIndex + 1;
+            metalCommandBuffer->blitEncoder = [metalCommandBuffer->handle blitCommandEncoderWithDescriptor:passDescriptor];
+            return;
+        }
+    }
+
     metalCommandBuffer->blitEncoder = [metalCommandBuffer->handle blitCommandEncoder];
 }
 
@@ -1499,6 +2148,7 @@ static void METAL_UploadToTexture(
     MetalTextureContainer *metalTextureContainer = (MetalTextureContainer*) textureRegion->textureSlice.texture;
 
     MetalTexture *metalTexture = METAL_INTERNAL_PrepareTextureForWrite(renderer, metalTextureContainer, cycle);
+    METAL_INTERNAL_AcquireTransientTexture(metalCommandBuffer, metalTextureContainer);
 
     [metalCommandBuffer->blitEncoder
      copyFromBuffer:metalTransferBufferContainer->activeBuffer->stagingBuffer
@@ -1513,6 +2163,9 @@ static void METAL_UploadToTexture(
 
     METAL_INTERNAL_TrackTexture(metalCommandBuffer, metalTexture);
     METAL_INTERNAL_TrackTransferBuffer(metalCommandBuffer, metalTransferBufferContainer->activeBuffer);
+
+    metalCommandBuffer->common.stats.bytesUploaded +=
+        (Uint64) BytesPerImage(textureRegion->w, textureRegion->h, metalTextureContainer->createInfo.format) * textureRegion->d;
 }
 
 static void METAL_UploadToBuffer(
@@ -1562,6 +2215,9 @@ static void METAL_CopyTextureToTexture(
         cycle
     );
 
+    METAL_INTERNAL_AcquireTransientTexture(metalCommandBuffer, srcContainer);
+    METAL_INTERNAL_AcquireTransientTexture(metalCommandBuffer, dstContainer);
+
     [metalCommandBuffer->blitEncoder
      copyFromTexture:srcTexture->handle
      sourceSlice:source->textureSlice.layer
@@ -1591,7 +2247,17 @@ static void METAL_GenerateMipmaps(
     SDL_GpuCommandBuffer *commandBuffer,
     SDL_GpuTexture *texture
 ) {
-    NOT_IMPLEMENTED
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    MetalTexture *metalTexture = ((MetalTextureContainer*) texture)->activeTexture;
+
+    if (((MetalTextureContainer*) texture)->createInfo.levelCount <= 1) { return; }
+
+    METAL_INTERNAL_AcquireTransientTexture(metalCommandBuffer, (MetalTextureContainer*) texture);
+
+    /* The whole chain, every layer, in one command */
+    [metalCommandBuffer->blitEncoder generateMipmapsForTexture:metalTexture->handle];
+
+    METAL_INTERNAL_TrackTexture(metalCommandBuffer, metalTexture);
 }
 
 static void METAL_DownloadFromTexture(
@@ -1641,6 +2307,17 @@ static void METAL_INTERNAL_AllocateCommandBuffers(
 
         /* The native Metal command buffer is created later */
 
+        commandBuffer->parallelRenderEncoder = nil;
+        commandBuffer->subPassCommandBufferCapacity = 4;
+        commandBuffer->subPassCommandBufferCount = 0;
+        commandBuffer->subPassCommandBuffers = SDL_malloc(
+            commandBuffer->subPassCommandBufferCapacity * sizeof(MetalCommandBuffer*)
+        );
+
+        commandBuffer->passTimingSampleBuffer = nil;
+        commandBuffer->passTimingCount = 0;
+        commandBuffer->passTimingEnabled = 0;
+
         /* Reference Counting */
         commandBuffer->usedBufferCapacity = 4;
         commandBuffer->usedBufferCount = 0;
@@ -1660,6 +2337,21 @@ static void METAL_INTERNAL_AllocateCommandBuffers(
             commandBuffer->usedTextureCapacity * sizeof(MetalTexture*)
         );
 
+        commandBuffer->usedBindlessTableCapacity = 2;
+        commandBuffer->usedBindlessTableCount = 0;
+        commandBuffer->usedBindlessTables = SDL_malloc(
+            commandBuffer->usedBindlessTableCapacity * sizeof(MetalBindlessTable*)
+        );
+
+        /* Transient memory, the heap is created on first use */
+        commandBuffer->transientHeap = NULL;
+        commandBuffer->transientHeapSize = 0;
+        commandBuffer->transientTextureCapacity = 4;
+        commandBuffer->transientTextureCount = 0;
+        commandBuffer->transientTextures = SDL_malloc(
+            commandBuffer->transientTextureCapacity * sizeof(MetalTexture*)
+        );
+
         renderer->availableCommandBuffers[renderer->availableCommandBufferCount] = commandBuffer;
         renderer->availableCommandBufferCount += 1;
     }
@@ -1691,6 +2383,7 @@ static Uint8 METAL_INTERNAL_CreateFence(
 
     fence = SDL_malloc(sizeof(MetalFence));
     SDL_AtomicSet(&fence->complete, 0);
+    fence->passTimingCount = 0;
 
     /* Add it to the available pool */
     /* FIXME: Should this be EXPAND_IF_NEEDED? */
@@ -1737,12 +2430,15 @@ static Uint8 METAL_INTERNAL_AcquireFence(
     /* Associate the fence with the command buffer */
     commandBuffer->fence = fence;
     SDL_AtomicSet(&fence->complete, 0); /* FIXME: Is this right? */
+    fence->passTimingCount = 0;
 
     return 1;
 }
 
+/* Everything goes through the one MTLCommandQueue, Metal overlaps blit and compute encoders on its own */
 static SDL_GpuCommandBuffer* METAL_AcquireCommandBuffer(
-    SDL_GpuRenderer *driverData
+    SDL_GpuRenderer *driverData,
+    SDL_GpuCommandQueue queue
 ) {
     MetalRenderer *renderer = (MetalRenderer*) driverData;
     MetalCommandBuffer *commandBuffer;
@@ -1762,13 +2458,13 @@ static SDL_GpuCommandBuffer* METAL_AcquireCommandBuffer(
     return (SDL_GpuCommandBuffer*) commandBuffer;
 }
 
-static void METAL_BeginRenderPass(
-    SDL_GpuCommandBuffer *commandBuffer,
+static void METAL_INTERNAL_BeginRenderPass(
+    MetalCommandBuffer *metalCommandBuffer,
     SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
     Uint32 colorAttachmentCount,
-    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo,
+    SDL_bool parallel
 ) {
-    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
     MTLRenderPassDescriptor *passDescriptor = [MTLRenderPassDescriptor renderPassDescriptor];
     SDL_GpuColorAttachmentInfo *attachmentInfo;
     MetalTexture *texture;
@@ -1776,10 +2472,12 @@ static void METAL_BeginRenderPass(
     Uint32 vpHeight = UINT_MAX;
     MTLViewport viewport;
     MTLScissorRect scissorRect;
+    Sint32 sampleIndex;
 
     for (Uint32 i = 0; i < colorAttachmentCount; i += 1)
     {
         attachmentInfo = &colorAttachmentInfos[i];
+        METAL_INTERNAL_AcquireTransientTexture(metalCommandBuffer, (MetalTextureContainer*) attachmentInfo->textureSlice.texture);
         texture = ((MetalTextureContainer*) attachmentInfo->textureSlice.texture)->activeTexture;
 
         /* FIXME: cycle! */
@@ -1802,6 +2500,7 @@ static void METAL_BeginRenderPass(
     if (depthStencilAttachmentInfo != NULL)
     {
         MetalTextureContainer *container = (MetalTextureContainer*) depthStencilAttachmentInfo->textureSlice.texture;
+        METAL_INTERNAL_AcquireTransientTexture(metalCommandBuffer, container);
         texture = container->activeTexture;
 
         /* FIXME: cycle! */
@@ -1826,7 +2525,29 @@ static void METAL_BeginRenderPass(
         METAL_INTERNAL_TrackTexture(metalCommandBuffer, texture);
     }
 
-    metalCommandBuffer->renderEncoder = [metalCommandBuffer->handle renderCommandEncoderWithDescriptor:passDescriptor];
+    sampleIndex = METAL_INTERNAL_BeginPassTiming(metalCommandBuffer, SDL_GPU_PASSTYPE_RENDER);
+    if (sampleIndex >= 0)
+    {
+        if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *))
+        {
+            /* From the first vertex work to the last fragment work */
+            MTLRenderPassSampleBufferAttachmentDescriptor *sampleAttachment = passDescriptor.sampleBufferAttachments[0];
+            sampleAttachment.sampleBuffer = metalCommandBuffer->passTimingSampleBuffer;
+            sampleAttachment.startOfVertexSampleIndex = sampleIndex;
+            sampleAttachment.endOfVertexSampleIndex = MTLCounterDontSample;
+            sampleAttachment.startOfFragmentSampleIndex = MTLCounterDontSample;
+            sampleAttachment.endOfFragmentSampleIndex = sampleIndex + 1;
+        }
+    }
+
+    if (parallel)
+    {
+        metalCommandBuffer->parallelRenderEncoder = [metalCommandBuffer->handle parallelRenderCommandEncoderWithDescriptor:passDescriptor];
+    }
+    else
+    {
+        metalCommandBuffer->renderEncoder = [metalCommandBuffer->handle renderCommandEncoderWithDescriptor:passDescriptor];
+    }
 
     /* The viewport cannot be larger than the smallest attachment. */
     for (Uint32 i = 0; i < colorAttachmentCount; i += 1)
@@ -1855,13 +2576,36 @@ static void METAL_BeginRenderPass(
     viewport.height = vpHeight;
     viewport.znear = 0;
     viewport.zfar = 1;
-    [metalCommandBuffer->renderEncoder setViewport:viewport];
 
     scissorRect.x = 0;
     scissorRect.y = 0;
     scissorRect.width = viewport.width;
     scissorRect.height = viewport.height;
-    [metalCommandBuffer->renderEncoder setScissorRect:scissorRect];
+
+    /* Sub pass encoders start without any state, so they apply this themselves */
+    metalCommandBuffer->defaultViewport = viewport;
+    metalCommandBuffer->defaultScissorRect = scissorRect;
+
+    if (!parallel)
+    {
+        [metalCommandBuffer->renderEncoder setViewport:viewport];
+        [metalCommandBuffer->renderEncoder setScissorRect:scissorRect];
+    }
+}
+
+static void METAL_BeginRenderPass(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+    Uint32 colorAttachmentCount,
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+) {
+    METAL_INTERNAL_BeginRenderPass(
+        (MetalCommandBuffer*) commandBuffer,
+        colorAttachmentInfos,
+        colorAttachmentCount,
+        depthStencilAttachmentInfo,
+        SDL_FALSE
+    );
 }
 
 static void METAL_BindGraphicsPipeline(
@@ -2029,6 +2773,31 @@ static void METAL_BindFragmentStorageBuffers(
     NOT_IMPLEMENTED
 }
 
+static void METAL_BindGraphicsBindlessTable(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    MetalBindlessTable *metalTable = (MetalBindlessTable*) bindlessTable;
+
+    [metalCommandBuffer->renderEncoder setVertexBuffer:metalTable->argumentBuffer offset:0 atIndex:METAL_BINDLESS_BUFFER_INDEX];
+    [metalCommandBuffer->renderEncoder setFragmentBuffer:metalTable->argumentBuffer offset:0 atIndex:METAL_BINDLESS_BUFFER_INDEX];
+
+    /* Textures reached through an argument buffer are not made resident by the encoder */
+    for (Uint32 i = 0; i < metalTable->capacity; i += 1)
+    {
+        if (metalTable->textures[i] != NULL)
+        {
+            [metalCommandBuffer->renderEncoder
+                useResource:metalTable->textures[i]->handle
+                usage:MTLResourceUsageRead
+                stages:MTLRenderStageVertex | MTLRenderStageFragment];
+        }
+    }
+
+    METAL_INTERNAL_TrackBindlessTable(metalCommandBuffer, metalTable);
+}
+
 static void METAL_DrawIndexedPrimitives(
     SDL_GpuCommandBuffer *commandBuffer,
     Uint32 baseVertex,
@@ -2085,6 +2854,51 @@ static void METAL_DrawIndexedPrimitivesIndirect(
     NOT_IMPLEMENTED
 }
 
+static void METAL_DrawPrimitivesIndirectCount(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
+) {
+    /* Render encoders can't run the compute pass a count emulation would need */
+    (void) commandBuffer;
+    (void) buffer;
+    (void) offsetInBytes;
+    (void) countBuffer;
+    (void) countOffsetInBytes;
+    (void) maxDrawCount;
+    (void) stride;
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "DrawPrimitivesIndirectCount is not supported on Metal, check SDL_GpuSupportsIndirectCount!"
+    );
+}
+
+static void METAL_DrawIndexedPrimitivesIndirectCount(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
+) {
+    (void) commandBuffer;
+    (void) buffer;
+    (void) offsetInBytes;
+    (void) countBuffer;
+    (void) countOffsetInBytes;
+    (void) maxDrawCount;
+    (void) stride;
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "DrawIndexedPrimitivesIndirectCount is not supported on Metal, check SDL_GpuSupportsIndirectCount!"
+    );
+}
+
 static void METAL_EndRenderPass(
     SDL_GpuCommandBuffer *commandBuffer
 ) {
@@ -2094,6 +2908,81 @@ static void METAL_EndRenderPass(
     /* FIXME: Anything else to do here? */
 }
 
+/* Parallel Render Pass */
+
+static void METAL_BeginParallelRenderPass(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+    Uint32 colorAttachmentCount,
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+) {
+    METAL_INTERNAL_BeginRenderPass(
+        (MetalCommandBuffer*) commandBuffer,
+        colorAttachmentInfos,
+        colorAttachmentCount,
+        depthStencilAttachmentInfo,
+        SDL_TRUE
+    );
+}
+
+static SDL_GpuCommandBuffer* METAL_AcquireRenderSubPass(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    MetalRenderer *renderer = metalCommandBuffer->renderer;
+    MetalCommandBuffer *subPassCommandBuffer;
+
+    /* Sub encoders execute in creation order, so create them under the lock */
+    SDL_LockMutex(renderer->acquireCommandBufferLock);
+
+    subPassCommandBuffer = METAL_INTERNAL_GetInactiveCommandBufferFromPool(renderer);
+    subPassCommandBuffer->renderEncoder = [metalCommandBuffer->parallelRenderEncoder renderCommandEncoder];
+
+    EXPAND_ARRAY_IF_NEEDED(
+        metalCommandBuffer->subPassCommandBuffers,
+        MetalCommandBuffer*,
+        metalCommandBuffer->subPassCommandBufferCount + 1,
+        metalCommandBuffer->subPassCommandBufferCapacity,
+        metalCommandBuffer->subPassCommandBufferCapacity * 2
+    );
+
+    metalCommandBuffer->subPassCommandBuffers[
+        metalCommandBuffer->subPassCommandBufferCount
+    ] = subPassCommandBuffer;
+    metalCommandBuffer->subPassCommandBufferCount += 1;
+
+    SDL_UnlockMutex(renderer->acquireCommandBufferLock);
+
+    /* Sub passes only encode, the primary command buffer owns the handle and fence */
+    subPassCommandBuffer->handle = nil;
+    subPassCommandBuffer->windowData = NULL;
+    subPassCommandBuffer->indexBuffer = NULL;
+    subPassCommandBuffer->graphicsPipeline = NULL;
+    subPassCommandBuffer->fence = NULL;
+    subPassCommandBuffer->autoReleaseFence = 0;
+
+    [subPassCommandBuffer->renderEncoder setViewport:metalCommandBuffer->defaultViewport];
+    [subPassCommandBuffer->renderEncoder setScissorRect:metalCommandBuffer->defaultScissorRect];
+
+    return (SDL_GpuCommandBuffer*) subPassCommandBuffer;
+}
+
+static void METAL_EndRenderSubPass(
+    SDL_GpuCommandBuffer *subPassCommandBuffer
+) {
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) subPassCommandBuffer;
+    [metalCommandBuffer->renderEncoder endEncoding];
+    metalCommandBuffer->renderEncoder = nil;
+}
+
+static void METAL_EndParallelRenderPass(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    [metalCommandBuffer->parallelRenderEncoder endEncoding];
+    metalCommandBuffer->parallelRenderEncoder = nil;
+}
+
 static void METAL_PushVertexUniformData(
     SDL_GpuCommandBuffer *commandBuffer,
     Uint32 slotIndex,
@@ -2112,6 +3001,56 @@ static void METAL_PushFragmentUniformData(
     NOT_IMPLEMENTED
 }
 
+static void METAL_DrawIndexedPrimitivesBatch(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuIndexedDrawRecord *draws,
+    Uint32 drawCount,
+    Uint32 vertexUniformDataLengthInBytes,
+    Uint32 fragmentUniformDataLengthInBytes
+) {
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    SDL_GpuPrimitiveType primitiveType = metalCommandBuffer->graphicsPipeline->primitiveType;
+    Uint32 indexSize = IndexSize(metalCommandBuffer->indexElementSize);
+    SDL_GpuIndexedDrawRecord *draw;
+    Uint32 i;
+
+    /* Uniform pushes are the same as the unbatched path until they are implemented */
+    for (i = 0; i < drawCount; i += 1)
+    {
+        draw = &draws[i];
+
+        if (draw->vertexUniformData != NULL)
+        {
+            METAL_PushVertexUniformData(
+                commandBuffer,
+                0,
+                draw->vertexUniformData,
+                vertexUniformDataLengthInBytes
+            );
+        }
+
+        if (draw->fragmentUniformData != NULL)
+        {
+            METAL_PushFragmentUniformData(
+                commandBuffer,
+                0,
+                draw->fragmentUniformData,
+                fragmentUniformDataLengthInBytes
+            );
+        }
+
+        [metalCommandBuffer->renderEncoder
+         drawIndexedPrimitives:SDLToMetal_PrimitiveType[primitiveType]
+         indexCount:PrimitiveVerts(primitiveType, draw->primitiveCount)
+         indexType:SDLToMetal_IndexType[metalCommandBuffer->indexElementSize]
+         indexBuffer:metalCommandBuffer->indexBuffer->handle
+         indexBufferOffset:metalCommandBuffer->indexBufferOffset + (draw->startIndex * indexSize)
+         instanceCount:draw->instanceCount
+         baseVertex:draw->baseVertex
+         baseInstance:draw->firstInstance];
+    }
+}
+
 /* Blit */
 
 static void METAL_Blit(
@@ -2124,26 +3063,68 @@ static void METAL_Blit(
     NOT_IMPLEMENTED
 }
 
-/* Compute State */
-
-static void METAL_BeginComputePass(
+static void METAL_BlitBatch(
     SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuStorageTextureReadWriteBinding *storageTextureBindings,
-    Uint32 storageTextureBindingCount,
-    SDL_GpuStorageBufferReadWriteBinding *storageBufferBindings,
-    Uint32 storageBufferBindingCount
+    SDL_GpuBlitRegion *blits,
+    Uint32 blitCount,
+    SDL_GpuFilter filterMode,
+    SDL_bool cycle
 ) {
     NOT_IMPLEMENTED
 }
 
-static void METAL_BindComputePipeline(
+static void METAL_DiscardTransientTexture(
     SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuComputePipeline *computePipeline
+    SDL_GpuTexture *texture
 ) {
-    NOT_IMPLEMENTED
-}
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    MetalTextureContainer *container = (MetalTextureContainer*) texture;
+    MetalTexture *metalTexture = container->activeTexture;
 
-static void METAL_BindComputeStorageTextures(
+    if (!container->isTransient)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only transient textures can be discarded!");
+        return;
+    }
+
+    /* Not used by this command buffer, so there is no memory to give back */
+    if (metalTexture->transientOwner != metalCommandBuffer)
+    {
+        return;
+    }
+
+    /* Commands already encoded keep the texture object alive,
+     * but later allocations from the heap may now overlap its memory.
+     */
+    if (metalTexture->handle.heap != nil)
+    {
+        [metalTexture->handle makeAliasable];
+    }
+
+    metalTexture->handle = nil;
+    metalTexture->transientOwner = NULL;
+}
+
+/* Compute State */
+
+static void METAL_BeginComputePass(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuStorageTextureReadWriteBinding *storageTextureBindings,
+    Uint32 storageTextureBindingCount,
+    SDL_GpuStorageBufferReadWriteBinding *storageBufferBindings,
+    Uint32 storageBufferBindingCount
+) {
+    NOT_IMPLEMENTED
+}
+
+static void METAL_BindComputePipeline(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuComputePipeline *computePipeline
+) {
+    NOT_IMPLEMENTED
+}
+
+static void METAL_BindComputeStorageTextures(
     SDL_GpuCommandBuffer *commandBuffer,
     Uint32 firstSlot,
     SDL_GpuTextureSlice *storageTextureSlices,
@@ -2161,6 +3142,13 @@ static void METAL_BindComputeStorageBuffers(
     NOT_IMPLEMENTED
 }
 
+static void METAL_BindComputeBindlessTable(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    NOT_IMPLEMENTED
+}
+
 static void METAL_PushComputeUniformData(
     SDL_GpuCommandBuffer *commandBuffer,
     Uint32 slotIndex,
@@ -2218,12 +3206,105 @@ static void METAL_ReleaseFence(
     );
 }
 
+/* Memory Management */
+
+static SDL_bool METAL_Defragment(
+    SDL_GpuRenderer *driverData,
+    Uint32 maxBytes,
+    Uint32 maxMilliseconds
+) {
+    /* Metal resources aren't suballocated, so there's nothing to compact */
+    (void) driverData;
+    (void) maxBytes;
+    (void) maxMilliseconds;
+    return SDL_FALSE;
+}
+
+static void METAL_GetFrameStats(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuFrameStats *stats
+) {
+    /* Everything Metal counts is recorded into the command buffer */
+    (void) driverData;
+    (void) stats;
+}
+
+static void METAL_GetMemoryStats(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuMemoryStats *stats
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+
+    /* Metal only exposes a single device-wide pool */
+    stats->heapCount = 1;
+    stats->heaps[0].deviceLocal = SDL_TRUE;
+
+    if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, *))
+    {
+        stats->heaps[0].deviceLocal = !renderer->device.hasUnifiedMemory;
+    }
+
+    if (@available(macOS 10.13, iOS 11.0, tvOS 11.0, *))
+    {
+        stats->heaps[0].usageBytes = renderer->device.currentAllocatedSize;
+    }
+
+    if (@available(macOS 10.12, iOS 16.0, tvOS 16.0, *))
+    {
+        stats->heaps[0].budgetBytes = renderer->device.recommendedMaxWorkingSetSize;
+    }
+    else
+    {
+        stats->heaps[0].budgetBytes = [NSProcessInfo processInfo].physicalMemory;
+    }
+
+    /* Every resource is its own allocation, there's no free space to report */
+    stats->heaps[0].allocatedBytes = stats->heaps[0].usageBytes;
+    stats->heaps[0].usedBytes = stats->heaps[0].usageBytes;
+
+    stats->bufferCount = (Uint32) SDL_AtomicGet(&renderer->liveBufferCount);
+    stats->textureCount = (Uint32) SDL_AtomicGet(&renderer->liveTextureCount);
+}
+
 /* Cleanup */
 
 static void METAL_INTERNAL_CleanCommandBuffer(
     MetalRenderer *renderer,
     MetalCommandBuffer *commandBuffer
 ) {
+    /* Sub passes hold their own references until the primary has finished executing */
+    for (Uint32 i = 0; i < commandBuffer->subPassCommandBufferCount; i += 1)
+    {
+        METAL_INTERNAL_CleanCommandBuffer(
+            renderer,
+            commandBuffer->subPassCommandBuffers[i]
+        );
+    }
+    commandBuffer->subPassCommandBufferCount = 0;
+
+    /* Nobody can read pass timings from an auto-released fence */
+    if (commandBuffer->passTimingEnabled)
+    {
+        if (!commandBuffer->autoReleaseFence)
+        {
+            METAL_INTERNAL_ResolvePassTimings(renderer, commandBuffer);
+        }
+
+        commandBuffer->passTimingEnabled = 0;
+        commandBuffer->passTimingCount = 0;
+    }
+
+    /* Transient memory goes back to the heap, unless another command buffer has taken the texture since */
+    for (Uint32 i = 0; i < commandBuffer->transientTextureCount; i += 1)
+    {
+        if (commandBuffer->transientTextures[i]->transientOwner == commandBuffer)
+        {
+            commandBuffer->transientTextures[i]->handle = nil;
+            commandBuffer->transientTextures[i]->transientOwner = NULL;
+        }
+    }
+    commandBuffer->transientTextureCount = 0;
+
     /* Reference Counting */
 
     for (Uint32 i = 0; i < commandBuffer->usedBufferCount; i += 1)
@@ -2244,6 +3325,12 @@ static void METAL_INTERNAL_CleanCommandBuffer(
     }
     commandBuffer->usedTextureCount = 0;
 
+    for (Uint32 i = 0; i < commandBuffer->usedBindlessTableCount; i += 1)
+    {
+        (void)SDL_AtomicDecRef(&commandBuffer->usedBindlessTables[i]->referenceCount);
+    }
+    commandBuffer->usedBindlessTableCount = 0;
+
     /* The fence is now available (unless SubmitAndAcquireFence was called) */
     if (commandBuffer->autoReleaseFence)
     {
@@ -2286,6 +3373,20 @@ static void METAL_INTERNAL_PerformPendingDestroys(
     Sint32 i;
     Uint32 j;
 
+    /* Tables go first, they may be holding the last references on textures below */
+    for (i = renderer->bindlessTablesToDestroyCount - 1; i >= 0; i -= 1)
+    {
+        if (SDL_AtomicGet(&renderer->bindlessTablesToDestroy[i]->referenceCount) == 0)
+        {
+            METAL_INTERNAL_DestroyBindlessTable(
+                renderer->bindlessTablesToDestroy[i]
+            );
+
+            renderer->bindlessTablesToDestroy[i] = renderer->bindlessTablesToDestroy[renderer->bindlessTablesToDestroyCount - 1];
+            renderer->bindlessTablesToDestroyCount -= 1;
+        }
+    }
+
     for (i = renderer->transferBufferContainersToDestroyCount - 1; i >= 0; i -= 1)
     {
         referenceCount = 0;
@@ -2315,6 +3416,11 @@ static void METAL_INTERNAL_PerformPendingDestroys(
 
         if (referenceCount == 0)
         {
+            SDL_AtomicAdd(
+                &renderer->liveBufferCount,
+                -(int) renderer->bufferContainersToDestroy[i]->bufferCount
+            );
+
             METAL_INTERNAL_DestroyBufferContainer(
                 renderer->bufferContainersToDestroy[i]
             );
@@ -2334,6 +3440,11 @@ static void METAL_INTERNAL_PerformPendingDestroys(
 
         if (referenceCount == 0)
         {
+            SDL_AtomicAdd(
+                &renderer->liveTextureCount,
+                -(int) renderer->textureContainersToDestroy[i]->textureCount
+            );
+
             METAL_INTERNAL_DestroyTextureContainer(
                 renderer->textureContainersToDestroy[i]
             );
@@ -2342,6 +3453,20 @@ static void METAL_INTERNAL_PerformPendingDestroys(
             renderer->textureContainersToDestroyCount -= 1;
         }
     }
+
+    /* Return empty heaps to the system, but keep one around to avoid churn */
+    SDL_LockMutex(renderer->heapLock);
+    for (i = (Sint32) renderer->heapCount - 1; i >= 1; i -= 1)
+    {
+        if ([renderer->heaps[i]->handle usedSize] == 0)
+        {
+            METAL_INTERNAL_DestroyHeap(renderer->heaps[i]);
+
+            renderer->heaps[i] = renderer->heaps[renderer->heapCount - 1];
+            renderer->heapCount -= 1;
+        }
+    }
+    SDL_UnlockMutex(renderer->heapLock);
 }
 
 /* Fences */
@@ -2741,6 +3866,314 @@ static SDL_bool METAL_OcclusionQueryPixelCount(
     return SDL_FALSE;
 }
 
+static SDL_GpuTimestampQuery* METAL_CreateTimestampQuery(
+    SDL_GpuRenderer *driverData
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+    MetalTimestampQuery *query;
+    id sampleBuffer;
+
+    if (renderer->timestampCounterSet == nil)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Timestamp queries are not supported on this device!"
+        );
+        return NULL;
+    }
+
+    sampleBuffer = METAL_INTERNAL_CreateTimestampSampleBuffer(renderer, 1);
+    if (sampleBuffer == nil)
+    {
+        return NULL;
+    }
+
+    query = (MetalTimestampQuery*) SDL_malloc(sizeof(MetalTimestampQuery));
+    query->sampleBuffer = sampleBuffer;
+    return (SDL_GpuTimestampQuery*) query;
+}
+
+/* Bindless Tables */
+
+static SDL_GpuBindlessTable* METAL_CreateBindlessTable(
+    SDL_GpuRenderer *driverData,
+    Uint32 capacity
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+    MTLArgumentDescriptor *textureArgument;
+    MTLArgumentDescriptor *samplerArgument;
+    id<MTLArgumentEncoder> encoder;
+    id<MTLBuffer> argumentBuffer;
+    MetalBindlessTable *bindlessTable;
+
+    if (renderer->device.argumentBuffersSupport < MTLArgumentBuffersTier2)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Bindless tables are not supported on this device!"
+        );
+        return NULL;
+    }
+
+    if (capacity == 0 || capacity > METAL_MAX_BINDLESS_TABLE_SIZE)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Invalid bindless table capacity: %u", capacity);
+        return NULL;
+    }
+
+    textureArgument = [MTLArgumentDescriptor argumentDescriptor];
+    textureArgument.dataType = MTLDataTypeTexture;
+    textureArgument.textureType = MTLTextureType2D;
+    textureArgument.access = MTLArgumentAccessReadOnly;
+    textureArgument.index = 0;
+    textureArgument.arrayLength = capacity;
+
+    samplerArgument = [MTLArgumentDescriptor argumentDescriptor];
+    samplerArgument.dataType = MTLDataTypeSampler;
+    samplerArgument.access = MTLArgumentAccessReadOnly;
+    samplerArgument.index = capacity;
+    samplerArgument.arrayLength = capacity;
+
+    encoder = [renderer->device newArgumentEncoderWithArguments:@[textureArgument, samplerArgument]];
+    if (encoder == nil)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create bindless table encoder");
+        return NULL;
+    }
+
+    argumentBuffer = [renderer->device
+        newBufferWithLength:encoder.encodedLength
+        options:MTLResourceStorageModeShared];
+    if (argumentBuffer == nil)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create bindless table buffer");
+        return NULL;
+    }
+
+    [encoder setArgumentBuffer:argumentBuffer offset:0];
+
+    bindlessTable = (MetalBindlessTable*) SDL_malloc(sizeof(MetalBindlessTable));
+    bindlessTable->encoder = encoder;
+    bindlessTable->argumentBuffer = argumentBuffer;
+    bindlessTable->capacity = capacity;
+    bindlessTable->textures = (MetalTexture**) SDL_calloc(capacity, sizeof(MetalTexture*));
+    SDL_AtomicSet(&bindlessTable->referenceCount, 0);
+
+    return (SDL_GpuBindlessTable*) bindlessTable;
+}
+
+static void METAL_UpdateBindlessTable(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuBindlessTable *bindlessTable,
+    Uint32 firstIndex,
+    SDL_GpuTextureSamplerBinding *textureSamplerBindings,
+    Uint32 bindingCount
+) {
+    (void) driverData; /* used by other backends */
+    MetalBindlessTable *metalTable = (MetalBindlessTable*) bindlessTable;
+    MetalTexture *texture;
+    Uint32 index;
+
+    if (firstIndex + bindingCount > metalTable->capacity)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless table update is out of range!");
+        return;
+    }
+
+    /* The buffer is shared storage, so encoded writes are visible without a flush */
+    for (Uint32 i = 0; i < bindingCount; i += 1)
+    {
+        index = firstIndex + i;
+
+        if (((MetalTextureContainer*) textureSamplerBindings[i].texture)->isTransient)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Transient textures cannot be placed in a bindless table!");
+            continue;
+        }
+
+        texture = ((MetalTextureContainer*) textureSamplerBindings[i].texture)->activeTexture;
+
+        SDL_AtomicIncRef(&texture->referenceCount);
+        if (metalTable->textures[index] != NULL)
+        {
+            (void)SDL_AtomicDecRef(&metalTable->textures[index]->referenceCount);
+        }
+        metalTable->textures[index] = texture;
+
+        [metalTable->encoder setTexture:texture->handle atIndex:index];
+        [metalTable->encoder
+            setSamplerState:((MetalSampler*) textureSamplerBindings[i].sampler)->handle
+            atIndex:metalTable->capacity + index];
+    }
+}
+
+static Uint32 METAL_GetMaxBindlessTableSize(
+    SDL_GpuRenderer *driverData
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+
+    if (renderer->device.argumentBuffersSupport < MTLArgumentBuffersTier2)
+    {
+        return 0;
+    }
+
+    return METAL_MAX_BINDLESS_TABLE_SIZE;
+}
+
+static SDL_bool METAL_SupportsIndirectCount(
+    SDL_GpuRenderer *driverData
+) {
+    (void) driverData;
+    return SDL_FALSE;
+}
+
+static void METAL_WriteTimestamp(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTimestampQuery *query
+) {
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    MetalTimestampQuery *metalQuery = (MetalTimestampQuery*) query;
+
+    /* Metal only samples at encoder boundaries, so encode an empty blit pass */
+    if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *))
+    {
+        MTLBlitPassDescriptor *passDescriptor = [MTLBlitPassDescriptor blitPassDescriptor];
+        id<MTLBlitCommandEncoder> blitEncoder;
+
+        passDescriptor.sampleBufferAttachments[0].sampleBuffer = metalQuery->sampleBuffer;
+        passDescriptor.sampleBufferAttachments[0].startOfEncoderSampleIndex = MTLCounterDontSample;
+        passDescriptor.sampleBufferAttachments[0].endOfEncoderSampleIndex = 0;
+
+        blitEncoder = [metalCommandBuffer->handle blitCommandEncoderWithDescriptor:passDescriptor];
+        [blitEncoder endEncoding];
+    }
+}
+
+static SDL_bool METAL_TimestampQueryResult(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTimestampQuery *query,
+    Uint64 *nanoseconds
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+    MetalTimestampQuery *metalQuery = (MetalTimestampQuery*) query;
+
+    if (@available(macOS 10.15, iOS 14.0, tvOS 14.0, *))
+    {
+        id<MTLCounterSampleBuffer> sampleBuffer = metalQuery->sampleBuffer;
+        NSData *data = [sampleBuffer resolveCounterRange:NSMakeRange(0, 1)];
+        MTLTimestamp timestamp;
+
+        if (data == nil)
+        {
+            return SDL_FALSE;
+        }
+
+        timestamp = ((const MTLCounterResultTimestamp*) data.bytes)->timestamp;
+        if (timestamp == MTLCounterErrorValue || timestamp == 0)
+        {
+            return SDL_FALSE;
+        }
+
+        /* Rebase onto the CPU clock so the calibration stays small */
+        *nanoseconds = renderer->calibrationCpuTimestamp + (
+            (timestamp >= renderer->calibrationGpuTimestamp) ?
+                METAL_INTERNAL_GpuTicksToNanoseconds(renderer, timestamp - renderer->calibrationGpuTimestamp) :
+                0
+        );
+        return SDL_TRUE;
+    }
+
+    return SDL_FALSE;
+}
+
+static void METAL_EnablePassTiming(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer*) commandBuffer;
+    MetalRenderer *renderer = metalCommandBuffer->renderer;
+
+    if (renderer->timestampCounterSet == nil)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Timestamp queries are not supported on this device!"
+        );
+        return;
+    }
+
+    if (metalCommandBuffer->passTimingEnabled)
+    {
+        return;
+    }
+
+    /* Each command buffer owns its sample buffer so recording threads never contend */
+    if (metalCommandBuffer->passTimingSampleBuffer == nil)
+    {
+        metalCommandBuffer->passTimingSampleBuffer = METAL_INTERNAL_CreateTimestampSampleBuffer(
+            renderer,
+            SDL_GPU_MAX_TIMED_PASSES * 2
+        );
+        if (metalCommandBuffer->passTimingSampleBuffer == nil)
+        {
+            return;
+        }
+    }
+
+    metalCommandBuffer->passTimingEnabled = 1;
+    metalCommandBuffer->passTimingCount = 0;
+}
+
+static Uint32 METAL_GetPassTimings(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuFence *fence,
+    SDL_GpuPassTiming *timings,
+    Uint32 maxTimings
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+    MetalFence *metalFence = (MetalFence*) fence;
+    Uint32 count;
+
+    if (!SDL_AtomicGet(&metalFence->complete))
+    {
+        return 0;
+    }
+
+    SDL_LockMutex(renderer->submitLock);
+
+    /* Timings are resolved when the command buffer is cleaned */
+    for (Sint32 i = renderer->submittedCommandBufferCount - 1; i >= 0; i -= 1)
+    {
+        if (SDL_AtomicGet(&renderer->submittedCommandBuffers[i]->fence->complete))
+        {
+            METAL_INTERNAL_CleanCommandBuffer(
+                renderer,
+                renderer->submittedCommandBuffers[i]
+            );
+        }
+    }
+
+    count = SDL_min(metalFence->passTimingCount, maxTimings);
+    SDL_memcpy(
+        timings,
+        metalFence->passTimings,
+        sizeof(SDL_GpuPassTiming) * count
+    );
+
+    SDL_UnlockMutex(renderer->submitLock);
+
+    return count;
+}
+
+static void METAL_EnablePipelineStatistics(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    (void) commandBuffer;
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Pipeline statistics are not supported on Metal!"
+    );
+}
+
 /* Format Info */
 
 static SDL_bool METAL_IsTextureFormatSupported(
@@ -2823,6 +4256,75 @@ static SDL_GpuSampleCount METAL_GetBestSampleCount(
     return highestSupported;
 }
 
+/* Pipeline Cache */
+
+static SDL_bool METAL_GetPipelineCacheData(
+    SDL_GpuRenderer *driverData,
+    void *data,
+    size_t *dataSize
+) {
+    MetalRenderer *renderer = (MetalRenderer*) driverData;
+    NSData *archiveData = nil;
+    NSError *error = NULL;
+    size_t payloadSize = 0;
+    void *payload;
+
+    /* Without binary archive support we still hand out a valid, empty blob */
+    if (renderer->binaryArchive != nil)
+    {
+        if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *))
+        {
+            id<MTLBinaryArchive> archive = renderer->binaryArchive;
+            NSURL *url = METAL_INTERNAL_GetTemporaryArchiveURL();
+
+            if (![archive serializeToURL:url error:&error])
+            {
+                SDL_LogError(
+                    SDL_LOG_CATEGORY_APPLICATION,
+                    "Serializing binary archive failed: %s", [[error description] UTF8String]
+                );
+                return SDL_FALSE;
+            }
+
+            archiveData = [NSData dataWithContentsOfURL:url];
+            [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+
+            if (archiveData == nil)
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reading back binary archive failed!");
+                return SDL_FALSE;
+            }
+
+            payloadSize = [archiveData length];
+        }
+    }
+
+    if (data == NULL)
+    {
+        *dataSize = sizeof(PipelineCacheHeader) + payloadSize;
+        return SDL_TRUE;
+    }
+
+    if (*dataSize < sizeof(PipelineCacheHeader) + payloadSize)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Pipeline cache data buffer is too small!");
+        return SDL_FALSE;
+    }
+
+    payload = PipelineCache_WriteHeader(
+        &renderer->pipelineCacheIdentity,
+        payloadSize,
+        data
+    );
+    if (archiveData != nil)
+    {
+        SDL_memcpy(payload, [archiveData bytes], payloadSize);
+    }
+
+    *dataSize = sizeof(PipelineCacheHeader) + payloadSize;
+    return SDL_TRUE;
+}
+
 /* SPIR-V Cross Interop */
 
 static SDL_GpuShader* METAL_CompileFromSPIRVCross(
@@ -2848,8 +4350,79 @@ static Uint8 METAL_PrepareDriver(SDL_VideoDevice *_this)
     return (_this->Metal_CreateView != NULL);
 }
 
-static SDL_GpuDevice* METAL_CreateDevice(SDL_bool debugMode)
-{
+static void METAL_INTERNAL_CreateBinaryArchive(
+    MetalRenderer *renderer,
+    const void *pipelineCacheData,
+    size_t pipelineCacheSize
+) {
+    NSOperatingSystemVersion osVersion = [[NSProcessInfo processInfo] operatingSystemVersion];
+    const char *deviceName = [[renderer->device name] UTF8String];
+    Uint64 nameHash = HashBytes(deviceName, SDL_strlen(deviceName), HASH_SEED);
+    const void *payload;
+    size_t payloadSize;
+
+    /* Metal has no driver version, but the compiler ships with the OS */
+    renderer->pipelineCacheIdentity.backend = SDL_GPU_BACKEND_METAL;
+    renderer->pipelineCacheIdentity.vendorID = 0x106B; /* Apple */
+    renderer->pipelineCacheIdentity.deviceID = (Uint32) nameHash;
+    renderer->pipelineCacheIdentity.driverVersion =
+        ((Uint64) osVersion.majorVersion << 32) |
+        ((Uint64) (osVersion.minorVersion & 0xFFFF) << 16) |
+        (Uint64) (osVersion.patchVersion & 0xFFFF);
+    SDL_memcpy(renderer->pipelineCacheIdentity.deviceUUID, &nameHash, sizeof(nameHash));
+
+    if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *))
+    {
+        MTLBinaryArchiveDescriptor *archiveDescriptor = [MTLBinaryArchiveDescriptor new];
+        NSURL *seedURL = nil;
+        NSError *error = NULL;
+
+        payload = PipelineCache_GetPayload(
+            &renderer->pipelineCacheIdentity,
+            pipelineCacheData,
+            pipelineCacheSize,
+            &payloadSize
+        );
+
+        /* Binary archives can only be loaded from a file, so round-trip the seed through one */
+        if (payload != NULL)
+        {
+            NSData *seedData = [NSData dataWithBytesNoCopy:(void*) payload length:payloadSize freeWhenDone:NO];
+            seedURL = METAL_INTERNAL_GetTemporaryArchiveURL();
+            if ([seedData writeToURL:seedURL atomically:NO])
+            {
+                archiveDescriptor.url = seedURL;
+            }
+        }
+
+        renderer->binaryArchive = [renderer->device newBinaryArchiveWithDescriptor:archiveDescriptor error:&error];
+        if (renderer->binaryArchive == nil && archiveDescriptor.url != nil)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Pipeline cache data was rejected by the driver, ignoring");
+            archiveDescriptor.url = nil;
+            error = NULL;
+            renderer->binaryArchive = [renderer->device newBinaryArchiveWithDescriptor:archiveDescriptor error:&error];
+        }
+        if (renderer->binaryArchive == nil)
+        {
+            SDL_LogWarn(
+                SDL_LOG_CATEGORY_APPLICATION,
+                "Creating binary archive failed: %s", [[error description] UTF8String]
+            );
+        }
+
+        if (seedURL != nil)
+        {
+            [[NSFileManager defaultManager] removeItemAtURL:seedURL error:nil];
+        }
+    }
+}
+
+static SDL_GpuDevice* METAL_CreateDevice(
+    SDL_bool debugMode,
+    const void *pipelineCacheData,
+    size_t pipelineCacheSize
+) {
     MetalRenderer *renderer;
 
     /* Allocate and zero out the renderer */
@@ -2872,6 +4445,45 @@ static SDL_GpuDevice* METAL_CreateDevice(SDL_bool debugMode)
     renderer->disposeLock = SDL_CreateMutex();
     renderer->fenceLock = SDL_CreateMutex();
     renderer->windowLock = SDL_CreateMutex();
+    renderer->heapLock = SDL_CreateMutex();
+
+    /* Sub-allocate from heaps where they can be hazard tracked */
+    if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, *))
+    {
+        renderer->useHeaps = 1;
+    }
+    renderer->heapCapacity = 4;
+    renderer->heapCount = 0;
+    renderer->heaps = SDL_malloc(
+        renderer->heapCapacity * sizeof(MetalHeap*)
+    );
+
+    /* Create the pipeline cache */
+    METAL_INTERNAL_CreateBinaryArchive(renderer, pipelineCacheData, pipelineCacheSize);
+
+    /* Look for a timestamp counter set that can be sampled at encoder boundaries */
+    renderer->timestampCounterSet = nil;
+    if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *))
+    {
+        if ([renderer->device supportsCounterSampling:MTLCounterSamplingPointAtStageBoundary])
+        {
+            for (id<MTLCounterSet> counterSet in renderer->device.counterSets)
+            {
+                if ([counterSet.name isEqualToString:MTLCommonCounterSetTimestamp])
+                {
+                    renderer->timestampCounterSet = counterSet;
+                    break;
+                }
+            }
+        }
+
+        if (renderer->timestampCounterSet != nil)
+        {
+            [renderer->device
+                sampleTimestamps:&renderer->calibrationCpuTimestamp
+                gpuTimestamp:&renderer->calibrationGpuTimestamp];
+        }
+    }
 
     /* Create command buffer pool */
     METAL_INTERNAL_AllocateCommandBuffers(renderer, 2);
@@ -2901,6 +4513,12 @@ static SDL_GpuDevice* METAL_CreateDevice(SDL_bool debugMode)
         renderer->textureContainersToDestroyCapacity * sizeof(MetalTextureContainer*)
     );
 
+    renderer->bindlessTablesToDestroyCapacity = 2;
+    renderer->bindlessTablesToDestroyCount = 0;
+    renderer->bindlessTablesToDestroy = SDL_malloc(
+        renderer->bindlessTablesToDestroyCapacity * sizeof(MetalBindlessTable*)
+    );
+
     /* Create claimed window list */
     renderer->claimedWindowCapacity = 1;
     renderer->claimedWindows = SDL_malloc(
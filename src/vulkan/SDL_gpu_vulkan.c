@@ -58,11 +58,26 @@ typedef struct VulkanExtensions
     /* Core since 1.1 */
     Uint8 KHR_maintenance1;
     Uint8 KHR_get_memory_requirements2;
+    Uint8 KHR_dedicated_allocation;
+    Uint8 KHR_multiview;
+    Uint8 KHR_maintenance2;
+    Uint8 KHR_maintenance3;
 
     /* Core since 1.2 */
     Uint8 KHR_driver_properties;
+    Uint8 KHR_draw_indirect_count;
+    Uint8 KHR_create_renderpass2;
+    Uint8 KHR_depth_stencil_resolve;
+    Uint8 KHR_timeline_semaphore;
+    Uint8 EXT_descriptor_indexing;
+    /* Core since 1.3 */
+    Uint8 KHR_synchronization2;
+    Uint8 KHR_dynamic_rendering;
+    /* Core since 1.4 */
+    Uint8 KHR_push_descriptor;
     /* EXT, probably not going to be Core */
     Uint8 EXT_vertex_attribute_divisor;
+    Uint8 EXT_memory_budget;
     /* Only required for special implementations (i.e. MoltenVK) */
     Uint8 KHR_portability_subset;
 } VulkanExtensions;
@@ -72,10 +87,30 @@ typedef struct VulkanExtensions
 #define SMALL_ALLOCATION_THRESHOLD 2097152      /* 2   MiB */
 #define SMALL_ALLOCATION_SIZE 16777216          /* 16  MiB */
 #define LARGE_ALLOCATION_INCREMENT 67108864     /* 64  MiB */
-#define MAX_UBO_SECTION_SIZE 4096               /* 4   KiB */
-#define UNIFORM_BUFFER_SIZE 1048576             /* 1   MiB */
+#define DEDICATED_ALLOCATION_THRESHOLD 8388608  /* 8   MiB */
+#define MEMORY_FREE_FIRST_LEVELS 40             /* regions up to 1 TiB */
+#define MEMORY_FREE_SECOND_LEVEL_LOG2 3
+#define MEMORY_FREE_SECOND_LEVELS (1 << MEMORY_FREE_SECOND_LEVEL_LOG2)
+#define MAX_UNIFORM_PUSH_SIZE 65536             /* 64  KiB */
+#define UNIFORM_ARENA_BLOCK_SIZE 262144         /* 256 KiB */
+#define UNIFORM_ARENA_BLOCKS_PER_PAGE 32        /* 8   MiB pages */
 #define DESCRIPTOR_POOL_STARTING_SIZE 128
+#define DESCRIPTOR_SET_CACHE_BATCH_SIZE 16
+#define NUM_WRITTEN_DESCRIPTOR_SET_BUCKETS 61
 #define MAX_QUERIES 16
+#define MAX_TIMESTAMP_QUERIES 64
+
+/* Results come back in bit order, see VULKAN_INTERNAL_ResolvePipelineStatistics */
+#define VULKAN_GRAPHICS_PIPELINE_STATISTICS ( \
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT | \
+    VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT | \
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT | \
+    VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT | \
+    VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT \
+)
+#define MAX_BINDLESS_TABLE_SIZE 65536
+#define DEFRAG_BYTES_PER_PASS 33554432          /* 32  MiB */
+#define DEFRAG_MILLISECONDS_PER_PASS 2
 #define WINDOW_PROPERTY_DATA "SDL_GpuVulkanWindowPropertyData"
 
 #define IDENTITY_SWIZZLE 		\
@@ -378,8 +413,16 @@ typedef struct VulkanTextureContainer VulkanTextureContainer;
 
 typedef struct VulkanFenceHandle
 {
-    VkFence fence;
+    VkFence fence; /* VK_NULL_HANDLE with timeline semaphores */
     SDL_atomic_t referenceCount;
+
+    /* With timeline semaphores a fence is just a point on its queue's timeline */
+    VkSemaphore timelineSemaphore;
+    Uint64 timelineValue;
+
+    /* Resolved from the command buffer's pass timing queries once it completes */
+    SDL_GpuPassTiming passTimings[SDL_GPU_MAX_TIMED_PASSES];
+    Uint32 passTimingCount;
 } VulkanFenceHandle;
 
 /* Memory Allocation */
@@ -390,7 +433,10 @@ typedef struct VulkanMemoryFreeRegion
     VkDeviceSize offset;
     VkDeviceSize size;
     Uint32 allocationIndex;
-    Uint32 sortedIndex;
+
+    /* links within its free bin, only while the allocation is available */
+    struct VulkanMemoryFreeRegion *prevFree;
+    struct VulkanMemoryFreeRegion *nextFree;
 } VulkanMemoryFreeRegion;
 
 typedef struct VulkanMemoryUsedRegion
@@ -409,14 +455,25 @@ typedef struct VulkanMemoryUsedRegion
     };
 } VulkanMemoryUsedRegion;
 
+/* Free regions of allocations that are available for allocation, in a
+ * two-level segregated fit index. The first level is floor(log2(size)),
+ * the second splits each power of two into MEMORY_FREE_SECOND_LEVELS linear
+ * steps. The bitmaps mark non-empty bins, so insertion, removal and finding
+ * a bin that fits are all O(1).
+ */
+typedef struct VulkanMemoryFreeIndex
+{
+    Uint64 firstLevelBitmap;
+    Uint32 secondLevelBitmaps[MEMORY_FREE_FIRST_LEVELS];
+    VulkanMemoryFreeRegion *bins[MEMORY_FREE_FIRST_LEVELS][MEMORY_FREE_SECOND_LEVELS];
+} VulkanMemoryFreeIndex;
+
 typedef struct VulkanMemorySubAllocator
 {
     Uint32 memoryTypeIndex;
     VulkanMemoryAllocation **allocations;
     Uint32 allocationCount;
-    VulkanMemoryFreeRegion **sortedFreeRegions;
-    Uint32 sortedFreeRegionCount;
-    Uint32 sortedFreeRegionCapacity;
+    VulkanMemoryFreeIndex freeIndices[2]; /* large allocations, small allocations */
 } VulkanMemorySubAllocator;
 
 struct VulkanMemoryAllocation
@@ -431,6 +488,7 @@ struct VulkanMemoryAllocation
     Uint32 freeRegionCount;
     Uint32 freeRegionCapacity;
     Uint8 availableForAllocation;
+    Uint8 dedicated; /* Owned by a single resource, never suballocated */
     VkDeviceSize freeSpace;
     VkDeviceSize usedSpace;
     Uint8 *mapPointer;
@@ -570,6 +628,9 @@ struct VulkanTexture
 
     VulkanTextureHandle *handle;
 
+    /* Bindless table entries bake the image view, so defrag must not move the image */
+    SDL_atomic_t bindlessReferenceCount;
+
     Uint8 markedForDestroy; /* so that defrag doesn't double-free */
 };
 
@@ -594,6 +655,8 @@ struct VulkanTextureContainer
     /* Swapchain images cannot be cycled */
     Uint8 canBeCycled;
 
+    SDL_GpuTextureFormat format; /* for SDL_GpuFrameStats transfer sizes */
+
     char *debugName;
 };
 
@@ -676,12 +739,21 @@ typedef struct VulkanPresentData
     Uint32 swapchainImageIndex;
 } VulkanPresentData;
 
-typedef struct VulkanUniformBuffer
+/* Uniform data lives in a device-wide arena of persistently mapped pages.
+ * Pages are carved into fixed-size blocks that command buffers check out
+ * and bump-allocate from while recording, then hand back once the GPU is
+ * done with them. Only block checkout touches the arena lock.
+ */
+typedef struct VulkanUniformBlock
 {
-    VulkanBufferContainer *bufferContainer;
+    VulkanBuffer *buffer; /* The arena page this block lives in */
+    Uint32 offset;
+} VulkanUniformBlock;
 
+typedef struct VulkanUniformBuffer
+{
+    VulkanBuffer *buffer;
     Uint32 drawOffset;
-    Uint32 offset;
 } VulkanUniformBuffer;
 
 typedef struct VulkanDescriptorInfo
@@ -696,6 +768,9 @@ typedef struct DescriptorSetPool
 
     VkDescriptorSetLayout descriptorSetLayout;
 
+    /* Push descriptor layouts are written with vkCmdPushDescriptorSetKHR and own no sets */
+    Uint8 pushDescriptors;
+
     VulkanDescriptorInfo *descriptorInfos;
     Uint32 descriptorInfoCount;
 
@@ -708,6 +783,9 @@ typedef struct DescriptorSetPool
     VkDescriptorSet *inactiveDescriptorSets;
     Uint32 inactiveDescriptorSetCount;
     Uint32 inactiveDescriptorSetCapacity;
+
+    /* Set once the owning pipeline is released, so idle caches let go of it */
+    SDL_atomic_t released;
 } DescriptorSetPool;
 
 typedef struct VulkanGraphicsPipelineResourceLayout
@@ -720,8 +798,10 @@ typedef struct VulkanGraphicsPipelineResourceLayout
      * 1: vertex uniform buffers
      * 2: fragment resources
      * 3: fragment uniform buffers
+     * 4: bindless table, if the pipeline uses one
      */
     DescriptorSetPool descriptorSetPools[4];
+    Uint8 useBindlessTable;
 
     Uint32 vertexSamplerCount;
     Uint32 vertexStorageBufferCount;
@@ -756,8 +836,10 @@ typedef struct VulkanComputePipelineResourceLayout
      * 0: read-only textures, then read-only buffers
      * 1: read-write textures, then read-write buffers
      * 2: uniform buffers
+     * 3: bindless table, if the pipeline uses one
      */
     DescriptorSetPool descriptorSetPools[3];
+    Uint8 useBindlessTable;
 
     Uint32 readOnlyStorageTextureCount;
     Uint32 readOnlyStorageBufferCount;
@@ -777,15 +859,34 @@ typedef struct VulkanComputePipeline
     SDL_atomic_t referenceCount;
 } VulkanComputePipeline;
 
+/* A single update-after-bind set of combined image samplers.
+ * Every occupied entry holds a reference on its texture and sampler.
+ */
+typedef struct VulkanBindlessTable
+{
+    VkDescriptorPool descriptorPool;
+    VkDescriptorSet descriptorSet;
+    Uint32 capacity;
+
+    VulkanTexture **textures;
+    VulkanSampler **samplers;
+
+    SDL_atomic_t referenceCount;
+} VulkanBindlessTable;
+
 typedef struct VulkanOcclusionQuery
 {
     Uint32 index;
 } VulkanOcclusionQuery;
 
+typedef struct VulkanTimestampQuery
+{
+    Uint32 index;
+} VulkanTimestampQuery;
+
 typedef struct RenderPassColorTargetDescription
 {
     VkFormat format;
-    SDL_GpuColor clearColor;
     SDL_GpuLoadOp loadOp;
     SDL_GpuStoreOp storeOp;
 } RenderPassColorTargetDescription;
@@ -843,14 +944,6 @@ static inline Uint8 RenderPassHash_Compare(
             return 0;
         }
 
-        if (	a->colorTargetDescriptions[i].clearColor.r != b->colorTargetDescriptions[i].clearColor.r ||
-            a->colorTargetDescriptions[i].clearColor.g != b->colorTargetDescriptions[i].clearColor.g ||
-            a->colorTargetDescriptions[i].clearColor.b != b->colorTargetDescriptions[i].clearColor.b ||
-            a->colorTargetDescriptions[i].clearColor.a != b->colorTargetDescriptions[i].clearColor.a	)
-        {
-            return 0;
-        }
-
         if (a->colorTargetDescriptions[i].loadOp != b->colorTargetDescriptions[i].loadOp)
         {
             return 0;
@@ -925,6 +1018,59 @@ static inline void RenderPassHashArray_Insert(
     arr->count += 1;
 }
 
+#define NUM_RENDER_PASS_HASH_BUCKETS 67
+
+typedef struct RenderPassHashTable
+{
+    RenderPassHashArray buckets[NUM_RENDER_PASS_HASH_BUCKETS];
+} RenderPassHashTable;
+
+static inline uint64_t RenderPassHashTable_GetHashCode(RenderPassHash *key)
+{
+    const uint64_t HASH_FACTOR = 97;
+    uint64_t result = 1;
+    Uint32 i;
+
+    result = result * HASH_FACTOR + (uint64_t) key->colorAttachmentCount;
+    result = result * HASH_FACTOR + (uint64_t) key->colorAttachmentSampleCount;
+
+    for (i = 0; i < key->colorAttachmentCount; i += 1)
+    {
+        result = result * HASH_FACTOR + (uint64_t) key->colorTargetDescriptions[i].format;
+        result = result * HASH_FACTOR + (uint64_t) key->colorTargetDescriptions[i].loadOp;
+        result = result * HASH_FACTOR + (uint64_t) key->colorTargetDescriptions[i].storeOp;
+    }
+
+    result = result * HASH_FACTOR + (uint64_t) key->depthStencilTargetDescription.format;
+    result = result * HASH_FACTOR + (uint64_t) key->depthStencilTargetDescription.loadOp;
+    result = result * HASH_FACTOR + (uint64_t) key->depthStencilTargetDescription.storeOp;
+    result = result * HASH_FACTOR + (uint64_t) key->depthStencilTargetDescription.stencilLoadOp;
+    result = result * HASH_FACTOR + (uint64_t) key->depthStencilTargetDescription.stencilStoreOp;
+
+    return result;
+}
+
+static inline VkRenderPass RenderPassHashTable_Fetch(
+    RenderPassHashTable *table,
+    RenderPassHash *key
+) {
+    uint64_t hashcode = RenderPassHashTable_GetHashCode(key);
+    RenderPassHashArray *arr = &table->buckets[hashcode % NUM_RENDER_PASS_HASH_BUCKETS];
+
+    return RenderPassHashArray_Fetch(arr, key);
+}
+
+static inline void RenderPassHashTable_Insert(
+    RenderPassHashTable *table,
+    RenderPassHash key,
+    VkRenderPass value
+) {
+    uint64_t hashcode = RenderPassHashTable_GetHashCode(&key);
+    RenderPassHashArray *arr = &table->buckets[hashcode % NUM_RENDER_PASS_HASH_BUCKETS];
+
+    RenderPassHashArray_Insert(arr, key, value);
+}
+
 typedef struct FramebufferHash
 {
     VkImageView colorAttachmentViews[MAX_COLOR_TARGET_BINDINGS];
@@ -939,6 +1085,7 @@ typedef struct FramebufferHashMap
 {
     FramebufferHash key;
     VulkanFramebuffer *value;
+    Uint32 lastUsedSubmit; /* Submit counter at the most recent fetch */
 } FramebufferHashMap;
 
 typedef struct FramebufferHashArray
@@ -992,7 +1139,8 @@ static inline Uint8 FramebufferHash_Compare(
 
 static inline VulkanFramebuffer* FramebufferHashArray_Fetch(
     FramebufferHashArray *arr,
-    FramebufferHash *key
+    FramebufferHash *key,
+    Uint32 submitIndex
 ) {
     Sint32 i;
 
@@ -1001,6 +1149,7 @@ static inline VulkanFramebuffer* FramebufferHashArray_Fetch(
         FramebufferHash *e = &arr->elements[i].key;
         if (FramebufferHash_Compare(e, key))
         {
+            arr->elements[i].lastUsedSubmit = submitIndex;
             return arr->elements[i].value;
         }
     }
@@ -1011,11 +1160,13 @@ static inline VulkanFramebuffer* FramebufferHashArray_Fetch(
 static inline void FramebufferHashArray_Insert(
     FramebufferHashArray *arr,
     FramebufferHash key,
-    VulkanFramebuffer *value
+    VulkanFramebuffer *value,
+    Uint32 submitIndex
 ) {
     FramebufferHashMap map;
     map.key = key;
     map.value = value;
+    map.lastUsedSubmit = submitIndex;
 
     EXPAND_ELEMENTS_IF_NEEDED(arr, 4, FramebufferHashMap)
 
@@ -1035,13 +1186,107 @@ static inline void FramebufferHashArray_Remove(
     arr->count -= 1;
 }
 
+#define NUM_FRAMEBUFFER_HASH_BUCKETS 257
+
+/* Every FRAMEBUFFER_EVICTION_INTERVAL submits, framebuffers that have not been
+ * fetched for more than FRAMEBUFFER_MAX_IDLE_SUBMITS submits are released.
+ */
+#define FRAMEBUFFER_EVICTION_INTERVAL 64
+#define FRAMEBUFFER_MAX_IDLE_SUBMITS 256
+
+typedef struct FramebufferHashTable
+{
+    FramebufferHashArray buckets[NUM_FRAMEBUFFER_HASH_BUCKETS];
+} FramebufferHashTable;
+
+static inline uint64_t FramebufferHashTable_GetHashCode(FramebufferHash *key)
+{
+    const uint64_t HASH_FACTOR = 97;
+    uint64_t result = 1;
+    Uint32 i;
+
+    result = result * HASH_FACTOR + (uint64_t) key->colorAttachmentCount;
+
+    for (i = 0; i < key->colorAttachmentCount; i += 1)
+    {
+        result = result * HASH_FACTOR + (uint64_t) key->colorAttachmentViews[i];
+        result = result * HASH_FACTOR + (uint64_t) key->colorMultiSampleAttachmentViews[i];
+    }
+
+    result = result * HASH_FACTOR + (uint64_t) key->depthStencilAttachmentView;
+    result = result * HASH_FACTOR + (uint64_t) key->width;
+    result = result * HASH_FACTOR + (uint64_t) key->height;
+
+    return result;
+}
+
+static inline VulkanFramebuffer* FramebufferHashTable_Fetch(
+    FramebufferHashTable *table,
+    FramebufferHash *key,
+    Uint32 submitIndex
+) {
+    uint64_t hashcode = FramebufferHashTable_GetHashCode(key);
+    FramebufferHashArray *arr = &table->buckets[hashcode % NUM_FRAMEBUFFER_HASH_BUCKETS];
+
+    return FramebufferHashArray_Fetch(arr, key, submitIndex);
+}
+
+static inline void FramebufferHashTable_Insert(
+    FramebufferHashTable *table,
+    FramebufferHash key,
+    VulkanFramebuffer *value,
+    Uint32 submitIndex
+) {
+    uint64_t hashcode = FramebufferHashTable_GetHashCode(&key);
+    FramebufferHashArray *arr = &table->buckets[hashcode % NUM_FRAMEBUFFER_HASH_BUCKETS];
+
+    FramebufferHashArray_Insert(arr, key, value, submitIndex);
+}
+
 /* Command structures */
 
-typedef struct DescriptorSetData
+/*
+ * Descriptor sets taken from a shared DescriptorSetPool are kept by the
+ * command buffer that took them. Sets are handed out without locking and are
+ * all made available again when the command buffer is cleaned, so the shared
+ * pool lock is only taken to refill or trim the cache in batches.
+ */
+typedef struct DescriptorSetCache
+{
+    DescriptorSetPool *descriptorSetPool;
+
+    /* The cache holds a reference on the pipeline that owns the pool */
+    SDL_atomic_t *pipelineReferenceCount;
+
+    VkDescriptorSet *descriptorSets;
+    Uint32 descriptorSetCount;
+    Uint32 descriptorSetCapacity;
+
+    /* Sets at indices below this are in use by the command buffer */
+    Uint32 usedDescriptorSetCount;
+} DescriptorSetCache;
+
+/*
+ * Descriptor sets that have already been written during this recording,
+ * keyed by their pool and the handles written into them. The key handles
+ * are stored in the command buffer's key array. A written set is never
+ * rewritten before the command buffer is cleaned, so it can be rebound.
+ */
+typedef struct WrittenDescriptorSet
 {
+    Uint64 hash;
     DescriptorSetPool *descriptorSetPool;
+    Uint32 keyOffset;
+    Uint32 keyLength;
     VkDescriptorSet descriptorSet;
-} DescriptorSetData;
+} WrittenDescriptorSet;
+
+typedef struct WrittenDescriptorSetArray
+{
+    WrittenDescriptorSet *elements;
+    Uint32 count;
+    Uint32 capacity;
+} WrittenDescriptorSetArray;
 
 typedef struct VulkanFencePool
 {
@@ -1056,6 +1301,37 @@ typedef struct VulkanCommandPool VulkanCommandPool;
 
 typedef struct VulkanRenderer VulkanRenderer;
 
+/* One monotonically increasing counter per queue, signaled by every submission */
+typedef struct VulkanTimeline
+{
+    VkSemaphore semaphore;
+    Uint64 submittedValue; /* guarded by submitLock */
+    Uint64 completedValue; /* refreshed once per retirement pass */
+} VulkanTimeline;
+
+typedef struct VulkanSemaphoreList
+{
+    VkSemaphore *elements;
+    Uint32 count;
+    Uint32 capacity;
+} VulkanSemaphoreList;
+
+static inline void VULKAN_INTERNAL_PushSemaphore(
+    VulkanSemaphoreList *list,
+    VkSemaphore semaphore
+) {
+    EXPAND_ELEMENTS_IF_NEEDED(list, 4, VkSemaphore)
+
+    list->elements[list->count] = semaphore;
+    list->count += 1;
+}
+
+typedef struct VulkanBarrierStages
+{
+    VkPipelineStageFlags srcStages;
+    VkPipelineStageFlags dstStages;
+} VulkanBarrierStages;
+
 typedef struct VulkanCommandBuffer
 {
     CommandBufferCommonHeader common;
@@ -1063,6 +1339,7 @@ typedef struct VulkanCommandBuffer
 
     VkCommandBuffer commandBuffer;
     VulkanCommandPool *commandPool;
+    VkCommandBufferLevel level;
 
     VulkanPresentData *presentDatas;
     Uint32 presentDataCount;
@@ -1076,6 +1353,12 @@ typedef struct VulkanCommandBuffer
     Uint32 signalSemaphoreCount;
     Uint32 signalSemaphoreCapacity;
 
+    /* Cross-queue semaphores waited on by this submission, recycled on clean */
+    VulkanSemaphoreList queueWaitSemaphores;
+
+    /* Signaled by earlier submissions on this queue but never waited on, destroyed on clean */
+    VulkanSemaphoreList supersededQueueSemaphores;
+
     VulkanComputePipeline *currentComputePipeline;
     VulkanGraphicsPipeline *currentGraphicsPipeline;
 
@@ -1086,6 +1369,18 @@ typedef struct VulkanCommandBuffer
 
     VulkanTextureSlice *depthStencilAttachmentSlice; /* may be NULL */
 
+    /* Inherited by sub passes, VK_NULL_HANDLE with dynamic rendering */
+    VkRenderPass currentRenderPass;
+    VkFramebuffer currentFramebuffer;
+
+    /* Sub passes of a parallel render pass, executed in this order.
+     * Only touched under acquireCommandBufferLock while the pass is recording.
+     */
+    struct VulkanCommandBuffer **secondaryCommandBuffers;
+    Uint32 secondaryCommandBufferCount;
+    Uint32 secondaryCommandBufferCapacity;
+    Uint32 firstSubPassIndex; /* where the current parallel render pass starts */
+
     /* Viewport/scissor state */
 
     VkViewport currentViewport;
@@ -1105,6 +1400,11 @@ typedef struct VulkanCommandBuffer
     SDL_bool needNewComputeUniformDescriptorSet;
     SDL_bool needNewComputeUniformOffsets;
 
+    VulkanBindlessTable *graphicsBindlessTable;
+    VulkanBindlessTable *computeBindlessTable;
+    SDL_bool needNewGraphicsBindlessTable;
+    SDL_bool needNewComputeBindlessTable;
+
     VkDescriptorSet vertexResourceDescriptorSet;
     VkDescriptorSet vertexUniformDescriptorSet;
     VkDescriptorSet fragmentResourceDescriptorSet;
@@ -1114,9 +1414,15 @@ typedef struct VulkanCommandBuffer
     VkDescriptorSet computeReadWriteDescriptorSet;
     VkDescriptorSet computeUniformDescriptorSet;
 
-    DescriptorSetData *boundDescriptorSetDatas;
-    Uint32 boundDescriptorSetDataCount;
-    Uint32 boundDescriptorSetDataCapacity;
+    DescriptorSetCache *descriptorSetCaches;
+    Uint32 descriptorSetCacheCount;
+    Uint32 descriptorSetCacheCapacity;
+    Uint32 lastDescriptorSetCacheIndex;
+
+    WrittenDescriptorSetArray writtenDescriptorSetBuckets[NUM_WRITTEN_DESCRIPTOR_SET_BUCKETS];
+    Uint64 *writtenDescriptorSetKeys;
+    Uint32 writtenDescriptorSetKeyCount;
+    Uint32 writtenDescriptorSetKeyCapacity;
 
     VulkanTexture *vertexSamplerTextures[MAX_TEXTURE_SAMPLERS_PER_STAGE];
     VulkanSampler *vertexSamplers[MAX_TEXTURE_SAMPLERS_PER_STAGE];
@@ -1136,13 +1442,15 @@ typedef struct VulkanCommandBuffer
 
     /* Uniform buffers */
 
-    VulkanUniformBuffer *vertexUniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
-    VulkanUniformBuffer *fragmentUniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
-    VulkanUniformBuffer *computeUniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
+    VulkanUniformBuffer vertexUniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
+    VulkanUniformBuffer fragmentUniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
+    VulkanUniformBuffer computeUniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
 
-    Uint32 initializedVertexUniformBufferCount;
-    Uint32 initializedFragmentUniformBufferCount;
-    Uint32 initializedComputeUniformBufferCount;
+    /* Arena blocks checked out by this command buffer, the last one is current */
+    VulkanUniformBlock *uniformBlocks;
+    Uint32 uniformBlockCount;
+    Uint32 uniformBlockCapacity;
+    Uint32 uniformBlockCursor;
 
     /* Track used resources */
 
@@ -1166,24 +1474,58 @@ typedef struct VulkanCommandBuffer
     Uint32 usedComputePipelineCount;
     Uint32 usedComputePipelineCapacity;
 
+    VulkanBindlessTable **usedBindlessTables;
+    Uint32 usedBindlessTableCount;
+    Uint32 usedBindlessTableCapacity;
+
     VulkanFramebuffer **usedFramebuffers;
     Uint32 usedFramebufferCount;
     Uint32 usedFramebufferCapacity;
 
+    /* Barriers waiting for the next command, see VULKAN_INTERNAL_FlushBarriers */
+
+    VkBufferMemoryBarrier *pendingBufferBarriers;
+    VulkanBarrierStages *pendingBufferBarrierStages;
+    Uint32 pendingBufferBarrierCount;
+    Uint32 pendingBufferBarrierCapacity;
+
+    VkImageMemoryBarrier *pendingImageBarriers;
+    VulkanBarrierStages *pendingImageBarrierStages;
+    Uint32 pendingImageBarrierCount;
+    Uint32 pendingImageBarrierCapacity;
+
     VulkanFenceHandle *inFlightFence;
     Uint8 autoReleaseFence;
 
+    /* Pass timing, two timestamps per pass */
+    VkQueryPool passTimingQueryPool; /* created on first use */
+    SDL_GpuPassType passTimingTypes[SDL_GPU_MAX_TIMED_PASSES];
+    Uint32 passTimingCount;
+    Uint8 passTimingEnabled;
+
+    /* Pipeline statistics, one query around the whole command buffer */
+    VkQueryPool pipelineStatisticsQueryPool; /* created on first use */
+    Uint8 pipelineStatisticsEnabled;
+
     Uint8 isDefrag; /* Whether this CB was created for defragging */
 } VulkanCommandBuffer;
 
 struct VulkanCommandPool
 {
     SDL_threadID threadID;
+    Uint32 queueFamilyIndex;
+    VkQueue queue; /* where command buffers from this pool are submitted */
+    VulkanTimeline *timeline; /* NULL without timeline semaphores */
     VkCommandPool commandPool;
 
     VulkanCommandBuffer **inactiveCommandBuffers;
     Uint32 inactiveCommandBufferCapacity;
     Uint32 inactiveCommandBufferCount;
+
+    /* Secondary command buffers record sub passes of parallel render passes */
+    VulkanCommandBuffer **inactiveSecondaryCommandBuffers;
+    Uint32 inactiveSecondaryCommandBufferCapacity;
+    Uint32 inactiveSecondaryCommandBufferCount;
 };
 
 #define NUM_COMMAND_POOL_BUCKETS 1031
@@ -1191,6 +1533,7 @@ struct VulkanCommandPool
 typedef struct CommandPoolHash
 {
     SDL_threadID threadID;
+    VkQueue queue;
 } CommandPoolHash;
 
 typedef struct CommandPoolHashMap
@@ -1216,6 +1559,7 @@ static inline uint64_t CommandPoolHashTable_GetHashCode(CommandPoolHash key)
     const uint64_t HASH_FACTOR = 97;
     uint64_t result = 1;
     result = result * HASH_FACTOR + (uint64_t) key.threadID;
+    result = result * HASH_FACTOR + (uint64_t) (size_t) key.queue;
     return result;
 }
 
@@ -1230,7 +1574,7 @@ static inline VulkanCommandPool* CommandPoolHashTable_Fetch(
     for (i = 0; i < arr->count; i += 1)
     {
         const CommandPoolHash *e = &arr->elements[i].key;
-        if (key.threadID == e->threadID)
+        if (key.threadID == e->threadID && key.queue == e->queue)
         {
             return arr->elements[i].value;
         }
@@ -1265,6 +1609,7 @@ struct VulkanRenderer
     VkPhysicalDevice physicalDevice;
     VkPhysicalDeviceProperties2 physicalDeviceProperties;
     VkPhysicalDeviceDriverPropertiesKHR physicalDeviceDriverProperties;
+    VkPhysicalDevicePushDescriptorPropertiesKHR physicalDevicePushDescriptorProperties;
     VkDevice logicalDevice;
     Uint8 integratedMemoryNotification;
     Uint8 outOfDeviceLocalMemoryWarning;
@@ -1284,6 +1629,29 @@ struct VulkanRenderer
     Uint32 queueFamilyIndex;
     VkQueue unifiedQueue;
 
+    /* Dedicated queues alias the unified queue when the device has no suitable family */
+    Uint32 computeQueueFamilyIndex;
+    VkQueue computeQueue;
+    Uint32 transferQueueFamilyIndex;
+    VkQueue transferQueue;
+
+    /* Resources are shared concurrently between these families when there is more than one */
+    Uint32 queueFamilyIndices[3];
+    Uint32 queueFamilyIndexCount;
+
+    /* The latest semaphore an upstream queue signaled for the next downstream submission, or VK_NULL_HANDLE.
+     * A signal covers all earlier work on its queue, so each one supersedes the one before it.
+     * Guarded by submitLock.
+     */
+    VkSemaphore transferToGraphicsSemaphore;
+    VkSemaphore computeToGraphicsSemaphore;
+    VkSemaphore transferToComputeSemaphore;
+    VulkanSemaphoreList availableQueueSemaphores;
+
+    /* Indexed like queueFamilyIndices, only created with KHR_timeline_semaphore */
+    VulkanTimeline timelines[3];
+    Uint32 timelineCount;
+
     VulkanCommandBuffer **submittedCommandBuffers;
     Uint32 submittedCommandBufferCount;
     Uint32 submittedCommandBufferCapacity;
@@ -1291,10 +1659,21 @@ struct VulkanRenderer
     VulkanFencePool fencePool;
 
     CommandPoolHashTable commandPoolHashTable;
-    RenderPassHashArray renderPassHashArray;
-    FramebufferHashArray framebufferHashArray;
+    RenderPassHashTable renderPassHashTable;
+    FramebufferHashTable framebufferHashTable;
+    SDL_atomic_t submitCounter;
 
     Uint32 minUBOAlignment;
+    Uint32 maxUniformPushSize;
+
+    /* Device-wide uniform arena */
+    VulkanBuffer **uniformArenaPages;
+    Uint32 uniformArenaPageCount;
+    Uint32 uniformArenaPageCapacity;
+
+    VulkanUniformBlock *availableUniformBlocks;
+    Uint32 availableUniformBlockCount;
+    Uint32 availableUniformBlockCapacity;
 
     /* Some drivers don't support D16 for some reason. Fun! */
     VkFormat D16Format;
@@ -1305,6 +1684,27 @@ struct VulkanRenderer
     Sint8 freeQueryIndexStack[MAX_QUERIES];
     Sint8 freeQueryIndexStackHead;
 
+    Uint8 supportsTimestamps;
+    float timestampPeriod; /* nanoseconds per tick */
+    Uint64 timestampMask;
+    VkQueryPool timestampQueryPool;
+    Sint8 freeTimestampQueryIndexStack[MAX_TIMESTAMP_QUERIES];
+
+    /* Needs inheritedQueries too, so sub passes can run inside the query */
+    Uint8 supportsPipelineStatistics;
+
+    /* Counters recorded at submit or resolved at cleanup, guarded by submitLock */
+    SDL_GpuFrameStats frameStats;
+    Sint8 freeTimestampQueryIndexStackHead;
+
+    /* Pipeline cache, seeded from and exported to SDL_GpuGetPipelineCacheData blobs */
+    VkPipelineCache pipelineCache;
+    PipelineCacheHeader pipelineCacheIdentity;
+
+    /* Shared by every bindless table, only created with EXT_descriptor_indexing */
+    VkDescriptorSetLayout bindlessDescriptorSetLayout;
+    Uint32 maxBindlessTableSize;
+
     /* Deferred resource destruction */
 
     VulkanTexture **texturesToDestroy;
@@ -1327,6 +1727,10 @@ struct VulkanRenderer
     Uint32 computePipelinesToDestroyCount;
     Uint32 computePipelinesToDestroyCapacity;
 
+    VulkanBindlessTable **bindlessTablesToDestroy;
+    Uint32 bindlessTablesToDestroyCount;
+    Uint32 bindlessTablesToDestroyCapacity;
+
     VulkanShader **shadersToDestroy;
     Uint32 shadersToDestroyCount;
     Uint32 shadersToDestroyCapacity;
@@ -1342,6 +1746,7 @@ struct VulkanRenderer
     SDL_mutex *renderPassFetchLock;
     SDL_mutex *framebufferFetchLock;
     SDL_mutex *queryLock;
+    SDL_mutex *uniformArenaLock;
 
     Uint8 defragInProgress;
 
@@ -1362,11 +1767,16 @@ struct VulkanRenderer
 
 /* Forward declarations */
 
-static Uint8 VULKAN_INTERNAL_DefragmentMemory(VulkanRenderer *renderer);
+static SDL_bool VULKAN_INTERNAL_DefragmentMemory(
+    VulkanRenderer *renderer,
+    Uint32 maxBytes,
+    Uint32 maxMilliseconds
+);
 static void VULKAN_INTERNAL_BeginCommandBuffer(VulkanRenderer *renderer, VulkanCommandBuffer *commandBuffer);
 static void VULKAN_UnclaimWindow(SDL_GpuRenderer *driverData, SDL_Window *window);
 static void VULKAN_Wait(SDL_GpuRenderer *driverData);
 static void VULKAN_WaitForFences(SDL_GpuRenderer *driverData, SDL_bool waitAll, Uint32 fenceCount, SDL_GpuFence **pFences);
+static void VULKAN_INTERNAL_PerformPendingDestroys(VulkanRenderer *renderer);
 static void VULKAN_Submit(SDL_GpuCommandBuffer *commandBuffer);
 static VulkanTextureSlice* VULKAN_INTERNAL_FetchTextureSlice(VulkanTexture* texture, Uint32 layer, Uint32 level);
 static VulkanTexture* VULKAN_INTERNAL_CreateTexture(
@@ -1448,6 +1858,23 @@ static inline SDL_bool VULKAN_INTERNAL_IsVulkanDepthFormat(VkFormat format)
     );
 }
 
+static inline VkResolveModeFlagBits VULKAN_INTERNAL_GetColorResolveMode(VkFormat format)
+{
+    /* Integer formats cannot be averaged */
+    if (
+        format == SDLToVK_SurfaceFormat[SDL_GPU_TEXTUREFORMAT_R8_UINT] ||
+        format == SDLToVK_SurfaceFormat[SDL_GPU_TEXTUREFORMAT_R8G8_UINT] ||
+        format == SDLToVK_SurfaceFormat[SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UINT] ||
+        format == SDLToVK_SurfaceFormat[SDL_GPU_TEXTUREFORMAT_R16_UINT] ||
+        format == SDLToVK_SurfaceFormat[SDL_GPU_TEXTUREFORMAT_R16G16_UINT] ||
+        format == SDLToVK_SurfaceFormat[SDL_GPU_TEXTUREFORMAT_R16G16B16A16_UINT]
+    ) {
+        return VK_RESOLVE_MODE_SAMPLE_ZERO_BIT_KHR;
+    }
+
+    return VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+}
+
 static inline VkSampleCountFlagBits VULKAN_INTERNAL_GetMaxMultiSampleCount(
     VulkanRenderer *renderer,
     VkSampleCountFlagBits multiSampleCount
@@ -1514,119 +1941,297 @@ static inline Uint32 VULKAN_INTERNAL_NextHighestAlignment32(
     return align * ((n + align - 1) / align);
 }
 
-static void VULKAN_INTERNAL_MakeMemoryUnavailable(
-    VulkanRenderer* renderer,
-    VulkanMemoryAllocation *allocation
+static inline Uint32 VULKAN_INTERNAL_FloorLog2(
+    VkDeviceSize size
 ) {
-    Uint32 i, j;
-    VulkanMemoryFreeRegion *freeRegion;
+    Uint32 result = 0;
 
-    allocation->availableForAllocation = 0;
-
-    for (i = 0; i < allocation->freeRegionCount; i += 1)
+    while (size > 1)
     {
-        freeRegion = allocation->freeRegions[i];
+        size >>= 1;
+        result += 1;
+    }
 
-        /* close the gap in the sorted list */
-        if (allocation->allocator->sortedFreeRegionCount > 1)
-        {
-            for (j = freeRegion->sortedIndex; j < allocation->allocator->sortedFreeRegionCount - 1; j += 1)
-            {
-                allocation->allocator->sortedFreeRegions[j] =
-                    allocation->allocator->sortedFreeRegions[j + 1];
+    return result;
+}
 
-                allocation->allocator->sortedFreeRegions[j]->sortedIndex = j;
-            }
-        }
+static inline Uint32 VULKAN_INTERNAL_LowestSetBit(
+    Uint64 mask
+) {
+    Uint32 result = 0;
 
-        allocation->allocator->sortedFreeRegionCount -= 1;
-    }
+    /* mask must be nonzero, halve the search window each step */
+    if ((mask & 0xFFFFFFFFULL) == 0) { mask >>= 32; result += 32; }
+    if ((mask & 0xFFFFULL) == 0) { mask >>= 16; result += 16; }
+    if ((mask & 0xFFULL) == 0) { mask >>= 8; result += 8; }
+    if ((mask & 0xFULL) == 0) { mask >>= 4; result += 4; }
+    if ((mask & 0x3ULL) == 0) { mask >>= 2; result += 2; }
+    if ((mask & 0x1ULL) == 0) { result += 1; }
+
+    return result;
 }
 
-static void VULKAN_INTERNAL_MarkAllocationsForDefrag(
-    VulkanRenderer *renderer
+static inline void VULKAN_INTERNAL_MapFreeBin(
+    VkDeviceSize size,
+    Uint32 *pFirstLevel,
+    Uint32 *pSecondLevel
 ) {
-    Uint32 memoryType, allocationIndex;
-    VulkanMemorySubAllocator *currentAllocator;
+    Uint32 firstLevel = VULKAN_INTERNAL_FloorLog2(size);
+    Uint32 secondLevel = 0;
 
-    for (memoryType = 0; memoryType < VK_MAX_MEMORY_TYPES; memoryType += 1)
+    if (firstLevel >= MEMORY_FREE_FIRST_LEVELS)
     {
-        currentAllocator = &renderer->memoryAllocator->subAllocators[memoryType];
+        firstLevel = MEMORY_FREE_FIRST_LEVELS - 1;
+        secondLevel = MEMORY_FREE_SECOND_LEVELS - 1;
+    }
+    else if (firstLevel >= MEMORY_FREE_SECOND_LEVEL_LOG2)
+    {
+        /* the bits right below the leading one pick the linear step */
+        secondLevel = (Uint32) (size >> (firstLevel - MEMORY_FREE_SECOND_LEVEL_LOG2)) & (MEMORY_FREE_SECOND_LEVELS - 1);
+    }
 
-        for (allocationIndex = 0; allocationIndex < currentAllocator->allocationCount; allocationIndex += 1)
-        {
-            if (currentAllocator->allocations[allocationIndex]->availableForAllocation == 1)
-            {
-                if (currentAllocator->allocations[allocationIndex]->freeRegionCount > 1)
-                {
-                    EXPAND_ARRAY_IF_NEEDED(
-                        renderer->allocationsToDefrag,
-                        VulkanMemoryAllocation*,
-                        renderer->allocationsToDefragCount + 1,
-                        renderer->allocationsToDefragCapacity,
-                        renderer->allocationsToDefragCapacity * 2
-                    );
+    *pFirstLevel = firstLevel;
+    *pSecondLevel = secondLevel;
+}
 
-                    renderer->allocationsToDefrag[renderer->allocationsToDefragCount] =
-                        currentAllocator->allocations[allocationIndex];
+static inline VulkanMemoryFreeIndex* VULKAN_INTERNAL_FreeIndexForAllocation(
+    VulkanMemoryAllocation *allocation
+) {
+    return &allocation->allocator->freeIndices[allocation->size == SMALL_ALLOCATION_SIZE];
+}
 
-                    renderer->allocationsToDefragCount += 1;
+static void VULKAN_INTERNAL_InsertFreeRegion(
+    VulkanMemoryFreeRegion *freeRegion
+) {
+    VulkanMemoryFreeIndex *index = VULKAN_INTERNAL_FreeIndexForAllocation(freeRegion->allocation);
+    Uint32 firstLevel, secondLevel;
 
-                    VULKAN_INTERNAL_MakeMemoryUnavailable(
-                        renderer,
-                        currentAllocator->allocations[allocationIndex]
-                    );
-                }
-            }
-        }
+    VULKAN_INTERNAL_MapFreeBin(freeRegion->size, &firstLevel, &secondLevel);
+
+    freeRegion->prevFree = NULL;
+    freeRegion->nextFree = index->bins[firstLevel][secondLevel];
+    if (freeRegion->nextFree != NULL)
+    {
+        freeRegion->nextFree->prevFree = freeRegion;
     }
+    index->bins[firstLevel][secondLevel] = freeRegion;
+
+    index->firstLevelBitmap |= 1ULL << firstLevel;
+    index->secondLevelBitmaps[firstLevel] |= 1U << secondLevel;
 }
 
-static void VULKAN_INTERNAL_RemoveMemoryFreeRegion(
-    VulkanRenderer *renderer,
+static void VULKAN_INTERNAL_UnlinkFreeRegion(
     VulkanMemoryFreeRegion *freeRegion
 ) {
-    Uint32 i;
+    VulkanMemoryFreeIndex *index = VULKAN_INTERNAL_FreeIndexForAllocation(freeRegion->allocation);
+    Uint32 firstLevel, secondLevel;
 
-    SDL_LockMutex(renderer->allocatorLock);
+    VULKAN_INTERNAL_MapFreeBin(freeRegion->size, &firstLevel, &secondLevel);
 
-    if (freeRegion->allocation->availableForAllocation)
+    if (freeRegion->prevFree != NULL)
     {
-        /* close the gap in the sorted list */
-        if (freeRegion->allocation->allocator->sortedFreeRegionCount > 1)
-        {
-            for (i = freeRegion->sortedIndex; i < freeRegion->allocation->allocator->sortedFreeRegionCount - 1; i += 1)
-            {
-                freeRegion->allocation->allocator->sortedFreeRegions[i] =
-                    freeRegion->allocation->allocator->sortedFreeRegions[i + 1];
-
-                freeRegion->allocation->allocator->sortedFreeRegions[i]->sortedIndex = i;
-            }
-        }
+        freeRegion->prevFree->nextFree = freeRegion->nextFree;
+    }
+    else
+    {
+        index->bins[firstLevel][secondLevel] = freeRegion->nextFree;
+    }
 
-        freeRegion->allocation->allocator->sortedFreeRegionCount -= 1;
+    if (freeRegion->nextFree != NULL)
+    {
+        freeRegion->nextFree->prevFree = freeRegion->prevFree;
     }
 
-    /* close the gap in the buffer list */
-    if (freeRegion->allocation->freeRegionCount > 1 && freeRegion->allocationIndex != freeRegion->allocation->freeRegionCount - 1)
+    if (index->bins[firstLevel][secondLevel] == NULL)
     {
-        freeRegion->allocation->freeRegions[freeRegion->allocationIndex] =
-            freeRegion->allocation->freeRegions[freeRegion->allocation->freeRegionCount - 1];
+        index->secondLevelBitmaps[firstLevel] &= ~(1U << secondLevel);
+        if (index->secondLevelBitmaps[firstLevel] == 0)
+        {
+            index->firstLevelBitmap &= ~(1ULL << firstLevel);
+        }
+    }
 
-        freeRegion->allocation->freeRegions[freeRegion->allocationIndex]->allocationIndex =
-            freeRegion->allocationIndex;
+    freeRegion->prevFree = NULL;
+    freeRegion->nextFree = NULL;
+}
+
+/* Good fit: start at the first bin whose regions are all at least size bytes,
+ * so the search is a couple of bitmap lookups. Regions only get scanned when
+ * alignment padding makes the first candidate too small.
+ */
+static VulkanMemoryFreeRegion* VULKAN_INTERNAL_FindFreeRegion(
+    VulkanMemoryFreeIndex *index,
+    VkDeviceSize size,
+    VkDeviceSize alignment,
+    VkDeviceSize *pAlignedOffset
+) {
+    VulkanMemoryFreeRegion *region;
+    VkDeviceSize alignedOffset;
+    Uint32 firstLevel, secondLevel;
+    Uint32 secondLevelMask;
+    Uint64 firstLevelMask;
+    Uint32 roundLog2 = VULKAN_INTERNAL_FloorLog2(size);
+
+    /* round up to the next bin boundary */
+    if (roundLog2 >= MEMORY_FREE_SECOND_LEVEL_LOG2)
+    {
+        roundLog2 -= MEMORY_FREE_SECOND_LEVEL_LOG2;
     }
+    VULKAN_INTERNAL_MapFreeBin(size + (((VkDeviceSize) 1 << roundLog2) - 1), &firstLevel, &secondLevel);
 
-    freeRegion->allocation->freeRegionCount -= 1;
+    secondLevelMask = index->secondLevelBitmaps[firstLevel] & (~0U << secondLevel);
 
-    freeRegion->allocation->freeSpace -= freeRegion->size;
+    for (;;)
+    {
+        if (secondLevelMask == 0)
+        {
+            firstLevelMask = (firstLevel + 1 < 64) ?
+                index->firstLevelBitmap & (~0ULL << (firstLevel + 1)) :
+                0;
 
-    SDL_free(freeRegion);
+            if (firstLevelMask == 0)
+            {
+                return NULL;
+            }
 
-    SDL_UnlockMutex(renderer->allocatorLock);
-}
+            firstLevel = VULKAN_INTERNAL_LowestSetBit(firstLevelMask);
+            secondLevelMask = index->secondLevelBitmaps[firstLevel];
+        }
 
-static void VULKAN_INTERNAL_NewMemoryFreeRegion(
+        secondLevel = VULKAN_INTERNAL_LowestSetBit(secondLevelMask);
+
+        for (region = index->bins[firstLevel][secondLevel]; region != NULL; region = region->nextFree)
+        {
+            alignedOffset = VULKAN_INTERNAL_NextHighestAlignment(region->offset, alignment);
+
+            if (alignedOffset + size <= region->offset + region->size)
+            {
+                *pAlignedOffset = alignedOffset;
+                return region;
+            }
+        }
+
+        secondLevelMask &= ~(1U << secondLevel);
+    }
+}
+
+static void VULKAN_INTERNAL_MakeMemoryUnavailable(
+    VulkanRenderer* renderer,
+    VulkanMemoryAllocation *allocation
+) {
+    Uint32 i;
+
+    allocation->availableForAllocation = 0;
+
+    for (i = 0; i < allocation->freeRegionCount; i += 1)
+    {
+        VULKAN_INTERNAL_UnlinkFreeRegion(allocation->freeRegions[i]);
+    }
+}
+
+/* Uniform arena pages and transfer buffers hand out mapped pointers that must not move,
+ * and bindless tables hold image views that cannot be rewritten behind the client's back.
+ */
+static SDL_bool VULKAN_INTERNAL_AllocationIsPinned(
+    VulkanMemoryAllocation *allocation
+) {
+    Uint32 i;
+
+    for (i = 0; i < allocation->usedRegionCount; i += 1)
+    {
+        if (
+            allocation->usedRegions[i]->isBuffer &&
+            (
+                allocation->usedRegions[i]->vulkanBuffer->type == VULKAN_BUFFER_TYPE_UNIFORM ||
+                allocation->usedRegions[i]->vulkanBuffer->type == VULKAN_BUFFER_TYPE_TRANSFER
+            )
+        ) {
+            return SDL_TRUE;
+        }
+
+        if (
+            !allocation->usedRegions[i]->isBuffer &&
+            SDL_AtomicGet(&allocation->usedRegions[i]->vulkanTexture->bindlessReferenceCount) > 0
+        ) {
+            return SDL_TRUE;
+        }
+    }
+
+    return SDL_FALSE;
+}
+
+static void VULKAN_INTERNAL_MarkAllocationsForDefrag(
+    VulkanRenderer *renderer
+) {
+    Uint32 memoryType, allocationIndex;
+    VulkanMemorySubAllocator *currentAllocator;
+
+    for (memoryType = 0; memoryType < VK_MAX_MEMORY_TYPES; memoryType += 1)
+    {
+        currentAllocator = &renderer->memoryAllocator->subAllocators[memoryType];
+
+        for (allocationIndex = 0; allocationIndex < currentAllocator->allocationCount; allocationIndex += 1)
+        {
+            if (currentAllocator->allocations[allocationIndex]->availableForAllocation == 1)
+            {
+                if (
+                    currentAllocator->allocations[allocationIndex]->freeRegionCount > 1 &&
+                    !VULKAN_INTERNAL_AllocationIsPinned(currentAllocator->allocations[allocationIndex])
+                ) {
+                    EXPAND_ARRAY_IF_NEEDED(
+                        renderer->allocationsToDefrag,
+                        VulkanMemoryAllocation*,
+                        renderer->allocationsToDefragCount + 1,
+                        renderer->allocationsToDefragCapacity,
+                        renderer->allocationsToDefragCapacity * 2
+                    );
+
+                    renderer->allocationsToDefrag[renderer->allocationsToDefragCount] =
+                        currentAllocator->allocations[allocationIndex];
+
+                    renderer->allocationsToDefragCount += 1;
+
+                    VULKAN_INTERNAL_MakeMemoryUnavailable(
+                        renderer,
+                        currentAllocator->allocations[allocationIndex]
+                    );
+                }
+            }
+        }
+    }
+}
+
+static void VULKAN_INTERNAL_RemoveMemoryFreeRegion(
+    VulkanRenderer *renderer,
+    VulkanMemoryFreeRegion *freeRegion
+) {
+    SDL_LockMutex(renderer->allocatorLock);
+
+    if (freeRegion->allocation->availableForAllocation)
+    {
+        VULKAN_INTERNAL_UnlinkFreeRegion(freeRegion);
+    }
+
+    /* close the gap in the buffer list */
+    if (freeRegion->allocation->freeRegionCount > 1 && freeRegion->allocationIndex != freeRegion->allocation->freeRegionCount - 1)
+    {
+        freeRegion->allocation->freeRegions[freeRegion->allocationIndex] =
+            freeRegion->allocation->freeRegions[freeRegion->allocation->freeRegionCount - 1];
+
+        freeRegion->allocation->freeRegions[freeRegion->allocationIndex]->allocationIndex =
+            freeRegion->allocationIndex;
+    }
+
+    freeRegion->allocation->freeRegionCount -= 1;
+
+    freeRegion->allocation->freeSpace -= freeRegion->size;
+
+    SDL_free(freeRegion);
+
+    SDL_UnlockMutex(renderer->allocatorLock);
+}
+
+static void VULKAN_INTERNAL_NewMemoryFreeRegion(
     VulkanRenderer *renderer,
     VulkanMemoryAllocation *allocation,
     VkDeviceSize offset,
@@ -1634,7 +2239,6 @@ static void VULKAN_INTERNAL_NewMemoryFreeRegion(
 ) {
     VulkanMemoryFreeRegion *newFreeRegion;
     VkDeviceSize newOffset, newSize;
-    Sint32 insertionIndex = 0;
     Sint32 i;
 
     SDL_LockMutex(renderer->allocatorLock);
@@ -1692,39 +2296,7 @@ static void VULKAN_INTERNAL_NewMemoryFreeRegion(
 
     if (allocation->availableForAllocation)
     {
-        for (i = 0; i < allocation->allocator->sortedFreeRegionCount; i += 1)
-        {
-            if (allocation->allocator->sortedFreeRegions[i]->size < size)
-            {
-                /* this is where the new region should go */
-                break;
-            }
-
-            insertionIndex += 1;
-        }
-
-        if (allocation->allocator->sortedFreeRegionCount + 1 > allocation->allocator->sortedFreeRegionCapacity)
-        {
-            allocation->allocator->sortedFreeRegionCapacity *= 2;
-            allocation->allocator->sortedFreeRegions = SDL_realloc(
-                allocation->allocator->sortedFreeRegions,
-                sizeof(VulkanMemoryFreeRegion*) * allocation->allocator->sortedFreeRegionCapacity
-            );
-        }
-
-        /* perform insertion sort */
-        if (allocation->allocator->sortedFreeRegionCount > 0 && insertionIndex != allocation->allocator->sortedFreeRegionCount)
-        {
-            for (i = allocation->allocator->sortedFreeRegionCount; i > insertionIndex && i > 0; i -= 1)
-            {
-                allocation->allocator->sortedFreeRegions[i] = allocation->allocator->sortedFreeRegions[i - 1];
-                allocation->allocator->sortedFreeRegions[i]->sortedIndex = i;
-            }
-        }
-
-        allocation->allocator->sortedFreeRegionCount += 1;
-        allocation->allocator->sortedFreeRegions[insertionIndex] = newFreeRegion;
-        newFreeRegion->sortedIndex = insertionIndex;
+        VULKAN_INTERNAL_InsertFreeRegion(newFreeRegion);
     }
 
     SDL_UnlockMutex(renderer->allocatorLock);
@@ -1759,6 +2331,7 @@ static VulkanMemoryUsedRegion* VULKAN_INTERNAL_NewMemoryUsedRegion(
     memoryUsedRegion->resourceOffset = resourceOffset;
     memoryUsedRegion->resourceSize = resourceSize;
     memoryUsedRegion->alignment = alignment;
+    memoryUsedRegion->vulkanBuffer = NULL; /* set by the owner once bound */
 
     allocation->usedSpace += size;
 
@@ -1951,11 +2524,13 @@ static Uint8 VULKAN_INTERNAL_AllocateMemory(
     Uint32 memoryTypeIndex,
     VkDeviceSize allocationSize,
     Uint8 isHostVisible,
+    Uint8 dedicated,
     VulkanMemoryAllocation **pMemoryAllocation)
 {
     VulkanMemoryAllocation *allocation;
     VulkanMemorySubAllocator *allocator = &renderer->memoryAllocator->subAllocators[memoryTypeIndex];
     VkMemoryAllocateInfo allocInfo;
+    VkMemoryDedicatedAllocateInfoKHR dedicatedInfo;
     VkResult result;
 
     allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
@@ -1963,6 +2538,16 @@ static Uint8 VULKAN_INTERNAL_AllocateMemory(
     allocInfo.memoryTypeIndex = memoryTypeIndex;
     allocInfo.allocationSize = allocationSize;
 
+    if (dedicated)
+    {
+        dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+        dedicatedInfo.pNext = NULL;
+        dedicatedInfo.buffer = buffer;
+        dedicatedInfo.image = image;
+
+        allocInfo.pNext = &dedicatedInfo;
+    }
+
     allocation = SDL_malloc(sizeof(VulkanMemoryAllocation));
     allocation->size = allocationSize;
     allocation->freeSpace = 0; /* added by FreeRegions */
@@ -1979,8 +2564,9 @@ static Uint8 VULKAN_INTERNAL_AllocateMemory(
         allocator->allocationCount - 1
     ] = allocation;
 
-    allocInfo.pNext = NULL;
-    allocation->availableForAllocation = 1;
+    /* Dedicated allocations never expose their free space to other resources */
+    allocation->availableForAllocation = !dedicated;
+    allocation->dedicated = dedicated;
 
     allocation->usedRegions = SDL_malloc(sizeof(VulkanMemoryUsedRegion*));
     allocation->usedRegionCount = 0;
@@ -2099,6 +2685,7 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
     VkDeviceSize resourceSize, /* may be different from requirements size! */
     VkBuffer buffer, /* may be VK_NULL_HANDLE */
     VkImage image, /* may be VK_NULL_HANDLE */
+    Uint8 dedicated,
     VulkanMemoryUsedRegion** pMemoryUsedRegion
 ) {
     VulkanMemoryAllocation *allocation;
@@ -2108,10 +2695,9 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
     VulkanMemoryUsedRegion *usedRegion;
 
     VkDeviceSize requiredSize, allocationSize;
-    VkDeviceSize alignedOffset;
+    VkDeviceSize alignedOffset = 0;
     Uint32 newRegionSize, newRegionOffset;
     Uint8 isHostVisible, smallAllocation, allocationResult;
-    Sint32 i;
 
     isHostVisible =
         (renderer->memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags &
@@ -2132,32 +2718,16 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
 
     selectedRegion = NULL;
 
-    for (i = allocator->sortedFreeRegionCount - 1; i >= 0; i -= 1)
+    /* Dedicated resources skip the free lists and get their own allocation */
+    if (!dedicated)
     {
-        region = allocator->sortedFreeRegions[i];
-
-        if (smallAllocation && region->allocation->size != SMALL_ALLOCATION_SIZE)
-        {
-            /* region is not in a small allocation */
-            continue;
-        }
-
-        if (!smallAllocation && region->allocation->size == SMALL_ALLOCATION_SIZE)
-        {
-            /* allocation is not small and current region is in a small allocation */
-            continue;
-        }
-
-        alignedOffset = VULKAN_INTERNAL_NextHighestAlignment(
-            region->offset,
-            memoryRequirements->memoryRequirements.alignment
+        /* small resources only go in small allocations, and large ones only in large allocations */
+        selectedRegion = VULKAN_INTERNAL_FindFreeRegion(
+            &allocator->freeIndices[smallAllocation],
+            requiredSize,
+            memoryRequirements->memoryRequirements.alignment,
+            &alignedOffset
         );
-
-        if (alignedOffset + requiredSize <= region->offset + region->size)
-        {
-            selectedRegion = region;
-            break;
-        }
     }
 
     if (selectedRegion != NULL)
@@ -2235,6 +2805,7 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
 
     /* No suitable free regions exist, allocate a new memory region */
     if (
+        !dedicated &&
         renderer->allocationsToDefragCount == 0 &&
         !renderer->defragInProgress
     ) {
@@ -2242,7 +2813,11 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
         VULKAN_INTERNAL_MarkAllocationsForDefrag(renderer);
     }
 
-    if (requiredSize > SMALL_ALLOCATION_THRESHOLD)
+    if (dedicated)
+    {
+        allocationSize = requiredSize;
+    }
+    else if (requiredSize > SMALL_ALLOCATION_THRESHOLD)
     {
         /* allocate a page of required size aligned to LARGE_ALLOCATION_INCREMENT increments */
         allocationSize =
@@ -2260,6 +2835,7 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
         memoryTypeIndex,
         allocationSize,
         isHostVisible,
+        dedicated,
         &allocation
     );
 
@@ -2340,20 +2916,56 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
     return 1;
 }
 
+static Uint8 VULKAN_INTERNAL_WantsDedicatedAllocation(
+    VulkanRenderer *renderer,
+    VkMemoryRequirements2KHR *memoryRequirements,
+    VkMemoryDedicatedRequirementsKHR *dedicatedRequirements,
+    Uint8 isRenderTarget
+) {
+    if (!renderer->supports.KHR_dedicated_allocation)
+    {
+        return 0;
+    }
+
+    if (
+        dedicatedRequirements->requiresDedicatedAllocation ||
+        dedicatedRequirements->prefersDedicatedAllocation
+    ) {
+        return 1;
+    }
+
+    /* Large render targets churn the shared pages for little benefit */
+    return (
+        isRenderTarget &&
+        memoryRequirements->memoryRequirements.size >= DEDICATED_ALLOCATION_THRESHOLD
+    );
+}
+
 static Uint8 VULKAN_INTERNAL_BindMemoryForImage(
     VulkanRenderer* renderer,
     VkImage image,
+    Uint8 isRenderTarget,
     VulkanMemoryUsedRegion** usedRegion
 ) {
     Uint8 bindResult = 0;
     Uint32 memoryTypeIndex = 0;
     VkMemoryPropertyFlags requiredMemoryPropertyFlags;
+    VkMemoryDedicatedRequirementsKHR dedicatedRequirements =
+    {
+        VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR,
+        NULL
+    };
     VkMemoryRequirements2KHR memoryRequirements =
     {
         VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR,
         NULL
     };
 
+    if (renderer->supports.KHR_dedicated_allocation)
+    {
+        memoryRequirements.pNext = &dedicatedRequirements;
+    }
+
     /* Prefer GPU allocation for textures */
     requiredMemoryPropertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
@@ -2371,6 +2983,12 @@ static Uint8 VULKAN_INTERNAL_BindMemoryForImage(
             memoryRequirements.memoryRequirements.size,
             VK_NULL_HANDLE,
             image,
+            VULKAN_INTERNAL_WantsDedicatedAllocation(
+                renderer,
+                &memoryRequirements,
+                &dedicatedRequirements,
+                isRenderTarget
+            ),
             usedRegion
         );
 
@@ -2406,6 +3024,12 @@ static Uint8 VULKAN_INTERNAL_BindMemoryForImage(
                 memoryRequirements.memoryRequirements.size,
                 VK_NULL_HANDLE,
                 image,
+                VULKAN_INTERNAL_WantsDedicatedAllocation(
+                    renderer,
+                    &memoryRequirements,
+                    &dedicatedRequirements,
+                    isRenderTarget
+                ),
                 usedRegion
             );
 
@@ -2434,12 +3058,22 @@ static Uint8 VULKAN_INTERNAL_BindMemoryForBuffer(
     Uint32 memoryTypeIndex = 0;
     VkMemoryPropertyFlags requiredMemoryPropertyFlags = 0;
     VkMemoryPropertyFlags ignoredMemoryPropertyFlags = 0;
+    VkMemoryDedicatedRequirementsKHR dedicatedRequirements =
+    {
+        VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR,
+        NULL
+    };
     VkMemoryRequirements2KHR memoryRequirements =
     {
         VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR,
         NULL
     };
 
+    if (renderer->supports.KHR_dedicated_allocation)
+    {
+        memoryRequirements.pNext = &dedicatedRequirements;
+    }
+
     if (type == VULKAN_BUFFER_TYPE_GPU)
     {
         requiredMemoryPropertyFlags |=
@@ -2482,6 +3116,12 @@ static Uint8 VULKAN_INTERNAL_BindMemoryForBuffer(
             size,
             buffer,
             VK_NULL_HANDLE,
+            VULKAN_INTERNAL_WantsDedicatedAllocation(
+                renderer,
+                &memoryRequirements,
+                &dedicatedRequirements,
+                0
+            ),
             usedRegion
         );
 
@@ -2550,6 +3190,12 @@ static Uint8 VULKAN_INTERNAL_BindMemoryForBuffer(
                 size,
                 buffer,
                 VK_NULL_HANDLE,
+                VULKAN_INTERNAL_WantsDedicatedAllocation(
+                    renderer,
+                    &memoryRequirements,
+                    &dedicatedRequirements,
+                    0
+                ),
                 usedRegion
             );
 
@@ -2684,6 +3330,20 @@ static void VULKAN_INTERNAL_TrackComputePipeline(
     )
 }
 
+static void VULKAN_INTERNAL_TrackBindlessTable(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VulkanBindlessTable *bindlessTable
+) {
+    TRACK_RESOURCE(
+        bindlessTable,
+        VulkanBindlessTable*,
+        usedBindlessTables,
+        usedBindlessTableCount,
+        usedBindlessTableCapacity
+    )
+}
+
 static void VULKAN_INTERNAL_TrackFramebuffer(
     VulkanRenderer *renderer,
     VulkanCommandBuffer *commandBuffer,
@@ -2734,56 +3394,336 @@ static void VULKAN_INTERNAL_TrackFramebuffer(
  * For example, a texture cannot have both the SAMPLER and GRAPHICS_STORAGE usage flags,
  * because then it is imposible for the backend to infer which default usage mode the texture should use.
  *
+ * Barriers are not recorded immediately. They are queued on the command buffer and
+ * VULKAN_INTERNAL_FlushBarriers records all of them with a single barrier command right
+ * before the next command that depends on them (pass begin, dispatch, copy, blit or the
+ * end of the command buffer). A resource transitioned twice with no command in between
+ * is folded into one barrier from the first source to the last destination.
+ *
  * Sync hazards can be detected by setting VK_KHRONOS_VALIDATION_VALIDATE_SYNC=1 when using validation layers.
  */
 
-static void VULKAN_INTERNAL_BufferMemoryBarrier(
-    VulkanRenderer *renderer,
+static void VULKAN_INTERNAL_QueueBufferBarrier(
     VulkanCommandBuffer *commandBuffer,
-    VulkanBufferUsageMode sourceUsageMode,
-    VulkanBufferUsageMode destinationUsageMode,
-    VulkanBuffer *buffer
+    VkBufferMemoryBarrier *memoryBarrier,
+    VkPipelineStageFlags srcStages,
+    VkPipelineStageFlags dstStages
 ) {
-    VkPipelineStageFlags srcStages = 0;
-    VkPipelineStageFlags dstStages = 0;
-    VkBufferMemoryBarrier memoryBarrier;
-
-    memoryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-    memoryBarrier.pNext = NULL;
-    memoryBarrier.srcAccessMask = 0;
-    memoryBarrier.dstAccessMask = 0;
-    memoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    memoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    memoryBarrier.buffer = buffer->buffer;
-    memoryBarrier.offset = 0;
-    memoryBarrier.size = buffer->size;
+    Uint32 i;
 
-    if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_COPY_SOURCE)
+    for (i = 0; i < commandBuffer->pendingBufferBarrierCount; i += 1)
     {
-        srcStages = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        if (commandBuffer->pendingBufferBarriers[i].buffer == memoryBarrier->buffer)
+        {
+            commandBuffer->pendingBufferBarriers[i].dstAccessMask = memoryBarrier->dstAccessMask;
+            commandBuffer->pendingBufferBarrierStages[i].dstStages = dstStages;
+            return;
+        }
     }
-    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_COPY_DESTINATION)
+
+    if (commandBuffer->pendingBufferBarrierCount == commandBuffer->pendingBufferBarrierCapacity)
     {
-        srcStages = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        commandBuffer->pendingBufferBarrierCapacity *= 2;
+        commandBuffer->pendingBufferBarriers = SDL_realloc(
+            commandBuffer->pendingBufferBarriers,
+            commandBuffer->pendingBufferBarrierCapacity * sizeof(VkBufferMemoryBarrier)
+        );
+        commandBuffer->pendingBufferBarrierStages = SDL_realloc(
+            commandBuffer->pendingBufferBarrierStages,
+            commandBuffer->pendingBufferBarrierCapacity * sizeof(VulkanBarrierStages)
+        );
     }
-    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_VERTEX_READ)
+
+    commandBuffer->pendingBufferBarriers[commandBuffer->pendingBufferBarrierCount] = *memoryBarrier;
+    commandBuffer->pendingBufferBarrierStages[commandBuffer->pendingBufferBarrierCount].srcStages = srcStages;
+    commandBuffer->pendingBufferBarrierStages[commandBuffer->pendingBufferBarrierCount].dstStages = dstStages;
+    commandBuffer->pendingBufferBarrierCount += 1;
+}
+
+static void VULKAN_INTERNAL_QueueImageBarrier(
+    VulkanCommandBuffer *commandBuffer,
+    VkImageMemoryBarrier *memoryBarrier,
+    VkPipelineStageFlags srcStages,
+    VkPipelineStageFlags dstStages
+) {
+    VkImageMemoryBarrier *pending;
+    Uint32 i;
+
+    for (i = 0; i < commandBuffer->pendingImageBarrierCount; i += 1)
     {
-        srcStages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
-        memoryBarrier.srcAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+        pending = &commandBuffer->pendingImageBarriers[i];
+        if (
+            pending->image == memoryBarrier->image &&
+            pending->subresourceRange.baseMipLevel == memoryBarrier->subresourceRange.baseMipLevel &&
+            pending->subresourceRange.baseArrayLayer == memoryBarrier->subresourceRange.baseArrayLayer
+        ) {
+            pending->dstAccessMask = memoryBarrier->dstAccessMask;
+            pending->newLayout = memoryBarrier->newLayout;
+            commandBuffer->pendingImageBarrierStages[i].dstStages = dstStages;
+            return;
+        }
     }
-    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_INDEX_READ)
+
+    if (commandBuffer->pendingImageBarrierCount == commandBuffer->pendingImageBarrierCapacity)
     {
-        srcStages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
-        memoryBarrier.srcAccessMask = VK_ACCESS_INDEX_READ_BIT;
+        commandBuffer->pendingImageBarrierCapacity *= 2;
+        commandBuffer->pendingImageBarriers = SDL_realloc(
+            commandBuffer->pendingImageBarriers,
+            commandBuffer->pendingImageBarrierCapacity * sizeof(VkImageMemoryBarrier)
+        );
+        commandBuffer->pendingImageBarrierStages = SDL_realloc(
+            commandBuffer->pendingImageBarrierStages,
+            commandBuffer->pendingImageBarrierCapacity * sizeof(VulkanBarrierStages)
+        );
     }
-    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_INDIRECT)
+
+    commandBuffer->pendingImageBarriers[commandBuffer->pendingImageBarrierCount] = *memoryBarrier;
+    commandBuffer->pendingImageBarrierStages[commandBuffer->pendingImageBarrierCount].srcStages = srcStages;
+    commandBuffer->pendingImageBarrierStages[commandBuffer->pendingImageBarrierCount].dstStages = dstStages;
+    commandBuffer->pendingImageBarrierCount += 1;
+}
+
+static void VULKAN_INTERNAL_MaskBarrierForQueue(
+    VkPipelineStageFlags queueStages,
+    VkAccessFlags queueAccess,
+    VulkanBarrierStages *stages,
+    VkAccessFlags *srcAccessMask,
+    VkAccessFlags *dstAccessMask
+) {
+    stages->srcStages &= queueStages;
+    *srcAccessMask &= queueAccess;
+
+    if (stages->srcStages == 0)
     {
-        srcStages = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
-        memoryBarrier.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+        stages->srcStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        *srcAccessMask = 0;
     }
-    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_GRAPHICS_STORAGE_READ)
+
+    stages->dstStages &= queueStages;
+    *dstAccessMask &= queueAccess;
+
+    if (stages->dstStages == 0)
+    {
+        stages->dstStages = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        *dstAccessMask = 0;
+    }
+}
+
+static void VULKAN_INTERNAL_FlushBarriers(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    VkBufferMemoryBarrier2KHR *bufferBarriers;
+    VkImageMemoryBarrier2KHR *imageBarriers;
+    VkDependencyInfoKHR dependencyInfo;
+    VkPipelineStageFlags srcStages = 0;
+    VkPipelineStageFlags dstStages = 0;
+    VkPipelineStageFlags queueStages;
+    VkAccessFlags queueAccess;
+    Uint32 i;
+
+    if (
+        commandBuffer->pendingBufferBarrierCount == 0 &&
+        commandBuffer->pendingImageBarrierCount == 0
+    ) {
+        return;
+    }
+
+    commandBuffer->common.stats.barriersIssued +=
+        commandBuffer->pendingBufferBarrierCount +
+        commandBuffer->pendingImageBarrierCount;
+
+    /* Dedicated queues reject graphics stages. Work done on other queues
+     * is ordered by the cross-queue semaphores at submit, not by these barriers.
+     */
+    if (commandBuffer->commandPool->queue != renderer->unifiedQueue)
+    {
+        queueStages =
+            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT |
+            VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT |
+            VK_PIPELINE_STAGE_TRANSFER_BIT |
+            VK_PIPELINE_STAGE_HOST_BIT;
+        queueAccess =
+            VK_ACCESS_TRANSFER_READ_BIT |
+            VK_ACCESS_TRANSFER_WRITE_BIT |
+            VK_ACCESS_HOST_READ_BIT |
+            VK_ACCESS_HOST_WRITE_BIT |
+            VK_ACCESS_MEMORY_READ_BIT |
+            VK_ACCESS_MEMORY_WRITE_BIT;
+
+        if (commandBuffer->commandPool->queue == renderer->computeQueue)
+        {
+            queueStages |=
+                VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT |
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            queueAccess |=
+                VK_ACCESS_INDIRECT_COMMAND_READ_BIT |
+                VK_ACCESS_UNIFORM_READ_BIT |
+                VK_ACCESS_SHADER_READ_BIT |
+                VK_ACCESS_SHADER_WRITE_BIT;
+        }
+
+        for (i = 0; i < commandBuffer->pendingBufferBarrierCount; i += 1)
+        {
+            VULKAN_INTERNAL_MaskBarrierForQueue(
+                queueStages,
+                queueAccess,
+                &commandBuffer->pendingBufferBarrierStages[i],
+                &commandBuffer->pendingBufferBarriers[i].srcAccessMask,
+                &commandBuffer->pendingBufferBarriers[i].dstAccessMask
+            );
+        }
+
+        for (i = 0; i < commandBuffer->pendingImageBarrierCount; i += 1)
+        {
+            VULKAN_INTERNAL_MaskBarrierForQueue(
+                queueStages,
+                queueAccess,
+                &commandBuffer->pendingImageBarrierStages[i],
+                &commandBuffer->pendingImageBarriers[i].srcAccessMask,
+                &commandBuffer->pendingImageBarriers[i].dstAccessMask
+            );
+        }
+    }
+
+    if (renderer->supports.KHR_synchronization2)
+    {
+        /* Synchronization2 keeps the stage masks per barrier instead of merging them */
+        bufferBarriers = SDL_stack_alloc(VkBufferMemoryBarrier2KHR, commandBuffer->pendingBufferBarrierCount + 1);
+        imageBarriers = SDL_stack_alloc(VkImageMemoryBarrier2KHR, commandBuffer->pendingImageBarrierCount + 1);
+
+        for (i = 0; i < commandBuffer->pendingBufferBarrierCount; i += 1)
+        {
+            VkBufferMemoryBarrier *barrier = &commandBuffer->pendingBufferBarriers[i];
+
+            bufferBarriers[i].sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+            bufferBarriers[i].pNext = NULL;
+            bufferBarriers[i].srcStageMask = commandBuffer->pendingBufferBarrierStages[i].srcStages;
+            bufferBarriers[i].srcAccessMask = barrier->srcAccessMask;
+            bufferBarriers[i].dstStageMask = commandBuffer->pendingBufferBarrierStages[i].dstStages;
+            bufferBarriers[i].dstAccessMask = barrier->dstAccessMask;
+            bufferBarriers[i].srcQueueFamilyIndex = barrier->srcQueueFamilyIndex;
+            bufferBarriers[i].dstQueueFamilyIndex = barrier->dstQueueFamilyIndex;
+            bufferBarriers[i].buffer = barrier->buffer;
+            bufferBarriers[i].offset = barrier->offset;
+            bufferBarriers[i].size = barrier->size;
+        }
+
+        for (i = 0; i < commandBuffer->pendingImageBarrierCount; i += 1)
+        {
+            VkImageMemoryBarrier *barrier = &commandBuffer->pendingImageBarriers[i];
+
+            imageBarriers[i].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+            imageBarriers[i].pNext = NULL;
+            imageBarriers[i].srcStageMask = commandBuffer->pendingImageBarrierStages[i].srcStages;
+            imageBarriers[i].srcAccessMask = barrier->srcAccessMask;
+            imageBarriers[i].dstStageMask = commandBuffer->pendingImageBarrierStages[i].dstStages;
+            imageBarriers[i].dstAccessMask = barrier->dstAccessMask;
+            imageBarriers[i].oldLayout = barrier->oldLayout;
+            imageBarriers[i].newLayout = barrier->newLayout;
+            imageBarriers[i].srcQueueFamilyIndex = barrier->srcQueueFamilyIndex;
+            imageBarriers[i].dstQueueFamilyIndex = barrier->dstQueueFamilyIndex;
+            imageBarriers[i].image = barrier->image;
+            imageBarriers[i].subresourceRange = barrier->subresourceRange;
+        }
+
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.pNext = NULL;
+        dependencyInfo.dependencyFlags = 0;
+        dependencyInfo.memoryBarrierCount = 0;
+        dependencyInfo.pMemoryBarriers = NULL;
+        dependencyInfo.bufferMemoryBarrierCount = commandBuffer->pendingBufferBarrierCount;
+        dependencyInfo.pBufferMemoryBarriers = bufferBarriers;
+        dependencyInfo.imageMemoryBarrierCount = commandBuffer->pendingImageBarrierCount;
+        dependencyInfo.pImageMemoryBarriers = imageBarriers;
+
+        renderer->vkCmdPipelineBarrier2KHR(
+            commandBuffer->commandBuffer,
+            &dependencyInfo
+        );
+
+        SDL_stack_free(bufferBarriers);
+        SDL_stack_free(imageBarriers);
+    }
+    else
+    {
+        for (i = 0; i < commandBuffer->pendingBufferBarrierCount; i += 1)
+        {
+            srcStages |= commandBuffer->pendingBufferBarrierStages[i].srcStages;
+            dstStages |= commandBuffer->pendingBufferBarrierStages[i].dstStages;
+        }
+
+        for (i = 0; i < commandBuffer->pendingImageBarrierCount; i += 1)
+        {
+            srcStages |= commandBuffer->pendingImageBarrierStages[i].srcStages;
+            dstStages |= commandBuffer->pendingImageBarrierStages[i].dstStages;
+        }
+
+        renderer->vkCmdPipelineBarrier(
+            commandBuffer->commandBuffer,
+            srcStages,
+            dstStages,
+            0,
+            0,
+            NULL,
+            commandBuffer->pendingBufferBarrierCount,
+            commandBuffer->pendingBufferBarriers,
+            commandBuffer->pendingImageBarrierCount,
+            commandBuffer->pendingImageBarriers
+        );
+    }
+
+    commandBuffer->pendingBufferBarrierCount = 0;
+    commandBuffer->pendingImageBarrierCount = 0;
+}
+
+static void VULKAN_INTERNAL_BufferMemoryBarrier(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VulkanBufferUsageMode sourceUsageMode,
+    VulkanBufferUsageMode destinationUsageMode,
+    VulkanBuffer *buffer
+) {
+    VkPipelineStageFlags srcStages = 0;
+    VkPipelineStageFlags dstStages = 0;
+    VkBufferMemoryBarrier memoryBarrier;
+
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    memoryBarrier.pNext = NULL;
+    memoryBarrier.srcAccessMask = 0;
+    memoryBarrier.dstAccessMask = 0;
+    memoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    memoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    memoryBarrier.buffer = buffer->buffer;
+    memoryBarrier.offset = 0;
+    memoryBarrier.size = buffer->size;
+
+    if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_COPY_SOURCE)
+    {
+        srcStages = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    }
+    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_COPY_DESTINATION)
+    {
+        srcStages = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
+    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_VERTEX_READ)
+    {
+        srcStages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+        memoryBarrier.srcAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+    }
+    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_INDEX_READ)
+    {
+        srcStages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+        memoryBarrier.srcAccessMask = VK_ACCESS_INDEX_READ_BIT;
+    }
+    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_INDIRECT)
+    {
+        srcStages = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+        memoryBarrier.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    }
+    else if (sourceUsageMode == VULKAN_BUFFER_USAGE_MODE_GRAPHICS_STORAGE_READ)
     {
         srcStages = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
         memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
@@ -2850,17 +3790,11 @@ static void VULKAN_INTERNAL_BufferMemoryBarrier(
         return;
     }
 
-    renderer->vkCmdPipelineBarrier(
-        commandBuffer->commandBuffer,
-        srcStages,
-        dstStages,
-        0,
-        0,
-        NULL,
-        1,
+    VULKAN_INTERNAL_QueueBufferBarrier(
+        commandBuffer,
         &memoryBarrier,
-        0,
-        NULL
+        srcStages,
+        dstStages
     );
 
     buffer->transitioned = SDL_TRUE;
@@ -3011,17 +3945,11 @@ static void VULKAN_INTERNAL_ImageMemoryBarrier(
         return;
     }
 
-    renderer->vkCmdPipelineBarrier(
-        commandBuffer->commandBuffer,
+    VULKAN_INTERNAL_QueueImageBarrier(
+        commandBuffer,
+        &memoryBarrier,
         srcStages,
-        dstStages,
-        0,
-        0,
-        NULL,
-        0,
-        NULL,
-        1,
-        &memoryBarrier
+        dstStages
     );
 
     textureSlice->transitioned = SDL_TRUE;
@@ -3199,33 +4127,84 @@ static void VULKAN_INTERNAL_RemoveFramebuffersContainingView(
     VulkanRenderer *renderer,
     VkImageView view
 ) {
+    FramebufferHashArray *arr;
     FramebufferHash *hash;
-    Sint32 i, j;
+    SDL_bool containsView;
+    Sint32 i, j, k;
+
+    /* Dynamic rendering never populates the framebuffer cache */
+    if (renderer->supports.KHR_dynamic_rendering)
+    {
+        return;
+    }
 
     SDL_LockMutex(renderer->framebufferFetchLock);
 
-    for (i = renderer->framebufferHashArray.count - 1; i >= 0; i -= 1)
+    for (i = 0; i < NUM_FRAMEBUFFER_HASH_BUCKETS; i += 1)
     {
-        hash = &renderer->framebufferHashArray.elements[i].key;
+        arr = &renderer->framebufferHashTable.buckets[i];
 
-        for (j = 0; j < hash->colorAttachmentCount; j += 1)
+        for (j = arr->count - 1; j >= 0; j -= 1)
         {
-            if (hash->colorAttachmentViews[j] == view)
+            hash = &arr->elements[j].key;
+            containsView = hash->depthStencilAttachmentView == view;
+
+            for (k = 0; k < hash->colorAttachmentCount; k += 1)
+            {
+                if (
+                    hash->colorAttachmentViews[k] == view ||
+                    hash->colorMultiSampleAttachmentViews[k] == view
+                ) {
+                    containsView = SDL_TRUE;
+                    break;
+                }
+            }
+
+            if (containsView)
             {
                 /* FIXME: do we actually need to queue this?
                  * The framebuffer should not be in use once the associated texture is being destroyed
                  */
                 VULKAN_INTERNAL_ReleaseFramebuffer(
                     renderer,
-                    renderer->framebufferHashArray.elements[i].value
+                    arr->elements[j].value
                 );
 
-                FramebufferHashArray_Remove(
-                    &renderer->framebufferHashArray,
-                    i
+                FramebufferHashArray_Remove(arr, j);
+            }
+        }
+    }
+
+    SDL_UnlockMutex(renderer->framebufferFetchLock);
+}
+
+static void VULKAN_INTERNAL_EvictStaleFramebuffers(
+    VulkanRenderer *renderer
+) {
+    FramebufferHashArray *arr;
+    Uint32 submitIndex;
+    Sint32 i, j;
+
+    SDL_LockMutex(renderer->framebufferFetchLock);
+
+    submitIndex = (Uint32) SDL_AtomicGet(&renderer->submitCounter);
+
+    for (i = 0; i < NUM_FRAMEBUFFER_HASH_BUCKETS; i += 1)
+    {
+        arr = &renderer->framebufferHashTable.buckets[i];
+
+        for (j = arr->count - 1; j >= 0; j -= 1)
+        {
+            /* Unsigned subtraction keeps this correct when the counter wraps */
+            if (submitIndex - arr->elements[j].lastUsedSubmit > FRAMEBUFFER_MAX_IDLE_SUBMITS)
+            {
+                /* Destruction is deferred until no command buffer references it */
+                VULKAN_INTERNAL_ReleaseFramebuffer(
+                    renderer,
+                    arr->elements[j].value
                 );
 
-                break;
+                FramebufferHashArray_Remove(arr, j);
             }
         }
     }
@@ -3331,66 +4310,195 @@ static void VULKAN_INTERNAL_DestroyBufferContainer(
     SDL_UnlockMutex(renderer->disposeLock);
 }
 
-static void VULKAN_INTERNAL_DestroyCommandPool(
-    VulkanRenderer *renderer,
-    VulkanCommandPool *commandPool
+static void VULKAN_INTERNAL_ReturnDescriptorSets(
+    DescriptorSetPool *descriptorSetPool,
+    VkDescriptorSet *descriptorSets,
+    Uint32 descriptorSetCount
 ) {
-    Uint32 i, j;
-    VulkanCommandBuffer* commandBuffer;
+    SDL_LockMutex(descriptorSetPool->lock);
 
-    renderer->vkDestroyCommandPool(
-        renderer->logicalDevice,
-        commandPool->commandPool,
-        NULL
+    if (descriptorSetPool->inactiveDescriptorSetCount + descriptorSetCount > descriptorSetPool->inactiveDescriptorSetCapacity)
+    {
+        descriptorSetPool->inactiveDescriptorSetCapacity = SDL_max(
+            descriptorSetPool->inactiveDescriptorSetCapacity * 2,
+            descriptorSetPool->inactiveDescriptorSetCount + descriptorSetCount
+        );
+        descriptorSetPool->inactiveDescriptorSets = SDL_realloc(
+            descriptorSetPool->inactiveDescriptorSets,
+            descriptorSetPool->inactiveDescriptorSetCapacity * sizeof(VkDescriptorSet)
+        );
+    }
+
+    SDL_memcpy(
+        &descriptorSetPool->inactiveDescriptorSets[descriptorSetPool->inactiveDescriptorSetCount],
+        descriptorSets,
+        descriptorSetCount * sizeof(VkDescriptorSet)
     );
+    descriptorSetPool->inactiveDescriptorSetCount += descriptorSetCount;
 
-    for (i = 0; i < commandPool->inactiveCommandBufferCount; i += 1)
+    SDL_UnlockMutex(descriptorSetPool->lock);
+}
+
+/* Gives every set back to the shared pool and drops the pipeline reference */
+static void VULKAN_INTERNAL_ReleaseDescriptorSetCache(
+    DescriptorSetCache *descriptorSetCache
+) {
+    if (descriptorSetCache->descriptorSetCount > 0)
     {
-        commandBuffer = commandPool->inactiveCommandBuffers[i];
+        VULKAN_INTERNAL_ReturnDescriptorSets(
+            descriptorSetCache->descriptorSetPool,
+            descriptorSetCache->descriptorSets,
+            descriptorSetCache->descriptorSetCount
+        );
+    }
 
-        for (j = 0; j < commandBuffer->initializedVertexUniformBufferCount; j += 1)
-        {
-            VULKAN_INTERNAL_DestroyBufferContainer(
-                renderer,
-                commandBuffer->vertexUniformBuffers[j]->bufferContainer
-            );
+    (void)SDL_AtomicDecRef(descriptorSetCache->pipelineReferenceCount);
 
-            SDL_free(commandBuffer->vertexUniformBuffers[j]);
-        }
+    SDL_free(descriptorSetCache->descriptorSets);
+    descriptorSetCache->descriptorSets = NULL;
+    descriptorSetCache->descriptorSetCount = 0;
+    descriptorSetCache->descriptorSetCapacity = 0;
+    descriptorSetCache->usedDescriptorSetCount = 0;
+}
+
+/*
+ * Called when a command buffer is submitted. Sets that were not handed out
+ * during recording are given back to the shared pool, keeping a batch-sized
+ * reserve so the next recording does not immediately refill. Caches that were
+ * not used at all are released so they do not keep their pipeline alive.
+ */
+static void VULKAN_INTERNAL_TrimDescriptorSetCaches(
+    VulkanCommandBuffer *commandBuffer
+) {
+    DescriptorSetCache *descriptorSetCache;
+    Uint32 keepCount;
+    Sint32 i;
 
-        for (j = 0; j < commandBuffer->initializedFragmentUniformBufferCount; j += 1)
+    for (i = commandBuffer->descriptorSetCacheCount - 1; i >= 0; i -= 1)
+    {
+        descriptorSetCache = &commandBuffer->descriptorSetCaches[i];
+
+        if (descriptorSetCache->usedDescriptorSetCount == 0)
         {
-            VULKAN_INTERNAL_DestroyBufferContainer(
-                renderer,
-                commandBuffer->fragmentUniformBuffers[j]->bufferContainer
-            );
-            SDL_free(commandBuffer->fragmentUniformBuffers[j]);
+            VULKAN_INTERNAL_ReleaseDescriptorSetCache(descriptorSetCache);
+
+            commandBuffer->descriptorSetCaches[i] = commandBuffer->descriptorSetCaches[commandBuffer->descriptorSetCacheCount - 1];
+            commandBuffer->descriptorSetCacheCount -= 1;
+            continue;
         }
 
-        for (j = 0; j < commandBuffer->initializedComputeUniformBufferCount; j += 1)
+        keepCount = (
+            (descriptorSetCache->usedDescriptorSetCount + DESCRIPTOR_SET_CACHE_BATCH_SIZE - 1) /
+            DESCRIPTOR_SET_CACHE_BATCH_SIZE
+        ) * DESCRIPTOR_SET_CACHE_BATCH_SIZE;
+
+        if (descriptorSetCache->descriptorSetCount > keepCount)
         {
-            VULKAN_INTERNAL_DestroyBufferContainer(
-                renderer,
-                commandBuffer->computeUniformBuffers[j]->bufferContainer
+            VULKAN_INTERNAL_ReturnDescriptorSets(
+                descriptorSetCache->descriptorSetPool,
+                &descriptorSetCache->descriptorSets[keepCount],
+                descriptorSetCache->descriptorSetCount - keepCount
             );
-            SDL_free(commandBuffer->computeUniformBuffers[j]);
+            descriptorSetCache->descriptorSetCount = keepCount;
         }
+    }
+
+    commandBuffer->lastDescriptorSetCacheIndex = 0;
+}
+
+static void VULKAN_INTERNAL_FreeInactiveCommandBuffer(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    Uint32 j;
+
+    /* Inactive command buffers have already returned their blocks */
+    SDL_free(commandBuffer->uniformBlocks);
+
+    if (commandBuffer->passTimingQueryPool != VK_NULL_HANDLE)
+    {
+        renderer->vkDestroyQueryPool(
+            renderer->logicalDevice,
+            commandBuffer->passTimingQueryPool,
+            NULL
+        );
+    }
+
+    if (commandBuffer->pipelineStatisticsQueryPool != VK_NULL_HANDLE)
+    {
+        renderer->vkDestroyQueryPool(
+            renderer->logicalDevice,
+            commandBuffer->pipelineStatisticsQueryPool,
+            NULL
+        );
+    }
 
-        SDL_free(commandBuffer->presentDatas);
-        SDL_free(commandBuffer->waitSemaphores);
-        SDL_free(commandBuffer->signalSemaphores);
-        SDL_free(commandBuffer->boundDescriptorSetDatas);
-        SDL_free(commandBuffer->usedBuffers);
-        SDL_free(commandBuffer->usedTextureSlices);
-        SDL_free(commandBuffer->usedSamplers);
-        SDL_free(commandBuffer->usedGraphicsPipelines);
-        SDL_free(commandBuffer->usedComputePipelines);
-        SDL_free(commandBuffer->usedFramebuffers);
+    SDL_free(commandBuffer->presentDatas);
+    SDL_free(commandBuffer->waitSemaphores);
+    SDL_free(commandBuffer->signalSemaphores);
+    SDL_free(commandBuffer->queueWaitSemaphores.elements);
+    SDL_free(commandBuffer->supersededQueueSemaphores.elements);
 
-        SDL_free(commandBuffer);
+    for (j = 0; j < commandBuffer->descriptorSetCacheCount; j += 1)
+    {
+        VULKAN_INTERNAL_ReleaseDescriptorSetCache(&commandBuffer->descriptorSetCaches[j]);
+    }
+    SDL_free(commandBuffer->descriptorSetCaches);
+
+    for (j = 0; j < NUM_WRITTEN_DESCRIPTOR_SET_BUCKETS; j += 1)
+    {
+        SDL_free(commandBuffer->writtenDescriptorSetBuckets[j].elements);
+    }
+    SDL_free(commandBuffer->writtenDescriptorSetKeys);
+
+    SDL_free(commandBuffer->usedBuffers);
+    SDL_free(commandBuffer->usedTextureSlices);
+    SDL_free(commandBuffer->usedSamplers);
+    SDL_free(commandBuffer->usedGraphicsPipelines);
+    SDL_free(commandBuffer->usedComputePipelines);
+    SDL_free(commandBuffer->usedBindlessTables);
+    SDL_free(commandBuffer->usedFramebuffers);
+
+    SDL_free(commandBuffer->pendingBufferBarriers);
+    SDL_free(commandBuffer->pendingBufferBarrierStages);
+    SDL_free(commandBuffer->pendingImageBarriers);
+    SDL_free(commandBuffer->pendingImageBarrierStages);
+
+    SDL_free(commandBuffer->secondaryCommandBuffers);
+
+    SDL_free(commandBuffer);
+}
+
+static void VULKAN_INTERNAL_DestroyCommandPool(
+    VulkanRenderer *renderer,
+    VulkanCommandPool *commandPool
+) {
+    Uint32 i;
+
+    renderer->vkDestroyCommandPool(
+        renderer->logicalDevice,
+        commandPool->commandPool,
+        NULL
+    );
+
+    for (i = 0; i < commandPool->inactiveCommandBufferCount; i += 1)
+    {
+        VULKAN_INTERNAL_FreeInactiveCommandBuffer(
+            renderer,
+            commandPool->inactiveCommandBuffers[i]
+        );
+    }
+
+    for (i = 0; i < commandPool->inactiveSecondaryCommandBufferCount; i += 1)
+    {
+        VULKAN_INTERNAL_FreeInactiveCommandBuffer(
+            renderer,
+            commandPool->inactiveSecondaryCommandBuffers[i]
+        );
     }
 
     SDL_free(commandPool->inactiveCommandBuffers);
+    SDL_free(commandPool->inactiveSecondaryCommandBuffers);
     SDL_free(commandPool);
 }
 
@@ -3515,6 +4623,47 @@ static void VULKAN_INTERNAL_DestroySampler(
     SDL_free(vulkanSampler);
 }
 
+static void VULKAN_INTERNAL_ClearBindlessTableEntry(
+    VulkanBindlessTable *bindlessTable,
+    Uint32 index
+) {
+    if (bindlessTable->textures[index] != NULL)
+    {
+        (void)SDL_AtomicDecRef(&bindlessTable->textures[index]->bindlessReferenceCount);
+        (void)SDL_AtomicDecRef(&bindlessTable->textures[index]->slices[0].referenceCount);
+        bindlessTable->textures[index] = NULL;
+    }
+
+    if (bindlessTable->samplers[index] != NULL)
+    {
+        (void)SDL_AtomicDecRef(&bindlessTable->samplers[index]->referenceCount);
+        bindlessTable->samplers[index] = NULL;
+    }
+}
+
+static void VULKAN_INTERNAL_DestroyBindlessTable(
+    VulkanRenderer *renderer,
+    VulkanBindlessTable *bindlessTable
+) {
+    Uint32 i;
+
+    for (i = 0; i < bindlessTable->capacity; i += 1)
+    {
+        VULKAN_INTERNAL_ClearBindlessTableEntry(bindlessTable, i);
+    }
+
+    /* Destroying the pool frees the set */
+    renderer->vkDestroyDescriptorPool(
+        renderer->logicalDevice,
+        bindlessTable->descriptorPool,
+        NULL
+    );
+
+    SDL_free(bindlessTable->textures);
+    SDL_free(bindlessTable->samplers);
+    SDL_free(bindlessTable);
+}
+
 static void VULKAN_INTERNAL_DestroySwapchain(
     VulkanRenderer* renderer,
     WindowData *windowData
@@ -3684,9 +4833,21 @@ static void VULKAN_INTERNAL_InitializeDescriptorSetPool(
     DescriptorSetPool *descriptorSetPool
 ) {
     descriptorSetPool->lock = SDL_CreateMutex();
+    SDL_AtomicSet(&descriptorSetPool->released, 0);
 
     /* Descriptor set layout and descriptor infos are already set when this function is called */
 
+    if (descriptorSetPool->pushDescriptors)
+    {
+        descriptorSetPool->descriptorPoolCount = 0;
+        descriptorSetPool->descriptorPools = NULL;
+        descriptorSetPool->nextPoolSize = 0;
+        descriptorSetPool->inactiveDescriptorSetCapacity = 0;
+        descriptorSetPool->inactiveDescriptorSetCount = 0;
+        descriptorSetPool->inactiveDescriptorSets = NULL;
+        return;
+    }
+
     descriptorSetPool->descriptorPoolCount = 1;
     descriptorSetPool->descriptorPools = SDL_malloc(sizeof(VkDescriptorPool));
     descriptorSetPool->nextPoolSize = DESCRIPTOR_POOL_STARTING_SIZE * 2;
@@ -3714,6 +4875,21 @@ static void VULKAN_INTERNAL_InitializeDescriptorSetPool(
     );
 }
 
+/*
+ * Only one set per pipeline layout may use push descriptors, and the set
+ * must not hold dynamic uniform buffers, so only resource sets qualify.
+ */
+static inline Uint8 VULKAN_INTERNAL_CanPushDescriptors(
+    VulkanRenderer *renderer,
+    Uint32 bindingCount
+) {
+    return (
+        renderer->supports.KHR_push_descriptor &&
+        bindingCount > 0 &&
+        bindingCount <= renderer->physicalDevicePushDescriptorProperties.maxPushDescriptors
+    );
+}
+
 static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
     VulkanRenderer *renderer,
     SDL_GpuGraphicsPipelineResourceInfo *vertexResourceInfo,
@@ -3722,9 +4898,10 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
 ) {
     VkDescriptorSetLayoutBinding descriptorSetLayoutBindings[MAX_TEXTURE_SAMPLERS_PER_STAGE + MAX_STORAGE_TEXTURES_PER_STAGE + MAX_STORAGE_BUFFERS_PER_STAGE];
     VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo;
-    VkDescriptorSetLayout descriptorSetLayouts[4];
+    VkDescriptorSetLayout descriptorSetLayouts[5];
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
     DescriptorSetPool *descriptorSetPool;
+    Sint32 pushDescriptorSetIndex = -1;
     VkResult vulkanResult;
     Uint32 i;
 
@@ -3738,6 +4915,21 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
     pipelineResourceLayout->fragmentStorageBufferCount = fragmentResourceInfo->storageBufferCount;
     pipelineResourceLayout->fragmentUniformBufferCount = fragmentResourceInfo->uniformBufferCount;
 
+    /* Fragment resources usually change more often than vertex resources, so prefer pushing those */
+
+    if (VULKAN_INTERNAL_CanPushDescriptors(
+        renderer,
+        fragmentResourceInfo->samplerCount + fragmentResourceInfo->storageTextureCount + fragmentResourceInfo->storageBufferCount
+    )) {
+        pushDescriptorSetIndex = 2;
+    }
+    else if (VULKAN_INTERNAL_CanPushDescriptors(
+        renderer,
+        vertexResourceInfo->samplerCount + vertexResourceInfo->storageTextureCount + vertexResourceInfo->storageBufferCount
+    )) {
+        pushDescriptorSetIndex = 0;
+    }
+
     /* Vertex Resources */
 
     descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
@@ -3751,6 +4943,11 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
 
     descriptorSetPool = &pipelineResourceLayout->descriptorSetPools[0];
 
+    descriptorSetPool->pushDescriptors = (pushDescriptorSetIndex == 0);
+    descriptorSetLayoutCreateInfo.flags = descriptorSetPool->pushDescriptors ?
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+        0;
+
     descriptorSetPool->descriptorInfoCount = descriptorSetLayoutCreateInfo.bindingCount;
     descriptorSetPool->descriptorInfos = NULL;
 
@@ -3818,6 +5015,11 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
 
     descriptorSetPool = &pipelineResourceLayout->descriptorSetPools[1];
 
+    descriptorSetPool->pushDescriptors = (pushDescriptorSetIndex == 1);
+    descriptorSetLayoutCreateInfo.flags = descriptorSetPool->pushDescriptors ?
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+        0;
+
     descriptorSetLayoutCreateInfo.bindingCount = pipelineResourceLayout->vertexUniformBufferCount;
     descriptorSetLayoutCreateInfo.pBindings = NULL;
 
@@ -3864,6 +5066,11 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
 
     descriptorSetPool = &pipelineResourceLayout->descriptorSetPools[2];
 
+    descriptorSetPool->pushDescriptors = (pushDescriptorSetIndex == 2);
+    descriptorSetLayoutCreateInfo.flags = descriptorSetPool->pushDescriptors ?
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+        0;
+
     descriptorSetLayoutCreateInfo.bindingCount =
         fragmentResourceInfo->samplerCount +
         fragmentResourceInfo->storageTextureCount +
@@ -3912,7 +5119,7 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
             descriptorSetLayoutBindings[i].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
             descriptorSetLayoutBindings[i].pImmutableSamplers = NULL;
 
-            descriptorSetPool->descriptorInfos[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            descriptorSetPool->descriptorInfos[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             descriptorSetPool->descriptorInfos[i].stageFlag = VK_SHADER_STAGE_FRAGMENT_BIT;
         }
 
@@ -3938,6 +5145,11 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
 
     descriptorSetPool = &pipelineResourceLayout->descriptorSetPools[3];
 
+    descriptorSetPool->pushDescriptors = (pushDescriptorSetIndex == 3);
+    descriptorSetLayoutCreateInfo.flags = descriptorSetPool->pushDescriptors ?
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+        0;
+
     descriptorSetLayoutCreateInfo.bindingCount =
         pipelineResourceLayout->fragmentUniformBufferCount;
 
@@ -3982,12 +5194,15 @@ static SDL_bool VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
         return SDL_FALSE;
     }
 
+    /* The bindless set is owned by the renderer, so it has no pool here */
+    descriptorSetLayouts[4] = renderer->bindlessDescriptorSetLayout;
+
     /* Create the pipeline layout */
 
     pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutCreateInfo.pNext = NULL;
     pipelineLayoutCreateInfo.flags = 0;
-    pipelineLayoutCreateInfo.setLayoutCount = 4;
+    pipelineLayoutCreateInfo.setLayoutCount = pipelineResourceLayout->useBindlessTable ? 5 : 4;
     pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayouts;
     pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
     pipelineLayoutCreateInfo.pPushConstantRanges = NULL;
@@ -4023,9 +5238,10 @@ static SDL_bool VULKAN_INTERNAL_InitializeComputePipelineResourceLayout(
 ) {
     VkDescriptorSetLayoutBinding descriptorSetLayoutBindings[MAX_UNIFORM_BUFFERS_PER_STAGE];
     VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo;
-    VkDescriptorSetLayout descriptorSetLayouts[3];
+    VkDescriptorSetLayout descriptorSetLayouts[4];
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
     DescriptorSetPool *descriptorSetPool;
+    Sint32 pushDescriptorSetIndex = -1;
     VkResult vulkanResult;
     Uint32 i;
 
@@ -4035,6 +5251,19 @@ static SDL_bool VULKAN_INTERNAL_InitializeComputePipelineResourceLayout(
     pipelineResourceLayout->readWriteStorageBufferCount = resourceLayoutInfo->readWriteStorageBufferCount;
     pipelineResourceLayout->uniformBufferCount = resourceLayoutInfo->uniformBufferCount;
 
+    if (VULKAN_INTERNAL_CanPushDescriptors(
+        renderer,
+        resourceLayoutInfo->readOnlyStorageTextureCount + resourceLayoutInfo->readOnlyStorageBufferCount
+    )) {
+        pushDescriptorSetIndex = 0;
+    }
+    else if (VULKAN_INTERNAL_CanPushDescriptors(
+        renderer,
+        resourceLayoutInfo->readWriteStorageTextureCount + resourceLayoutInfo->readWriteStorageBufferCount
+    )) {
+        pushDescriptorSetIndex = 1;
+    }
+
     /* Read-only resources */
 
     descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
@@ -4047,6 +5276,11 @@ static SDL_bool VULKAN_INTERNAL_InitializeComputePipelineResourceLayout(
 
     descriptorSetPool = &pipelineResourceLayout->descriptorSetPools[0];
 
+    descriptorSetPool->pushDescriptors = (pushDescriptorSetIndex == 0);
+    descriptorSetLayoutCreateInfo.flags = descriptorSetPool->pushDescriptors ?
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+        0;
+
     descriptorSetPool->descriptorInfoCount = descriptorSetLayoutCreateInfo.bindingCount;
     descriptorSetPool->descriptorInfos = NULL;
 
@@ -4108,6 +5342,11 @@ static SDL_bool VULKAN_INTERNAL_InitializeComputePipelineResourceLayout(
 
     descriptorSetPool = &pipelineResourceLayout->descriptorSetPools[1];
 
+    descriptorSetPool->pushDescriptors = (pushDescriptorSetIndex == 1);
+    descriptorSetLayoutCreateInfo.flags = descriptorSetPool->pushDescriptors ?
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+        0;
+
     descriptorSetPool->descriptorInfoCount = descriptorSetLayoutCreateInfo.bindingCount;
     descriptorSetPool->descriptorInfos = NULL;
 
@@ -4163,6 +5402,11 @@ static SDL_bool VULKAN_INTERNAL_InitializeComputePipelineResourceLayout(
 
     descriptorSetPool = &pipelineResourceLayout->descriptorSetPools[2];
 
+    descriptorSetPool->pushDescriptors = (pushDescriptorSetIndex == 2);
+    descriptorSetLayoutCreateInfo.flags = descriptorSetPool->pushDescriptors ?
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+        0;
+
     descriptorSetLayoutCreateInfo.bindingCount = resourceLayoutInfo->uniformBufferCount;
     descriptorSetLayoutCreateInfo.pBindings = NULL;
 
@@ -4205,12 +5449,15 @@ static SDL_bool VULKAN_INTERNAL_InitializeComputePipelineResourceLayout(
         return SDL_FALSE;
     }
 
+    /* The bindless set is owned by the renderer, so it has no pool here */
+    descriptorSetLayouts[3] = renderer->bindlessDescriptorSetLayout;
+
     /* Create the pipeline layout */
 
     pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutCreateInfo.pNext = NULL;
     pipelineLayoutCreateInfo.flags = 0;
-    pipelineLayoutCreateInfo.setLayoutCount = 3;
+    pipelineLayoutCreateInfo.setLayoutCount = pipelineResourceLayout->useBindlessTable ? 4 : 3;
     pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayouts;
     pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
     pipelineLayoutCreateInfo.pPushConstantRanges = NULL;
@@ -4299,9 +5546,12 @@ static VulkanBuffer* VULKAN_INTERNAL_CreateBuffer(
     bufferCreateInfo.flags = 0;
     bufferCreateInfo.size = size;
     bufferCreateInfo.usage = vulkanUsageFlags;
-    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    bufferCreateInfo.queueFamilyIndexCount = 1;
-    bufferCreateInfo.pQueueFamilyIndices = &renderer->queueFamilyIndex;
+    /* Concurrent sharing spares us ownership transfers between the dedicated queues */
+    bufferCreateInfo.sharingMode = renderer->queueFamilyIndexCount > 1 ?
+        VK_SHARING_MODE_CONCURRENT :
+        VK_SHARING_MODE_EXCLUSIVE;
+    bufferCreateInfo.queueFamilyIndexCount = renderer->queueFamilyIndexCount;
+    bufferCreateInfo.pQueueFamilyIndices = renderer->queueFamilyIndices;
 
     /* Set transfer bits so we can defrag */
     bufferCreateInfo.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
@@ -4993,6 +6243,7 @@ static Uint8 VULKAN_INTERNAL_CreateSwapchain(
     for (i = 0; i < swapchainData->imageCount; i += 1)
     {
         swapchainData->textureContainers[i].canBeCycled = 0;
+        swapchainData->textureContainers[i].format = SDL_GPU_TEXTUREFORMAT_B8G8R8A8; /* every swapchain format is 4 bytes per texel */
         swapchainData->textureContainers[i].textureCapacity = 0;
         swapchainData->textureContainers[i].textureCount = 0;
         swapchainData->textureContainers[i].textureHandles = NULL;
@@ -5126,6 +6377,18 @@ static void VULKAN_INTERNAL_EndCommandBuffer(
 ) {
     VkResult result;
 
+    /* Resources transitioned back to their defaults at the end of the last pass */
+    VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
+
+    if (commandBuffer->pipelineStatisticsEnabled)
+    {
+        renderer->vkCmdEndQuery(
+            commandBuffer->commandBuffer,
+            commandBuffer->pipelineStatisticsQueryPool,
+            0
+        );
+    }
+
     result = renderer->vkEndCommandBuffer(
         commandBuffer->commandBuffer
     );
@@ -5171,6 +6434,60 @@ static void VULKAN_DestroyDevice(
     SDL_free(renderer->fencePool.availableFences);
     SDL_DestroyMutex(renderer->fencePool.lock);
 
+    /* Semaphores signaled for a queue that never submitted again are still pending */
+    if (renderer->transferToGraphicsSemaphore != VK_NULL_HANDLE)
+    {
+        VULKAN_INTERNAL_PushSemaphore(
+            &renderer->availableQueueSemaphores,
+            renderer->transferToGraphicsSemaphore
+        );
+    }
+
+    if (renderer->computeToGraphicsSemaphore != VK_NULL_HANDLE)
+    {
+        VULKAN_INTERNAL_PushSemaphore(
+            &renderer->availableQueueSemaphores,
+            renderer->computeToGraphicsSemaphore
+        );
+    }
+
+    if (renderer->transferToComputeSemaphore != VK_NULL_HANDLE)
+    {
+        VULKAN_INTERNAL_PushSemaphore(
+            &renderer->availableQueueSemaphores,
+            renderer->transferToComputeSemaphore
+        );
+    }
+
+    for (i = 0; i < renderer->availableQueueSemaphores.count; i += 1)
+    {
+        renderer->vkDestroySemaphore(
+            renderer->logicalDevice,
+            renderer->availableQueueSemaphores.elements[i],
+            NULL
+        );
+    }
+
+    SDL_free(renderer->availableQueueSemaphores.elements);
+
+    for (i = 0; i < renderer->timelineCount; i += 1)
+    {
+        renderer->vkDestroySemaphore(
+            renderer->logicalDevice,
+            renderer->timelines[i].semaphore,
+            NULL
+        );
+    }
+
+    if (renderer->bindlessDescriptorSetLayout != VK_NULL_HANDLE)
+    {
+        renderer->vkDestroyDescriptorSetLayout(
+            renderer->logicalDevice,
+            renderer->bindlessDescriptorSetLayout,
+            NULL
+        );
+    }
+
     for (i = 0; i < NUM_COMMAND_POOL_BUCKETS; i += 1)
     {
         commandPoolHashArray = renderer->commandPoolHashTable.buckets[i];
@@ -5188,32 +6505,63 @@ static void VULKAN_DestroyDevice(
         }
     }
 
+    /* Pipelines kept alive by descriptor set caches can be destroyed now */
+    VULKAN_INTERNAL_PerformPendingDestroys(renderer);
+
+    for (i = 0; i < (Sint32) renderer->uniformArenaPageCount; i += 1)
+    {
+        VULKAN_INTERNAL_DestroyBuffer(renderer, renderer->uniformArenaPages[i]);
+    }
+    SDL_free(renderer->uniformArenaPages);
+    SDL_free(renderer->availableUniformBlocks);
+
     renderer->vkDestroyQueryPool(
         renderer->logicalDevice,
         renderer->queryPool,
         NULL
     );
 
-    for (i = 0; i < renderer->framebufferHashArray.count; i += 1)
+    if (renderer->timestampQueryPool != VK_NULL_HANDLE)
     {
-        VULKAN_INTERNAL_DestroyFramebuffer(
-            renderer,
-            renderer->framebufferHashArray.elements[i].value
+        renderer->vkDestroyQueryPool(
+            renderer->logicalDevice,
+            renderer->timestampQueryPool,
+            NULL
         );
     }
 
-    SDL_free(renderer->framebufferHashArray.elements);
+    renderer->vkDestroyPipelineCache(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        NULL
+    );
 
-    for (i = 0; i < renderer->renderPassHashArray.count; i += 1)
+    for (i = 0; i < NUM_FRAMEBUFFER_HASH_BUCKETS; i += 1)
     {
-        renderer->vkDestroyRenderPass(
-            renderer->logicalDevice,
-            renderer->renderPassHashArray.elements[i].value,
-            NULL
-        );
+        for (j = 0; j < renderer->framebufferHashTable.buckets[i].count; j += 1)
+        {
+            VULKAN_INTERNAL_DestroyFramebuffer(
+                renderer,
+                renderer->framebufferHashTable.buckets[i].elements[j].value
+            );
+        }
+
+        SDL_free(renderer->framebufferHashTable.buckets[i].elements);
     }
 
-    SDL_free(renderer->renderPassHashArray.elements);
+    for (i = 0; i < NUM_RENDER_PASS_HASH_BUCKETS; i += 1)
+    {
+        for (j = 0; j < renderer->renderPassHashTable.buckets[i].count; j += 1)
+        {
+            renderer->vkDestroyRenderPass(
+                renderer->logicalDevice,
+                renderer->renderPassHashTable.buckets[i].elements[j].value,
+                NULL
+            );
+        }
+
+        SDL_free(renderer->renderPassHashTable.buckets[i].elements);
+    }
 
     for (i = 0; i < VK_MAX_MEMORY_TYPES; i += 1)
     {
@@ -5240,8 +6588,6 @@ static void VULKAN_DestroyDevice(
         {
             SDL_free(renderer->memoryAllocator->subAllocators[i].allocations);
         }
-
-        SDL_free(renderer->memoryAllocator->subAllocators[i].sortedFreeRegions);
     }
 
     SDL_free(renderer->memoryAllocator);
@@ -5250,6 +6596,7 @@ static void VULKAN_DestroyDevice(
     SDL_free(renderer->buffersToDestroy);
     SDL_free(renderer->graphicsPipelinesToDestroy);
     SDL_free(renderer->computePipelinesToDestroy);
+    SDL_free(renderer->bindlessTablesToDestroy);
     SDL_free(renderer->shadersToDestroy);
     SDL_free(renderer->samplersToDestroy);
     SDL_free(renderer->framebuffersToDestroy);
@@ -5261,6 +6608,7 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyMutex(renderer->renderPassFetchLock);
     SDL_DestroyMutex(renderer->framebufferFetchLock);
     SDL_DestroyMutex(renderer->queryLock);
+    SDL_DestroyMutex(renderer->uniformArenaLock);
 
     renderer->vkDestroyDevice(renderer->logicalDevice, NULL);
     renderer->vkDestroyInstance(renderer->instance, NULL);
@@ -5270,18 +6618,29 @@ static void VULKAN_DestroyDevice(
     SDL_Vulkan_UnloadLibrary();
 }
 
-static VkDescriptorSet VULKAN_INTERNAL_FetchDescriptorSet(
+static SDL_bool VULKAN_INTERNAL_RefillDescriptorSetCache(
     VulkanRenderer *renderer,
-    VulkanCommandBuffer *vulkanCommandBuffer,
-    DescriptorSetPool *descriptorSetPool
+    DescriptorSetCache *descriptorSetCache
 ) {
-    VkDescriptorSet descriptorSet;
+    DescriptorSetPool *descriptorSetPool = descriptorSetCache->descriptorSetPool;
+
+    if (descriptorSetCache->descriptorSetCount + DESCRIPTOR_SET_CACHE_BATCH_SIZE > descriptorSetCache->descriptorSetCapacity)
+    {
+        descriptorSetCache->descriptorSetCapacity = SDL_max(
+            descriptorSetCache->descriptorSetCapacity * 2,
+            descriptorSetCache->descriptorSetCount + DESCRIPTOR_SET_CACHE_BATCH_SIZE
+        );
+        descriptorSetCache->descriptorSets = SDL_realloc(
+            descriptorSetCache->descriptorSets,
+            descriptorSetCache->descriptorSetCapacity * sizeof(VkDescriptorSet)
+        );
+    }
 
     SDL_LockMutex(descriptorSetPool->lock);
 
-    /* If no inactive descriptor sets remain, create a new pool and allocate new inactive sets */
+    /* If not enough inactive descriptor sets remain, create a new pool and allocate new inactive sets */
 
-    if (descriptorSetPool->inactiveDescriptorSetCount == 0)
+    if (descriptorSetPool->inactiveDescriptorSetCount < DESCRIPTOR_SET_CACHE_BATCH_SIZE)
     {
         descriptorSetPool->descriptorPoolCount += 1;
         descriptorSetPool->descriptorPools = SDL_realloc(
@@ -5296,52 +6655,247 @@ static VkDescriptorSet VULKAN_INTERNAL_FetchDescriptorSet(
             descriptorSetPool->nextPoolSize,
             &descriptorSetPool->descriptorPools[descriptorSetPool->descriptorPoolCount - 1]
         )) {
+            descriptorSetPool->descriptorPoolCount -= 1;
             SDL_UnlockMutex(descriptorSetPool->lock);
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create descriptor pool!");
-            return VK_NULL_HANDLE;
+            return SDL_FALSE;
         }
 
-        descriptorSetPool->inactiveDescriptorSetCapacity += descriptorSetPool->nextPoolSize;
-
-        descriptorSetPool->inactiveDescriptorSets = SDL_realloc(
-            descriptorSetPool->inactiveDescriptorSets,
-            sizeof(VkDescriptorSet) * descriptorSetPool->inactiveDescriptorSetCapacity
-        );
+        if (descriptorSetPool->inactiveDescriptorSetCount + descriptorSetPool->nextPoolSize > descriptorSetPool->inactiveDescriptorSetCapacity)
+        {
+            descriptorSetPool->inactiveDescriptorSetCapacity = descriptorSetPool->inactiveDescriptorSetCount + descriptorSetPool->nextPoolSize;
+            descriptorSetPool->inactiveDescriptorSets = SDL_realloc(
+                descriptorSetPool->inactiveDescriptorSets,
+                sizeof(VkDescriptorSet) * descriptorSetPool->inactiveDescriptorSetCapacity
+            );
+        }
 
         if (!VULKAN_INTERNAL_AllocateDescriptorSets(
             renderer,
             descriptorSetPool->descriptorPools[descriptorSetPool->descriptorPoolCount - 1],
             descriptorSetPool->descriptorSetLayout,
             descriptorSetPool->nextPoolSize,
-            descriptorSetPool->inactiveDescriptorSets
+            &descriptorSetPool->inactiveDescriptorSets[descriptorSetPool->inactiveDescriptorSetCount]
         )) {
             SDL_UnlockMutex(descriptorSetPool->lock);
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate descriptor sets!");
-            return VK_NULL_HANDLE;
+            return SDL_FALSE;
         }
 
-        descriptorSetPool->inactiveDescriptorSetCount = descriptorSetPool->nextPoolSize;
+        descriptorSetPool->inactiveDescriptorSetCount += descriptorSetPool->nextPoolSize;
 
         descriptorSetPool->nextPoolSize *= 2;
     }
 
-    descriptorSet = descriptorSetPool->inactiveDescriptorSets[descriptorSetPool->inactiveDescriptorSetCount - 1];
-    descriptorSetPool->inactiveDescriptorSetCount -= 1;
+    descriptorSetPool->inactiveDescriptorSetCount -= DESCRIPTOR_SET_CACHE_BATCH_SIZE;
+
+    SDL_memcpy(
+        &descriptorSetCache->descriptorSets[descriptorSetCache->descriptorSetCount],
+        &descriptorSetPool->inactiveDescriptorSets[descriptorSetPool->inactiveDescriptorSetCount],
+        DESCRIPTOR_SET_CACHE_BATCH_SIZE * sizeof(VkDescriptorSet)
+    );
 
     SDL_UnlockMutex(descriptorSetPool->lock);
 
-    if (vulkanCommandBuffer->boundDescriptorSetDataCount == vulkanCommandBuffer->boundDescriptorSetDataCapacity)
+    descriptorSetCache->descriptorSetCount += DESCRIPTOR_SET_CACHE_BATCH_SIZE;
+
+    return SDL_TRUE;
+}
+
+static DescriptorSetCache* VULKAN_INTERNAL_FetchDescriptorSetCache(
+    VulkanCommandBuffer *vulkanCommandBuffer,
+    DescriptorSetPool *descriptorSetPool,
+    SDL_atomic_t *pipelineReferenceCount
+) {
+    DescriptorSetCache *descriptorSetCache;
+    Uint32 count = vulkanCommandBuffer->descriptorSetCacheCount;
+    Uint32 index = vulkanCommandBuffer->lastDescriptorSetCacheIndex;
+    Uint32 i;
+
+    /* Fetches for one pipeline tend to be adjacent, so start from the last hit */
+    for (i = 0; i < count; i += 1)
+    {
+        if (index >= count)
+        {
+            index = 0;
+        }
+
+        if (vulkanCommandBuffer->descriptorSetCaches[index].descriptorSetPool == descriptorSetPool)
+        {
+            vulkanCommandBuffer->lastDescriptorSetCacheIndex = index;
+            return &vulkanCommandBuffer->descriptorSetCaches[index];
+        }
+
+        index += 1;
+    }
+
+    if (vulkanCommandBuffer->descriptorSetCacheCount == vulkanCommandBuffer->descriptorSetCacheCapacity)
+    {
+        vulkanCommandBuffer->descriptorSetCacheCapacity *= 2;
+        vulkanCommandBuffer->descriptorSetCaches = SDL_realloc(
+            vulkanCommandBuffer->descriptorSetCaches,
+            vulkanCommandBuffer->descriptorSetCacheCapacity * sizeof(DescriptorSetCache)
+        );
+    }
+
+    descriptorSetCache = &vulkanCommandBuffer->descriptorSetCaches[vulkanCommandBuffer->descriptorSetCacheCount];
+    descriptorSetCache->descriptorSetPool = descriptorSetPool;
+    descriptorSetCache->pipelineReferenceCount = pipelineReferenceCount;
+    descriptorSetCache->descriptorSets = NULL;
+    descriptorSetCache->descriptorSetCount = 0;
+    descriptorSetCache->descriptorSetCapacity = 0;
+    descriptorSetCache->usedDescriptorSetCount = 0;
+
+    (void)SDL_AtomicIncRef(pipelineReferenceCount);
+
+    vulkanCommandBuffer->lastDescriptorSetCacheIndex = vulkanCommandBuffer->descriptorSetCacheCount;
+    vulkanCommandBuffer->descriptorSetCacheCount += 1;
+
+    return descriptorSetCache;
+}
+
+static VkDescriptorSet VULKAN_INTERNAL_FetchDescriptorSet(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *vulkanCommandBuffer,
+    DescriptorSetPool *descriptorSetPool,
+    SDL_atomic_t *pipelineReferenceCount
+) {
+    DescriptorSetCache *descriptorSetCache;
+    VkDescriptorSet descriptorSet;
+
+    descriptorSetCache = VULKAN_INTERNAL_FetchDescriptorSetCache(
+        vulkanCommandBuffer,
+        descriptorSetPool,
+        pipelineReferenceCount
+    );
+
+    if (descriptorSetCache->usedDescriptorSetCount == descriptorSetCache->descriptorSetCount)
+    {
+        if (!VULKAN_INTERNAL_RefillDescriptorSetCache(renderer, descriptorSetCache))
+        {
+            return VK_NULL_HANDLE;
+        }
+    }
+
+    descriptorSet = descriptorSetCache->descriptorSets[descriptorSetCache->usedDescriptorSetCount];
+    descriptorSetCache->usedDescriptorSetCount += 1;
+    vulkanCommandBuffer->common.stats.descriptorSetsAllocated += 1;
+
+    return descriptorSet;
+}
+
+/*
+ * Returns a descriptor set holding the given writes. If a set with the same
+ * contents was already written from this pool during the recording it is
+ * reused and vkUpdateDescriptorSets is skipped, otherwise a new set is fetched
+ * and written. The dstSet of each write is filled in here.
+ */
+static VkDescriptorSet VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    DescriptorSetPool *descriptorSetPool,
+    SDL_atomic_t *pipelineReferenceCount,
+    VkWriteDescriptorSet *writeDescriptorSets,
+    Uint32 writeDescriptorSetCount
+) {
+    WrittenDescriptorSetArray *arr;
+    WrittenDescriptorSet *writtenDescriptorSet;
+    VkDescriptorSet descriptorSet;
+    Uint64 *key;
+    Uint32 keyOffset = commandBuffer->writtenDescriptorSetKeyCount;
+    Uint32 keyLength = writeDescriptorSetCount * 3;
+    Uint64 hash;
+    Uint32 i;
+
+    if (keyOffset + keyLength > commandBuffer->writtenDescriptorSetKeyCapacity)
     {
-        vulkanCommandBuffer->boundDescriptorSetDataCapacity *= 2;
-        vulkanCommandBuffer->boundDescriptorSetDatas = SDL_realloc(
-            vulkanCommandBuffer->boundDescriptorSetDatas,
-            vulkanCommandBuffer->boundDescriptorSetDataCapacity * sizeof(DescriptorSetData)
+        commandBuffer->writtenDescriptorSetKeyCapacity = SDL_max(
+            commandBuffer->writtenDescriptorSetKeyCapacity * 2,
+            keyOffset + keyLength
         );
+        commandBuffer->writtenDescriptorSetKeys = SDL_realloc(
+            commandBuffer->writtenDescriptorSetKeys,
+            commandBuffer->writtenDescriptorSetKeyCapacity * sizeof(Uint64)
+        );
+    }
+
+    /* Non-dispatchable Vulkan handles are always 64 bits wide */
+    key = &commandBuffer->writtenDescriptorSetKeys[keyOffset];
+
+    for (i = 0; i < writeDescriptorSetCount; i += 1)
+    {
+        if (writeDescriptorSets[i].pImageInfo != NULL)
+        {
+            SDL_memcpy(&key[i * 3 + 0], &writeDescriptorSets[i].pImageInfo->sampler, sizeof(Uint64));
+            SDL_memcpy(&key[i * 3 + 1], &writeDescriptorSets[i].pImageInfo->imageView, sizeof(Uint64));
+            key[i * 3 + 2] = (Uint64) writeDescriptorSets[i].pImageInfo->imageLayout;
+        }
+        else
+        {
+            SDL_memcpy(&key[i * 3 + 0], &writeDescriptorSets[i].pBufferInfo->buffer, sizeof(Uint64));
+            key[i * 3 + 1] = (Uint64) writeDescriptorSets[i].pBufferInfo->offset;
+            key[i * 3 + 2] = (Uint64) writeDescriptorSets[i].pBufferInfo->range;
+        }
+    }
+
+    hash = HashBytes(&descriptorSetPool, sizeof(DescriptorSetPool*), HASH_SEED);
+    hash = HashBytes(key, keyLength * sizeof(Uint64), hash);
+
+    arr = &commandBuffer->writtenDescriptorSetBuckets[hash % NUM_WRITTEN_DESCRIPTOR_SET_BUCKETS];
+
+    for (i = 0; i < arr->count; i += 1)
+    {
+        writtenDescriptorSet = &arr->elements[i];
+
+        if (    writtenDescriptorSet->hash == hash &&
+                writtenDescriptorSet->descriptorSetPool == descriptorSetPool &&
+                writtenDescriptorSet->keyLength == keyLength &&
+                SDL_memcmp(
+                    &commandBuffer->writtenDescriptorSetKeys[writtenDescriptorSet->keyOffset],
+                    key,
+                    keyLength * sizeof(Uint64)
+                ) == 0    )
+        {
+            return writtenDescriptorSet->descriptorSet;
+        }
+    }
+
+    descriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
+        renderer,
+        commandBuffer,
+        descriptorSetPool,
+        pipelineReferenceCount
+    );
+
+    if (descriptorSet == VK_NULL_HANDLE)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    for (i = 0; i < writeDescriptorSetCount; i += 1)
+    {
+        writeDescriptorSets[i].dstSet = descriptorSet;
     }
 
-    vulkanCommandBuffer->boundDescriptorSetDatas[vulkanCommandBuffer->boundDescriptorSetDataCount].descriptorSet = descriptorSet;
-    vulkanCommandBuffer->boundDescriptorSetDatas[vulkanCommandBuffer->boundDescriptorSetDataCount].descriptorSetPool = descriptorSetPool;
-    vulkanCommandBuffer->boundDescriptorSetDataCount += 1;
+    renderer->vkUpdateDescriptorSets(
+        renderer->logicalDevice,
+        writeDescriptorSetCount,
+        writeDescriptorSets,
+        0,
+        NULL
+    );
+
+    EXPAND_ELEMENTS_IF_NEEDED(arr, 4, WrittenDescriptorSet)
+
+    writtenDescriptorSet = &arr->elements[arr->count];
+    writtenDescriptorSet->hash = hash;
+    writtenDescriptorSet->descriptorSetPool = descriptorSetPool;
+    writtenDescriptorSet->keyOffset = keyOffset;
+    writtenDescriptorSet->keyLength = keyLength;
+    writtenDescriptorSet->descriptorSet = descriptorSet;
+    arr->count += 1;
+
+    commandBuffer->writtenDescriptorSetKeyCount += keyLength;
 
     return descriptorSet;
 }
@@ -5367,12 +6921,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
     {
         descriptorSetPool = &resourceLayout->descriptorSetPools[0];
 
-        commandBuffer->vertexResourceDescriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
-            renderer,
-            commandBuffer,
-            descriptorSetPool
-        );
-
         writeDescriptorSets = SDL_stack_alloc(
             VkWriteDescriptorSet,
             resourceLayout->vertexSamplerCount +
@@ -5389,7 +6937,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->vertexResourceDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pBufferInfo = NULL;
 
@@ -5412,7 +6959,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = resourceLayout->vertexSamplerCount + i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->vertexResourceDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pBufferInfo = NULL;
 
@@ -5435,7 +6981,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = resourceLayout->vertexSamplerCount + resourceLayout->vertexStorageTextureCount + i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->vertexResourceDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pImageInfo = NULL;
 
@@ -5448,24 +6993,39 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             bufferInfoCount += 1;
         }
 
-        renderer->vkUpdateDescriptorSets(
-            renderer->logicalDevice,
-            resourceLayout->vertexSamplerCount + resourceLayout->vertexStorageTextureCount + resourceLayout->vertexStorageBufferCount,
-            writeDescriptorSets,
-            0,
-            NULL
-        );
-
-        renderer->vkCmdBindDescriptorSets(
-            commandBuffer->commandBuffer,
-            VK_PIPELINE_BIND_POINT_GRAPHICS,
-            resourceLayout->pipelineLayout,
-            0,
-            1,
-            &commandBuffer->vertexResourceDescriptorSet,
-            0,
-            NULL
-        );
+        if (descriptorSetPool->pushDescriptors)
+        {
+            renderer->vkCmdPushDescriptorSetKHR(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                resourceLayout->pipelineLayout,
+                0,
+                resourceLayout->vertexSamplerCount + resourceLayout->vertexStorageTextureCount + resourceLayout->vertexStorageBufferCount,
+                writeDescriptorSets
+            );
+        }
+        else
+        {
+            commandBuffer->vertexResourceDescriptorSet = VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+                renderer,
+                commandBuffer,
+                descriptorSetPool,
+                &commandBuffer->currentGraphicsPipeline->referenceCount,
+                writeDescriptorSets,
+                resourceLayout->vertexSamplerCount + resourceLayout->vertexStorageTextureCount + resourceLayout->vertexStorageBufferCount
+            );
+
+            renderer->vkCmdBindDescriptorSets(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                resourceLayout->pipelineLayout,
+                0,
+                1,
+                &commandBuffer->vertexResourceDescriptorSet,
+                0,
+                NULL
+            );
+        }
 
         SDL_stack_free(writeDescriptorSets);
         bufferInfoCount = 0;
@@ -5478,12 +7038,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
     {
         descriptorSetPool = &resourceLayout->descriptorSetPools[1];
 
-        commandBuffer->vertexUniformDescriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
-            renderer,
-            commandBuffer,
-            descriptorSetPool
-        );
-
         writeDescriptorSets = SDL_stack_alloc(
             VkWriteDescriptorSet,
             resourceLayout->vertexUniformBufferCount
@@ -5499,25 +7053,25 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->vertexUniformDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pImageInfo = NULL;
 
-            bufferInfos[bufferInfoCount].buffer = commandBuffer->vertexUniformBuffers[i]->bufferContainer->activeBufferHandle->vulkanBuffer->buffer;
+            bufferInfos[bufferInfoCount].buffer = commandBuffer->vertexUniformBuffers[i].buffer->buffer;
             bufferInfos[bufferInfoCount].offset = 0;
-            bufferInfos[bufferInfoCount].range = MAX_UBO_SECTION_SIZE;
+            bufferInfos[bufferInfoCount].range = renderer->maxUniformPushSize;
 
             currentWriteDescriptorSet->pBufferInfo = &bufferInfos[bufferInfoCount];
 
             bufferInfoCount += 1;
         }
 
-        renderer->vkUpdateDescriptorSets(
-            renderer->logicalDevice,
-            resourceLayout->vertexUniformBufferCount,
+        commandBuffer->vertexUniformDescriptorSet = VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+            renderer,
+            commandBuffer,
+            descriptorSetPool,
+            &commandBuffer->currentGraphicsPipeline->referenceCount,
             writeDescriptorSets,
-            0,
-            NULL
+            resourceLayout->vertexUniformBufferCount
         );
 
         SDL_stack_free(writeDescriptorSets);
@@ -5532,7 +7086,7 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
     {
         for (i = 0; i < resourceLayout->vertexUniformBufferCount; i += 1)
         {
-            dynamicOffsets[i] = commandBuffer->vertexUniformBuffers[i]->drawOffset;
+            dynamicOffsets[i] = commandBuffer->vertexUniformBuffers[i].drawOffset;
         }
 
         renderer->vkCmdBindDescriptorSets(
@@ -5553,12 +7107,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
     {
         descriptorSetPool = &resourceLayout->descriptorSetPools[2];
 
-        commandBuffer->fragmentResourceDescriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
-            renderer,
-            commandBuffer,
-            descriptorSetPool
-        );
-
         writeDescriptorSets = SDL_stack_alloc(
             VkWriteDescriptorSet,
             resourceLayout->fragmentSamplerCount +
@@ -5575,7 +7123,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->fragmentResourceDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pBufferInfo = NULL;
 
@@ -5598,7 +7145,6 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = resourceLayout->fragmentSamplerCount + i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->fragmentResourceDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pBufferInfo = NULL;
 
@@ -5618,10 +7164,9 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
             currentWriteDescriptorSet->pNext = NULL;
             currentWriteDescriptorSet->descriptorCount = 1;
-            currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = resourceLayout->fragmentSamplerCount + resourceLayout->fragmentStorageTextureCount + i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->fragmentResourceDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pImageInfo = NULL;
 
@@ -5634,42 +7179,51 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             bufferInfoCount += 1;
         }
 
-        renderer->vkUpdateDescriptorSets(
-            renderer->logicalDevice,
-            resourceLayout->fragmentSamplerCount + resourceLayout->fragmentStorageTextureCount + resourceLayout->fragmentStorageBufferCount,
-            writeDescriptorSets,
-            0,
-            NULL
-        );
+        if (descriptorSetPool->pushDescriptors)
+        {
+            renderer->vkCmdPushDescriptorSetKHR(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                resourceLayout->pipelineLayout,
+                2,
+                resourceLayout->fragmentSamplerCount + resourceLayout->fragmentStorageTextureCount + resourceLayout->fragmentStorageBufferCount,
+                writeDescriptorSets
+            );
+        }
+        else
+        {
+            commandBuffer->fragmentResourceDescriptorSet = VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+                renderer,
+                commandBuffer,
+                descriptorSetPool,
+                &commandBuffer->currentGraphicsPipeline->referenceCount,
+                writeDescriptorSets,
+                resourceLayout->fragmentSamplerCount + resourceLayout->fragmentStorageTextureCount + resourceLayout->fragmentStorageBufferCount
+            );
 
-        renderer->vkCmdBindDescriptorSets(
-            commandBuffer->commandBuffer,
-            VK_PIPELINE_BIND_POINT_GRAPHICS,
-            resourceLayout->pipelineLayout,
-            2,
-            1,
-            &commandBuffer->fragmentResourceDescriptorSet,
-            0,
-            NULL
-        );
+            renderer->vkCmdBindDescriptorSets(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                resourceLayout->pipelineLayout,
+                2,
+                1,
+                &commandBuffer->fragmentResourceDescriptorSet,
+                0,
+                NULL
+            );
+        }
 
         SDL_stack_free(writeDescriptorSets);
         bufferInfoCount = 0;
         imageInfoCount = 0;
 
-        commandBuffer->needNewFragmentResourceDescriptorSet = SDL_TRUE;
+        commandBuffer->needNewFragmentResourceDescriptorSet = SDL_FALSE;
     }
 
     if (commandBuffer->needNewFragmentUniformDescriptorSet)
     {
         descriptorSetPool = &resourceLayout->descriptorSetPools[3];
 
-        commandBuffer->fragmentUniformDescriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
-            renderer,
-            commandBuffer,
-            descriptorSetPool
-        );
-
         writeDescriptorSets = SDL_stack_alloc(
             VkWriteDescriptorSet,
             resourceLayout->fragmentUniformBufferCount
@@ -5685,25 +7239,25 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->fragmentUniformDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pImageInfo = NULL;
 
-            bufferInfos[bufferInfoCount].buffer = commandBuffer->fragmentUniformBuffers[i]->bufferContainer->activeBufferHandle->vulkanBuffer->buffer;
+            bufferInfos[bufferInfoCount].buffer = commandBuffer->fragmentUniformBuffers[i].buffer->buffer;
             bufferInfos[bufferInfoCount].offset = 0;
-            bufferInfos[bufferInfoCount].range = MAX_UBO_SECTION_SIZE;
+            bufferInfos[bufferInfoCount].range = renderer->maxUniformPushSize;
 
             currentWriteDescriptorSet->pBufferInfo = &bufferInfos[bufferInfoCount];
 
             bufferInfoCount += 1;
         }
 
-        renderer->vkUpdateDescriptorSets(
-            renderer->logicalDevice,
-            resourceLayout->fragmentUniformBufferCount,
+        commandBuffer->fragmentUniformDescriptorSet = VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+            renderer,
+            commandBuffer,
+            descriptorSetPool,
+            &commandBuffer->currentGraphicsPipeline->referenceCount,
             writeDescriptorSets,
-            0,
-            NULL
+            resourceLayout->fragmentUniformBufferCount
         );
 
         SDL_stack_free(writeDescriptorSets);
@@ -5718,7 +7272,7 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
     {
         for (i = 0; i < resourceLayout->fragmentUniformBufferCount; i += 1)
         {
-            dynamicOffsets[i] = commandBuffer->fragmentUniformBuffers[i]->drawOffset;
+            dynamicOffsets[i] = commandBuffer->fragmentUniformBuffers[i].drawOffset;
         }
 
         renderer->vkCmdBindDescriptorSets(
@@ -5734,6 +7288,25 @@ static void VULKAN_INTERNAL_BindGraphicsDescriptorSets(
 
         commandBuffer->needNewFragmentUniformOffsets = SDL_FALSE;
     }
+
+    if (
+        commandBuffer->needNewGraphicsBindlessTable &&
+        resourceLayout->useBindlessTable &&
+        commandBuffer->graphicsBindlessTable != NULL
+    ) {
+        renderer->vkCmdBindDescriptorSets(
+            commandBuffer->commandBuffer,
+            VK_PIPELINE_BIND_POINT_GRAPHICS,
+            resourceLayout->pipelineLayout,
+            4,
+            1,
+            &commandBuffer->graphicsBindlessTable->descriptorSet,
+            0,
+            NULL
+        );
+
+        commandBuffer->needNewGraphicsBindlessTable = SDL_FALSE;
+    }
 }
 
 static void VULKAN_DrawIndexedPrimitives(
@@ -5831,6 +7404,78 @@ static void VULKAN_DrawIndexedPrimitivesIndirect(
     VULKAN_INTERNAL_TrackBuffer(renderer, vulkanCommandBuffer, vulkanBuffer);
 }
 
+static void VULKAN_DrawPrimitivesIndirectCount(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer* renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+    VulkanBuffer *vulkanBuffer = ((VulkanBufferContainer*) buffer)->activeBufferHandle->vulkanBuffer;
+    VulkanBuffer *vulkanCountBuffer = ((VulkanBufferContainer*) countBuffer)->activeBufferHandle->vulkanBuffer;
+
+    if (!renderer->supports.KHR_draw_indirect_count)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "DrawPrimitivesIndirectCount requires VK_KHR_draw_indirect_count, check SDL_GpuSupportsIndirectCount!");
+        return;
+    }
+
+    VULKAN_INTERNAL_BindGraphicsDescriptorSets(renderer, vulkanCommandBuffer);
+
+    renderer->vkCmdDrawIndirectCountKHR(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanBuffer->buffer,
+        offsetInBytes,
+        vulkanCountBuffer->buffer,
+        countOffsetInBytes,
+        maxDrawCount,
+        stride
+    );
+
+    VULKAN_INTERNAL_TrackBuffer(renderer, vulkanCommandBuffer, vulkanBuffer);
+    VULKAN_INTERNAL_TrackBuffer(renderer, vulkanCommandBuffer, vulkanCountBuffer);
+}
+
+static void VULKAN_DrawIndexedPrimitivesIndirectCount(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBuffer *buffer,
+    Uint32 offsetInBytes,
+    SDL_GpuBuffer *countBuffer,
+    Uint32 countOffsetInBytes,
+    Uint32 maxDrawCount,
+    Uint32 stride
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer* renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+    VulkanBuffer *vulkanBuffer = ((VulkanBufferContainer*) buffer)->activeBufferHandle->vulkanBuffer;
+    VulkanBuffer *vulkanCountBuffer = ((VulkanBufferContainer*) countBuffer)->activeBufferHandle->vulkanBuffer;
+
+    if (!renderer->supports.KHR_draw_indirect_count)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "DrawIndexedPrimitivesIndirectCount requires VK_KHR_draw_indirect_count, check SDL_GpuSupportsIndirectCount!");
+        return;
+    }
+
+    VULKAN_INTERNAL_BindGraphicsDescriptorSets(renderer, vulkanCommandBuffer);
+
+    renderer->vkCmdDrawIndexedIndirectCountKHR(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanBuffer->buffer,
+        offsetInBytes,
+        vulkanCountBuffer->buffer,
+        countOffsetInBytes,
+        maxDrawCount,
+        stride
+    );
+
+    VULKAN_INTERNAL_TrackBuffer(renderer, vulkanCommandBuffer, vulkanBuffer);
+    VULKAN_INTERNAL_TrackBuffer(renderer, vulkanCommandBuffer, vulkanCountBuffer);
+}
+
 /* Debug Naming */
 
 static void VULKAN_INTERNAL_SetBufferName(
@@ -6040,6 +7685,7 @@ static VulkanTexture* VULKAN_INTERNAL_CreateTexture(
     texture->is3D = 0;
     texture->isRenderTarget = isRenderTarget;
     texture->markedForDestroy = 0;
+    SDL_AtomicSet(&texture->bindlessReferenceCount, 0);
 
     if (isCube)
     {
@@ -6085,9 +7731,11 @@ static VulkanTexture* VULKAN_INTERNAL_CreateTexture(
     imageCreateInfo.samples = VULKAN_INTERNAL_IsVulkanDepthFormat(format) ? sampleCount : VK_SAMPLE_COUNT_1_BIT;
     imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
     imageCreateInfo.usage = vkUsageFlags;
-    imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    imageCreateInfo.queueFamilyIndexCount = 0;
-    imageCreateInfo.pQueueFamilyIndices = NULL;
+    imageCreateInfo.sharingMode = renderer->queueFamilyIndexCount > 1 ?
+        VK_SHARING_MODE_CONCURRENT :
+        VK_SHARING_MODE_EXCLUSIVE;
+    imageCreateInfo.queueFamilyIndexCount = renderer->queueFamilyIndexCount;
+    imageCreateInfo.pQueueFamilyIndices = renderer->queueFamilyIndices;
     imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
     vulkanResult = renderer->vkCreateImage(
@@ -6101,6 +7749,7 @@ static VulkanTexture* VULKAN_INTERNAL_CreateTexture(
     bindResult = VULKAN_INTERNAL_BindMemoryForImage(
         renderer,
         texture->image,
+        isRenderTarget,
         &texture->usedRegion
     );
 
@@ -6844,6 +8493,10 @@ static SDL_GpuGraphicsPipeline* VULKAN_CreateGraphicsPipeline(
     };
     VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo;
 
+    VkPipelineRenderingCreateInfoKHR pipelineRenderingCreateInfo;
+    VkFormat colorAttachmentFormats[MAX_COLOR_TARGET_BINDINGS];
+    VkRenderPass transientRenderPass = VK_NULL_HANDLE;
+
     VulkanRenderer *renderer = (VulkanRenderer*) driverData;
 
     /* Find a compatible sample count to use */
@@ -6853,13 +8506,47 @@ static SDL_GpuGraphicsPipeline* VULKAN_CreateGraphicsPipeline(
         SDLToVK_SampleCount[pipelineCreateInfo->multisampleState.multisampleCount]
     );
 
-    /* Create a "compatible" render pass */
+    if (renderer->supports.KHR_dynamic_rendering)
+    {
+        /* Dynamic rendering only needs the attachment formats */
 
-    VkRenderPass transientRenderPass = VULKAN_INTERNAL_CreateTransientRenderPass(
-        renderer,
-        pipelineCreateInfo->attachmentInfo,
-        actualSampleCount
-    );
+        for (i = 0; i < pipelineCreateInfo->attachmentInfo.colorAttachmentCount; i += 1)
+        {
+            colorAttachmentFormats[i] = SDLToVK_SurfaceFormat[
+                pipelineCreateInfo->attachmentInfo.colorAttachmentDescriptions[i].format
+            ];
+        }
+
+        pipelineRenderingCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        pipelineRenderingCreateInfo.pNext = NULL;
+        pipelineRenderingCreateInfo.viewMask = 0;
+        pipelineRenderingCreateInfo.colorAttachmentCount = pipelineCreateInfo->attachmentInfo.colorAttachmentCount;
+        pipelineRenderingCreateInfo.pColorAttachmentFormats = colorAttachmentFormats;
+        pipelineRenderingCreateInfo.depthAttachmentFormat = VK_FORMAT_UNDEFINED;
+        pipelineRenderingCreateInfo.stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+
+        if (pipelineCreateInfo->attachmentInfo.hasDepthStencilAttachment)
+        {
+            pipelineRenderingCreateInfo.depthAttachmentFormat =
+                SDLToVK_SurfaceFormat[pipelineCreateInfo->attachmentInfo.depthStencilFormat];
+
+            if (IsStencilFormat(pipelineCreateInfo->attachmentInfo.depthStencilFormat))
+            {
+                pipelineRenderingCreateInfo.stencilAttachmentFormat =
+                    pipelineRenderingCreateInfo.depthAttachmentFormat;
+            }
+        }
+    }
+    else
+    {
+        /* Create a "compatible" render pass */
+
+        transientRenderPass = VULKAN_INTERNAL_CreateTransientRenderPass(
+            renderer,
+            pipelineCreateInfo->attachmentInfo,
+            actualSampleCount
+        );
+    }
 
     /* Dynamic state */
 
@@ -7127,6 +8814,18 @@ static SDL_GpuGraphicsPipeline* VULKAN_CreateGraphicsPipeline(
 
     /* Pipeline Layout */
 
+    graphicsPipeline->resourceLayout.useBindlessTable = pipelineCreateInfo->useBindlessTable;
+    if (pipelineCreateInfo->useBindlessTable && renderer->bindlessDescriptorSetLayout == VK_NULL_HANDLE)
+    {
+        SDL_stack_free(vertexInputBindingDescriptions);
+        SDL_stack_free(vertexInputAttributeDescriptions);
+        SDL_stack_free(colorBlendAttachmentStates);
+        SDL_stack_free(divisorDescriptions);
+        SDL_free(graphicsPipeline);
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless tables are not supported on this device!");
+        return NULL;
+    }
+
     if (!VULKAN_INTERNAL_InitializeGraphicsPipelineResourceLayout(
         renderer,
         &pipelineCreateInfo->vertexResourceInfo,
@@ -7145,7 +8844,9 @@ static SDL_GpuGraphicsPipeline* VULKAN_CreateGraphicsPipeline(
     /* Pipeline */
 
     vkPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    vkPipelineCreateInfo.pNext = NULL;
+    vkPipelineCreateInfo.pNext = renderer->supports.KHR_dynamic_rendering ?
+        &pipelineRenderingCreateInfo :
+        NULL;
     vkPipelineCreateInfo.flags = 0;
     vkPipelineCreateInfo.stageCount = 2;
     vkPipelineCreateInfo.pStages = shaderStageCreateInfos;
@@ -7164,10 +8865,9 @@ static SDL_GpuGraphicsPipeline* VULKAN_CreateGraphicsPipeline(
     vkPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
     vkPipelineCreateInfo.basePipelineIndex = 0;
 
-    /* TODO: enable pipeline caching */
     vulkanResult = renderer->vkCreateGraphicsPipelines(
         renderer->logicalDevice,
-        VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkPipelineCreateInfo,
         NULL,
@@ -7179,11 +8879,14 @@ static SDL_GpuGraphicsPipeline* VULKAN_CreateGraphicsPipeline(
     SDL_stack_free(colorBlendAttachmentStates);
     SDL_stack_free(divisorDescriptions);
 
-    renderer->vkDestroyRenderPass(
-        renderer->logicalDevice,
-        transientRenderPass,
-        NULL
-    );
+    if (transientRenderPass != VK_NULL_HANDLE)
+    {
+        renderer->vkDestroyRenderPass(
+            renderer->logicalDevice,
+            transientRenderPass,
+            NULL
+        );
+    }
 
     if (vulkanResult != VK_SUCCESS)
     {
@@ -7219,6 +8922,14 @@ static SDL_GpuComputePipeline* VULKAN_CreateComputePipeline(
     pipelineShaderStageCreateInfo.pName = vulkanComputePipeline->computeShader->entryPointName;
     pipelineShaderStageCreateInfo.pSpecializationInfo = NULL;
 
+    vulkanComputePipeline->resourceLayout.useBindlessTable = pipelineCreateInfo->useBindlessTable;
+    if (pipelineCreateInfo->useBindlessTable && renderer->bindlessDescriptorSetLayout == VK_NULL_HANDLE)
+    {
+        SDL_free(vulkanComputePipeline);
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless tables are not supported on this device!");
+        return NULL;
+    }
+
     if (!VULKAN_INTERNAL_InitializeComputePipelineResourceLayout(
         renderer,
         &pipelineCreateInfo->pipelineResourceInfo,
@@ -7240,7 +8951,7 @@ static SDL_GpuComputePipeline* VULKAN_CreateComputePipeline(
 
     renderer->vkCreateComputePipelines(
         renderer->logicalDevice,
-        (VkPipelineCache) VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &computePipelineCreateInfo,
         NULL,
@@ -7417,7 +9128,8 @@ static SDL_GpuTexture* VULKAN_CreateTexture(
     }
 
     container = SDL_malloc(sizeof(VulkanTextureContainer));
-    container->canBeCycled = 1;
+    container->canBeCycled = !(textureCreateInfo->usageFlags & SDL_GPU_TEXTUREUSAGE_TRANSIENT_BIT);
+    container->format = textureCreateInfo->format;
     container->activeTextureHandle = textureHandle;
     container->textureCapacity = 1;
     container->textureCount = 1 ;
@@ -7445,25 +9157,6 @@ static SDL_GpuBuffer* VULKAN_CreateBuffer(
     );
 }
 
-static VulkanUniformBuffer* VULKAN_INTERNAL_CreateUniformBuffer(
-    VulkanRenderer *renderer,
-    Uint32 sizeInBytes
-) {
-    VulkanUniformBuffer *uniformBuffer = SDL_malloc(sizeof(VulkanUniformBuffer));
-
-    uniformBuffer->bufferContainer = VULKAN_INTERNAL_CreateBufferContainer(
-        renderer,
-        sizeInBytes,
-        0,
-        VULKAN_BUFFER_TYPE_UNIFORM
-    );
-
-    uniformBuffer->drawOffset = 0;
-    uniformBuffer->offset = 0;
-
-    return uniformBuffer;
-}
-
 static SDL_GpuTransferBuffer* VULKAN_CreateTransferBuffer(
     SDL_GpuRenderer *driverData,
     SDL_GpuTransferUsage usage, /* ignored on Vulkan */
@@ -7660,6 +9353,12 @@ static void VULKAN_ReleaseComputePipeline(
 ) {
     VulkanRenderer *renderer = (VulkanRenderer*) driverData;
     VulkanComputePipeline *vulkanComputePipeline = (VulkanComputePipeline*) computePipeline;
+    Uint32 i;
+
+    for (i = 0; i < SDL_arraysize(vulkanComputePipeline->resourceLayout.descriptorSetPools); i += 1)
+    {
+        SDL_AtomicSet(&vulkanComputePipeline->resourceLayout.descriptorSetPools[i].released, 1);
+    }
 
     SDL_LockMutex(renderer->disposeLock);
 
@@ -7683,6 +9382,12 @@ static void VULKAN_ReleaseGraphicsPipeline(
 ) {
     VulkanRenderer *renderer = (VulkanRenderer*) driverData;
     VulkanGraphicsPipeline *vulkanGraphicsPipeline = (VulkanGraphicsPipeline*) graphicsPipeline;
+    Uint32 i;
+
+    for (i = 0; i < SDL_arraysize(vulkanGraphicsPipeline->resourceLayout.descriptorSetPools); i += 1)
+    {
+        SDL_AtomicSet(&vulkanGraphicsPipeline->resourceLayout.descriptorSetPools[i].released, 1);
+    }
 
     SDL_LockMutex(renderer->disposeLock);
 
@@ -7717,6 +9422,25 @@ static void VULKAN_ReleaseOcclusionQuery(
     SDL_UnlockMutex(renderer->queryLock);
 }
 
+static void VULKAN_ReleaseTimestampQuery(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTimestampQuery *query
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VulkanTimestampQuery *vulkanQuery = (VulkanTimestampQuery*) query;
+
+    SDL_LockMutex(renderer->queryLock);
+
+    /* Push the now-free index to the stack */
+    renderer->freeTimestampQueryIndexStack[vulkanQuery->index] =
+        renderer->freeTimestampQueryIndexStackHead;
+    renderer->freeTimestampQueryIndexStackHead = vulkanQuery->index;
+
+    SDL_UnlockMutex(renderer->queryLock);
+
+    SDL_free(vulkanQuery);
+}
+
 /* Command Buffer render state */
 
 static VkRenderPass VULKAN_INTERNAL_FetchRenderPass(
@@ -7735,7 +9459,6 @@ static VkRenderPass VULKAN_INTERNAL_FetchRenderPass(
     for (i = 0; i < colorAttachmentCount; i += 1)
     {
         hash.colorTargetDescriptions[i].format = ((VulkanTextureContainer*) colorAttachmentInfos[i].textureSlice.texture)->activeTextureHandle->vulkanTexture->format;
-        hash.colorTargetDescriptions[i].clearColor = colorAttachmentInfos[i].clearColor;
         hash.colorTargetDescriptions[i].loadOp = colorAttachmentInfos[i].loadOp;
         hash.colorTargetDescriptions[i].storeOp = colorAttachmentInfos[i].storeOp;
     }
@@ -7765,17 +9488,20 @@ static VkRenderPass VULKAN_INTERNAL_FetchRenderPass(
         hash.depthStencilTargetDescription.stencilStoreOp = depthStencilAttachmentInfo->stencilStoreOp;
     }
 
-    renderPass = RenderPassHashArray_Fetch(
-        &renderer->renderPassHashArray,
+    renderPass = RenderPassHashTable_Fetch(
+        &renderer->renderPassHashTable,
         &hash
     );
 
     if (renderPass != VK_NULL_HANDLE)
     {
         SDL_UnlockMutex(renderer->renderPassFetchLock);
+        commandBuffer->common.stats.renderPassCacheHits += 1;
         return renderPass;
     }
 
+    commandBuffer->common.stats.renderPassCacheMisses += 1;
+
     renderPass = VULKAN_INTERNAL_CreateRenderPass(
         renderer,
         commandBuffer,
@@ -7786,8 +9512,8 @@ static VkRenderPass VULKAN_INTERNAL_FetchRenderPass(
 
     if (renderPass != VK_NULL_HANDLE)
     {
-        RenderPassHashArray_Insert(
-            &renderer->renderPassHashArray,
+        RenderPassHashTable_Insert(
+            &renderer->renderPassHashTable,
             hash,
             renderPass
         );
@@ -7799,6 +9525,7 @@ static VkRenderPass VULKAN_INTERNAL_FetchRenderPass(
 
 static VulkanFramebuffer* VULKAN_INTERNAL_FetchFramebuffer(
     VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
     VkRenderPass renderPass,
     SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
     Uint32 colorAttachmentCount,
@@ -7850,18 +9577,22 @@ static VulkanFramebuffer* VULKAN_INTERNAL_FetchFramebuffer(
 
     SDL_LockMutex(renderer->framebufferFetchLock);
 
-    vulkanFramebuffer = FramebufferHashArray_Fetch(
-        &renderer->framebufferHashArray,
-        &hash
+    vulkanFramebuffer = FramebufferHashTable_Fetch(
+        &renderer->framebufferHashTable,
+        &hash,
+        (Uint32) SDL_AtomicGet(&renderer->submitCounter)
     );
 
     SDL_UnlockMutex(renderer->framebufferFetchLock);
 
     if (vulkanFramebuffer != NULL)
     {
+        commandBuffer->common.stats.framebufferCacheHits += 1;
         return vulkanFramebuffer;
     }
 
+    commandBuffer->common.stats.framebufferCacheMisses += 1;
+
     vulkanFramebuffer = SDL_malloc(sizeof(VulkanFramebuffer));
 
     SDL_AtomicSet(&vulkanFramebuffer->referenceCount, 0);
@@ -7917,10 +9648,11 @@ static VulkanFramebuffer* VULKAN_INTERNAL_FetchFramebuffer(
     {
         SDL_LockMutex(renderer->framebufferFetchLock);
 
-        FramebufferHashArray_Insert(
-            &renderer->framebufferHashArray,
+        FramebufferHashTable_Insert(
+            &renderer->framebufferHashTable,
             hash,
-            vulkanFramebuffer
+            vulkanFramebuffer,
+            (Uint32) SDL_AtomicGet(&renderer->submitCounter)
         );
 
         SDL_UnlockMutex(renderer->framebufferFetchLock);
@@ -8194,47 +9926,215 @@ static void VULKAN_BindFragmentStorageBuffers(
     vulkanCommandBuffer->needNewFragmentResourceDescriptorSet = SDL_TRUE;
 }
 
-static void VULKAN_INTERNAL_PushUniformData(
+static void VULKAN_BindGraphicsBindlessTable(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanBindlessTable *vulkanBindlessTable = (VulkanBindlessTable*) bindlessTable;
+
+    /* The table's own references keep its textures alive while we keep the table alive */
+    VULKAN_INTERNAL_TrackBindlessTable(renderer, vulkanCommandBuffer, vulkanBindlessTable);
+
+    vulkanCommandBuffer->graphicsBindlessTable = vulkanBindlessTable;
+    vulkanCommandBuffer->needNewGraphicsBindlessTable = SDL_TRUE;
+}
+
+static SDL_bool VULKAN_INTERNAL_AcquireUniformBlock(
     VulkanRenderer *renderer,
-    VulkanCommandBuffer *commandBuffer,
-    VulkanUniformBuffer *uniformBuffer,
-    SDL_GpuShaderStage shaderStage,
-    void *data,
-    Uint32 dataLengthInBytes
+    VulkanCommandBuffer *commandBuffer
 ) {
-    Uint32 blockSize =
-        VULKAN_INTERNAL_NextHighestAlignment32(
-            dataLengthInBytes,
-            renderer->minUBOAlignment
-        );
+    VulkanBuffer *page;
+    Uint32 i;
 
-    /* If there is no more room, cycle the uniform buffer */
-    if (uniformBuffer->offset + blockSize + MAX_UBO_SECTION_SIZE >= uniformBuffer->bufferContainer->activeBufferHandle->vulkanBuffer->size)
+    SDL_LockMutex(renderer->uniformArenaLock);
+
+    if (renderer->availableUniformBlockCount == 0)
     {
-        VULKAN_INTERNAL_CycleActiveBuffer(
+        /* Pages are padded so a full-range binding at the last block stays in bounds */
+        page = VULKAN_INTERNAL_CreateBuffer(
             renderer,
-            uniformBuffer->bufferContainer
+            (UNIFORM_ARENA_BLOCK_SIZE * UNIFORM_ARENA_BLOCKS_PER_PAGE) + renderer->maxUniformPushSize,
+            0,
+            VULKAN_BUFFER_TYPE_UNIFORM
+        );
+
+        if (page == NULL)
+        {
+            SDL_UnlockMutex(renderer->uniformArenaLock);
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create uniform arena page!");
+            return SDL_FALSE;
+        }
+
+        EXPAND_ARRAY_IF_NEEDED(
+            renderer->uniformArenaPages,
+            VulkanBuffer*,
+            renderer->uniformArenaPageCount + 1,
+            renderer->uniformArenaPageCapacity,
+            renderer->uniformArenaPageCapacity * 2
         );
 
-        uniformBuffer->drawOffset = 0;
-        uniformBuffer->offset = 0;
+        renderer->uniformArenaPages[renderer->uniformArenaPageCount] = page;
+        renderer->uniformArenaPageCount += 1;
 
-        VULKAN_INTERNAL_TrackBuffer(
-            renderer,
-            commandBuffer,
-            uniformBuffer->bufferContainer->activeBufferHandle->vulkanBuffer
+        EXPAND_ARRAY_IF_NEEDED(
+            renderer->availableUniformBlocks,
+            VulkanUniformBlock,
+            renderer->availableUniformBlockCount + UNIFORM_ARENA_BLOCKS_PER_PAGE,
+            renderer->availableUniformBlockCapacity,
+            renderer->availableUniformBlockCapacity + UNIFORM_ARENA_BLOCKS_PER_PAGE
         );
 
-        if (shaderStage == SDL_GPU_SHADERSTAGE_VERTEX)
-        {
-            commandBuffer->needNewVertexUniformDescriptorSet = SDL_TRUE;
-        }
-        else if (shaderStage == SDL_GPU_SHADERSTAGE_FRAGMENT)
+        /* Push in reverse so blocks are handed out front to back */
+        for (i = UNIFORM_ARENA_BLOCKS_PER_PAGE; i > 0; i -= 1)
         {
-            commandBuffer->needNewFragmentUniformDescriptorSet = SDL_TRUE;
+            renderer->availableUniformBlocks[renderer->availableUniformBlockCount].buffer = page;
+            renderer->availableUniformBlocks[renderer->availableUniformBlockCount].offset = (i - 1) * UNIFORM_ARENA_BLOCK_SIZE;
+            renderer->availableUniformBlockCount += 1;
         }
-        else if (shaderStage == SDL_GPU_SHADERSTAGE_COMPUTE)
-        {
+    }
+
+    renderer->availableUniformBlockCount -= 1;
+
+    EXPAND_ARRAY_IF_NEEDED(
+        commandBuffer->uniformBlocks,
+        VulkanUniformBlock,
+        commandBuffer->uniformBlockCount + 1,
+        commandBuffer->uniformBlockCapacity,
+        commandBuffer->uniformBlockCapacity * 2
+    );
+
+    commandBuffer->uniformBlocks[commandBuffer->uniformBlockCount] =
+        renderer->availableUniformBlocks[renderer->availableUniformBlockCount];
+    commandBuffer->uniformBlockCount += 1;
+    commandBuffer->uniformBlockCursor = 0;
+
+    SDL_UnlockMutex(renderer->uniformArenaLock);
+
+    return SDL_TRUE;
+}
+
+static void VULKAN_INTERNAL_ReturnUniformBlocks(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    if (commandBuffer->uniformBlockCount == 0)
+    {
+        return;
+    }
+
+    SDL_LockMutex(renderer->uniformArenaLock);
+
+    EXPAND_ARRAY_IF_NEEDED(
+        renderer->availableUniformBlocks,
+        VulkanUniformBlock,
+        renderer->availableUniformBlockCount + commandBuffer->uniformBlockCount,
+        renderer->availableUniformBlockCapacity,
+        renderer->availableUniformBlockCapacity + commandBuffer->uniformBlockCount
+    );
+
+    SDL_memcpy(
+        &renderer->availableUniformBlocks[renderer->availableUniformBlockCount],
+        commandBuffer->uniformBlocks,
+        commandBuffer->uniformBlockCount * sizeof(VulkanUniformBlock)
+    );
+    renderer->availableUniformBlockCount += commandBuffer->uniformBlockCount;
+
+    SDL_UnlockMutex(renderer->uniformArenaLock);
+
+    commandBuffer->uniformBlockCount = 0;
+    commandBuffer->uniformBlockCursor = 0;
+}
+
+/* Points any slot that hasn't been pushed to yet at valid memory,
+ * the shader can't read garbage handles even if the client never pushes.
+ */
+static void VULKAN_INTERNAL_InitializeUniformBuffers(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VulkanUniformBuffer *uniformBuffers,
+    Uint32 uniformBufferCount
+) {
+    VulkanUniformBlock *block;
+    Uint32 i;
+
+    for (i = 0; i < uniformBufferCount; i += 1)
+    {
+        if (uniformBuffers[i].buffer != NULL)
+        {
+            continue;
+        }
+
+        if (commandBuffer->uniformBlockCount == 0)
+        {
+            if (!VULKAN_INTERNAL_AcquireUniformBlock(renderer, commandBuffer))
+            {
+                return;
+            }
+        }
+
+        block = &commandBuffer->uniformBlocks[commandBuffer->uniformBlockCount - 1];
+        uniformBuffers[i].buffer = block->buffer;
+        uniformBuffers[i].drawOffset = block->offset;
+    }
+}
+
+static void VULKAN_INTERNAL_PushUniformData(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VulkanUniformBuffer *uniformBuffer,
+    SDL_GpuShaderStage shaderStage,
+    void *data,
+    Uint32 dataLengthInBytes
+) {
+    VulkanUniformBlock *block;
+    Uint8 *dst;
+    Uint32 blockSize =
+        VULKAN_INTERNAL_NextHighestAlignment32(
+            dataLengthInBytes,
+            renderer->minUBOAlignment
+        );
+
+    if (dataLengthInBytes > renderer->maxUniformPushSize)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Uniform push of %u bytes exceeds the maximum of %u bytes!",
+            dataLengthInBytes,
+            renderer->maxUniformPushSize
+        );
+        return;
+    }
+
+    /* If there is no more room, check out another block from the arena */
+    if (
+        commandBuffer->uniformBlockCount == 0 ||
+        commandBuffer->uniformBlockCursor + blockSize > UNIFORM_ARENA_BLOCK_SIZE
+    ) {
+        if (!VULKAN_INTERNAL_AcquireUniformBlock(renderer, commandBuffer))
+        {
+            return;
+        }
+    }
+
+    block = &commandBuffer->uniformBlocks[commandBuffer->uniformBlockCount - 1];
+
+    /* Dynamic offsets cover moves within a page, a new page needs a new descriptor */
+    if (uniformBuffer->buffer != block->buffer)
+    {
+        uniformBuffer->buffer = block->buffer;
+
+        if (shaderStage == SDL_GPU_SHADERSTAGE_VERTEX)
+        {
+            commandBuffer->needNewVertexUniformDescriptorSet = SDL_TRUE;
+        }
+        else if (shaderStage == SDL_GPU_SHADERSTAGE_FRAGMENT)
+        {
+            commandBuffer->needNewFragmentUniformDescriptorSet = SDL_TRUE;
+        }
+        else if (shaderStage == SDL_GPU_SHADERSTAGE_COMPUTE)
+        {
             commandBuffer->needNewComputeUniformDescriptorSet = SDL_TRUE;
         }
         else
@@ -8244,12 +10144,12 @@ static void VULKAN_INTERNAL_PushUniformData(
         }
     }
 
-    uniformBuffer->drawOffset = uniformBuffer->offset;
+    uniformBuffer->drawOffset = block->offset + commandBuffer->uniformBlockCursor;
 
-    Uint8 *dst =
-        uniformBuffer->bufferContainer->activeBufferHandle->vulkanBuffer->usedRegion->allocation->mapPointer +
-        uniformBuffer->bufferContainer->activeBufferHandle->vulkanBuffer->usedRegion->resourceOffset +
-        uniformBuffer->offset;
+    dst =
+        block->buffer->usedRegion->allocation->mapPointer +
+        block->buffer->usedRegion->resourceOffset +
+        uniformBuffer->drawOffset;
 
     SDL_memcpy(
         dst,
@@ -8257,7 +10157,7 @@ static void VULKAN_INTERNAL_PushUniformData(
         dataLengthInBytes
     );
 
-    uniformBuffer->offset += blockSize;
+    commandBuffer->uniformBlockCursor += blockSize;
 
     if (shaderStage == SDL_GPU_SHADERSTAGE_VERTEX)
     {
@@ -8278,161 +10178,171 @@ static void VULKAN_INTERNAL_PushUniformData(
     }
 }
 
-static void VULKAN_BeginRenderPass(
-    SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
-    Uint32 colorAttachmentCount,
-    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+/* Pass Timing */
+
+static void VULKAN_INTERNAL_BeginPassTiming(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    SDL_GpuPassType passType
 ) {
-    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
-    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
-    VkRenderPass renderPass;
-    VulkanFramebuffer *framebuffer;
+    if (
+        !commandBuffer->passTimingEnabled ||
+        commandBuffer->passTimingCount == SDL_GPU_MAX_TIMED_PASSES
+    ) {
+        return;
+    }
 
-    VulkanTextureContainer *textureContainer;
-    VulkanTextureSlice *textureSlice;
-    Uint32 w, h;
-    VkClearValue *clearValues;
-    Uint32 clearCount = colorAttachmentCount;
-    Uint32 multisampleAttachmentCount = 0;
-    Uint32 totalColorAttachmentCount = 0;
-    Uint32 i;
-    SDL_GpuViewport defaultViewport;
-    SDL_GpuRect defaultScissor;
-    Uint32 framebufferWidth = UINT32_MAX;
-    Uint32 framebufferHeight = UINT32_MAX;
+    commandBuffer->passTimingTypes[commandBuffer->passTimingCount] = passType;
 
-    for (i = 0; i < colorAttachmentCount; i += 1)
-    {
-        textureContainer = (VulkanTextureContainer*) colorAttachmentInfos[i].textureSlice.texture;
+    /* Top of pipe, so the pass barriers are included in the duration */
+    renderer->vkCmdWriteTimestamp(
+        commandBuffer->commandBuffer,
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        commandBuffer->passTimingQueryPool,
+        commandBuffer->passTimingCount * 2
+    );
+}
 
-        w = textureContainer->activeTextureHandle->vulkanTexture->dimensions.width >> colorAttachmentInfos[i].textureSlice.mipLevel;
-        h = textureContainer->activeTextureHandle->vulkanTexture->dimensions.height >> colorAttachmentInfos[i].textureSlice.mipLevel;
+static void VULKAN_INTERNAL_EndPassTiming(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    if (
+        !commandBuffer->passTimingEnabled ||
+        commandBuffer->passTimingCount == SDL_GPU_MAX_TIMED_PASSES
+    ) {
+        return;
+    }
 
-        /* The framebuffer cannot be larger than the smallest attachment. */
+    renderer->vkCmdWriteTimestamp(
+        commandBuffer->commandBuffer,
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+        commandBuffer->passTimingQueryPool,
+        commandBuffer->passTimingCount * 2 + 1
+    );
 
-        if (w < framebufferWidth)
-        {
-            framebufferWidth = w;
-        }
+    commandBuffer->passTimingCount += 1;
+}
 
-        if (h < framebufferHeight)
-        {
-            framebufferHeight = h;
-        }
+/* Called once the command buffer has finished executing */
+static void VULKAN_INTERNAL_ResolvePassTimings(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    Uint64 timestamps[SDL_GPU_MAX_TIMED_PASSES * 2];
+    VulkanFenceHandle *fenceHandle = commandBuffer->inFlightFence;
+    VkResult vulkanResult;
+    Uint32 i;
 
-        if (!textureContainer->activeTextureHandle->vulkanTexture->isRenderTarget)
-        {
-            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Color attachment texture was not designated as a target!");
-            return;
-        }
+    if (commandBuffer->passTimingCount == 0)
+    {
+        return;
     }
 
-    if (depthStencilAttachmentInfo != NULL)
+    vulkanResult = renderer->vkGetQueryPoolResults(
+        renderer->logicalDevice,
+        commandBuffer->passTimingQueryPool,
+        0,
+        commandBuffer->passTimingCount * 2,
+        sizeof(Uint64) * commandBuffer->passTimingCount * 2,
+        timestamps,
+        sizeof(Uint64),
+        VK_QUERY_RESULT_64_BIT
+    );
+    VULKAN_ERROR_CHECK(vulkanResult, vkGetQueryPoolResults, )
+
+    for (i = 0; i < commandBuffer->passTimingCount; i += 1)
     {
-        textureContainer = (VulkanTextureContainer*) depthStencilAttachmentInfo->textureSlice.texture;
+        fenceHandle->passTimings[i].passType = commandBuffer->passTimingTypes[i];
+        fenceHandle->passTimings[i].durationNanoseconds = (Uint64) (
+            (double) ((timestamps[i * 2 + 1] - timestamps[i * 2]) & renderer->timestampMask) *
+            renderer->timestampPeriod
+        );
+    }
 
-        w = textureContainer->activeTextureHandle->vulkanTexture->dimensions.width >> depthStencilAttachmentInfo->textureSlice.mipLevel;
-        h = textureContainer->activeTextureHandle->vulkanTexture->dimensions.height >> depthStencilAttachmentInfo->textureSlice.mipLevel;
+    fenceHandle->passTimingCount = commandBuffer->passTimingCount;
+}
 
-        /* The framebuffer cannot be larger than the smallest attachment. */
+/* Pipeline Statistics */
 
-        if (w < framebufferWidth)
-        {
-            framebufferWidth = w;
-        }
+/* Called with the submit lock held once the command buffer has finished executing */
+static void VULKAN_INTERNAL_ResolvePipelineStatistics(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    Uint64 results[5];
+    VkResult vulkanResult;
 
-        if (h < framebufferHeight)
-        {
-            framebufferHeight = h;
-        }
+    /* Dedicated compute queues only collect the compute statistic */
+    if (commandBuffer->commandPool->queue != renderer->unifiedQueue)
+    {
+        vulkanResult = renderer->vkGetQueryPoolResults(
+            renderer->logicalDevice,
+            commandBuffer->pipelineStatisticsQueryPool,
+            0,
+            1,
+            sizeof(Uint64),
+            results,
+            sizeof(Uint64),
+            VK_QUERY_RESULT_64_BIT
+        );
+        VULKAN_ERROR_CHECK(vulkanResult, vkGetQueryPoolResults, )
 
-        if (!textureContainer->activeTextureHandle->vulkanTexture->isRenderTarget)
-        {
-            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Depth stencil attachment texture was not designated as a target!");
-            return;
-        }
+        renderer->frameStats.computeShaderInvocations += results[0];
+        return;
     }
 
-    /* Layout transitions */
+    vulkanResult = renderer->vkGetQueryPoolResults(
+        renderer->logicalDevice,
+        commandBuffer->pipelineStatisticsQueryPool,
+        0,
+        1,
+        sizeof(results),
+        results,
+        sizeof(results),
+        VK_QUERY_RESULT_64_BIT
+    );
+    VULKAN_ERROR_CHECK(vulkanResult, vkGetQueryPoolResults, )
 
-    for (i = 0; i < colorAttachmentCount; i += 1)
-    {
-        SDL_bool cycle;
-        if (colorAttachmentInfos[i].loadOp)
-        {
-            cycle = SDL_FALSE;
-        }
-        else
-        {
-            cycle = colorAttachmentInfos[i].cycle;
-        }
+    renderer->frameStats.inputAssemblyVertices += results[0];
+    renderer->frameStats.vertexShaderInvocations += results[1];
+    renderer->frameStats.clippingPrimitives += results[2];
+    renderer->frameStats.fragmentShaderInvocations += results[3];
+    renderer->frameStats.computeShaderInvocations += results[4];
+}
 
-        textureContainer = (VulkanTextureContainer*) colorAttachmentInfos[i].textureSlice.texture;
-        textureSlice = VULKAN_INTERNAL_PrepareTextureSliceForWrite(
-            renderer,
-            vulkanCommandBuffer,
-            textureContainer,
-            colorAttachmentInfos[i].textureSlice.layer,
-            colorAttachmentInfos[i].textureSlice.mipLevel,
-            cycle,
-            VULKAN_TEXTURE_USAGE_MODE_COLOR_ATTACHMENT
-        );
+static void VULKAN_INTERNAL_BeginCachedRenderPass(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *vulkanCommandBuffer,
+    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+    Uint32 colorAttachmentCount,
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo,
+    Uint32 framebufferWidth,
+    Uint32 framebufferHeight,
+    SDL_bool subPassContents
+) {
+    VkRenderPass renderPass;
+    VulkanFramebuffer *framebuffer;
+    VulkanTextureSlice *textureSlice;
+    VkClearValue *clearValues;
+    Uint32 clearCount = colorAttachmentCount;
+    Uint32 multisampleAttachmentCount = 0;
+    Uint32 totalColorAttachmentCount = 0;
+    Uint32 i;
 
-        if (textureSlice->msaaTexHandle != NULL)
+    for (i = 0; i < colorAttachmentCount; i += 1)
+    {
+        if (vulkanCommandBuffer->colorAttachmentSlices[i]->msaaTexHandle != NULL)
         {
-            /* Transition the multisample attachment */
-            VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
-                renderer,
-                vulkanCommandBuffer,
-                VULKAN_TEXTURE_USAGE_MODE_COLOR_ATTACHMENT,
-                &textureSlice->msaaTexHandle->vulkanTexture->slices[0]
-            );
-
             clearCount += 1;
             multisampleAttachmentCount += 1;
         }
-
-        vulkanCommandBuffer->colorAttachmentSlices[i] = textureSlice;
-
-        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, textureSlice);
-        /* TODO: do we need to track the msaa texture? or is it implicitly only used when the regular texture is used? */
     }
 
-    vulkanCommandBuffer->colorAttachmentSliceCount = colorAttachmentCount;
-
     if (depthStencilAttachmentInfo != NULL)
     {
-        SDL_bool cycle;
-
-        if (
-            depthStencilAttachmentInfo->loadOp == SDL_GPU_LOADOP_LOAD ||
-            depthStencilAttachmentInfo->stencilLoadOp == SDL_GPU_LOADOP_LOAD
-        ) {
-            cycle = SDL_FALSE;
-        }
-        else
-        {
-            cycle = depthStencilAttachmentInfo->cycle;
-        }
-
-        textureContainer = (VulkanTextureContainer*) depthStencilAttachmentInfo->textureSlice.texture;
-        textureSlice = VULKAN_INTERNAL_PrepareTextureSliceForWrite(
-            renderer,
-            vulkanCommandBuffer,
-            textureContainer,
-            depthStencilAttachmentInfo->textureSlice.layer,
-            depthStencilAttachmentInfo->textureSlice.mipLevel,
-            cycle,
-            VULKAN_TEXTURE_USAGE_MODE_DEPTH_STENCIL_ATTACHMENT
-        );
-
-        clearCount += 1;
-
-        vulkanCommandBuffer->depthStencilAttachmentSlice = textureSlice;
-
-        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, textureSlice);
-    }
+        clearCount += 1;
+    }
 
     /* Fetch required render objects */
 
@@ -8446,6 +10356,7 @@ static void VULKAN_BeginRenderPass(
 
     framebuffer = VULKAN_INTERNAL_FetchFramebuffer(
         renderer,
+        vulkanCommandBuffer,
         renderPass,
         colorAttachmentInfos,
         colorAttachmentCount,
@@ -8456,6 +10367,9 @@ static void VULKAN_BeginRenderPass(
 
     VULKAN_INTERNAL_TrackFramebuffer(renderer, vulkanCommandBuffer, framebuffer);
 
+    vulkanCommandBuffer->currentRenderPass = renderPass;
+    vulkanCommandBuffer->currentFramebuffer = framebuffer->framebuffer;
+
     /* Set clear values */
 
     clearValues = SDL_stack_alloc(VkClearValue, clearCount);
@@ -8501,15 +10415,296 @@ static void VULKAN_BeginRenderPass(
     renderPassBeginInfo.renderArea.offset.x = 0;
     renderPassBeginInfo.renderArea.offset.y = 0;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdBeginRenderPass(
         vulkanCommandBuffer->commandBuffer,
         &renderPassBeginInfo,
-        VK_SUBPASS_CONTENTS_INLINE
+        subPassContents ?
+            VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS :
+            VK_SUBPASS_CONTENTS_INLINE
     );
 
     SDL_stack_free(clearValues);
+}
+
+static void VULKAN_INTERNAL_BeginDynamicRendering(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *vulkanCommandBuffer,
+    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+    Uint32 colorAttachmentCount,
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo,
+    Uint32 framebufferWidth,
+    Uint32 framebufferHeight,
+    SDL_bool subPassContents
+) {
+    VkRenderingAttachmentInfoKHR colorAttachments[MAX_COLOR_TARGET_BINDINGS];
+    VkRenderingAttachmentInfoKHR depthAttachment;
+    VkRenderingAttachmentInfoKHR stencilAttachment;
+    VkRenderingInfoKHR renderingInfo;
+    VulkanTextureSlice *textureSlice;
+    Uint32 i;
+
+    for (i = 0; i < colorAttachmentCount; i += 1)
+    {
+        textureSlice = vulkanCommandBuffer->colorAttachmentSlices[i];
+
+        colorAttachments[i].sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        colorAttachments[i].pNext = NULL;
+        colorAttachments[i].imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        colorAttachments[i].loadOp = SDLToVK_LoadOp[colorAttachmentInfos[i].loadOp];
+        colorAttachments[i].clearValue.color.float32[0] = colorAttachmentInfos[i].clearColor.r;
+        colorAttachments[i].clearValue.color.float32[1] = colorAttachmentInfos[i].clearColor.g;
+        colorAttachments[i].clearValue.color.float32[2] = colorAttachmentInfos[i].clearColor.b;
+        colorAttachments[i].clearValue.color.float32[3] = colorAttachmentInfos[i].clearColor.a;
+
+        if (textureSlice->msaaTexHandle != NULL)
+        {
+            /* Render into the multisample texture, resolve into the target */
+            colorAttachments[i].imageView = textureSlice->msaaTexHandle->vulkanTexture->view;
+            colorAttachments[i].storeOp = SDLToVK_StoreOp[colorAttachmentInfos[i].storeOp];
+            colorAttachments[i].resolveMode = VULKAN_INTERNAL_GetColorResolveMode(textureSlice->parent->format);
+            colorAttachments[i].resolveImageView = textureSlice->view;
+            colorAttachments[i].resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+        else
+        {
+            colorAttachments[i].imageView = textureSlice->view;
+            colorAttachments[i].storeOp = VK_ATTACHMENT_STORE_OP_STORE; /* Always store non-MSAA textures */
+            colorAttachments[i].resolveMode = VK_RESOLVE_MODE_NONE_KHR;
+            colorAttachments[i].resolveImageView = VK_NULL_HANDLE;
+            colorAttachments[i].resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+    }
+
+    renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+    renderingInfo.pNext = NULL;
+    renderingInfo.flags = subPassContents ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR : 0;
+    renderingInfo.renderArea.extent.width = framebufferWidth;
+    renderingInfo.renderArea.extent.height = framebufferHeight;
+    renderingInfo.renderArea.offset.x = 0;
+    renderingInfo.renderArea.offset.y = 0;
+    renderingInfo.layerCount = 1;
+    renderingInfo.viewMask = 0;
+    renderingInfo.colorAttachmentCount = colorAttachmentCount;
+    renderingInfo.pColorAttachments = colorAttachments;
+    renderingInfo.pDepthAttachment = NULL;
+    renderingInfo.pStencilAttachment = NULL;
+
+    if (depthStencilAttachmentInfo != NULL)
+    {
+        textureSlice = vulkanCommandBuffer->depthStencilAttachmentSlice;
+
+        depthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        depthAttachment.pNext = NULL;
+        depthAttachment.imageView = textureSlice->view;
+        depthAttachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        depthAttachment.resolveMode = VK_RESOLVE_MODE_NONE_KHR;
+        depthAttachment.resolveImageView = VK_NULL_HANDLE;
+        depthAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        depthAttachment.loadOp = SDLToVK_LoadOp[depthStencilAttachmentInfo->loadOp];
+        depthAttachment.storeOp = SDLToVK_StoreOp[depthStencilAttachmentInfo->storeOp];
+        depthAttachment.clearValue.depthStencil.depth = depthStencilAttachmentInfo->depthStencilClearValue.depth;
+        depthAttachment.clearValue.depthStencil.stencil = depthStencilAttachmentInfo->depthStencilClearValue.stencil;
+
+        renderingInfo.pDepthAttachment = &depthAttachment;
+
+        if (textureSlice->parent->aspectFlags & VK_IMAGE_ASPECT_STENCIL_BIT)
+        {
+            stencilAttachment = depthAttachment;
+            stencilAttachment.loadOp = SDLToVK_LoadOp[depthStencilAttachmentInfo->stencilLoadOp];
+            stencilAttachment.storeOp = SDLToVK_StoreOp[depthStencilAttachmentInfo->stencilStoreOp];
+
+            renderingInfo.pStencilAttachment = &stencilAttachment;
+        }
+    }
+
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
+    renderer->vkCmdBeginRenderingKHR(
+        vulkanCommandBuffer->commandBuffer,
+        &renderingInfo
+    );
+}
+
+static void VULKAN_INTERNAL_BeginRenderPass(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *vulkanCommandBuffer,
+    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+    Uint32 colorAttachmentCount,
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo,
+    SDL_bool subPassContents
+) {
+    VulkanTextureContainer *textureContainer;
+    VulkanTextureSlice *textureSlice;
+    Uint32 w, h;
+    Uint32 i;
+    SDL_GpuViewport defaultViewport;
+    SDL_GpuRect defaultScissor;
+    Uint32 framebufferWidth = UINT32_MAX;
+    Uint32 framebufferHeight = UINT32_MAX;
+
+    VULKAN_INTERNAL_BeginPassTiming(
+        renderer,
+        vulkanCommandBuffer,
+        SDL_GPU_PASSTYPE_RENDER
+    );
+
+    for (i = 0; i < colorAttachmentCount; i += 1)
+    {
+        textureContainer = (VulkanTextureContainer*) colorAttachmentInfos[i].textureSlice.texture;
+
+        w = textureContainer->activeTextureHandle->vulkanTexture->dimensions.width >> colorAttachmentInfos[i].textureSlice.mipLevel;
+        h = textureContainer->activeTextureHandle->vulkanTexture->dimensions.height >> colorAttachmentInfos[i].textureSlice.mipLevel;
+
+        /* The framebuffer cannot be larger than the smallest attachment. */
+
+        if (w < framebufferWidth)
+        {
+            framebufferWidth = w;
+        }
+
+        if (h < framebufferHeight)
+        {
+            framebufferHeight = h;
+        }
+
+        if (!textureContainer->activeTextureHandle->vulkanTexture->isRenderTarget)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Color attachment texture was not designated as a target!");
+            return;
+        }
+    }
+
+    if (depthStencilAttachmentInfo != NULL)
+    {
+        textureContainer = (VulkanTextureContainer*) depthStencilAttachmentInfo->textureSlice.texture;
+
+        w = textureContainer->activeTextureHandle->vulkanTexture->dimensions.width >> depthStencilAttachmentInfo->textureSlice.mipLevel;
+        h = textureContainer->activeTextureHandle->vulkanTexture->dimensions.height >> depthStencilAttachmentInfo->textureSlice.mipLevel;
+
+        /* The framebuffer cannot be larger than the smallest attachment. */
+
+        if (w < framebufferWidth)
+        {
+            framebufferWidth = w;
+        }
 
-    /* Set sensible default viewport state */
+        if (h < framebufferHeight)
+        {
+            framebufferHeight = h;
+        }
+
+        if (!textureContainer->activeTextureHandle->vulkanTexture->isRenderTarget)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Depth stencil attachment texture was not designated as a target!");
+            return;
+        }
+    }
+
+    /* Layout transitions */
+
+    for (i = 0; i < colorAttachmentCount; i += 1)
+    {
+        SDL_bool cycle;
+        if (colorAttachmentInfos[i].loadOp)
+        {
+            cycle = SDL_FALSE;
+        }
+        else
+        {
+            cycle = colorAttachmentInfos[i].cycle;
+        }
+
+        textureContainer = (VulkanTextureContainer*) colorAttachmentInfos[i].textureSlice.texture;
+        textureSlice = VULKAN_INTERNAL_PrepareTextureSliceForWrite(
+            renderer,
+            vulkanCommandBuffer,
+            textureContainer,
+            colorAttachmentInfos[i].textureSlice.layer,
+            colorAttachmentInfos[i].textureSlice.mipLevel,
+            cycle,
+            VULKAN_TEXTURE_USAGE_MODE_COLOR_ATTACHMENT
+        );
+
+        if (textureSlice->msaaTexHandle != NULL)
+        {
+            /* Transition the multisample attachment */
+            VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
+                renderer,
+                vulkanCommandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COLOR_ATTACHMENT,
+                &textureSlice->msaaTexHandle->vulkanTexture->slices[0]
+            );
+        }
+
+        vulkanCommandBuffer->colorAttachmentSlices[i] = textureSlice;
+
+        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, textureSlice);
+        /* TODO: do we need to track the msaa texture? or is it implicitly only used when the regular texture is used? */
+    }
+
+    vulkanCommandBuffer->colorAttachmentSliceCount = colorAttachmentCount;
+
+    if (depthStencilAttachmentInfo != NULL)
+    {
+        SDL_bool cycle;
+
+        if (
+            depthStencilAttachmentInfo->loadOp == SDL_GPU_LOADOP_LOAD ||
+            depthStencilAttachmentInfo->stencilLoadOp == SDL_GPU_LOADOP_LOAD
+        ) {
+            cycle = SDL_FALSE;
+        }
+        else
+        {
+            cycle = depthStencilAttachmentInfo->cycle;
+        }
+
+        textureContainer = (VulkanTextureContainer*) depthStencilAttachmentInfo->textureSlice.texture;
+        textureSlice = VULKAN_INTERNAL_PrepareTextureSliceForWrite(
+            renderer,
+            vulkanCommandBuffer,
+            textureContainer,
+            depthStencilAttachmentInfo->textureSlice.layer,
+            depthStencilAttachmentInfo->textureSlice.mipLevel,
+            cycle,
+            VULKAN_TEXTURE_USAGE_MODE_DEPTH_STENCIL_ATTACHMENT
+        );
+
+        vulkanCommandBuffer->depthStencilAttachmentSlice = textureSlice;
+
+        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, textureSlice);
+    }
+
+    if (renderer->supports.KHR_dynamic_rendering)
+    {
+        VULKAN_INTERNAL_BeginDynamicRendering(
+            renderer,
+            vulkanCommandBuffer,
+            colorAttachmentInfos,
+            colorAttachmentCount,
+            depthStencilAttachmentInfo,
+            framebufferWidth,
+            framebufferHeight,
+            subPassContents
+        );
+    }
+    else
+    {
+        VULKAN_INTERNAL_BeginCachedRenderPass(
+            renderer,
+            vulkanCommandBuffer,
+            colorAttachmentInfos,
+            colorAttachmentCount,
+            depthStencilAttachmentInfo,
+            framebufferWidth,
+            framebufferHeight,
+            subPassContents
+        );
+    }
+
+    /* Set sensible default viewport state, sub passes copy it when they begin */
 
     defaultViewport.x = 0;
     defaultViewport.y = 0;
@@ -8534,6 +10729,24 @@ static void VULKAN_BeginRenderPass(
     );
 }
 
+static void VULKAN_BeginRenderPass(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+    Uint32 colorAttachmentCount,
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+
+    VULKAN_INTERNAL_BeginRenderPass(
+        vulkanCommandBuffer->renderer,
+        vulkanCommandBuffer,
+        colorAttachmentInfos,
+        colorAttachmentCount,
+        depthStencilAttachmentInfo,
+        SDL_FALSE
+    );
+}
+
 static void VULKAN_BindGraphicsPipeline(
     SDL_GpuCommandBuffer *commandBuffer,
     SDL_GpuGraphicsPipeline *graphicsPipeline
@@ -8541,7 +10754,6 @@ static void VULKAN_BindGraphicsPipeline(
     VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
     VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
     VulkanGraphicsPipeline* pipeline = (VulkanGraphicsPipeline*) graphicsPipeline;
-    Uint32 i;
 
     renderer->vkCmdBindPipeline(
         vulkanCommandBuffer->commandBuffer,
@@ -8567,35 +10779,19 @@ static void VULKAN_BindGraphicsPipeline(
         &vulkanCommandBuffer->currentScissor
     );
 
-    for (i = vulkanCommandBuffer->initializedVertexUniformBufferCount; i < pipeline->resourceLayout.vertexUniformBufferCount; i += 1)
-    {
-        vulkanCommandBuffer->vertexUniformBuffers[i] = VULKAN_INTERNAL_CreateUniformBuffer(renderer, UNIFORM_BUFFER_SIZE);
-        vulkanCommandBuffer->initializedVertexUniformBufferCount += 1;
-    }
+    VULKAN_INTERNAL_InitializeUniformBuffers(
+        renderer,
+        vulkanCommandBuffer,
+        vulkanCommandBuffer->vertexUniformBuffers,
+        pipeline->resourceLayout.vertexUniformBufferCount
+    );
 
-    for (i = vulkanCommandBuffer->initializedFragmentUniformBufferCount; i < pipeline->resourceLayout.fragmentUniformBufferCount; i += 1)
-    {
-        vulkanCommandBuffer->fragmentUniformBuffers[i] = VULKAN_INTERNAL_CreateUniformBuffer(renderer, UNIFORM_BUFFER_SIZE);
-        vulkanCommandBuffer->initializedFragmentUniformBufferCount += 1;
-    }
-
-    for (i = 0; i < pipeline->resourceLayout.vertexUniformBufferCount; i += 1)
-    {
-        VULKAN_INTERNAL_TrackBuffer(
-            renderer,
-            vulkanCommandBuffer,
-            vulkanCommandBuffer->vertexUniformBuffers[i]->bufferContainer->activeBufferHandle->vulkanBuffer
-        );
-    }
-
-    for (i = 0; i < pipeline->resourceLayout.fragmentUniformBufferCount; i += 1)
-    {
-        VULKAN_INTERNAL_TrackBuffer(
-            renderer,
-            vulkanCommandBuffer,
-            vulkanCommandBuffer->fragmentUniformBuffers[i]->bufferContainer->activeBufferHandle->vulkanBuffer
-        );
-    }
+    VULKAN_INTERNAL_InitializeUniformBuffers(
+        renderer,
+        vulkanCommandBuffer,
+        vulkanCommandBuffer->fragmentUniformBuffers,
+        pipeline->resourceLayout.fragmentUniformBufferCount
+    );
 
     vulkanCommandBuffer->needNewVertexResourceDescriptorSet = SDL_TRUE;
     vulkanCommandBuffer->needNewFragmentResourceDescriptorSet = SDL_TRUE;
@@ -8603,6 +10799,7 @@ static void VULKAN_BindGraphicsPipeline(
     vulkanCommandBuffer->needNewFragmentUniformDescriptorSet = SDL_TRUE;
     vulkanCommandBuffer->needNewVertexUniformOffsets = SDL_TRUE;
     vulkanCommandBuffer->needNewFragmentUniformOffsets = SDL_TRUE;
+    vulkanCommandBuffer->needNewGraphicsBindlessTable = SDL_TRUE;
 }
 
 static void VULKAN_BindVertexBuffers(
@@ -8674,7 +10871,7 @@ static void VULKAN_PushVertexUniformData(
     VULKAN_INTERNAL_PushUniformData(
         vulkanCommandBuffer->renderer,
         vulkanCommandBuffer,
-        vulkanCommandBuffer->vertexUniformBuffers[slotIndex],
+        &vulkanCommandBuffer->vertexUniformBuffers[slotIndex],
         SDL_GPU_SHADERSTAGE_VERTEX,
         data,
         dataLengthInBytes
@@ -8698,13 +10895,127 @@ static void VULKAN_PushFragmentUniformData(
     VULKAN_INTERNAL_PushUniformData(
         vulkanCommandBuffer->renderer,
         vulkanCommandBuffer,
-        vulkanCommandBuffer->fragmentUniformBuffers[slotIndex],
+        &vulkanCommandBuffer->fragmentUniformBuffers[slotIndex],
         SDL_GPU_SHADERSTAGE_FRAGMENT,
         data,
         dataLengthInBytes
     );
 }
 
+static void VULKAN_INTERNAL_BindGraphicsUniformOffsets(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    VulkanGraphicsPipelineResourceLayout *resourceLayout = &commandBuffer->currentGraphicsPipeline->resourceLayout;
+    VkDescriptorSet descriptorSets[3];
+    Uint32 dynamicOffsets[MAX_UNIFORM_BUFFERS_PER_STAGE * 2];
+    Uint32 dynamicOffsetCount = 0;
+    Uint32 i;
+
+    /* Moving both stages' offsets only needs one bind covering sets 1-3 */
+    if (
+        !commandBuffer->needNewVertexUniformOffsets ||
+        !commandBuffer->needNewFragmentUniformOffsets ||
+        commandBuffer->needNewVertexResourceDescriptorSet ||
+        commandBuffer->needNewVertexUniformDescriptorSet ||
+        commandBuffer->needNewFragmentResourceDescriptorSet ||
+        commandBuffer->needNewFragmentUniformDescriptorSet
+    ) {
+        VULKAN_INTERNAL_BindGraphicsDescriptorSets(renderer, commandBuffer);
+        return;
+    }
+
+    for (i = 0; i < resourceLayout->vertexUniformBufferCount; i += 1)
+    {
+        dynamicOffsets[dynamicOffsetCount] = commandBuffer->vertexUniformBuffers[i].drawOffset;
+        dynamicOffsetCount += 1;
+    }
+
+    for (i = 0; i < resourceLayout->fragmentUniformBufferCount; i += 1)
+    {
+        dynamicOffsets[dynamicOffsetCount] = commandBuffer->fragmentUniformBuffers[i].drawOffset;
+        dynamicOffsetCount += 1;
+    }
+
+    descriptorSets[0] = commandBuffer->vertexUniformDescriptorSet;
+    descriptorSets[1] = commandBuffer->fragmentResourceDescriptorSet;
+    descriptorSets[2] = commandBuffer->fragmentUniformDescriptorSet;
+
+    renderer->vkCmdBindDescriptorSets(
+        commandBuffer->commandBuffer,
+        VK_PIPELINE_BIND_POINT_GRAPHICS,
+        resourceLayout->pipelineLayout,
+        1,
+        3,
+        descriptorSets,
+        dynamicOffsetCount,
+        dynamicOffsets
+    );
+
+    commandBuffer->needNewVertexUniformOffsets = SDL_FALSE;
+    commandBuffer->needNewFragmentUniformOffsets = SDL_FALSE;
+}
+
+static void VULKAN_DrawIndexedPrimitivesBatch(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuIndexedDrawRecord *draws,
+    Uint32 drawCount,
+    Uint32 vertexUniformDataLengthInBytes,
+    Uint32 fragmentUniformDataLengthInBytes
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+    VulkanGraphicsPipeline *pipeline = vulkanCommandBuffer->currentGraphicsPipeline;
+    SDL_bool hasVertexUniforms = pipeline->resourceLayout.vertexUniformBufferCount > 0;
+    SDL_bool hasFragmentUniforms = pipeline->resourceLayout.fragmentUniformBufferCount > 0;
+    SDL_GpuIndexedDrawRecord *draw;
+    Uint32 i;
+
+    /* Uniforms land back to back in the arena block, so each draw only moves dynamic offsets */
+    for (i = 0; i < drawCount; i += 1)
+    {
+        draw = &draws[i];
+
+        if (draw->vertexUniformData != NULL && hasVertexUniforms)
+        {
+            VULKAN_INTERNAL_PushUniformData(
+                renderer,
+                vulkanCommandBuffer,
+                &vulkanCommandBuffer->vertexUniformBuffers[0],
+                SDL_GPU_SHADERSTAGE_VERTEX,
+                draw->vertexUniformData,
+                vertexUniformDataLengthInBytes
+            );
+        }
+
+        if (draw->fragmentUniformData != NULL && hasFragmentUniforms)
+        {
+            VULKAN_INTERNAL_PushUniformData(
+                renderer,
+                vulkanCommandBuffer,
+                &vulkanCommandBuffer->fragmentUniformBuffers[0],
+                SDL_GPU_SHADERSTAGE_FRAGMENT,
+                draw->fragmentUniformData,
+                fragmentUniformDataLengthInBytes
+            );
+        }
+
+        VULKAN_INTERNAL_BindGraphicsUniformOffsets(renderer, vulkanCommandBuffer);
+
+        renderer->vkCmdDrawIndexed(
+            vulkanCommandBuffer->commandBuffer,
+            PrimitiveVerts(
+                pipeline->primitiveType,
+                draw->primitiveCount
+            ),
+            draw->instanceCount,
+            draw->startIndex,
+            draw->baseVertex,
+            draw->firstInstance
+        );
+    }
+}
+
 static void VULKAN_EndRenderPass(
     SDL_GpuCommandBuffer *commandBuffer
 ) {
@@ -8712,9 +11023,18 @@ static void VULKAN_EndRenderPass(
     VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
     Uint32 i;
 
-    renderer->vkCmdEndRenderPass(
-        vulkanCommandBuffer->commandBuffer
-    );
+    if (renderer->supports.KHR_dynamic_rendering)
+    {
+        renderer->vkCmdEndRenderingKHR(
+            vulkanCommandBuffer->commandBuffer
+        );
+    }
+    else
+    {
+        renderer->vkCmdEndRenderPass(
+            vulkanCommandBuffer->commandBuffer
+        );
+    }
 
     for (i = 0; i < vulkanCommandBuffer->colorAttachmentSliceCount; i += 1)
     {
@@ -8739,11 +11059,210 @@ static void VULKAN_EndRenderPass(
     }
 
     vulkanCommandBuffer->currentGraphicsPipeline = NULL;
+    vulkanCommandBuffer->graphicsBindlessTable = NULL;
 
     vulkanCommandBuffer->vertexResourceDescriptorSet = VK_NULL_HANDLE;
     vulkanCommandBuffer->vertexUniformDescriptorSet = VK_NULL_HANDLE;
     vulkanCommandBuffer->fragmentResourceDescriptorSet = VK_NULL_HANDLE;
     vulkanCommandBuffer->fragmentUniformDescriptorSet = VK_NULL_HANDLE;
+
+    VULKAN_INTERNAL_EndPassTiming(renderer, vulkanCommandBuffer);
+}
+
+/* Parallel Render Pass */
+
+static void VULKAN_BeginParallelRenderPass(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuColorAttachmentInfo *colorAttachmentInfos,
+    Uint32 colorAttachmentCount,
+    SDL_GpuDepthStencilAttachmentInfo *depthStencilAttachmentInfo
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+
+    /* Earlier parallel passes keep their secondaries until the command buffer is cleaned */
+    vulkanCommandBuffer->firstSubPassIndex = vulkanCommandBuffer->secondaryCommandBufferCount;
+
+    VULKAN_INTERNAL_BeginRenderPass(
+        vulkanCommandBuffer->renderer,
+        vulkanCommandBuffer,
+        colorAttachmentInfos,
+        colorAttachmentCount,
+        depthStencilAttachmentInfo,
+        SDL_TRUE
+    );
+}
+
+static SDL_GpuCommandBuffer* VULKAN_AcquireRenderSubPass(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanCommandBuffer *subPassCommandBuffer;
+    VkFormat colorAttachmentFormats[MAX_COLOR_TARGET_BINDINGS];
+    VkCommandBufferInheritanceRenderingInfoKHR inheritanceRenderingInfo;
+    VkCommandBufferInheritanceInfo inheritanceInfo;
+    VkCommandBufferBeginInfo beginInfo;
+    VulkanTextureSlice *depthStencilSlice;
+    VkResult result;
+    Uint32 i;
+
+    /* Secondaries come from the calling thread's pool, so sub passes record in parallel */
+    SDL_LockMutex(renderer->acquireCommandBufferLock);
+
+    subPassCommandBuffer = VULKAN_INTERNAL_GetInactiveSecondaryCommandBufferFromPool(
+        renderer,
+        SDL_ThreadID()
+    );
+
+    if (subPassCommandBuffer != NULL)
+    {
+        EXPAND_ARRAY_IF_NEEDED(
+            vulkanCommandBuffer->secondaryCommandBuffers,
+            VulkanCommandBuffer*,
+            vulkanCommandBuffer->secondaryCommandBufferCount + 1,
+            vulkanCommandBuffer->secondaryCommandBufferCapacity,
+            vulkanCommandBuffer->secondaryCommandBufferCapacity * 2
+        );
+
+        vulkanCommandBuffer->secondaryCommandBuffers[
+            vulkanCommandBuffer->secondaryCommandBufferCount
+        ] = subPassCommandBuffer;
+        vulkanCommandBuffer->secondaryCommandBufferCount += 1;
+    }
+
+    SDL_UnlockMutex(renderer->acquireCommandBufferLock);
+
+    if (subPassCommandBuffer == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to acquire sub pass command buffer!");
+        return NULL;
+    }
+
+    VULKAN_INTERNAL_ResetCommandBuffer(renderer, subPassCommandBuffer);
+
+    /* The primary command buffer owns the fence */
+    subPassCommandBuffer->autoReleaseFence = 0;
+
+    subPassCommandBuffer->currentViewport = vulkanCommandBuffer->currentViewport;
+    subPassCommandBuffer->currentScissor = vulkanCommandBuffer->currentScissor;
+
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.pNext = NULL;
+    inheritanceInfo.renderPass = vulkanCommandBuffer->currentRenderPass;
+    inheritanceInfo.subpass = 0;
+    inheritanceInfo.framebuffer = vulkanCommandBuffer->currentFramebuffer;
+    inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+    inheritanceInfo.queryFlags = 0;
+    inheritanceInfo.pipelineStatistics = vulkanCommandBuffer->pipelineStatisticsEnabled ?
+        VULKAN_GRAPHICS_PIPELINE_STATISTICS :
+        0;
+
+    if (renderer->supports.KHR_dynamic_rendering)
+    {
+        inheritanceRenderingInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+        inheritanceRenderingInfo.pNext = NULL;
+        inheritanceRenderingInfo.flags = 0;
+        inheritanceRenderingInfo.viewMask = 0;
+        inheritanceRenderingInfo.colorAttachmentCount = vulkanCommandBuffer->colorAttachmentSliceCount;
+        inheritanceRenderingInfo.pColorAttachmentFormats = colorAttachmentFormats;
+        inheritanceRenderingInfo.depthAttachmentFormat = VK_FORMAT_UNDEFINED;
+        inheritanceRenderingInfo.stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+        inheritanceRenderingInfo.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        for (i = 0; i < vulkanCommandBuffer->colorAttachmentSliceCount; i += 1)
+        {
+            colorAttachmentFormats[i] = vulkanCommandBuffer->colorAttachmentSlices[i]->parent->format;
+            inheritanceRenderingInfo.rasterizationSamples = vulkanCommandBuffer->colorAttachmentSlices[i]->parent->sampleCount;
+        }
+
+        depthStencilSlice = vulkanCommandBuffer->depthStencilAttachmentSlice;
+
+        if (depthStencilSlice != NULL)
+        {
+            inheritanceRenderingInfo.depthAttachmentFormat = depthStencilSlice->parent->format;
+            inheritanceRenderingInfo.rasterizationSamples = depthStencilSlice->parent->sampleCount;
+
+            if (depthStencilSlice->parent->aspectFlags & VK_IMAGE_ASPECT_STENCIL_BIT)
+            {
+                inheritanceRenderingInfo.stencilAttachmentFormat = depthStencilSlice->parent->format;
+            }
+        }
+
+        inheritanceInfo.pNext = &inheritanceRenderingInfo;
+    }
+
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.pNext = NULL;
+    beginInfo.flags =
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+        VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    result = renderer->vkBeginCommandBuffer(
+        subPassCommandBuffer->commandBuffer,
+        &beginInfo
+    );
+
+    if (result != VK_SUCCESS)
+    {
+        LogVulkanResultAsError("vkBeginCommandBuffer", result);
+    }
+
+    return (SDL_GpuCommandBuffer*) subPassCommandBuffer;
+}
+
+static void VULKAN_EndRenderSubPass(
+    SDL_GpuCommandBuffer *subPassCommandBuffer
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) subPassCommandBuffer;
+
+    vulkanCommandBuffer->currentGraphicsPipeline = NULL;
+    vulkanCommandBuffer->graphicsBindlessTable = NULL;
+
+    /* Still exclusively ours, which will not be true by the time the primary is submitted */
+    VULKAN_INTERNAL_TrimDescriptorSetCaches(vulkanCommandBuffer);
+
+    VULKAN_INTERNAL_EndCommandBuffer(
+        vulkanCommandBuffer->renderer,
+        vulkanCommandBuffer
+    );
+}
+
+static void VULKAN_EndParallelRenderPass(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    Uint32 subPassCount =
+        vulkanCommandBuffer->secondaryCommandBufferCount -
+        vulkanCommandBuffer->firstSubPassIndex;
+    VkCommandBuffer *subPassCommandBuffers;
+    Uint32 i;
+
+    if (subPassCount > 0)
+    {
+        subPassCommandBuffers = SDL_stack_alloc(VkCommandBuffer, subPassCount);
+
+        for (i = 0; i < subPassCount; i += 1)
+        {
+            subPassCommandBuffers[i] = vulkanCommandBuffer->secondaryCommandBuffers[
+                vulkanCommandBuffer->firstSubPassIndex + i
+            ]->commandBuffer;
+        }
+
+        renderer->vkCmdExecuteCommands(
+            vulkanCommandBuffer->commandBuffer,
+            subPassCount,
+            subPassCommandBuffers
+        );
+
+        SDL_stack_free(subPassCommandBuffers);
+    }
+
+    vulkanCommandBuffer->currentRenderPass = VK_NULL_HANDLE;
+    vulkanCommandBuffer->currentFramebuffer = VK_NULL_HANDLE;
+
+    VULKAN_EndRenderPass(commandBuffer);
 }
 
 static void VULKAN_BeginComputePass(
@@ -8761,6 +11280,12 @@ static void VULKAN_BeginComputePass(
     VulkanBuffer *buffer;
     Uint32 i;
 
+    VULKAN_INTERNAL_BeginPassTiming(
+        renderer,
+        vulkanCommandBuffer,
+        SDL_GPU_PASSTYPE_COMPUTE
+    );
+
     for (i = 0; i < storageTextureBindingCount; i += 1)
     {
         textureContainer = (VulkanTextureContainer*) storageTextureBindings[i].textureSlice.texture;
@@ -8811,7 +11336,6 @@ static void VULKAN_BindComputePipeline(
     VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
     VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
     VulkanComputePipeline *vulkanComputePipeline = (VulkanComputePipeline*) computePipeline;
-    Uint32 i;
 
     renderer->vkCmdBindPipeline(
         vulkanCommandBuffer->commandBuffer,
@@ -8823,25 +11347,18 @@ static void VULKAN_BindComputePipeline(
 
     VULKAN_INTERNAL_TrackComputePipeline(renderer, vulkanCommandBuffer, vulkanComputePipeline);
 
-    for (i = vulkanCommandBuffer->initializedComputeUniformBufferCount; i < vulkanComputePipeline->resourceLayout.uniformBufferCount; i += 1)
-    {
-        vulkanCommandBuffer->computeUniformBuffers[i] = VULKAN_INTERNAL_CreateUniformBuffer(renderer, UNIFORM_BUFFER_SIZE);
-        vulkanCommandBuffer->initializedComputeUniformBufferCount += 1;
-    }
-
-    for (i = 0; i < vulkanComputePipeline->resourceLayout.uniformBufferCount; i += 1)
-    {
-        VULKAN_INTERNAL_TrackBuffer(
-            renderer,
-            vulkanCommandBuffer,
-            vulkanCommandBuffer->computeUniformBuffers[i]->bufferContainer->activeBufferHandle->vulkanBuffer
-        );
-    }
+    VULKAN_INTERNAL_InitializeUniformBuffers(
+        renderer,
+        vulkanCommandBuffer,
+        vulkanCommandBuffer->computeUniformBuffers,
+        vulkanComputePipeline->resourceLayout.uniformBufferCount
+    );
 
     vulkanCommandBuffer->needNewComputeReadWriteDescriptorSet = SDL_TRUE;
     vulkanCommandBuffer->needNewComputeReadOnlyDescriptorSet = SDL_TRUE;
     vulkanCommandBuffer->needNewComputeUniformDescriptorSet = SDL_TRUE;
     vulkanCommandBuffer->needNewComputeUniformOffsets = SDL_TRUE;
+    vulkanCommandBuffer->needNewComputeBindlessTable = SDL_TRUE;
 }
 
 static void VULKAN_BindComputeStorageTextures(
@@ -8938,6 +11455,20 @@ static void VULKAN_BindComputeStorageBuffers(
     vulkanCommandBuffer->needNewComputeReadOnlyDescriptorSet = SDL_TRUE;
 }
 
+static void VULKAN_BindComputeBindlessTable(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBindlessTable *bindlessTable
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanBindlessTable *vulkanBindlessTable = (VulkanBindlessTable*) bindlessTable;
+
+    VULKAN_INTERNAL_TrackBindlessTable(renderer, vulkanCommandBuffer, vulkanBindlessTable);
+
+    vulkanCommandBuffer->computeBindlessTable = vulkanBindlessTable;
+    vulkanCommandBuffer->needNewComputeBindlessTable = SDL_TRUE;
+}
+
 static void VULKAN_PushComputeUniformData(
     SDL_GpuCommandBuffer *commandBuffer,
 	Uint32 slotIndex,
@@ -8955,7 +11486,7 @@ static void VULKAN_PushComputeUniformData(
     VULKAN_INTERNAL_PushUniformData(
         vulkanCommandBuffer->renderer,
         vulkanCommandBuffer,
-        vulkanCommandBuffer->computeUniformBuffers[slotIndex],
+        &vulkanCommandBuffer->computeUniformBuffers[slotIndex],
         SDL_GPU_SHADERSTAGE_COMPUTE,
         data,
         dataLengthInBytes
@@ -8983,12 +11514,6 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
     {
         descriptorSetPool = &resourceLayout->descriptorSetPools[0];
 
-        commandBuffer->computeReadOnlyDescriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
-            renderer,
-            commandBuffer,
-            descriptorSetPool
-        );
-
         writeDescriptorSets = SDL_stack_alloc(
             VkWriteDescriptorSet,
             resourceLayout->readOnlyStorageTextureCount +
@@ -9004,7 +11529,6 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->computeReadOnlyDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pBufferInfo = NULL;
 
@@ -9027,7 +11551,6 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = resourceLayout->readOnlyStorageTextureCount + i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->computeReadOnlyDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pImageInfo = NULL;
 
@@ -9040,24 +11563,39 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
             bufferInfoCount += 1;
         }
 
-        renderer->vkUpdateDescriptorSets(
-            renderer->logicalDevice,
-            resourceLayout->readOnlyStorageTextureCount + resourceLayout->readOnlyStorageBufferCount,
-            writeDescriptorSets,
-            0,
-            NULL
-        );
+        if (descriptorSetPool->pushDescriptors)
+        {
+            renderer->vkCmdPushDescriptorSetKHR(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_COMPUTE,
+                resourceLayout->pipelineLayout,
+                0,
+                resourceLayout->readOnlyStorageTextureCount + resourceLayout->readOnlyStorageBufferCount,
+                writeDescriptorSets
+            );
+        }
+        else
+        {
+            commandBuffer->computeReadOnlyDescriptorSet = VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+                renderer,
+                commandBuffer,
+                descriptorSetPool,
+                &commandBuffer->currentComputePipeline->referenceCount,
+                writeDescriptorSets,
+                resourceLayout->readOnlyStorageTextureCount + resourceLayout->readOnlyStorageBufferCount
+            );
 
-        renderer->vkCmdBindDescriptorSets(
-            commandBuffer->commandBuffer,
-            VK_PIPELINE_BIND_POINT_COMPUTE,
-            resourceLayout->pipelineLayout,
-            0,
-            1,
-            &commandBuffer->computeReadOnlyDescriptorSet,
-            0,
-            NULL
-        );
+            renderer->vkCmdBindDescriptorSets(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_COMPUTE,
+                resourceLayout->pipelineLayout,
+                0,
+                1,
+                &commandBuffer->computeReadOnlyDescriptorSet,
+                0,
+                NULL
+            );
+        }
 
         SDL_stack_free(writeDescriptorSets);
         bufferInfoCount = 0;
@@ -9070,12 +11608,6 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
     {
         descriptorSetPool = &resourceLayout->descriptorSetPools[1];
 
-        commandBuffer->computeReadWriteDescriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
-            renderer,
-            commandBuffer,
-            descriptorSetPool
-        );
-
         writeDescriptorSets = SDL_stack_alloc(
             VkWriteDescriptorSet,
             resourceLayout->readWriteStorageTextureCount +
@@ -9092,7 +11624,6 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->computeReadWriteDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pBufferInfo = NULL;
 
@@ -9115,7 +11646,6 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = resourceLayout->readWriteStorageTextureCount + i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->computeReadWriteDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pImageInfo = NULL;
 
@@ -9128,27 +11658,42 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
             bufferInfoCount += 1;
         }
 
-        renderer->vkUpdateDescriptorSets(
-            renderer->logicalDevice,
-            resourceLayout->readWriteStorageTextureCount + resourceLayout->readWriteStorageBufferCount,
-            writeDescriptorSets,
-            0,
-            NULL
-        );
-
-        renderer->vkCmdBindDescriptorSets(
-            commandBuffer->commandBuffer,
-            VK_PIPELINE_BIND_POINT_COMPUTE,
-            resourceLayout->pipelineLayout,
-            1,
-            1,
-            &commandBuffer->computeReadWriteDescriptorSet,
-            0,
-            NULL
-        );
+        if (descriptorSetPool->pushDescriptors)
+        {
+            renderer->vkCmdPushDescriptorSetKHR(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_COMPUTE,
+                resourceLayout->pipelineLayout,
+                1,
+                resourceLayout->readWriteStorageTextureCount + resourceLayout->readWriteStorageBufferCount,
+                writeDescriptorSets
+            );
+        }
+        else
+        {
+            commandBuffer->computeReadWriteDescriptorSet = VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+                renderer,
+                commandBuffer,
+                descriptorSetPool,
+                &commandBuffer->currentComputePipeline->referenceCount,
+                writeDescriptorSets,
+                resourceLayout->readWriteStorageTextureCount + resourceLayout->readWriteStorageBufferCount
+            );
 
-        SDL_stack_free(writeDescriptorSets);
-        bufferInfoCount = 0;
+            renderer->vkCmdBindDescriptorSets(
+                commandBuffer->commandBuffer,
+                VK_PIPELINE_BIND_POINT_COMPUTE,
+                resourceLayout->pipelineLayout,
+                1,
+                1,
+                &commandBuffer->computeReadWriteDescriptorSet,
+                0,
+                NULL
+            );
+        }
+
+        SDL_stack_free(writeDescriptorSets);
+        bufferInfoCount = 0;
         imageInfoCount = 0;
 
         commandBuffer->needNewComputeReadWriteDescriptorSet = SDL_FALSE;
@@ -9158,12 +11703,6 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
     {
         descriptorSetPool = &resourceLayout->descriptorSetPools[2];
 
-        commandBuffer->computeUniformDescriptorSet = VULKAN_INTERNAL_FetchDescriptorSet(
-            renderer,
-            commandBuffer,
-            descriptorSetPool
-        );
-
         writeDescriptorSets = SDL_stack_alloc(
             VkWriteDescriptorSet,
             resourceLayout->uniformBufferCount
@@ -9179,25 +11718,25 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
             currentWriteDescriptorSet->descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
             currentWriteDescriptorSet->dstArrayElement = 0;
             currentWriteDescriptorSet->dstBinding = i;
-            currentWriteDescriptorSet->dstSet = commandBuffer->computeUniformDescriptorSet;
             currentWriteDescriptorSet->pTexelBufferView = NULL;
             currentWriteDescriptorSet->pImageInfo = NULL;
 
-            bufferInfos[bufferInfoCount].buffer = commandBuffer->computeUniformBuffers[i]->bufferContainer->activeBufferHandle->vulkanBuffer->buffer;
+            bufferInfos[bufferInfoCount].buffer = commandBuffer->computeUniformBuffers[i].buffer->buffer;
             bufferInfos[bufferInfoCount].offset = 0;
-            bufferInfos[bufferInfoCount].range = MAX_UBO_SECTION_SIZE;
+            bufferInfos[bufferInfoCount].range = renderer->maxUniformPushSize;
 
             currentWriteDescriptorSet->pBufferInfo = &bufferInfos[bufferInfoCount];
 
             bufferInfoCount += 1;
         }
 
-        renderer->vkUpdateDescriptorSets(
-            renderer->logicalDevice,
-            resourceLayout->uniformBufferCount,
+        commandBuffer->computeUniformDescriptorSet = VULKAN_INTERNAL_FetchWrittenDescriptorSet(
+            renderer,
+            commandBuffer,
+            descriptorSetPool,
+            &commandBuffer->currentComputePipeline->referenceCount,
             writeDescriptorSets,
-            0,
-            NULL
+            resourceLayout->uniformBufferCount
         );
 
         SDL_stack_free(writeDescriptorSets);
@@ -9212,7 +11751,7 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
     {
         for (i = 0; i < resourceLayout->uniformBufferCount; i += 1)
         {
-            dynamicOffsets[i] = commandBuffer->computeUniformBuffers[i]->drawOffset;
+            dynamicOffsets[i] = commandBuffer->computeUniformBuffers[i].drawOffset;
         }
 
         renderer->vkCmdBindDescriptorSets(
@@ -9228,6 +11767,25 @@ static void VULKAN_INTERNAL_BindComputeDescriptorSets(
 
         commandBuffer->needNewComputeUniformOffsets = SDL_FALSE;
     }
+
+    if (
+        commandBuffer->needNewComputeBindlessTable &&
+        resourceLayout->useBindlessTable &&
+        commandBuffer->computeBindlessTable != NULL
+    ) {
+        renderer->vkCmdBindDescriptorSets(
+            commandBuffer->commandBuffer,
+            VK_PIPELINE_BIND_POINT_COMPUTE,
+            resourceLayout->pipelineLayout,
+            3,
+            1,
+            &commandBuffer->computeBindlessTable->descriptorSet,
+            0,
+            NULL
+        );
+
+        commandBuffer->needNewComputeBindlessTable = SDL_FALSE;
+    }
 }
 
 static void VULKAN_DispatchCompute(
@@ -9241,6 +11799,8 @@ static void VULKAN_DispatchCompute(
 
     VULKAN_INTERNAL_BindComputeDescriptorSets(renderer, vulkanCommandBuffer);
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdDispatch(
         vulkanCommandBuffer->commandBuffer,
         groupCountX,
@@ -9316,10 +11876,76 @@ static void VULKAN_EndComputePass(
     }
 
     vulkanCommandBuffer->currentComputePipeline = NULL;
+    vulkanCommandBuffer->computeBindlessTable = NULL;
 
     vulkanCommandBuffer->computeReadOnlyDescriptorSet = VK_NULL_HANDLE;
     vulkanCommandBuffer->computeReadWriteDescriptorSet = VK_NULL_HANDLE;
     vulkanCommandBuffer->computeUniformDescriptorSet = VK_NULL_HANDLE;
+
+    VULKAN_INTERNAL_EndPassTiming(
+        vulkanCommandBuffer->renderer,
+        vulkanCommandBuffer
+    );
+}
+
+/* Transfer memory is host cached, which is not necessarily coherent */
+static void VULKAN_INTERNAL_SyncMappedRange(
+    VulkanRenderer *renderer,
+    VulkanBuffer *vulkanBuffer,
+    VkDeviceSize offset,
+    VkDeviceSize size,
+    SDL_bool invalidate
+) {
+    VulkanMemoryAllocation *allocation = vulkanBuffer->usedRegion->allocation;
+    VkDeviceSize atomSize = renderer->physicalDeviceProperties.properties.limits.nonCoherentAtomSize;
+    VkMappedMemoryRange range;
+    VkDeviceSize start, end;
+    VkResult vulkanResult;
+
+    if (
+        renderer->memoryProperties.memoryTypes[allocation->allocator->memoryTypeIndex].propertyFlags &
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+    ) {
+        return;
+    }
+
+    if (offset >= vulkanBuffer->size)
+    {
+        return;
+    }
+
+    size = SDL_min(size, vulkanBuffer->size - offset);
+
+    /* Ranges are relative to the whole allocation and must cover whole atoms */
+    start = vulkanBuffer->usedRegion->resourceOffset + offset;
+    end = start + size;
+    start = (start / atomSize) * atomSize;
+    end = ((end + atomSize - 1) / atomSize) * atomSize;
+
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.pNext = NULL;
+    range.memory = allocation->memory;
+    range.offset = start;
+    range.size = (end >= allocation->size) ? VK_WHOLE_SIZE : end - start;
+
+    if (invalidate)
+    {
+        vulkanResult = renderer->vkInvalidateMappedMemoryRanges(
+            renderer->logicalDevice,
+            1,
+            &range
+        );
+        VULKAN_ERROR_CHECK(vulkanResult, vkInvalidateMappedMemoryRanges, )
+    }
+    else
+    {
+        vulkanResult = renderer->vkFlushMappedMemoryRanges(
+            renderer->logicalDevice,
+            1,
+            &range
+        );
+        VULKAN_ERROR_CHECK(vulkanResult, vkFlushMappedMemoryRanges, )
+    }
 }
 
 static void VULKAN_MapTransferBuffer(
@@ -9345,6 +11971,14 @@ static void VULKAN_MapTransferBuffer(
         transferBufferContainer->activeBufferHandle->vulkanBuffer->usedRegion->allocation->mapPointer +
         transferBufferContainer->activeBufferHandle->vulkanBuffer->usedRegion->resourceOffset;
 
+    VULKAN_INTERNAL_SyncMappedRange(
+        renderer,
+        transferBufferContainer->activeBufferHandle->vulkanBuffer,
+        0,
+        VK_WHOLE_SIZE,
+        SDL_TRUE
+    );
+
     *ppData = bufferPointer;
 }
 
@@ -9352,9 +11986,50 @@ static void VULKAN_UnmapTransferBuffer(
     SDL_GpuRenderer *driverData,
     SDL_GpuTransferBuffer *transferBuffer
 ) {
-    /* no-op because transfer buffers are persistently mapped */
-    (void)driverData;
-    (void)transferBuffer;
+    VulkanBufferContainer *transferBufferContainer = (VulkanBufferContainer*) transferBuffer;
+
+    /* Transfer buffers are always mapped, so unmapping only publishes the writes */
+    VULKAN_INTERNAL_SyncMappedRange(
+        (VulkanRenderer*) driverData,
+        transferBufferContainer->activeBufferHandle->vulkanBuffer,
+        0,
+        VK_WHOLE_SIZE,
+        SDL_FALSE
+    );
+}
+
+static void VULKAN_FlushTransferBuffer(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+) {
+    VulkanBufferContainer *transferBufferContainer = (VulkanBufferContainer*) transferBuffer;
+
+    VULKAN_INTERNAL_SyncMappedRange(
+        (VulkanRenderer*) driverData,
+        transferBufferContainer->activeBufferHandle->vulkanBuffer,
+        offsetInBytes,
+        sizeInBytes,
+        SDL_FALSE
+    );
+}
+
+static void VULKAN_InvalidateTransferBuffer(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTransferBuffer *transferBuffer,
+    Uint32 offsetInBytes,
+    Uint32 sizeInBytes
+) {
+    VulkanBufferContainer *transferBufferContainer = (VulkanBufferContainer*) transferBuffer;
+
+    VULKAN_INTERNAL_SyncMappedRange(
+        (VulkanRenderer*) driverData,
+        transferBufferContainer->activeBufferHandle->vulkanBuffer,
+        offsetInBytes,
+        sizeInBytes,
+        SDL_TRUE
+    );
 }
 
 static void VULKAN_SetTransferData(
@@ -9387,6 +12062,14 @@ static void VULKAN_SetTransferData(
         ((Uint8*) data) + copyParams->srcOffset,
         copyParams->size
     );
+
+    VULKAN_INTERNAL_SyncMappedRange(
+        renderer,
+        transferBufferContainer->activeBufferHandle->vulkanBuffer,
+        copyParams->dstOffset,
+        copyParams->size,
+        SDL_FALSE
+    );
 }
 
 static void VULKAN_GetTransferData(
@@ -9395,10 +12078,17 @@ static void VULKAN_GetTransferData(
     void* data,
     SDL_GpuBufferCopy *copyParams
 ) {
-    (void) driverData; /* used by other backends */
     VulkanBufferContainer *transferBufferContainer = (VulkanBufferContainer*) transferBuffer;
     VulkanBuffer *vulkanBuffer = transferBufferContainer->activeBufferHandle->vulkanBuffer;
 
+    VULKAN_INTERNAL_SyncMappedRange(
+        (VulkanRenderer*) driverData,
+        vulkanBuffer,
+        copyParams->srcOffset,
+        copyParams->size,
+        SDL_TRUE
+    );
+
     Uint8 *bufferPointer =
         vulkanBuffer->usedRegion->allocation->mapPointer +
         vulkanBuffer->usedRegion->resourceOffset +
@@ -9414,8 +12104,13 @@ static void VULKAN_GetTransferData(
 static void VULKAN_BeginCopyPass(
     SDL_GpuCommandBuffer *commandBuffer
 ) {
-    /* no-op */
-    (void)commandBuffer;
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+
+    VULKAN_INTERNAL_BeginPassTiming(
+        vulkanCommandBuffer->renderer,
+        vulkanCommandBuffer,
+        SDL_GPU_PASSTYPE_COPY
+    );
 }
 
 static void VULKAN_UploadToTexture(
@@ -9458,6 +12153,8 @@ static void VULKAN_UploadToTexture(
     imageCopy.bufferRowLength = copyParams->bufferStride;
     imageCopy.bufferImageHeight = copyParams->bufferImageHeight;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdCopyBufferToImage(
         vulkanCommandBuffer->commandBuffer,
         transferBufferContainer->activeBufferHandle->vulkanBuffer->buffer,
@@ -9476,6 +12173,9 @@ static void VULKAN_UploadToTexture(
 
     VULKAN_INTERNAL_TrackBuffer(renderer, vulkanCommandBuffer, transferBufferContainer->activeBufferHandle->vulkanBuffer);
     VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, vulkanTextureSlice);
+
+    vulkanCommandBuffer->common.stats.bytesUploaded +=
+        (Uint64) BytesPerImage(textureRegion->w, textureRegion->h, vulkanTextureContainer->format) * textureRegion->d;
 }
 
 static void VULKAN_UploadToBuffer(
@@ -9505,6 +12205,8 @@ static void VULKAN_UploadToBuffer(
     bufferCopy.dstOffset = copyParams->dstOffset;
     bufferCopy.size = copyParams->size;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdCopyBuffer(
         vulkanCommandBuffer->commandBuffer,
         transferBufferContainer->activeBufferHandle->vulkanBuffer->buffer,
@@ -9562,6 +12264,8 @@ static void VULKAN_DownloadFromTexture(
     imageCopy.bufferRowLength = copyParams->bufferStride;
     imageCopy.bufferImageHeight = copyParams->bufferImageHeight;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdCopyImageToBuffer(
         vulkanCommandBuffer->commandBuffer,
         vulkanTextureSlice->parent->image,
@@ -9580,6 +12284,12 @@ static void VULKAN_DownloadFromTexture(
 
     VULKAN_INTERNAL_TrackBuffer(renderer, vulkanCommandBuffer, transferBufferContainer->activeBufferHandle->vulkanBuffer);
     VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, vulkanTextureSlice);
+
+    vulkanCommandBuffer->common.stats.bytesDownloaded += (Uint64) BytesPerImage(
+        textureRegion->w,
+        textureRegion->h,
+        ((VulkanTextureContainer*) textureRegion->textureSlice.texture)->format
+    ) * textureRegion->d;
 }
 
 static void VULKAN_DownloadFromBuffer(
@@ -9607,6 +12317,8 @@ static void VULKAN_DownloadFromBuffer(
     bufferCopy.dstOffset = copyParams->dstOffset;
     bufferCopy.size = copyParams->size;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdCopyBuffer(
         vulkanCommandBuffer->commandBuffer,
         bufferContainer->activeBufferHandle->vulkanBuffer->buffer,
@@ -9676,6 +12388,8 @@ static void VULKAN_CopyTextureToTexture(
     imageCopy.extent.height = source->h;
     imageCopy.extent.depth = source->d;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdCopyImage(
         vulkanCommandBuffer->commandBuffer,
         srcSlice->parent->image,
@@ -9736,6 +12450,8 @@ static void VULKAN_CopyBufferToBuffer(
     bufferCopy.dstOffset = copyParams->dstOffset;
     bufferCopy.size = copyParams->size;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
     renderer->vkCmdCopyBuffer(
         vulkanCommandBuffer->commandBuffer,
         srcContainer->activeBufferHandle->vulkanBuffer->buffer,
@@ -9776,62 +12492,69 @@ static void VULKAN_GenerateMipmaps(
 
     if (vulkanTexture->levelCount <= 1) { return; }
 
-    /* Blit each slice sequentially. Barriers, barriers everywhere! */
-    for (layer = 0; layer < vulkanTexture->layerCount; layer += 1)
+    /* One barrier batch and one blit per level, covering every layer at once.
+     * The queued transition back to default usage of each destination level
+     * merges with the transition to copy source for the next level.
+     */
     for (level = 1; level < vulkanTexture->levelCount; level += 1)
     {
-        srcTextureSlice = VULKAN_INTERNAL_FetchTextureSlice(
-            vulkanTexture,
-            layer,
-            level - 1
-        );
+        for (layer = 0; layer < vulkanTexture->layerCount; layer += 1)
+        {
+            srcTextureSlice = VULKAN_INTERNAL_FetchTextureSlice(
+                vulkanTexture,
+                layer,
+                level - 1
+            );
 
-        dstTextureSlice = VULKAN_INTERNAL_FetchTextureSlice(
-            vulkanTexture,
-            layer,
-            level
-        );
+            dstTextureSlice = VULKAN_INTERNAL_FetchTextureSlice(
+                vulkanTexture,
+                layer,
+                level
+            );
 
-        VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
-            renderer,
-            vulkanCommandBuffer,
-            VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
-            srcTextureSlice
-        );
+            VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
+                renderer,
+                vulkanCommandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
+                srcTextureSlice
+            );
 
-        VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
-            renderer,
-            vulkanCommandBuffer,
-            VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
-            dstTextureSlice
-        );
+            VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
+                renderer,
+                vulkanCommandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
+                dstTextureSlice
+            );
+        }
 
         blit.srcOffsets[0].x = 0;
         blit.srcOffsets[0].y = 0;
         blit.srcOffsets[0].z = 0;
 
-        blit.srcOffsets[1].x = vulkanTexture->dimensions.width >> (level - 1);
-        blit.srcOffsets[1].y = vulkanTexture->dimensions.height >> (level - 1);
+        blit.srcOffsets[1].x = SDL_max(vulkanTexture->dimensions.width >> (level - 1), 1);
+        blit.srcOffsets[1].y = SDL_max(vulkanTexture->dimensions.height >> (level - 1), 1);
         blit.srcOffsets[1].z = 1;
 
         blit.dstOffsets[0].x = 0;
         blit.dstOffsets[0].y = 0;
         blit.dstOffsets[0].z = 0;
 
-        blit.dstOffsets[1].x = vulkanTexture->dimensions.width >> level;
-        blit.dstOffsets[1].y = vulkanTexture->dimensions.height >> level;
+        blit.dstOffsets[1].x = SDL_max(vulkanTexture->dimensions.width >> level, 1);
+        blit.dstOffsets[1].y = SDL_max(vulkanTexture->dimensions.height >> level, 1);
         blit.dstOffsets[1].z = 1;
 
         blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        blit.srcSubresource.baseArrayLayer = layer;
-        blit.srcSubresource.layerCount = 1;
+        blit.srcSubresource.baseArrayLayer = 0;
+        blit.srcSubresource.layerCount = vulkanTexture->layerCount;
         blit.srcSubresource.mipLevel = level - 1;
 
         blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        blit.dstSubresource.baseArrayLayer = layer;
-        blit.dstSubresource.layerCount = 1;
+        blit.dstSubresource.baseArrayLayer = 0;
+        blit.dstSubresource.layerCount = vulkanTexture->layerCount;
         blit.dstSubresource.mipLevel = level;
 
+        VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
         renderer->vkCmdBlitImage(
             vulkanCommandBuffer->commandBuffer,
             vulkanTexture->image,
@@ -9843,30 +12566,181 @@ static void VULKAN_GenerateMipmaps(
             VK_FILTER_LINEAR
         );
 
+        for (layer = 0; layer < vulkanTexture->layerCount; layer += 1)
+        {
+            srcTextureSlice = VULKAN_INTERNAL_FetchTextureSlice(
+                vulkanTexture,
+                layer,
+                level - 1
+            );
+
+            dstTextureSlice = VULKAN_INTERNAL_FetchTextureSlice(
+                vulkanTexture,
+                layer,
+                level
+            );
+
+            VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
+                renderer,
+                vulkanCommandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
+                srcTextureSlice
+            );
+
+            VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
+                renderer,
+                vulkanCommandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
+                dstTextureSlice
+            );
+
+            VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, srcTextureSlice);
+            VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, dstTextureSlice);
+        }
+    }
+}
+
+static void VULKAN_EndCopyPass(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+
+    VULKAN_INTERNAL_EndPassTiming(
+        vulkanCommandBuffer->renderer,
+        vulkanCommandBuffer
+    );
+}
+
+static void VULKAN_BlitBatch(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuBlitRegion *blits,
+    Uint32 blitCount,
+    SDL_GpuFilter filterMode,
+    SDL_bool cycle
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+    VulkanTextureSlice **srcTextureSlices = SDL_malloc(blitCount * sizeof(VulkanTextureSlice*));
+    VulkanTextureSlice **dstTextureSlices = SDL_malloc(blitCount * sizeof(VulkanTextureSlice*));
+    VkImageBlit *regions = SDL_malloc(blitCount * sizeof(VkImageBlit));
+    SDL_GpuTextureRegion *source;
+    SDL_GpuTextureRegion *destination;
+    SDL_bool cycleDestination;
+    Uint32 runStart;
+    Uint32 i, j;
+
+    for (i = 0; i < blitCount; i += 1)
+    {
+        source = &blits[i].source;
+        destination = &blits[i].destination;
+
+        /* Only the first write to a texture may cycle it, or later blits would discard earlier ones */
+        cycleDestination = cycle;
+        for (j = 0; cycleDestination && j < i; j += 1)
+        {
+            if (blits[j].destination.textureSlice.texture == destination->textureSlice.texture)
+            {
+                cycleDestination = SDL_FALSE;
+            }
+        }
+
+        srcTextureSlices[i] = VULKAN_INTERNAL_FetchTextureSlice(
+            ((VulkanTextureContainer*) source->textureSlice.texture)->activeTextureHandle->vulkanTexture,
+            source->textureSlice.layer,
+            source->textureSlice.mipLevel
+        );
+
+        dstTextureSlices[i] = VULKAN_INTERNAL_PrepareTextureSliceForWrite(
+            renderer,
+            vulkanCommandBuffer,
+            (VulkanTextureContainer*) destination->textureSlice.texture,
+            destination->textureSlice.layer,
+            destination->textureSlice.mipLevel,
+            cycleDestination,
+            VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION
+        );
+
+        VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
+            renderer,
+            vulkanCommandBuffer,
+            VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
+            srcTextureSlices[i]
+        );
+
+        regions[i].srcSubresource.aspectMask = srcTextureSlices[i]->parent->aspectFlags;
+        regions[i].srcSubresource.baseArrayLayer = srcTextureSlices[i]->layer;
+        regions[i].srcSubresource.layerCount = 1;
+        regions[i].srcSubresource.mipLevel = srcTextureSlices[i]->level;
+        regions[i].srcOffsets[0].x = source->x;
+        regions[i].srcOffsets[0].y = source->y;
+        regions[i].srcOffsets[0].z = source->z;
+        regions[i].srcOffsets[1].x = source->x + source->w;
+        regions[i].srcOffsets[1].y = source->y + source->h;
+        regions[i].srcOffsets[1].z = source->z + source->d;
+
+        regions[i].dstSubresource.aspectMask = dstTextureSlices[i]->parent->aspectFlags;
+        regions[i].dstSubresource.baseArrayLayer = dstTextureSlices[i]->layer;
+        regions[i].dstSubresource.layerCount = 1;
+        regions[i].dstSubresource.mipLevel = dstTextureSlices[i]->level;
+        regions[i].dstOffsets[0].x = destination->x;
+        regions[i].dstOffsets[0].y = destination->y;
+        regions[i].dstOffsets[0].z = destination->z;
+        regions[i].dstOffsets[1].x = destination->x + destination->w;
+        regions[i].dstOffsets[1].y = destination->y + destination->h;
+        regions[i].dstOffsets[1].z = destination->z + destination->d;
+    }
+
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+
+    /* Consecutive blits between the same pair of images share a single command */
+    runStart = 0;
+    for (i = 1; i <= blitCount; i += 1)
+    {
+        if (
+            i < blitCount &&
+            srcTextureSlices[i]->parent == srcTextureSlices[runStart]->parent &&
+            dstTextureSlices[i]->parent == dstTextureSlices[runStart]->parent
+        ) {
+            continue;
+        }
+
+        renderer->vkCmdBlitImage(
+            vulkanCommandBuffer->commandBuffer,
+            srcTextureSlices[runStart]->parent->image,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            dstTextureSlices[runStart]->parent->image,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            i - runStart,
+            &regions[runStart],
+            SDLToVK_Filter[filterMode]
+        );
+
+        runStart = i;
+    }
+
+    for (i = 0; i < blitCount; i += 1)
+    {
         VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
             renderer,
             vulkanCommandBuffer,
             VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
-            srcTextureSlice
+            srcTextureSlices[i]
         );
 
         VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
             renderer,
             vulkanCommandBuffer,
             VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
-            dstTextureSlice
+            dstTextureSlices[i]
         );
 
-        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, srcTextureSlice);
-        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, dstTextureSlice);
+        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, srcTextureSlices[i]);
+        VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, dstTextureSlices[i]);
     }
-}
 
-static void VULKAN_EndCopyPass(
-    SDL_GpuCommandBuffer *commandBuffer
-) {
-    /* no-op */
-    (void) commandBuffer;
+    SDL_free(srcTextureSlices);
+    SDL_free(dstTextureSlices);
+    SDL_free(regions);
 }
 
 static void VULKAN_Blit(
@@ -9876,88 +12750,32 @@ static void VULKAN_Blit(
     SDL_GpuFilter filterMode,
 	SDL_bool cycle
 ) {
-    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
-    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
-    VulkanTextureContainer *sourceTextureContainer = (VulkanTextureContainer*) source->textureSlice.texture;
-    VkImageBlit region;
-
-    VulkanTextureSlice *srcTextureSlice = VULKAN_INTERNAL_FetchTextureSlice(
-        sourceTextureContainer->activeTextureHandle->vulkanTexture,
-        source->textureSlice.layer,
-        source->textureSlice.mipLevel
-    );
-
-    VulkanTextureSlice *dstTextureSlice = VULKAN_INTERNAL_PrepareTextureSliceForWrite(
-        renderer,
-        vulkanCommandBuffer,
-        (VulkanTextureContainer*) destination->textureSlice.texture,
-        destination->textureSlice.layer,
-        destination->textureSlice.mipLevel,
-        cycle,
-        VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION
-    );
+    SDL_GpuBlitRegion blit;
+    blit.source = *source;
+    blit.destination = *destination;
 
-    VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
-        renderer,
-        vulkanCommandBuffer,
-        VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
-        srcTextureSlice
-    );
-
-    region.srcSubresource.aspectMask = srcTextureSlice->parent->aspectFlags;
-    region.srcSubresource.baseArrayLayer = srcTextureSlice->layer;
-    region.srcSubresource.layerCount = 1;
-    region.srcSubresource.mipLevel = srcTextureSlice->level;
-    region.srcOffsets[0].x = source->x;
-    region.srcOffsets[0].y = source->y;
-    region.srcOffsets[0].z = source->z;
-    region.srcOffsets[1].x = source->x + source->w;
-    region.srcOffsets[1].y = source->y + source->h;
-    region.srcOffsets[1].z = source->z + source->d;
-
-    region.dstSubresource.aspectMask = dstTextureSlice->parent->aspectFlags;
-    region.dstSubresource.baseArrayLayer = dstTextureSlice->layer;
-    region.dstSubresource.layerCount = 1;
-    region.dstSubresource.mipLevel = dstTextureSlice->level;
-    region.dstOffsets[0].x = destination->x;
-    region.dstOffsets[0].y = destination->y;
-    region.dstOffsets[0].z = destination->z;
-    region.dstOffsets[1].x = destination->x + destination->w;
-    region.dstOffsets[1].y = destination->y + destination->h;
-    region.dstOffsets[1].z = destination->z + destination->d;
-
-    renderer->vkCmdBlitImage(
-        vulkanCommandBuffer->commandBuffer,
-        srcTextureSlice->parent->image,
-        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-        dstTextureSlice->parent->image,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+    VULKAN_BlitBatch(
+        commandBuffer,
+        &blit,
         1,
-        &region,
-        SDLToVK_Filter[filterMode]
+        filterMode,
+        cycle
     );
+}
 
-    VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
-        renderer,
-        vulkanCommandBuffer,
-        VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
-        srcTextureSlice
-    );
-
-    VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
-        renderer,
-        vulkanCommandBuffer,
-        VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
-        dstTextureSlice
-    );
-
-    VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, srcTextureSlice);
-    VULKAN_INTERNAL_TrackTextureSlice(renderer, vulkanCommandBuffer, dstTextureSlice);
-}
+static void VULKAN_DiscardTransientTexture(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTexture *texture
+) {
+    /* Transient images get their own dedicated memory here, there is nothing to give back */
+    (void) commandBuffer;
+    (void) texture;
+}
 
 static void VULKAN_INTERNAL_AllocateCommandBuffers(
     VulkanRenderer *renderer,
     VulkanCommandPool *vulkanCommandPool,
+    VkCommandBufferLevel level,
     Uint32 allocateCount
 ) {
     VkCommandBufferAllocateInfo allocateInfo;
@@ -9965,20 +12783,36 @@ static void VULKAN_INTERNAL_AllocateCommandBuffers(
     Uint32 i;
     VkCommandBuffer *commandBuffers = SDL_stack_alloc(VkCommandBuffer, allocateCount);
     VulkanCommandBuffer *commandBuffer;
+    VulkanCommandBuffer ***inactiveCommandBuffers;
+    Uint32 *inactiveCommandBufferCount;
+    Uint32 *inactiveCommandBufferCapacity;
 
-    vulkanCommandPool->inactiveCommandBufferCapacity += allocateCount;
+    if (level == VK_COMMAND_BUFFER_LEVEL_SECONDARY)
+    {
+        inactiveCommandBuffers = &vulkanCommandPool->inactiveSecondaryCommandBuffers;
+        inactiveCommandBufferCount = &vulkanCommandPool->inactiveSecondaryCommandBufferCount;
+        inactiveCommandBufferCapacity = &vulkanCommandPool->inactiveSecondaryCommandBufferCapacity;
+    }
+    else
+    {
+        inactiveCommandBuffers = &vulkanCommandPool->inactiveCommandBuffers;
+        inactiveCommandBufferCount = &vulkanCommandPool->inactiveCommandBufferCount;
+        inactiveCommandBufferCapacity = &vulkanCommandPool->inactiveCommandBufferCapacity;
+    }
+
+    *inactiveCommandBufferCapacity += allocateCount;
 
-    vulkanCommandPool->inactiveCommandBuffers = SDL_realloc(
-        vulkanCommandPool->inactiveCommandBuffers,
+    *inactiveCommandBuffers = SDL_realloc(
+        *inactiveCommandBuffers,
         sizeof(VulkanCommandBuffer*) *
-        vulkanCommandPool->inactiveCommandBufferCapacity
+        *inactiveCommandBufferCapacity
     );
 
     allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     allocateInfo.pNext = NULL;
     allocateInfo.commandPool = vulkanCommandPool->commandPool;
     allocateInfo.commandBufferCount = allocateCount;
-    allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocateInfo.level = level;
 
     vulkanResult = renderer->vkAllocateCommandBuffers(
         renderer->logicalDevice,
@@ -9999,6 +12833,7 @@ static void VULKAN_INTERNAL_AllocateCommandBuffers(
         commandBuffer->renderer = renderer;
         commandBuffer->commandPool = vulkanCommandPool;
         commandBuffer->commandBuffer = commandBuffers[i];
+        commandBuffer->level = level;
 
         commandBuffer->inFlightFence = VK_NULL_HANDLE;
 
@@ -10022,12 +12857,23 @@ static void VULKAN_INTERNAL_AllocateCommandBuffers(
             commandBuffer->signalSemaphoreCapacity * sizeof(VkSemaphore)
         );
 
+        SDL_zero(commandBuffer->queueWaitSemaphores);
+        SDL_zero(commandBuffer->supersededQueueSemaphores);
+
         /* Descriptor set tracking */
 
-        commandBuffer->boundDescriptorSetDataCapacity = 16;
-        commandBuffer->boundDescriptorSetDataCount = 0;
-        commandBuffer->boundDescriptorSetDatas = SDL_malloc(
-            commandBuffer->boundDescriptorSetDataCapacity * sizeof(DescriptorSetData)
+        commandBuffer->descriptorSetCacheCapacity = 16;
+        commandBuffer->descriptorSetCacheCount = 0;
+        commandBuffer->lastDescriptorSetCacheIndex = 0;
+        commandBuffer->descriptorSetCaches = SDL_malloc(
+            commandBuffer->descriptorSetCacheCapacity * sizeof(DescriptorSetCache)
+        );
+
+        SDL_zeroa(commandBuffer->writtenDescriptorSetBuckets);
+        commandBuffer->writtenDescriptorSetKeyCapacity = 64;
+        commandBuffer->writtenDescriptorSetKeyCount = 0;
+        commandBuffer->writtenDescriptorSetKeys = SDL_malloc(
+            commandBuffer->writtenDescriptorSetKeyCapacity * sizeof(Uint64)
         );
 
         /* Resource bind tracking */
@@ -10044,6 +12890,11 @@ static void VULKAN_INTERNAL_AllocateCommandBuffers(
         commandBuffer->needNewComputeUniformDescriptorSet = SDL_TRUE;
         commandBuffer->needNewComputeUniformOffsets = SDL_TRUE;
 
+        commandBuffer->graphicsBindlessTable = NULL;
+        commandBuffer->computeBindlessTable = NULL;
+        commandBuffer->needNewGraphicsBindlessTable = SDL_TRUE;
+        commandBuffer->needNewComputeBindlessTable = SDL_TRUE;
+
         commandBuffer->vertexResourceDescriptorSet = VK_NULL_HANDLE;
         commandBuffer->vertexUniformDescriptorSet = VK_NULL_HANDLE;
         commandBuffer->fragmentResourceDescriptorSet = VK_NULL_HANDLE;
@@ -10055,9 +12906,16 @@ static void VULKAN_INTERNAL_AllocateCommandBuffers(
 
         /* Uniform buffers */
 
-        commandBuffer->initializedVertexUniformBufferCount = 0;
-        commandBuffer->initializedFragmentUniformBufferCount = 0;
-        commandBuffer->initializedComputeUniformBufferCount = 0;
+        SDL_zeroa(commandBuffer->vertexUniformBuffers);
+        SDL_zeroa(commandBuffer->fragmentUniformBuffers);
+        SDL_zeroa(commandBuffer->computeUniformBuffers);
+
+        commandBuffer->uniformBlockCapacity = 4;
+        commandBuffer->uniformBlockCount = 0;
+        commandBuffer->uniformBlockCursor = 0;
+        commandBuffer->uniformBlocks = SDL_malloc(
+            commandBuffer->uniformBlockCapacity * sizeof(VulkanUniformBlock)
+        );
 
         /* Resource tracking */
 
@@ -10091,18 +12949,65 @@ static void VULKAN_INTERNAL_AllocateCommandBuffers(
             commandBuffer->usedComputePipelineCapacity * sizeof(VulkanComputePipeline*)
         );
 
+        commandBuffer->usedBindlessTableCapacity = 1;
+        commandBuffer->usedBindlessTableCount = 0;
+        commandBuffer->usedBindlessTables = SDL_malloc(
+            commandBuffer->usedBindlessTableCapacity * sizeof(VulkanBindlessTable*)
+        );
+
         commandBuffer->usedFramebufferCapacity = 4;
         commandBuffer->usedFramebufferCount = 0;
         commandBuffer->usedFramebuffers = SDL_malloc(
             commandBuffer->usedFramebufferCapacity * sizeof(VulkanFramebuffer*)
         );
 
+        /* Pending barriers */
+
+        commandBuffer->pendingBufferBarrierCapacity = 16;
+        commandBuffer->pendingBufferBarrierCount = 0;
+        commandBuffer->pendingBufferBarriers = SDL_malloc(
+            commandBuffer->pendingBufferBarrierCapacity * sizeof(VkBufferMemoryBarrier)
+        );
+        commandBuffer->pendingBufferBarrierStages = SDL_malloc(
+            commandBuffer->pendingBufferBarrierCapacity * sizeof(VulkanBarrierStages)
+        );
+
+        commandBuffer->pendingImageBarrierCapacity = 16;
+        commandBuffer->pendingImageBarrierCount = 0;
+        commandBuffer->pendingImageBarriers = SDL_malloc(
+            commandBuffer->pendingImageBarrierCapacity * sizeof(VkImageMemoryBarrier)
+        );
+        commandBuffer->pendingImageBarrierStages = SDL_malloc(
+            commandBuffer->pendingImageBarrierCapacity * sizeof(VulkanBarrierStages)
+        );
+
+        /* Pass timing */
+
+        commandBuffer->passTimingQueryPool = VK_NULL_HANDLE;
+        commandBuffer->passTimingCount = 0;
+        commandBuffer->passTimingEnabled = 0;
+
+        /* Pipeline statistics */
+
+        commandBuffer->pipelineStatisticsQueryPool = VK_NULL_HANDLE;
+        commandBuffer->pipelineStatisticsEnabled = 0;
+
+        /* Parallel render passes */
+
+        commandBuffer->currentRenderPass = VK_NULL_HANDLE;
+        commandBuffer->currentFramebuffer = VK_NULL_HANDLE;
+
+        commandBuffer->secondaryCommandBufferCapacity = 4;
+        commandBuffer->secondaryCommandBufferCount = 0;
+        commandBuffer->firstSubPassIndex = 0;
+        commandBuffer->secondaryCommandBuffers = SDL_malloc(
+            commandBuffer->secondaryCommandBufferCapacity * sizeof(VulkanCommandBuffer*)
+        );
+
         /* Pool it! */
 
-        vulkanCommandPool->inactiveCommandBuffers[
-            vulkanCommandPool->inactiveCommandBufferCount
-        ] = commandBuffer;
-        vulkanCommandPool->inactiveCommandBufferCount += 1;
+        (*inactiveCommandBuffers)[*inactiveCommandBufferCount] = commandBuffer;
+        *inactiveCommandBufferCount += 1;
     }
 
     SDL_stack_free(commandBuffers);
@@ -10110,14 +13015,18 @@ static void VULKAN_INTERNAL_AllocateCommandBuffers(
 
 static VulkanCommandPool* VULKAN_INTERNAL_FetchCommandPool(
     VulkanRenderer *renderer,
-    SDL_threadID threadID
+    SDL_threadID threadID,
+    VkQueue queue,
+    Uint32 queueFamilyIndex
 ) {
     VulkanCommandPool *vulkanCommandPool;
     VkCommandPoolCreateInfo commandPoolCreateInfo;
     VkResult vulkanResult;
     CommandPoolHash commandPoolHash;
+    Uint32 i;
 
     commandPoolHash.threadID = threadID;
+    commandPoolHash.queue = queue;
 
     vulkanCommandPool = CommandPoolHashTable_Fetch(
         &renderer->commandPoolHashTable,
@@ -10134,7 +13043,7 @@ static VulkanCommandPool* VULKAN_INTERNAL_FetchCommandPool(
     commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
     commandPoolCreateInfo.pNext = NULL;
     commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    commandPoolCreateInfo.queueFamilyIndex = renderer->queueFamilyIndex;
+    commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndex;
 
     vulkanResult = renderer->vkCreateCommandPool(
         renderer->logicalDevice,
@@ -10151,14 +13060,31 @@ static VulkanCommandPool* VULKAN_INTERNAL_FetchCommandPool(
     }
 
     vulkanCommandPool->threadID = threadID;
+    vulkanCommandPool->queueFamilyIndex = queueFamilyIndex;
+    vulkanCommandPool->queue = queue;
+    vulkanCommandPool->timeline = NULL;
+
+    for (i = 0; i < renderer->timelineCount; i += 1)
+    {
+        if (renderer->queueFamilyIndices[i] == queueFamilyIndex)
+        {
+            vulkanCommandPool->timeline = &renderer->timelines[i];
+        }
+    }
 
     vulkanCommandPool->inactiveCommandBufferCapacity = 0;
     vulkanCommandPool->inactiveCommandBufferCount = 0;
     vulkanCommandPool->inactiveCommandBuffers = NULL;
 
+    /* Allocated on the first parallel render pass recorded by this thread */
+    vulkanCommandPool->inactiveSecondaryCommandBufferCapacity = 0;
+    vulkanCommandPool->inactiveSecondaryCommandBufferCount = 0;
+    vulkanCommandPool->inactiveSecondaryCommandBuffers = NULL;
+
     VULKAN_INTERNAL_AllocateCommandBuffers(
         renderer,
         vulkanCommandPool,
+        VK_COMMAND_BUFFER_LEVEL_PRIMARY,
         2
     );
 
@@ -10173,10 +13099,12 @@ static VulkanCommandPool* VULKAN_INTERNAL_FetchCommandPool(
 
 static VulkanCommandBuffer* VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
     VulkanRenderer *renderer,
-    SDL_threadID threadID
+    SDL_threadID threadID,
+    VkQueue queue,
+    Uint32 queueFamilyIndex
 ) {
     VulkanCommandPool *commandPool =
-        VULKAN_INTERNAL_FetchCommandPool(renderer, threadID);
+        VULKAN_INTERNAL_FetchCommandPool(renderer, threadID, queue, queueFamilyIndex);
     VulkanCommandBuffer *commandBuffer;
 
     if (commandPool == NULL)
@@ -10190,6 +13118,7 @@ static VulkanCommandBuffer* VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
         VULKAN_INTERNAL_AllocateCommandBuffers(
             renderer,
             commandPool,
+            VK_COMMAND_BUFFER_LEVEL_PRIMARY,
             commandPool->inactiveCommandBufferCapacity
         );
     }
@@ -10200,32 +13129,60 @@ static VulkanCommandBuffer* VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
     return commandBuffer;
 }
 
-static SDL_GpuCommandBuffer* VULKAN_AcquireCommandBuffer(
-    SDL_GpuRenderer *driverData
+static VulkanCommandBuffer* VULKAN_INTERNAL_GetInactiveSecondaryCommandBufferFromPool(
+    VulkanRenderer *renderer,
+    SDL_threadID threadID
 ) {
-    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
-    VkResult result;
-    Uint32 i;
+    /* Sub passes only exist inside render passes, which run on the unified queue */
+    VulkanCommandPool *commandPool = VULKAN_INTERNAL_FetchCommandPool(
+        renderer,
+        threadID,
+        renderer->unifiedQueue,
+        renderer->queueFamilyIndex
+    );
+    VulkanCommandBuffer *commandBuffer;
 
-    SDL_threadID threadID = SDL_ThreadID();
+    if (commandPool == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to fetch command pool!");
+        return NULL;
+    }
 
-    SDL_LockMutex(renderer->acquireCommandBufferLock);
+    if (commandPool->inactiveSecondaryCommandBufferCount == 0)
+    {
+        VULKAN_INTERNAL_AllocateCommandBuffers(
+            renderer,
+            commandPool,
+            VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+            SDL_max(commandPool->inactiveSecondaryCommandBufferCapacity, 4)
+        );
 
-    VulkanCommandBuffer *commandBuffer =
-        VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(renderer, threadID);
+        if (commandPool->inactiveSecondaryCommandBufferCount == 0)
+        {
+            return NULL;
+        }
+    }
 
-    SDL_UnlockMutex(renderer->acquireCommandBufferLock);
+    commandBuffer = commandPool->inactiveSecondaryCommandBuffers[commandPool->inactiveSecondaryCommandBufferCount - 1];
+    commandPool->inactiveSecondaryCommandBufferCount -= 1;
 
-    if (commandBuffer == NULL)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to acquire command buffer!");
-        return NULL;
-    }
+    return commandBuffer;
+}
 
-    /* Reset state */
+static void VULKAN_INTERNAL_ResetCommandBuffer(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    VkResult result;
+    Uint32 i;
 
     commandBuffer->currentComputePipeline = NULL;
     commandBuffer->currentGraphicsPipeline = NULL;
+    commandBuffer->graphicsBindlessTable = NULL;
+    commandBuffer->computeBindlessTable = NULL;
+
+    /* Internal command buffers never pass through the front end */
+    SDL_zero(commandBuffer->common.stats);
 
     for (i = 0; i < MAX_COLOR_TARGET_BINDINGS; i += 1)
     {
@@ -10233,6 +13190,8 @@ static SDL_GpuCommandBuffer* VULKAN_AcquireCommandBuffer(
     }
 
     commandBuffer->depthStencilAttachmentSlice = NULL;
+    commandBuffer->currentRenderPass = VK_NULL_HANDLE;
+    commandBuffer->currentFramebuffer = VK_NULL_HANDLE;
 
     commandBuffer->needNewVertexResourceDescriptorSet = SDL_TRUE;
     commandBuffer->needNewVertexUniformDescriptorSet = SDL_TRUE;
@@ -10285,6 +13244,52 @@ static SDL_GpuCommandBuffer* VULKAN_AcquireCommandBuffer(
     {
         LogVulkanResultAsError("vkResetCommandBuffer", result);
     }
+}
+
+static SDL_GpuCommandBuffer* VULKAN_AcquireCommandBuffer(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuCommandQueue queue
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VkQueue vulkanQueue;
+    Uint32 queueFamilyIndex;
+
+    SDL_threadID threadID = SDL_ThreadID();
+
+    if (queue == SDL_GPU_COMMANDQUEUE_TRANSFER)
+    {
+        vulkanQueue = renderer->transferQueue;
+        queueFamilyIndex = renderer->transferQueueFamilyIndex;
+    }
+    else if (queue == SDL_GPU_COMMANDQUEUE_COMPUTE)
+    {
+        vulkanQueue = renderer->computeQueue;
+        queueFamilyIndex = renderer->computeQueueFamilyIndex;
+    }
+    else
+    {
+        vulkanQueue = renderer->unifiedQueue;
+        queueFamilyIndex = renderer->queueFamilyIndex;
+    }
+
+    SDL_LockMutex(renderer->acquireCommandBufferLock);
+
+    VulkanCommandBuffer *commandBuffer = VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
+        renderer,
+        threadID,
+        vulkanQueue,
+        queueFamilyIndex
+    );
+
+    SDL_UnlockMutex(renderer->acquireCommandBufferLock);
+
+    if (commandBuffer == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to acquire command buffer!");
+        return NULL;
+    }
+
+    VULKAN_INTERNAL_ResetCommandBuffer(renderer, commandBuffer);
 
     VULKAN_INTERNAL_BeginCommandBuffer(renderer, commandBuffer);
 
@@ -10296,11 +13301,25 @@ static SDL_bool VULKAN_QueryFence(
     SDL_GpuFence *fence
 ) {
     VulkanRenderer* renderer = (VulkanRenderer*) driverData;
+    VulkanFenceHandle *fenceHandle = (VulkanFenceHandle*) fence;
     VkResult result;
+    Uint64 value;
+
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        result = renderer->vkGetSemaphoreCounterValueKHR(
+            renderer->logicalDevice,
+            fenceHandle->timelineSemaphore,
+            &value
+        );
+        VULKAN_ERROR_CHECK(result, vkGetSemaphoreCounterValueKHR, 0)
+
+        return value >= fenceHandle->timelineValue;
+    }
 
     result = renderer->vkGetFenceStatus(
         renderer->logicalDevice,
-        ((VulkanFenceHandle*) fence)->fence
+        fenceHandle->fence
     );
 
     if (result == VK_SUCCESS)
@@ -10322,6 +13341,13 @@ static void VULKAN_INTERNAL_ReturnFenceToPool(
     VulkanRenderer *renderer,
     VulkanFenceHandle *fenceHandle
 ) {
+    /* Timeline points are not worth pooling */
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        SDL_free(fenceHandle);
+        return;
+    }
+
     SDL_LockMutex(renderer->fencePool.lock);
 
     EXPAND_ARRAY_IF_NEEDED(
@@ -10880,6 +13906,18 @@ static VulkanFenceHandle* VULKAN_INTERNAL_AcquireFenceFromPool(
     VkFence fence;
     VkResult vulkanResult;
 
+    /* The semaphore and value are filled in at submission */
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        handle = SDL_malloc(sizeof(VulkanFenceHandle));
+        handle->fence = VK_NULL_HANDLE;
+        handle->timelineSemaphore = VK_NULL_HANDLE;
+        handle->timelineValue = 0;
+        handle->passTimingCount = 0;
+        SDL_AtomicSet(&handle->referenceCount, 0);
+        return handle;
+    }
+
     if (renderer->fencePool.availableFenceCount == 0)
     {
         /* Create fence */
@@ -10902,6 +13940,7 @@ static VulkanFenceHandle* VULKAN_INTERNAL_AcquireFenceFromPool(
 
         handle = SDL_malloc(sizeof(VulkanFenceHandle));
         handle->fence = fence;
+        handle->passTimingCount = 0;
         SDL_AtomicSet(&handle->referenceCount, 0);
         return handle;
     }
@@ -10910,6 +13949,7 @@ static VulkanFenceHandle* VULKAN_INTERNAL_AcquireFenceFromPool(
 
     handle = renderer->fencePool.availableFences[renderer->fencePool.availableFenceCount - 1];
     renderer->fencePool.availableFenceCount -= 1;
+    handle->passTimingCount = 0;
 
     vulkanResult = renderer->vkResetFences(
         renderer->logicalDevice,
@@ -10935,6 +13975,21 @@ static void VULKAN_INTERNAL_PerformPendingDestroys(
 
     SDL_LockMutex(renderer->disposeLock);
 
+    /* Tables go first, they hold references on textures and samplers */
+    for (i = renderer->bindlessTablesToDestroyCount - 1; i >= 0; i -= 1)
+    {
+        if (SDL_AtomicGet(&renderer->bindlessTablesToDestroy[i]->referenceCount) == 0)
+        {
+            VULKAN_INTERNAL_DestroyBindlessTable(
+                renderer,
+                renderer->bindlessTablesToDestroy[i]
+            );
+
+            renderer->bindlessTablesToDestroy[i] = renderer->bindlessTablesToDestroy[renderer->bindlessTablesToDestroyCount - 1];
+            renderer->bindlessTablesToDestroyCount -= 1;
+        }
+    }
+
     for (i = renderer->texturesToDestroyCount - 1; i >= 0; i -= 1)
     {
         refCountTotal = 0;
@@ -11041,12 +14096,175 @@ static void VULKAN_INTERNAL_PerformPendingDestroys(
     SDL_UnlockMutex(renderer->disposeLock);
 }
 
+/* Cross-queue semaphores, all guarded by submitLock */
+
+static VkSemaphore VULKAN_INTERNAL_AcquireQueueSemaphore(
+    VulkanRenderer *renderer
+) {
+    VkSemaphoreCreateInfo semaphoreCreateInfo;
+    VkSemaphore semaphore;
+    VkResult vulkanResult;
+
+    if (renderer->availableQueueSemaphores.count > 0)
+    {
+        renderer->availableQueueSemaphores.count -= 1;
+        return renderer->availableQueueSemaphores.elements[renderer->availableQueueSemaphores.count];
+    }
+
+    semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreCreateInfo.pNext = NULL;
+    semaphoreCreateInfo.flags = 0;
+
+    vulkanResult = renderer->vkCreateSemaphore(
+        renderer->logicalDevice,
+        &semaphoreCreateInfo,
+        NULL,
+        &semaphore
+    );
+
+    if (vulkanResult != VK_SUCCESS)
+    {
+        LogVulkanResultAsError("vkCreateSemaphore", vulkanResult);
+        return VK_NULL_HANDLE;
+    }
+
+    return semaphore;
+}
+
+static void VULKAN_INTERNAL_SignalQueueSemaphore(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VkSemaphore *pPendingSemaphore
+) {
+    VkSemaphore semaphore = VULKAN_INTERNAL_AcquireQueueSemaphore(renderer);
+
+    if (semaphore == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    if (commandBuffer->signalSemaphoreCount == commandBuffer->signalSemaphoreCapacity)
+    {
+        commandBuffer->signalSemaphoreCapacity += 1;
+        commandBuffer->signalSemaphores = SDL_realloc(
+            commandBuffer->signalSemaphores,
+            commandBuffer->signalSemaphoreCapacity * sizeof(VkSemaphore)
+        );
+    }
+
+    commandBuffer->signalSemaphores[commandBuffer->signalSemaphoreCount] = semaphore;
+    commandBuffer->signalSemaphoreCount += 1;
+
+    /* Signaled binary semaphores cannot be signaled again without a wait,
+     * but once this submission retires the old signal has too, so it can be destroyed.
+     */
+    if (*pPendingSemaphore != VK_NULL_HANDLE)
+    {
+        VULKAN_INTERNAL_PushSemaphore(
+            &commandBuffer->supersededQueueSemaphores,
+            *pPendingSemaphore
+        );
+    }
+
+    *pPendingSemaphore = semaphore;
+}
+
+static void VULKAN_INTERNAL_WaitQueueSemaphore(
+    VulkanCommandBuffer *commandBuffer,
+    VkSemaphore *pPendingSemaphore
+) {
+    if (*pPendingSemaphore == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    EXPAND_ARRAY_IF_NEEDED(
+        commandBuffer->waitSemaphores,
+        VkSemaphore,
+        commandBuffer->waitSemaphoreCount + 1,
+        commandBuffer->waitSemaphoreCapacity,
+        commandBuffer->waitSemaphoreCount + 1
+    );
+
+    commandBuffer->waitSemaphores[commandBuffer->waitSemaphoreCount] = *pPendingSemaphore;
+    commandBuffer->waitSemaphoreCount += 1;
+
+    VULKAN_INTERNAL_PushSemaphore(
+        &commandBuffer->queueWaitSemaphores,
+        *pPendingSemaphore
+    );
+
+    *pPendingSemaphore = VK_NULL_HANDLE;
+}
+
+/* Transfer work is made visible to the next compute and graphics submissions,
+ * and compute work to the next graphics submission. Nothing flows the other way.
+ */
+static void VULKAN_INTERNAL_LinkQueueSemaphores(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer
+) {
+    VkQueue queue = commandBuffer->commandPool->queue;
+
+    if (queue == renderer->unifiedQueue)
+    {
+        VULKAN_INTERNAL_WaitQueueSemaphore(commandBuffer, &renderer->transferToGraphicsSemaphore);
+        VULKAN_INTERNAL_WaitQueueSemaphore(commandBuffer, &renderer->computeToGraphicsSemaphore);
+        return;
+    }
+
+    if (queue == renderer->computeQueue)
+    {
+        VULKAN_INTERNAL_WaitQueueSemaphore(commandBuffer, &renderer->transferToComputeSemaphore);
+
+        VULKAN_INTERNAL_SignalQueueSemaphore(
+            renderer,
+            commandBuffer,
+            &renderer->computeToGraphicsSemaphore
+        );
+        return;
+    }
+
+    VULKAN_INTERNAL_SignalQueueSemaphore(
+        renderer,
+        commandBuffer,
+        &renderer->transferToGraphicsSemaphore
+    );
+
+    if (renderer->computeQueue != renderer->unifiedQueue)
+    {
+        VULKAN_INTERNAL_SignalQueueSemaphore(
+            renderer,
+            commandBuffer,
+            &renderer->transferToComputeSemaphore
+        );
+    }
+}
+
 static void VULKAN_INTERNAL_CleanCommandBuffer(
     VulkanRenderer *renderer,
     VulkanCommandBuffer *commandBuffer
 ) {
+    DescriptorSetCache *descriptorSetCache;
     Uint32 i;
-    DescriptorSetData *descriptorSetData;
+
+    /* Nobody can read pass timings from an auto-released fence */
+    if (commandBuffer->passTimingEnabled)
+    {
+        if (!commandBuffer->autoReleaseFence)
+        {
+            VULKAN_INTERNAL_ResolvePassTimings(renderer, commandBuffer);
+        }
+
+        commandBuffer->passTimingEnabled = 0;
+        commandBuffer->passTimingCount = 0;
+    }
+
+    if (commandBuffer->pipelineStatisticsEnabled)
+    {
+        VULKAN_INTERNAL_ResolvePipelineStatistics(renderer, commandBuffer);
+        commandBuffer->pipelineStatisticsEnabled = 0;
+    }
 
     if (commandBuffer->autoReleaseFence)
     {
@@ -11058,30 +14276,32 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
         commandBuffer->inFlightFence = NULL;
     }
 
-    /* Bound descriptor sets are now available */
+    /* Sub passes hold their own references until the primary has finished executing */
 
-    for (i = 0; i < commandBuffer->boundDescriptorSetDataCount; i += 1)
+    for (i = 0; i < commandBuffer->secondaryCommandBufferCount; i += 1)
     {
-        descriptorSetData = &commandBuffer->boundDescriptorSetDatas[i];
-
-        SDL_LockMutex(descriptorSetData->descriptorSetPool->lock);
-
-        if (descriptorSetData->descriptorSetPool->inactiveDescriptorSetCount == descriptorSetData->descriptorSetPool->inactiveDescriptorSetCapacity)
-        {
-            descriptorSetData->descriptorSetPool->inactiveDescriptorSetCapacity *= 2;
-            descriptorSetData->descriptorSetPool->inactiveDescriptorSets = SDL_realloc(
-                descriptorSetData->descriptorSetPool->inactiveDescriptorSets,
-                descriptorSetData->descriptorSetPool->inactiveDescriptorSetCapacity * sizeof(VkDescriptorSet)
-            );
-        }
+        VULKAN_INTERNAL_CleanCommandBuffer(
+            renderer,
+            commandBuffer->secondaryCommandBuffers[i]
+        );
+    }
+    commandBuffer->secondaryCommandBufferCount = 0;
+    commandBuffer->firstSubPassIndex = 0;
 
-        descriptorSetData->descriptorSetPool->inactiveDescriptorSets[descriptorSetData->descriptorSetPool->inactiveDescriptorSetCount] = descriptorSetData->descriptorSet;
-        descriptorSetData->descriptorSetPool->inactiveDescriptorSetCount += 1;
+    /* Written sets are about to be handed out again, so forget their contents */
 
-        SDL_UnlockMutex(descriptorSetData->descriptorSetPool->lock);
+    for (i = 0; i < NUM_WRITTEN_DESCRIPTOR_SET_BUCKETS; i += 1)
+    {
+        commandBuffer->writtenDescriptorSetBuckets[i].count = 0;
     }
+    commandBuffer->writtenDescriptorSetKeyCount = 0;
+
+    /* Uniform blocks go back to the arena for any command buffer to use */
 
-    commandBuffer->boundDescriptorSetDataCount = 0;
+    VULKAN_INTERNAL_ReturnUniformBlocks(renderer, commandBuffer);
+    SDL_zeroa(commandBuffer->vertexUniformBuffers);
+    SDL_zeroa(commandBuffer->fragmentUniformBuffers);
+    SDL_zeroa(commandBuffer->computeUniformBuffers);
 
     /* Decrement reference counts */
 
@@ -11115,18 +14335,69 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
     }
     commandBuffer->usedComputePipelineCount = 0;
 
-    for (i = 0; i < commandBuffer->usedFramebufferCount; i += 1)
+    /* Cached descriptor sets are now available, rewind them all at once.
+     * Caches of released pipelines are released instead,
+     * so an idle command buffer does not keep the pipeline alive.
+     */
+
+    i = 0;
+    while (i < commandBuffer->descriptorSetCacheCount)
     {
-        (void)SDL_AtomicDecRef(&commandBuffer->usedFramebuffers[i]->referenceCount);
-    }
-    commandBuffer->usedFramebufferCount = 0;
+        descriptorSetCache = &commandBuffer->descriptorSetCaches[i];
 
-    /* Reset presentation data */
+        if (SDL_AtomicGet(&descriptorSetCache->descriptorSetPool->released))
+        {
+            VULKAN_INTERNAL_ReleaseDescriptorSetCache(descriptorSetCache);
+
+            commandBuffer->descriptorSetCaches[i] = commandBuffer->descriptorSetCaches[commandBuffer->descriptorSetCacheCount - 1];
+            commandBuffer->descriptorSetCacheCount -= 1;
+            continue;
+        }
+
+        descriptorSetCache->usedDescriptorSetCount = 0;
+        i += 1;
+    }
+    commandBuffer->lastDescriptorSetCacheIndex = 0;
+
+    for (i = 0; i < commandBuffer->usedBindlessTableCount; i += 1)
+    {
+        (void)SDL_AtomicDecRef(&commandBuffer->usedBindlessTables[i]->referenceCount);
+    }
+    commandBuffer->usedBindlessTableCount = 0;
+
+    for (i = 0; i < commandBuffer->usedFramebufferCount; i += 1)
+    {
+        (void)SDL_AtomicDecRef(&commandBuffer->usedFramebuffers[i]->referenceCount);
+    }
+    commandBuffer->usedFramebufferCount = 0;
+
+    /* Reset presentation data */
 
     commandBuffer->presentDataCount = 0;
     commandBuffer->waitSemaphoreCount = 0;
     commandBuffer->signalSemaphoreCount = 0;
 
+    /* The cross-queue semaphores have been waited on, so they can be signaled again */
+
+    for (i = 0; i < commandBuffer->queueWaitSemaphores.count; i += 1)
+    {
+        VULKAN_INTERNAL_PushSemaphore(
+            &renderer->availableQueueSemaphores,
+            commandBuffer->queueWaitSemaphores.elements[i]
+        );
+    }
+    commandBuffer->queueWaitSemaphores.count = 0;
+
+    for (i = 0; i < commandBuffer->supersededQueueSemaphores.count; i += 1)
+    {
+        renderer->vkDestroySemaphore(
+            renderer->logicalDevice,
+            commandBuffer->supersededQueueSemaphores.elements[i],
+            NULL
+        );
+    }
+    commandBuffer->supersededQueueSemaphores.count = 0;
+
     /* Reset defrag state */
 
     if (commandBuffer->isDefrag)
@@ -11138,6 +14409,26 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
 
     SDL_LockMutex(renderer->acquireCommandBufferLock);
 
+    if (commandBuffer->level == VK_COMMAND_BUFFER_LEVEL_SECONDARY)
+    {
+        EXPAND_ARRAY_IF_NEEDED(
+            commandBuffer->commandPool->inactiveSecondaryCommandBuffers,
+            VulkanCommandBuffer*,
+            commandBuffer->commandPool->inactiveSecondaryCommandBufferCount + 1,
+            commandBuffer->commandPool->inactiveSecondaryCommandBufferCapacity,
+            commandBuffer->commandPool->inactiveSecondaryCommandBufferCapacity + 1
+        );
+
+        commandBuffer->commandPool->inactiveSecondaryCommandBuffers[
+            commandBuffer->commandPool->inactiveSecondaryCommandBufferCount
+        ] = commandBuffer;
+        commandBuffer->commandPool->inactiveSecondaryCommandBufferCount += 1;
+
+        /* Secondaries are never in the submitted list */
+        SDL_UnlockMutex(renderer->acquireCommandBufferLock);
+        return;
+    }
+
     if (commandBuffer->commandPool->inactiveCommandBufferCount == commandBuffer->commandPool->inactiveCommandBufferCapacity)
     {
         commandBuffer->commandPool->inactiveCommandBufferCapacity += 1;
@@ -11165,38 +14456,45 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
     }
 }
 
-static void VULKAN_WaitForFences(
-    SDL_GpuRenderer *driverData,
-    SDL_bool waitAll,
-    Uint32 fenceCount,
-    SDL_GpuFence **pFences
+/* Must be called with submitLock held */
+static Uint8 VULKAN_INTERNAL_CleanCompletedCommandBuffers(
+    VulkanRenderer *renderer
 ) {
-    VulkanRenderer* renderer = (VulkanRenderer*) driverData;
-    VkFence* fences = SDL_stack_alloc(VkFence, fenceCount);
+    VulkanCommandBuffer *commandBuffer;
     VkResult result;
+    Uint8 commandBufferCleaned = 0;
     Sint32 i;
 
-    for (i = 0; i < fenceCount; i += 1)
+    if (renderer->supports.KHR_timeline_semaphore)
     {
-        fences[i] = ((VulkanFenceHandle*) pFences[i])->fence;
-    }
+        /* One counter read per queue covers every command buffer submitted to it */
+        for (i = 0; i < (Sint32) renderer->timelineCount; i += 1)
+        {
+            result = renderer->vkGetSemaphoreCounterValueKHR(
+                renderer->logicalDevice,
+                renderer->timelines[i].semaphore,
+                &renderer->timelines[i].completedValue
+            );
 
-    result = renderer->vkWaitForFences(
-        renderer->logicalDevice,
-        fenceCount,
-        fences,
-        waitAll,
-        UINT64_MAX
-    );
+            if (result != VK_SUCCESS)
+            {
+                LogVulkanResultAsError("vkGetSemaphoreCounterValueKHR", result);
+            }
+        }
 
-    if (result != VK_SUCCESS)
-    {
-        LogVulkanResultAsError("vkWaitForFences", result);
-    }
+        for (i = renderer->submittedCommandBufferCount - 1; i >= 0; i -= 1)
+        {
+            commandBuffer = renderer->submittedCommandBuffers[i];
 
-    SDL_stack_free(fences);
+            if (commandBuffer->inFlightFence->timelineValue <= commandBuffer->commandPool->timeline->completedValue)
+            {
+                VULKAN_INTERNAL_CleanCommandBuffer(renderer, commandBuffer);
+                commandBufferCleaned = 1;
+            }
+        }
 
-    SDL_LockMutex(renderer->submitLock);
+        return commandBufferCleaned;
+    }
 
     for (i = renderer->submittedCommandBufferCount - 1; i >= 0; i -= 1)
     {
@@ -11211,9 +14509,89 @@ static void VULKAN_WaitForFences(
                 renderer,
                 renderer->submittedCommandBuffers[i]
             );
+
+            commandBufferCleaned = 1;
         }
     }
 
+    return commandBufferCleaned;
+}
+
+static void VULKAN_WaitForFences(
+    SDL_GpuRenderer *driverData,
+    SDL_bool waitAll,
+    Uint32 fenceCount,
+    SDL_GpuFence **pFences
+) {
+    VulkanRenderer* renderer = (VulkanRenderer*) driverData;
+    VkSemaphoreWaitInfoKHR waitInfo;
+    VkSemaphore *semaphores;
+    Uint64 *values;
+    VkFence *fences;
+    VkResult result;
+    Sint32 i;
+
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        semaphores = SDL_stack_alloc(VkSemaphore, fenceCount);
+        values = SDL_stack_alloc(Uint64, fenceCount);
+
+        for (i = 0; i < fenceCount; i += 1)
+        {
+            semaphores[i] = ((VulkanFenceHandle*) pFences[i])->timelineSemaphore;
+            values[i] = ((VulkanFenceHandle*) pFences[i])->timelineValue;
+        }
+
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        waitInfo.pNext = NULL;
+        waitInfo.flags = waitAll ? 0 : VK_SEMAPHORE_WAIT_ANY_BIT_KHR;
+        waitInfo.semaphoreCount = fenceCount;
+        waitInfo.pSemaphores = semaphores;
+        waitInfo.pValues = values;
+
+        result = renderer->vkWaitSemaphoresKHR(
+            renderer->logicalDevice,
+            &waitInfo,
+            UINT64_MAX
+        );
+
+        if (result != VK_SUCCESS)
+        {
+            LogVulkanResultAsError("vkWaitSemaphoresKHR", result);
+        }
+
+        SDL_stack_free(semaphores);
+        SDL_stack_free(values);
+    }
+    else
+    {
+        fences = SDL_stack_alloc(VkFence, fenceCount);
+
+        for (i = 0; i < fenceCount; i += 1)
+        {
+            fences[i] = ((VulkanFenceHandle*) pFences[i])->fence;
+        }
+
+        result = renderer->vkWaitForFences(
+            renderer->logicalDevice,
+            fenceCount,
+            fences,
+            waitAll,
+            UINT64_MAX
+        );
+
+        if (result != VK_SUCCESS)
+        {
+            LogVulkanResultAsError("vkWaitForFences", result);
+        }
+
+        SDL_stack_free(fences);
+    }
+
+    SDL_LockMutex(renderer->submitLock);
+
+    VULKAN_INTERNAL_CleanCompletedCommandBuffers(renderer);
+
     VULKAN_INTERNAL_PerformPendingDestroys(renderer);
 
     SDL_UnlockMutex(renderer->submitLock);
@@ -11267,10 +14645,14 @@ static void VULKAN_Submit(
     VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
     VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
     VkSubmitInfo submitInfo;
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo;
+    Uint64 *signalValues = NULL;
+    VulkanTimeline *timeline;
     VkPresentInfoKHR presentInfo;
     VulkanPresentData *presentData;
     VkResult vulkanResult, presentResult = VK_SUCCESS;
-    VkPipelineStageFlags waitStages[MAX_PRESENT_COUNT];
+    VkPipelineStageFlags *waitStages;
+    Uint32 swapchainWaitCount;
     Uint32 swapchainImageIndex;
     VulkanTextureSlice *swapchainTextureSlice;
     Uint8 commandBufferCleaned = 0;
@@ -11278,12 +14660,22 @@ static void VULKAN_Submit(
     SDL_bool presenting = SDL_FALSE;
     Sint32 i, j;
 
+    /* The command buffer is still exclusively ours, so trim its descriptor set caches before locking */
+    VULKAN_INTERNAL_TrimDescriptorSetCaches(vulkanCommandBuffer);
+
     SDL_LockMutex(renderer->submitLock);
 
-    /* FIXME: Can this just be permanent? */
-    for (i = 0; i < MAX_PRESENT_COUNT; i += 1)
+    /* Swapchain acquires come first, then whatever the other queues left for us */
+    swapchainWaitCount = vulkanCommandBuffer->waitSemaphoreCount;
+    VULKAN_INTERNAL_LinkQueueSemaphores(renderer, vulkanCommandBuffer);
+
+    waitStages = SDL_stack_alloc(VkPipelineStageFlags, vulkanCommandBuffer->waitSemaphoreCount + 1);
+
+    for (i = 0; i < (Sint32) vulkanCommandBuffer->waitSemaphoreCount; i += 1)
     {
-        waitStages[i] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        waitStages[i] = (i < (Sint32) swapchainWaitCount) ?
+            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT :
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
     }
 
     for (j = 0; j < vulkanCommandBuffer->presentDataCount; j += 1)
@@ -11305,6 +14697,10 @@ static void VULKAN_Submit(
 
     VULKAN_INTERNAL_EndCommandBuffer(renderer, vulkanCommandBuffer);
 
+    /* The front end has already flushed the recording, this catches the submit barriers */
+    AccumulateFrameStats(&renderer->frameStats, &vulkanCommandBuffer->common.stats);
+    SDL_zero(vulkanCommandBuffer->common.stats);
+
     vulkanCommandBuffer->inFlightFence = VULKAN_INTERNAL_AcquireFenceFromPool(renderer);
 
     /* Command buffer has a reference to the in-flight fence */
@@ -11318,16 +14714,59 @@ static void VULKAN_Submit(
     submitInfo.pWaitDstStageMask = waitStages;
     submitInfo.pWaitSemaphores = vulkanCommandBuffer->waitSemaphores;
     submitInfo.waitSemaphoreCount = vulkanCommandBuffer->waitSemaphoreCount;
+
+    /* The next point on this queue's timeline stands in for the fence */
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        timeline = vulkanCommandBuffer->commandPool->timeline;
+        timeline->submittedValue += 1;
+
+        vulkanCommandBuffer->inFlightFence->timelineSemaphore = timeline->semaphore;
+        vulkanCommandBuffer->inFlightFence->timelineValue = timeline->submittedValue;
+
+        EXPAND_ARRAY_IF_NEEDED(
+            vulkanCommandBuffer->signalSemaphores,
+            VkSemaphore,
+            vulkanCommandBuffer->signalSemaphoreCount + 1,
+            vulkanCommandBuffer->signalSemaphoreCapacity,
+            vulkanCommandBuffer->signalSemaphoreCount + 1
+        );
+
+        vulkanCommandBuffer->signalSemaphores[vulkanCommandBuffer->signalSemaphoreCount] = timeline->semaphore;
+        vulkanCommandBuffer->signalSemaphoreCount += 1;
+
+        /* Values are ignored for the binary semaphores */
+        signalValues = SDL_stack_alloc(Uint64, vulkanCommandBuffer->signalSemaphoreCount);
+        SDL_memset(signalValues, 0, sizeof(Uint64) * vulkanCommandBuffer->signalSemaphoreCount);
+        signalValues[vulkanCommandBuffer->signalSemaphoreCount - 1] = timeline->submittedValue;
+
+        timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineSubmitInfo.pNext = NULL;
+        timelineSubmitInfo.waitSemaphoreValueCount = 0;
+        timelineSubmitInfo.pWaitSemaphoreValues = NULL;
+        timelineSubmitInfo.signalSemaphoreValueCount = vulkanCommandBuffer->signalSemaphoreCount;
+        timelineSubmitInfo.pSignalSemaphoreValues = signalValues;
+
+        submitInfo.pNext = &timelineSubmitInfo;
+    }
+
     submitInfo.pSignalSemaphores = vulkanCommandBuffer->signalSemaphores;
     submitInfo.signalSemaphoreCount = vulkanCommandBuffer->signalSemaphoreCount;
 
     vulkanResult = renderer->vkQueueSubmit(
-        renderer->unifiedQueue,
+        vulkanCommandBuffer->commandPool->queue,
         1,
         &submitInfo,
         vulkanCommandBuffer->inFlightFence->fence
     );
 
+    SDL_stack_free(waitStages);
+
+    if (signalValues != NULL)
+    {
+        SDL_stack_free(signalValues);
+    }
+
     if (vulkanResult != VK_SUCCESS)
     {
         LogVulkanResultAsError("vkQueueSubmit", vulkanResult);
@@ -11396,23 +14835,7 @@ static void VULKAN_Submit(
 
     /* Check if we can perform any cleanups */
 
-    for (i = renderer->submittedCommandBufferCount - 1; i >= 0; i -= 1)
-    {
-        vulkanResult = renderer->vkGetFenceStatus(
-            renderer->logicalDevice,
-            renderer->submittedCommandBuffers[i]->inFlightFence->fence
-        );
-
-        if (vulkanResult == VK_SUCCESS)
-        {
-            VULKAN_INTERNAL_CleanCommandBuffer(
-                renderer,
-                renderer->submittedCommandBuffers[i]
-            );
-
-            commandBufferCleaned = 1;
-        }
-    }
+    commandBufferCleaned = VULKAN_INTERNAL_CleanCompletedCommandBuffers(renderer);
 
     if (commandBufferCleaned)
     {
@@ -11438,6 +14861,14 @@ static void VULKAN_Submit(
         SDL_UnlockMutex(renderer->allocatorLock);
     }
 
+    /* Age out framebuffers that have not been used for a while */
+    if (
+        (Uint32) (SDL_AtomicAdd(&renderer->submitCounter, 1) + 1) % FRAMEBUFFER_EVICTION_INTERVAL == 0 &&
+        !renderer->supports.KHR_dynamic_rendering
+    ) {
+        VULKAN_INTERNAL_EvictStaleFramebuffers(renderer);
+    }
+
     /* Check pending destroys */
     VULKAN_INTERNAL_PerformPendingDestroys(renderer);
 
@@ -11447,337 +14878,1071 @@ static void VULKAN_Submit(
         renderer->allocationsToDefragCount > 0 &&
         !renderer->defragInProgress
     ) {
-        VULKAN_INTERNAL_DefragmentMemory(renderer);
+        VULKAN_INTERNAL_DefragmentMemory(
+            renderer,
+            DEFRAG_BYTES_PER_PASS,
+            DEFRAG_MILLISECONDS_PER_PASS
+        );
     }
 
     SDL_UnlockMutex(renderer->submitLock);
 }
 
-static Uint8 VULKAN_INTERNAL_DefragmentMemory(
-    VulkanRenderer *renderer
+static SDL_bool VULKAN_INTERNAL_IsRegionInFlight(
+    VulkanMemoryUsedRegion *region
+) {
+    Uint32 i;
+
+    if (region->isBuffer)
+    {
+        return SDL_AtomicGet(&region->vulkanBuffer->referenceCount) > 0;
+    }
+
+    for (i = 0; i < region->vulkanTexture->sliceCount; i += 1)
+    {
+        if (SDL_AtomicGet(&region->vulkanTexture->slices[i].referenceCount) > 0)
+        {
+            return SDL_TRUE;
+        }
+    }
+
+    return SDL_FALSE;
+}
+
+static Uint8 VULKAN_INTERNAL_DefragmentBuffer(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VulkanMemoryUsedRegion *currentRegion
 ) {
-    VulkanMemoryAllocation *allocation;
-    VulkanMemoryUsedRegion *currentRegion;
     VulkanBuffer* newBuffer;
-    VulkanTexture* newTexture;
     VkBufferCopy bufferCopy;
+
+    currentRegion->vulkanBuffer->usageFlags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+    newBuffer = VULKAN_INTERNAL_CreateBuffer(
+        renderer,
+        currentRegion->vulkanBuffer->size,
+        currentRegion->vulkanBuffer->usageFlags,
+        currentRegion->vulkanBuffer->type
+    );
+
+    if (newBuffer == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create defrag buffer!");
+        return 0;
+    }
+
+    if (
+        renderer->debugMode &&
+        renderer->supportsDebugUtils &&
+        currentRegion->vulkanBuffer->handle != NULL &&
+        currentRegion->vulkanBuffer->handle->container != NULL &&
+        currentRegion->vulkanBuffer->handle->container->debugName != NULL
+    ) {
+        VULKAN_INTERNAL_SetBufferName(
+            renderer,
+            newBuffer,
+            currentRegion->vulkanBuffer->handle->container->debugName
+        );
+    }
+
+    /* Copy buffer contents if necessary */
+    if (
+        currentRegion->vulkanBuffer->type == VULKAN_BUFFER_TYPE_GPU && currentRegion->vulkanBuffer->transitioned
+    ) {
+        VULKAN_INTERNAL_BufferTransitionFromDefaultUsage(
+            renderer,
+            commandBuffer,
+            VULKAN_BUFFER_USAGE_MODE_COPY_SOURCE,
+            currentRegion->vulkanBuffer
+        );
+
+        VULKAN_INTERNAL_BufferTransitionFromDefaultUsage(
+            renderer,
+            commandBuffer,
+            VULKAN_BUFFER_USAGE_MODE_COPY_DESTINATION,
+            newBuffer
+        );
+
+        bufferCopy.srcOffset = 0;
+        bufferCopy.dstOffset = 0;
+        bufferCopy.size = currentRegion->resourceSize;
+
+        VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
+
+        renderer->vkCmdCopyBuffer(
+            commandBuffer->commandBuffer,
+            currentRegion->vulkanBuffer->buffer,
+            newBuffer->buffer,
+            1,
+            &bufferCopy
+        );
+
+        VULKAN_INTERNAL_BufferTransitionToDefaultUsage(
+            renderer,
+            commandBuffer,
+            VULKAN_BUFFER_USAGE_MODE_COPY_DESTINATION,
+            newBuffer
+        );
+
+        VULKAN_INTERNAL_TrackBuffer(renderer, commandBuffer, currentRegion->vulkanBuffer);
+        VULKAN_INTERNAL_TrackBuffer(renderer, commandBuffer, newBuffer);
+    }
+
+    /* re-point original container to new buffer */
+    if (currentRegion->vulkanBuffer->handle != NULL)
+    {
+        newBuffer->handle = currentRegion->vulkanBuffer->handle;
+        newBuffer->handle->vulkanBuffer = newBuffer;
+        currentRegion->vulkanBuffer->handle = NULL;
+    }
+
+    VULKAN_INTERNAL_ReleaseBuffer(renderer, currentRegion->vulkanBuffer);
+
+    return 1;
+}
+
+static Uint8 VULKAN_INTERNAL_DefragmentTexture(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VulkanMemoryUsedRegion *currentRegion
+) {
+    VulkanTexture* newTexture;
     VkImageCopy imageCopy;
-    VulkanCommandBuffer *commandBuffer;
     VulkanTextureSlice *srcSlice;
     VulkanTextureSlice *dstSlice;
-    Uint32 i, sliceIndex;
+    Uint32 sliceIndex;
+
+    newTexture = VULKAN_INTERNAL_CreateTexture(
+        renderer,
+        currentRegion->vulkanTexture->dimensions.width,
+        currentRegion->vulkanTexture->dimensions.height,
+        currentRegion->vulkanTexture->depth,
+        currentRegion->vulkanTexture->isCube,
+        currentRegion->vulkanTexture->layerCount,
+        currentRegion->vulkanTexture->levelCount,
+        currentRegion->vulkanTexture->sampleCount,
+        currentRegion->vulkanTexture->format,
+        currentRegion->vulkanTexture->swizzle,
+        currentRegion->vulkanTexture->aspectFlags,
+        currentRegion->vulkanTexture->usageFlags
+    );
+
+    if (newTexture == NULL)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create defrag texture!");
+        return 0;
+    }
+
+    for (sliceIndex = 0; sliceIndex < currentRegion->vulkanTexture->sliceCount; sliceIndex += 1)
+    {
+        /* copy slice if necessary */
+        srcSlice = &currentRegion->vulkanTexture->slices[sliceIndex];
+        dstSlice = &newTexture->slices[sliceIndex];
+
+        /* Set debug name if it exists */
+        if (
+            renderer->debugMode &&
+            renderer->supportsDebugUtils &&
+            srcSlice->parent->handle != NULL &&
+            srcSlice->parent->handle->container != NULL &&
+            srcSlice->parent->handle->container->debugName != NULL
+        ) {
+            VULKAN_INTERNAL_SetTextureName(
+                renderer,
+                currentRegion->vulkanTexture,
+                srcSlice->parent->handle->container->debugName
+            );
+        }
+
+        if (srcSlice->transitioned)
+        {
+            VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
+                renderer,
+                commandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
+                srcSlice
+            );
+
+            VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
+                renderer,
+                commandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
+                dstSlice
+            );
+
+            imageCopy.srcOffset.x = 0;
+            imageCopy.srcOffset.y = 0;
+            imageCopy.srcOffset.z = 0;
+            imageCopy.srcSubresource.aspectMask = srcSlice->parent->aspectFlags;
+            imageCopy.srcSubresource.baseArrayLayer = srcSlice->layer;
+            imageCopy.srcSubresource.layerCount = 1;
+            imageCopy.srcSubresource.mipLevel = srcSlice->level;
+            imageCopy.extent.width = SDL_max(1, srcSlice->parent->dimensions.width >> srcSlice->level);
+            imageCopy.extent.height = SDL_max(1, srcSlice->parent->dimensions.height >> srcSlice->level);
+            imageCopy.extent.depth = srcSlice->parent->depth;
+            imageCopy.dstOffset.x = 0;
+            imageCopy.dstOffset.y = 0;
+            imageCopy.dstOffset.z = 0;
+            imageCopy.dstSubresource.aspectMask = dstSlice->parent->aspectFlags;
+            imageCopy.dstSubresource.baseArrayLayer = dstSlice->layer;
+            imageCopy.dstSubresource.layerCount = 1;
+            imageCopy.dstSubresource.mipLevel = dstSlice->level;
+
+            VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
+
+            renderer->vkCmdCopyImage(
+                commandBuffer->commandBuffer,
+                currentRegion->vulkanTexture->image,
+                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                newTexture->image,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                1,
+                &imageCopy
+            );
+
+            VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
+                renderer,
+                commandBuffer,
+                VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
+                dstSlice
+            );
+
+            VULKAN_INTERNAL_TrackTextureSlice(renderer, commandBuffer, srcSlice);
+            VULKAN_INTERNAL_TrackTextureSlice(renderer, commandBuffer, dstSlice);
+        }
+    }
+
+    /* re-point original container to new texture */
+    newTexture->handle = currentRegion->vulkanTexture->handle;
+    newTexture->handle->vulkanTexture = newTexture;
+    currentRegion->vulkanTexture->handle = NULL;
+
+    VULKAN_INTERNAL_ReleaseTexture(renderer, currentRegion->vulkanTexture);
+
+    return 1;
+}
+
+/* Moves regions out of the allocations marked for defrag until the byte or
+ * time budget runs out. Regions that submitted command buffers still use are
+ * left for a later pass, and the allocator lock is only held per region.
+ * Returns SDL_TRUE if marked allocations remain.
+ */
+static SDL_bool VULKAN_INTERNAL_DefragmentMemory(
+    VulkanRenderer *renderer,
+    Uint32 maxBytes,
+    Uint32 maxMilliseconds
+) {
+    VulkanMemoryAllocation *allocation;
+    VulkanMemoryUsedRegion *currentRegion;
+    VulkanCommandBuffer *commandBuffer = NULL;
+    SDL_bool regionsInFlight;
+    Uint64 deadline;
+    Uint64 bytesMoved = 0;
+    Uint8 result;
+    Uint32 i;
+
+    deadline =
+        SDL_GetPerformanceCounter() +
+        ((SDL_GetPerformanceFrequency() * maxMilliseconds) / 1000);
+
+    while (renderer->allocationsToDefragCount > 0)
+    {
+        SDL_LockMutex(renderer->allocatorLock);
+
+        allocation = renderer->allocationsToDefrag[renderer->allocationsToDefragCount - 1];
+        currentRegion = NULL;
+        regionsInFlight = SDL_FALSE;
+
+        /* Moved resources linger until their pending destroy, skip those too */
+        for (i = 0; i < allocation->usedRegionCount; i += 1)
+        {
+            if (allocation->usedRegions[i]->isBuffer ?
+                allocation->usedRegions[i]->vulkanBuffer->markedForDestroy :
+                allocation->usedRegions[i]->vulkanTexture->markedForDestroy
+            ) {
+                continue;
+            }
+
+            if (VULKAN_INTERNAL_IsRegionInFlight(allocation->usedRegions[i]))
+            {
+                regionsInFlight = SDL_TRUE;
+                continue;
+            }
+
+            currentRegion = allocation->usedRegions[i];
+            break;
+        }
+
+        if (currentRegion == NULL)
+        {
+            if (!regionsInFlight)
+            {
+                /* Everything has moved, the allocation frees once its old resources are destroyed */
+                renderer->allocationsToDefragCount -= 1;
+            }
+
+            SDL_UnlockMutex(renderer->allocatorLock);
+
+            if (regionsInFlight)
+            {
+                break;
+            }
+            continue;
+        }
+
+        if (commandBuffer == NULL)
+        {
+            renderer->defragInProgress = 1;
+
+            commandBuffer = (VulkanCommandBuffer*) VULKAN_AcquireCommandBuffer(
+                (SDL_GpuRenderer *) renderer,
+                SDL_GPU_COMMANDQUEUE_GRAPHICS
+            );
+            commandBuffer->isDefrag = 1;
+        }
+
+        bytesMoved += currentRegion->resourceSize;
+
+        if (currentRegion->isBuffer)
+        {
+            result = VULKAN_INTERNAL_DefragmentBuffer(renderer, commandBuffer, currentRegion);
+        }
+        else
+        {
+            result = VULKAN_INTERNAL_DefragmentTexture(renderer, commandBuffer, currentRegion);
+        }
+
+        SDL_UnlockMutex(renderer->allocatorLock);
+
+        /* Always move at least one region so oversized resources still make progress */
+        if (
+            !result ||
+            bytesMoved >= maxBytes ||
+            SDL_GetPerformanceCounter() >= deadline
+        ) {
+            break;
+        }
+    }
+
+    if (commandBuffer != NULL)
+    {
+        VULKAN_Submit(
+            (SDL_GpuCommandBuffer*) commandBuffer
+        );
+    }
+
+    return renderer->allocationsToDefragCount > 0;
+}
+
+static SDL_bool VULKAN_Defragment(
+    SDL_GpuRenderer *driverData,
+    Uint32 maxBytes,
+    Uint32 maxMilliseconds
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    SDL_bool result;
+
+    SDL_LockMutex(renderer->submitLock);
+
+    /* There is no allocation pressure to trigger marking without presenting, so do it here */
+    if (renderer->allocationsToDefragCount == 0 && !renderer->defragInProgress)
+    {
+        SDL_LockMutex(renderer->allocatorLock);
+        VULKAN_INTERNAL_MarkAllocationsForDefrag(renderer);
+        SDL_UnlockMutex(renderer->allocatorLock);
+    }
+
+    if (renderer->defragInProgress)
+    {
+        /* The previous pass hasn't retired yet */
+        result = renderer->allocationsToDefragCount > 0;
+    }
+    else
+    {
+        result = VULKAN_INTERNAL_DefragmentMemory(
+            renderer,
+            maxBytes == 0 ? DEFRAG_BYTES_PER_PASS : maxBytes,
+            maxMilliseconds == 0 ? DEFRAG_MILLISECONDS_PER_PASS : maxMilliseconds
+        );
+    }
+
+    SDL_UnlockMutex(renderer->submitLock);
+
+    return result;
+}
+
+static void VULKAN_GetFrameStats(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuFrameStats *stats
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+
+    SDL_LockMutex(renderer->submitLock);
+    AccumulateFrameStats(stats, &renderer->frameStats);
+    SDL_zero(renderer->frameStats);
+    SDL_UnlockMutex(renderer->submitLock);
+}
+
+static void VULKAN_GetMemoryStats(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuMemoryStats *stats
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties;
+    VkPhysicalDeviceMemoryProperties2KHR memoryProperties;
+    VulkanMemorySubAllocator *allocator;
+    VulkanMemoryAllocation *allocation;
+    VulkanMemoryUsedRegion *usedRegion;
+    SDL_GpuMemoryHeapStats *heapStats;
+    Uint32 i, j, k;
+
+    stats->heapCount = SDL_min(
+        renderer->memoryProperties.memoryHeapCount,
+        SDL_GPU_MAX_MEMORY_HEAPS
+    );
+
+    if (renderer->supports.EXT_memory_budget)
+    {
+        budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+        budgetProperties.pNext = NULL;
+
+        memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
+        memoryProperties.pNext = &budgetProperties;
+
+        renderer->vkGetPhysicalDeviceMemoryProperties2KHR(
+            renderer->physicalDevice,
+            &memoryProperties
+        );
+    }
+
+    SDL_LockMutex(renderer->allocatorLock);
+
+    for (i = 0; i < renderer->memoryProperties.memoryTypeCount; i += 1)
+    {
+        if (renderer->memoryProperties.memoryTypes[i].heapIndex >= stats->heapCount)
+        {
+            continue;
+        }
+
+        heapStats = &stats->heaps[renderer->memoryProperties.memoryTypes[i].heapIndex];
+        allocator = &renderer->memoryAllocator->subAllocators[i];
+
+        for (j = 0; j < allocator->allocationCount; j += 1)
+        {
+            allocation = allocator->allocations[j];
+
+            heapStats->allocatedBytes += allocation->size;
+            heapStats->usedBytes += allocation->usedSpace;
+            heapStats->allocationCount += 1;
+            heapStats->freeBlockCount += allocation->freeRegionCount;
+
+            for (k = 0; k < allocation->freeRegionCount; k += 1)
+            {
+                heapStats->largestFreeBlockBytes = SDL_max(
+                    heapStats->largestFreeBlockBytes,
+                    allocation->freeRegions[k]->size
+                );
+            }
+
+            for (k = 0; k < allocation->usedRegionCount; k += 1)
+            {
+                usedRegion = allocation->usedRegions[k];
+
+                if (!usedRegion->isBuffer)
+                {
+                    stats->textureCount += 1;
+                }
+                else if (
+                    usedRegion->vulkanBuffer != NULL &&
+                    usedRegion->vulkanBuffer->type == VULKAN_BUFFER_TYPE_GPU
+                ) {
+                    stats->bufferCount += 1;
+                }
+            }
+        }
+    }
+
+    SDL_UnlockMutex(renderer->allocatorLock);
+
+    for (i = 0; i < stats->heapCount; i += 1)
+    {
+        heapStats = &stats->heaps[i];
+
+        heapStats->deviceLocal =
+            (renderer->memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+
+        if (renderer->supports.EXT_memory_budget)
+        {
+            heapStats->budgetBytes = budgetProperties.heapBudget[i];
+            heapStats->usageBytes = budgetProperties.heapUsage[i];
+        }
+        else
+        {
+            heapStats->budgetBytes = renderer->memoryProperties.memoryHeaps[i].size;
+            heapStats->usageBytes = heapStats->allocatedBytes;
+        }
+    }
+}
+
+/* Queries */
+
+static SDL_GpuOcclusionQuery* VULKAN_CreateOcclusionQuery(
+    SDL_GpuRenderer *driverData
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VulkanOcclusionQuery *query = (VulkanOcclusionQuery*) SDL_malloc(sizeof(VulkanOcclusionQuery));
+
+    SDL_LockMutex(renderer->queryLock);
+
+    if (renderer->freeQueryIndexStackHead == -1)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Query limit of %d has been exceeded!",
+            MAX_QUERIES
+        );
+        return NULL;
+    }
+
+    query->index = (Uint32) renderer->freeQueryIndexStackHead;
+    renderer->freeQueryIndexStackHead = renderer->freeQueryIndexStack[renderer->freeQueryIndexStackHead];
+
+    SDL_UnlockMutex(renderer->queryLock);
+
+    return (SDL_GpuOcclusionQuery*) query;
+}
+
+static void VULKAN_OcclusionQueryBegin(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuOcclusionQuery *query
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+	VulkanOcclusionQuery *vulkanQuery = (VulkanOcclusionQuery*) query;
+
+	renderer->vkCmdResetQueryPool(
+		vulkanCommandBuffer->commandBuffer,
+		renderer->queryPool,
+		vulkanQuery->index,
+		1
+	);
+
+	renderer->vkCmdBeginQuery(
+		vulkanCommandBuffer->commandBuffer,
+		renderer->queryPool,
+		vulkanQuery->index,
+		renderer->supportsPreciseOcclusionQueries ?
+			VK_QUERY_CONTROL_PRECISE_BIT :
+			0
+	);
+}
+
+static void VULKAN_OcclusionQueryEnd(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuOcclusionQuery *query
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+	VulkanOcclusionQuery *vulkanQuery = (VulkanOcclusionQuery*) query;
+
+	renderer->vkCmdEndQuery(
+		vulkanCommandBuffer->commandBuffer,
+		renderer->queryPool,
+		vulkanQuery->index
+	);
+}
+
+static SDL_bool VULKAN_OcclusionQueryPixelCount(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuOcclusionQuery *query,
+    Uint32 *pixelCount
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+	VulkanOcclusionQuery *vulkanQuery = (VulkanOcclusionQuery*) query;
+    VkResult vulkanResult;
+	Uint32 queryResult;
+
+    SDL_LockMutex(renderer->queryLock);
+    vulkanResult = renderer->vkGetQueryPoolResults(
+        renderer->logicalDevice,
+        renderer->queryPool,
+        vulkanQuery->index,
+        1,
+        sizeof(queryResult),
+        &queryResult,
+        0,
+        0
+    );
+    SDL_UnlockMutex(renderer->queryLock);
+
+    *pixelCount = queryResult;
+    return vulkanResult == VK_SUCCESS;
+}
+
+static SDL_GpuTimestampQuery* VULKAN_CreateTimestampQuery(
+    SDL_GpuRenderer *driverData
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VulkanTimestampQuery *query;
+
+    if (!renderer->supportsTimestamps)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Timestamp queries are not supported on this device!"
+        );
+        return NULL;
+    }
+
+    query = (VulkanTimestampQuery*) SDL_malloc(sizeof(VulkanTimestampQuery));
+
+    SDL_LockMutex(renderer->queryLock);
+
+    if (renderer->freeTimestampQueryIndexStackHead == -1)
+    {
+        SDL_UnlockMutex(renderer->queryLock);
+        SDL_free(query);
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Timestamp query limit of %d has been exceeded!",
+            MAX_TIMESTAMP_QUERIES
+        );
+        return NULL;
+    }
+
+    query->index = (Uint32) renderer->freeTimestampQueryIndexStackHead;
+    renderer->freeTimestampQueryIndexStackHead = renderer->freeTimestampQueryIndexStack[renderer->freeTimestampQueryIndexStackHead];
+
+    SDL_UnlockMutex(renderer->queryLock);
+
+    return (SDL_GpuTimestampQuery*) query;
+}
+
+static SDL_bool VULKAN_INTERNAL_IsTransferOnlyQueue(
+    VulkanRenderer *renderer,
+    VkQueue queue
+) {
+    return (
+        queue != renderer->unifiedQueue &&
+        queue != renderer->computeQueue
+    );
+}
+
+static void VULKAN_WriteTimestamp(
+    SDL_GpuCommandBuffer *commandBuffer,
+    SDL_GpuTimestampQuery *query
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+    VulkanTimestampQuery *vulkanQuery = (VulkanTimestampQuery*) query;
+
+    if (VULKAN_INTERNAL_IsTransferOnlyQueue(renderer, vulkanCommandBuffer->commandPool->queue))
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Timestamps cannot be written on a transfer queue command buffer!"
+        );
+        return;
+    }
+
+    renderer->vkCmdResetQueryPool(
+        vulkanCommandBuffer->commandBuffer,
+        renderer->timestampQueryPool,
+        vulkanQuery->index,
+        1
+    );
+
+    /* Written once all previously submitted work has completed */
+    renderer->vkCmdWriteTimestamp(
+        vulkanCommandBuffer->commandBuffer,
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+        renderer->timestampQueryPool,
+        vulkanQuery->index
+    );
+}
+
+static SDL_bool VULKAN_TimestampQueryResult(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuTimestampQuery *query,
+    Uint64 *nanoseconds
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VulkanTimestampQuery *vulkanQuery = (VulkanTimestampQuery*) query;
+    VkResult vulkanResult;
+    Uint64 queryResult;
+
+    SDL_LockMutex(renderer->queryLock);
+    vulkanResult = renderer->vkGetQueryPoolResults(
+        renderer->logicalDevice,
+        renderer->timestampQueryPool,
+        vulkanQuery->index,
+        1,
+        sizeof(queryResult),
+        &queryResult,
+        sizeof(queryResult),
+        VK_QUERY_RESULT_64_BIT
+    );
+    SDL_UnlockMutex(renderer->queryLock);
+
+    if (vulkanResult != VK_SUCCESS)
+    {
+        return SDL_FALSE;
+    }
+
+    *nanoseconds = (Uint64) (
+        (double) (queryResult & renderer->timestampMask) *
+        renderer->timestampPeriod
+    );
+    return SDL_TRUE;
+}
+
+static void VULKAN_EnablePassTiming(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+    VkQueryPoolCreateInfo queryPoolCreateInfo;
+    VkResult vulkanResult;
+
+    if (!renderer->supportsTimestamps)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Timestamp queries are not supported on this device!"
+        );
+        return;
+    }
+
+    if (VULKAN_INTERNAL_IsTransferOnlyQueue(renderer, vulkanCommandBuffer->commandPool->queue))
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Pass timing is not supported on a transfer queue command buffer!"
+        );
+        return;
+    }
+
+    if (vulkanCommandBuffer->passTimingEnabled)
+    {
+        return;
+    }
+
+    /* Each command buffer owns its pool so recording threads never contend */
+    if (vulkanCommandBuffer->passTimingQueryPool == VK_NULL_HANDLE)
+    {
+        queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolCreateInfo.pNext = NULL;
+        queryPoolCreateInfo.flags = 0;
+        queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolCreateInfo.queryCount = SDL_GPU_MAX_TIMED_PASSES * 2;
+        queryPoolCreateInfo.pipelineStatistics = 0;
+
+        vulkanResult = renderer->vkCreateQueryPool(
+            renderer->logicalDevice,
+            &queryPoolCreateInfo,
+            NULL,
+            &vulkanCommandBuffer->passTimingQueryPool
+        );
+        VULKAN_ERROR_CHECK(vulkanResult, vkCreateQueryPool, )
+    }
+
+    renderer->vkCmdResetQueryPool(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanCommandBuffer->passTimingQueryPool,
+        0,
+        SDL_GPU_MAX_TIMED_PASSES * 2
+    );
+
+    vulkanCommandBuffer->passTimingEnabled = 1;
+    vulkanCommandBuffer->passTimingCount = 0;
+}
+
+static void VULKAN_EnablePipelineStatistics(
+    SDL_GpuCommandBuffer *commandBuffer
+) {
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
+    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
+    VkQueryPoolCreateInfo queryPoolCreateInfo;
+    VkResult vulkanResult;
+
+    if (!renderer->supportsPipelineStatistics)
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Pipeline statistics are not supported on this device!"
+        );
+        return;
+    }
 
-    SDL_LockMutex(renderer->allocatorLock);
+    if (VULKAN_INTERNAL_IsTransferOnlyQueue(renderer, vulkanCommandBuffer->commandPool->queue))
+    {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Pipeline statistics are not supported on a transfer queue command buffer!"
+        );
+        return;
+    }
 
-    renderer->defragInProgress = 1;
+    if (vulkanCommandBuffer->pipelineStatisticsEnabled)
+    {
+        return;
+    }
 
-    commandBuffer = (VulkanCommandBuffer*) VULKAN_AcquireCommandBuffer((SDL_GpuRenderer *) renderer);
-    commandBuffer->isDefrag = 1;
+    /* Each command buffer owns its pool so recording threads never contend */
+    if (vulkanCommandBuffer->pipelineStatisticsQueryPool == VK_NULL_HANDLE)
+    {
+        queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolCreateInfo.pNext = NULL;
+        queryPoolCreateInfo.flags = 0;
+        queryPoolCreateInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        queryPoolCreateInfo.queryCount = 1;
+        queryPoolCreateInfo.pipelineStatistics =
+            (vulkanCommandBuffer->commandPool->queue == renderer->unifiedQueue) ?
+                VULKAN_GRAPHICS_PIPELINE_STATISTICS :
+                VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
 
-    allocation = renderer->allocationsToDefrag[renderer->allocationsToDefragCount - 1];
-    renderer->allocationsToDefragCount -= 1;
+        vulkanResult = renderer->vkCreateQueryPool(
+            renderer->logicalDevice,
+            &queryPoolCreateInfo,
+            NULL,
+            &vulkanCommandBuffer->pipelineStatisticsQueryPool
+        );
+        VULKAN_ERROR_CHECK(vulkanResult, vkCreateQueryPool, )
+    }
 
-    /* For each used region in the allocation
-     * create a new resource, copy the data
-     * and re-point the resource containers
-     */
-    for (i = 0; i < allocation->usedRegionCount; i += 1)
-    {
-        currentRegion = allocation->usedRegions[i];
+    renderer->vkCmdResetQueryPool(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanCommandBuffer->pipelineStatisticsQueryPool,
+        0,
+        1
+    );
 
-        if (currentRegion->isBuffer && !currentRegion->vulkanBuffer->markedForDestroy)
-        {
-            currentRegion->vulkanBuffer->usageFlags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    /* Ended in VULKAN_INTERNAL_EndCommandBuffer */
+    renderer->vkCmdBeginQuery(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanCommandBuffer->pipelineStatisticsQueryPool,
+        0,
+        0
+    );
 
-            newBuffer = VULKAN_INTERNAL_CreateBuffer(
-                renderer,
-                currentRegion->vulkanBuffer->size,
-                currentRegion->vulkanBuffer->usageFlags,
-                currentRegion->vulkanBuffer->type
-            );
+    vulkanCommandBuffer->pipelineStatisticsEnabled = 1;
+}
 
-            if (newBuffer == NULL)
-            {
-                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create defrag buffer!");
-                return 0;
-            }
+static Uint32 VULKAN_GetPassTimings(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuFence *fence,
+    SDL_GpuPassTiming *timings,
+    Uint32 maxTimings
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VulkanFenceHandle *fenceHandle = (VulkanFenceHandle*) fence;
+    Uint32 count;
 
-            if (
-                renderer->debugMode &&
-                renderer->supportsDebugUtils &&
-                currentRegion->vulkanBuffer->handle != NULL &&
-                currentRegion->vulkanBuffer->handle->container != NULL &&
-                currentRegion->vulkanBuffer->handle->container->debugName != NULL
-            ) {
-                VULKAN_INTERNAL_SetBufferName(
-                    renderer,
-                    newBuffer,
-                    currentRegion->vulkanBuffer->handle->container->debugName
-                );
-            }
+    if (!VULKAN_QueryFence(driverData, fence))
+    {
+        return 0;
+    }
 
-            /* Copy buffer contents if necessary */
-            if (
-                currentRegion->vulkanBuffer->type == VULKAN_BUFFER_TYPE_GPU && currentRegion->vulkanBuffer->transitioned
-            ) {
-                VULKAN_INTERNAL_BufferTransitionFromDefaultUsage(
-                    renderer,
-                    commandBuffer,
-                    VULKAN_BUFFER_USAGE_MODE_COPY_SOURCE,
-                    currentRegion->vulkanBuffer
-                );
+    /* Timings are resolved when the command buffer is cleaned */
+    SDL_LockMutex(renderer->submitLock);
 
-                VULKAN_INTERNAL_BufferTransitionFromDefaultUsage(
-                    renderer,
-                    commandBuffer,
-                    VULKAN_BUFFER_USAGE_MODE_COPY_DESTINATION,
-                    newBuffer
-                );
+    VULKAN_INTERNAL_CleanCompletedCommandBuffers(renderer);
 
-                bufferCopy.srcOffset = 0;
-                bufferCopy.dstOffset = 0;
-                bufferCopy.size = currentRegion->resourceSize;
+    count = SDL_min(fenceHandle->passTimingCount, maxTimings);
+    SDL_memcpy(
+        timings,
+        fenceHandle->passTimings,
+        sizeof(SDL_GpuPassTiming) * count
+    );
 
-                renderer->vkCmdCopyBuffer(
-                    commandBuffer->commandBuffer,
-                    currentRegion->vulkanBuffer->buffer,
-                    newBuffer->buffer,
-                    1,
-                    &bufferCopy
-                );
+    SDL_UnlockMutex(renderer->submitLock);
 
-                VULKAN_INTERNAL_BufferTransitionToDefaultUsage(
-                    renderer,
-                    commandBuffer,
-                    VULKAN_BUFFER_USAGE_MODE_COPY_DESTINATION,
-                    newBuffer
-                );
+    return count;
+}
 
-                VULKAN_INTERNAL_TrackBuffer(renderer, commandBuffer, currentRegion->vulkanBuffer);
-                VULKAN_INTERNAL_TrackBuffer(renderer, commandBuffer, newBuffer);
-            }
+/* Bindless Tables */
 
-            /* re-point original container to new buffer */
-            if (currentRegion->vulkanBuffer->handle != NULL)
-            {
-                newBuffer->handle = currentRegion->vulkanBuffer->handle;
-                newBuffer->handle->vulkanBuffer = newBuffer;
-                currentRegion->vulkanBuffer->handle = NULL;
-            }
+static SDL_GpuBindlessTable* VULKAN_CreateBindlessTable(
+    SDL_GpuRenderer *driverData,
+    Uint32 capacity
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VulkanBindlessTable *bindlessTable;
+    VkDescriptorPoolSize descriptorPoolSize;
+    VkDescriptorPoolCreateInfo descriptorPoolInfo;
+    VkDescriptorSetVariableDescriptorCountAllocateInfoEXT variableCountInfo;
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo;
+    VkResult vulkanResult;
 
-            VULKAN_INTERNAL_ReleaseBuffer(renderer, currentRegion->vulkanBuffer);
-        }
-        else if (!currentRegion->isBuffer && !currentRegion->vulkanTexture->markedForDestroy)
-        {
-            newTexture = VULKAN_INTERNAL_CreateTexture(
-                renderer,
-                currentRegion->vulkanTexture->dimensions.width,
-                currentRegion->vulkanTexture->dimensions.height,
-                currentRegion->vulkanTexture->depth,
-                currentRegion->vulkanTexture->isCube,
-                currentRegion->vulkanTexture->layerCount,
-                currentRegion->vulkanTexture->levelCount,
-                currentRegion->vulkanTexture->sampleCount,
-                currentRegion->vulkanTexture->format,
-                currentRegion->vulkanTexture->swizzle,
-                currentRegion->vulkanTexture->aspectFlags,
-                currentRegion->vulkanTexture->usageFlags
-            );
+    if (renderer->bindlessDescriptorSetLayout == VK_NULL_HANDLE)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless tables are not supported on this device!");
+        return NULL;
+    }
 
-            if (newTexture == NULL)
-            {
-                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create defrag texture!");
-                return 0;
-            }
+    if (capacity == 0 || capacity > renderer->maxBindlessTableSize)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bindless table capacity must be between 1 and %u!", renderer->maxBindlessTableSize);
+        return NULL;
+    }
 
-            for (sliceIndex = 0; sliceIndex < currentRegion->vulkanTexture->sliceCount; sliceIndex += 1)
-            {
-                /* copy slice if necessary */
-                srcSlice = &currentRegion->vulkanTexture->slices[sliceIndex];
-                dstSlice = &newTexture->slices[sliceIndex];
+    bindlessTable = (VulkanBindlessTable*) SDL_malloc(sizeof(VulkanBindlessTable));
+    bindlessTable->capacity = capacity;
 
-                /* Set debug name if it exists */
-                if (
-                    renderer->debugMode &&
-                    renderer->supportsDebugUtils &&
-                    srcSlice->parent->handle != NULL &&
-                    srcSlice->parent->handle->container != NULL &&
-                    srcSlice->parent->handle->container->debugName != NULL
-                ) {
-                    VULKAN_INTERNAL_SetTextureName(
-                        renderer,
-                        currentRegion->vulkanTexture,
-                        srcSlice->parent->handle->container->debugName
-                    );
-                }
+    descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    descriptorPoolSize.descriptorCount = capacity;
 
-                if (srcSlice->transitioned)
-                {
-                    VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
-                        renderer,
-                        commandBuffer,
-                        VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
-                        srcSlice
-                    );
+    descriptorPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolInfo.pNext = NULL;
+    descriptorPoolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+    descriptorPoolInfo.maxSets = 1;
+    descriptorPoolInfo.poolSizeCount = 1;
+    descriptorPoolInfo.pPoolSizes = &descriptorPoolSize;
 
-                    VULKAN_INTERNAL_TextureTransitionFromDefaultUsage(
-                        renderer,
-                        commandBuffer,
-                        VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
-                        dstSlice
-                    );
+    vulkanResult = renderer->vkCreateDescriptorPool(
+        renderer->logicalDevice,
+        &descriptorPoolInfo,
+        NULL,
+        &bindlessTable->descriptorPool
+    );
 
-                    imageCopy.srcOffset.x = 0;
-                    imageCopy.srcOffset.y = 0;
-                    imageCopy.srcOffset.z = 0;
-                    imageCopy.srcSubresource.aspectMask = srcSlice->parent->aspectFlags;
-                    imageCopy.srcSubresource.baseArrayLayer = srcSlice->layer;
-                    imageCopy.srcSubresource.layerCount = 1;
-                    imageCopy.srcSubresource.mipLevel = srcSlice->level;
-                    imageCopy.extent.width = SDL_max(1, srcSlice->parent->dimensions.width >> srcSlice->level);
-                    imageCopy.extent.height = SDL_max(1, srcSlice->parent->dimensions.height >> srcSlice->level);
-                    imageCopy.extent.depth = srcSlice->parent->depth;
-                    imageCopy.dstOffset.x = 0;
-                    imageCopy.dstOffset.y = 0;
-                    imageCopy.dstOffset.z = 0;
-                    imageCopy.dstSubresource.aspectMask = dstSlice->parent->aspectFlags;
-                    imageCopy.dstSubresource.baseArrayLayer = dstSlice->layer;
-                    imageCopy.dstSubresource.layerCount = 1;
-                    imageCopy.dstSubresource.mipLevel = dstSlice->level;
-
-                    renderer->vkCmdCopyImage(
-                        commandBuffer->commandBuffer,
-                        currentRegion->vulkanTexture->image,
-                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                        newTexture->image,
-                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                        1,
-                        &imageCopy
-                    );
+    if (vulkanResult != VK_SUCCESS)
+    {
+        LogVulkanResultAsError("vkCreateDescriptorPool", vulkanResult);
+        SDL_free(bindlessTable);
+        return NULL;
+    }
 
-                    VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
-                        renderer,
-                        commandBuffer,
-                        VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION,
-                        dstSlice
-                    );
+    /* The layout is sized for the device limit, each table only takes what it asked for */
+    variableCountInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT;
+    variableCountInfo.pNext = NULL;
+    variableCountInfo.descriptorSetCount = 1;
+    variableCountInfo.pDescriptorCounts = &capacity;
 
-                    VULKAN_INTERNAL_TrackTextureSlice(renderer, commandBuffer, srcSlice);
-                    VULKAN_INTERNAL_TrackTextureSlice(renderer, commandBuffer, dstSlice);
-                }
-            }
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptorSetAllocateInfo.pNext = &variableCountInfo;
+    descriptorSetAllocateInfo.descriptorPool = bindlessTable->descriptorPool;
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.pSetLayouts = &renderer->bindlessDescriptorSetLayout;
 
-            /* re-point original container to new texture */
-            newTexture->handle = currentRegion->vulkanTexture->handle;
-            newTexture->handle->vulkanTexture = newTexture;
-            currentRegion->vulkanTexture->handle = NULL;
+    vulkanResult = renderer->vkAllocateDescriptorSets(
+        renderer->logicalDevice,
+        &descriptorSetAllocateInfo,
+        &bindlessTable->descriptorSet
+    );
 
-            VULKAN_INTERNAL_ReleaseTexture(renderer, currentRegion->vulkanTexture);
-        }
+    if (vulkanResult != VK_SUCCESS)
+    {
+        LogVulkanResultAsError("vkAllocateDescriptorSets", vulkanResult);
+        renderer->vkDestroyDescriptorPool(
+            renderer->logicalDevice,
+            bindlessTable->descriptorPool,
+            NULL
+        );
+        SDL_free(bindlessTable);
+        return NULL;
     }
 
-    SDL_UnlockMutex(renderer->allocatorLock);
-
-    VULKAN_Submit(
-        (SDL_GpuCommandBuffer*) commandBuffer
-    );
+    bindlessTable->textures = (VulkanTexture**) SDL_calloc(capacity, sizeof(VulkanTexture*));
+    bindlessTable->samplers = (VulkanSampler**) SDL_calloc(capacity, sizeof(VulkanSampler*));
+    SDL_AtomicSet(&bindlessTable->referenceCount, 0);
 
-    return 1;
+    return (SDL_GpuBindlessTable*) bindlessTable;
 }
 
-/* Queries */
-
-static SDL_GpuOcclusionQuery* VULKAN_CreateOcclusionQuery(
-    SDL_GpuRenderer *driverData
+static void VULKAN_UpdateBindlessTable(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuBindlessTable *bindlessTable,
+    Uint32 firstIndex,
+    SDL_GpuTextureSamplerBinding *textureSamplerBindings,
+    Uint32 bindingCount
 ) {
     VulkanRenderer *renderer = (VulkanRenderer*) driverData;
-    VulkanOcclusionQuery *query = (VulkanOcclusionQuery*) SDL_malloc(sizeof(VulkanOcclusionQuery));
-
-    SDL_LockMutex(renderer->queryLock);
+    VulkanBindlessTable *vulkanBindlessTable = (VulkanBindlessTable*) bindlessTable;
+    VkDescriptorImageInfo *imageInfos = SDL_stack_alloc(VkDescriptorImageInfo, bindingCount);
+    VkWriteDescriptorSet writeDescriptorSet;
+    VulkanTexture *vulkanTexture;
+    VulkanSampler *vulkanSampler;
+    Uint32 i;
 
-    if (renderer->freeQueryIndexStackHead == -1)
+    for (i = 0; i < bindingCount; i += 1)
     {
-        SDL_LogError(
-            SDL_LOG_CATEGORY_APPLICATION,
-            "Query limit of %d has been exceeded!",
-            MAX_QUERIES
-        );
-        return NULL;
+        /* The active handle is baked in, so cycling the texture later needs another update */
+        vulkanTexture = ((VulkanTextureContainer*) textureSamplerBindings[i].texture)->activeTextureHandle->vulkanTexture;
+        vulkanSampler = (VulkanSampler*) textureSamplerBindings[i].sampler;
+
+        SDL_AtomicIncRef(&vulkanTexture->slices[0].referenceCount);
+        SDL_AtomicIncRef(&vulkanTexture->bindlessReferenceCount);
+        SDL_AtomicIncRef(&vulkanSampler->referenceCount);
+
+        VULKAN_INTERNAL_ClearBindlessTableEntry(vulkanBindlessTable, firstIndex + i);
+        vulkanBindlessTable->textures[firstIndex + i] = vulkanTexture;
+        vulkanBindlessTable->samplers[firstIndex + i] = vulkanSampler;
+
+        imageInfos[i].sampler = vulkanSampler->sampler;
+        imageInfos[i].imageView = vulkanTexture->view;
+        imageInfos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     }
 
-    query->index = (Uint32) renderer->freeQueryIndexStackHead;
-    renderer->freeQueryIndexStackHead = renderer->freeQueryIndexStack[renderer->freeQueryIndexStackHead];
+    writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSet.pNext = NULL;
+    writeDescriptorSet.dstSet = vulkanBindlessTable->descriptorSet;
+    writeDescriptorSet.dstBinding = 0;
+    writeDescriptorSet.dstArrayElement = firstIndex;
+    writeDescriptorSet.descriptorCount = bindingCount;
+    writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writeDescriptorSet.pImageInfo = imageInfos;
+    writeDescriptorSet.pBufferInfo = NULL;
+    writeDescriptorSet.pTexelBufferView = NULL;
 
-    SDL_UnlockMutex(renderer->queryLock);
+    renderer->vkUpdateDescriptorSets(
+        renderer->logicalDevice,
+        1,
+        &writeDescriptorSet,
+        0,
+        NULL
+    );
 
-    return (SDL_GpuOcclusionQuery*) query;
+    SDL_stack_free(imageInfos);
 }
 
-static void VULKAN_OcclusionQueryBegin(
-    SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuOcclusionQuery *query
+static void VULKAN_ReleaseBindlessTable(
+    SDL_GpuRenderer *driverData,
+    SDL_GpuBindlessTable *bindlessTable
 ) {
-    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
-    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
-	VulkanOcclusionQuery *vulkanQuery = (VulkanOcclusionQuery*) query;
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    VulkanBindlessTable *vulkanBindlessTable = (VulkanBindlessTable*) bindlessTable;
 
-	renderer->vkCmdResetQueryPool(
-		vulkanCommandBuffer->commandBuffer,
-		renderer->queryPool,
-		vulkanQuery->index,
-		1
-	);
+    SDL_LockMutex(renderer->disposeLock);
 
-	renderer->vkCmdBeginQuery(
-		vulkanCommandBuffer->commandBuffer,
-		renderer->queryPool,
-		vulkanQuery->index,
-		renderer->supportsPreciseOcclusionQueries ?
-			VK_QUERY_CONTROL_PRECISE_BIT :
-			0
-	);
-}
+    EXPAND_ARRAY_IF_NEEDED(
+        renderer->bindlessTablesToDestroy,
+        VulkanBindlessTable*,
+        renderer->bindlessTablesToDestroyCount + 1,
+        renderer->bindlessTablesToDestroyCapacity,
+        renderer->bindlessTablesToDestroyCapacity * 2
+    )
 
-static void VULKAN_OcclusionQueryEnd(
-    SDL_GpuCommandBuffer *commandBuffer,
-    SDL_GpuOcclusionQuery *query
-) {
-    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer*) commandBuffer;
-    VulkanRenderer *renderer = (VulkanRenderer*) vulkanCommandBuffer->renderer;
-	VulkanOcclusionQuery *vulkanQuery = (VulkanOcclusionQuery*) query;
+    renderer->bindlessTablesToDestroy[renderer->bindlessTablesToDestroyCount] = vulkanBindlessTable;
+    renderer->bindlessTablesToDestroyCount += 1;
 
-	renderer->vkCmdEndQuery(
-		vulkanCommandBuffer->commandBuffer,
-		renderer->queryPool,
-		vulkanQuery->index
-	);
+    SDL_UnlockMutex(renderer->disposeLock);
 }
 
-static SDL_bool VULKAN_OcclusionQueryPixelCount(
-    SDL_GpuRenderer *driverData,
-    SDL_GpuOcclusionQuery *query,
-    Uint32 *pixelCount
+static Uint32 VULKAN_GetMaxBindlessTableSize(
+    SDL_GpuRenderer *driverData
 ) {
     VulkanRenderer *renderer = (VulkanRenderer*) driverData;
-	VulkanOcclusionQuery *vulkanQuery = (VulkanOcclusionQuery*) query;
-    VkResult vulkanResult;
-	Uint32 queryResult;
-
-    SDL_LockMutex(renderer->queryLock);
-    vulkanResult = renderer->vkGetQueryPoolResults(
-        renderer->logicalDevice,
-        renderer->queryPool,
-        vulkanQuery->index,
-        1,
-        sizeof(queryResult),
-        &queryResult,
-        0,
-        0
-    );
-    SDL_UnlockMutex(renderer->queryLock);
+    return renderer->maxBindlessTableSize;
+}
 
-    *pixelCount = queryResult;
-    return vulkanResult == VK_SUCCESS;
+static SDL_bool VULKAN_SupportsIndirectCount(
+    SDL_GpuRenderer *driverData
+) {
+    /* The D3D11 emulation needs a copy and a dispatch, which Vulkan forbids inside a render pass */
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    return renderer->supports.KHR_draw_indirect_count;
 }
 
 /* Format Info */
@@ -11844,24 +16009,84 @@ static SDL_GpuSampleCount VULKAN_GetBestSampleCount(
         renderer->physicalDeviceProperties.properties.limits.framebufferDepthSampleCounts :
         renderer->physicalDeviceProperties.properties.limits.framebufferColorSampleCounts;
 
-    if (bits & VK_SAMPLE_COUNT_8_BIT)
-    {
-        maxSupported = SDL_GPU_SAMPLECOUNT_8;
-    }
-    else if (bits & VK_SAMPLE_COUNT_4_BIT)
+    if (bits & VK_SAMPLE_COUNT_8_BIT)
+    {
+        maxSupported = SDL_GPU_SAMPLECOUNT_8;
+    }
+    else if (bits & VK_SAMPLE_COUNT_4_BIT)
+    {
+        maxSupported = SDL_GPU_SAMPLECOUNT_4;
+    }
+    else if (bits & VK_SAMPLE_COUNT_2_BIT)
+    {
+        maxSupported = SDL_GPU_SAMPLECOUNT_2;
+    }
+    else
+    {
+        maxSupported = SDL_GPU_SAMPLECOUNT_1;
+    }
+
+    return (SDL_GpuSampleCount) SDL_min(maxSupported, desiredSampleCount);
+}
+
+/* Pipeline Cache */
+
+static SDL_bool VULKAN_GetPipelineCacheData(
+    SDL_GpuRenderer *driverData,
+    void *data,
+    size_t *dataSize
+) {
+    VulkanRenderer *renderer = (VulkanRenderer*) driverData;
+    size_t payloadSize;
+    void *payload;
+    VkResult vulkanResult;
+
+    vulkanResult = renderer->vkGetPipelineCacheData(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        &payloadSize,
+        NULL
+    );
+    VULKAN_ERROR_CHECK(vulkanResult, vkGetPipelineCacheData, SDL_FALSE)
+
+    if (data == NULL)
     {
-        maxSupported = SDL_GPU_SAMPLECOUNT_4;
+        *dataSize = sizeof(PipelineCacheHeader) + payloadSize;
+        return SDL_TRUE;
     }
-    else if (bits & VK_SAMPLE_COUNT_2_BIT)
+
+    if (*dataSize < sizeof(PipelineCacheHeader) + payloadSize)
     {
-        maxSupported = SDL_GPU_SAMPLECOUNT_2;
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Pipeline cache data buffer is too small!");
+        return SDL_FALSE;
     }
-    else
+
+    /* The cache may have grown since the size query, so let it fill the whole buffer */
+    payload = (Uint8*) data + sizeof(PipelineCacheHeader);
+    payloadSize = *dataSize - sizeof(PipelineCacheHeader);
+
+    vulkanResult = renderer->vkGetPipelineCacheData(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        &payloadSize,
+        payload
+    );
+
+    /* VK_INCOMPLETE still leaves a valid, smaller cache in the buffer */
+    if (vulkanResult != VK_SUCCESS && vulkanResult != VK_INCOMPLETE)
     {
-        maxSupported = SDL_GPU_SAMPLECOUNT_1;
+        LogVulkanResultAsError("vkGetPipelineCacheData", vulkanResult);
+        return SDL_FALSE;
     }
 
-    return (SDL_GpuSampleCount) SDL_min(maxSupported, desiredSampleCount);
+    PipelineCache_WriteHeader(
+        &renderer->pipelineCacheIdentity,
+        payloadSize,
+        data
+    );
+
+    *dataSize = sizeof(PipelineCacheHeader) + payloadSize;
+    return SDL_TRUE;
 }
 
 /* SPIR-V Cross Interop */
@@ -11897,8 +16122,21 @@ static inline Uint8 CheckDeviceExtensions(
         CHECK(KHR_swapchain)
         else CHECK(KHR_maintenance1)
         else CHECK(KHR_get_memory_requirements2)
+        else CHECK(KHR_dedicated_allocation)
+        else CHECK(KHR_multiview)
+        else CHECK(KHR_maintenance2)
+        else CHECK(KHR_maintenance3)
         else CHECK(KHR_driver_properties)
+        else CHECK(KHR_draw_indirect_count)
+        else CHECK(KHR_create_renderpass2)
+        else CHECK(KHR_depth_stencil_resolve)
+        else CHECK(KHR_timeline_semaphore)
+        else CHECK(EXT_descriptor_indexing)
+        else CHECK(KHR_synchronization2)
+        else CHECK(KHR_dynamic_rendering)
+        else CHECK(KHR_push_descriptor)
         else CHECK(EXT_vertex_attribute_divisor)
+        else CHECK(EXT_memory_budget)
         else CHECK(KHR_portability_subset)
         #undef CHECK
     }
@@ -11914,8 +16152,21 @@ static inline Uint32 GetDeviceExtensionCount(VulkanExtensions *supports)
         supports->KHR_swapchain +
         supports->KHR_maintenance1 +
         supports->KHR_get_memory_requirements2 +
+        supports->KHR_dedicated_allocation +
+        supports->KHR_multiview +
+        supports->KHR_maintenance2 +
+        supports->KHR_maintenance3 +
         supports->KHR_driver_properties +
+        supports->KHR_draw_indirect_count +
+        supports->KHR_create_renderpass2 +
+        supports->KHR_depth_stencil_resolve +
+        supports->KHR_timeline_semaphore +
+        supports->EXT_descriptor_indexing +
+        supports->KHR_synchronization2 +
+        supports->KHR_dynamic_rendering +
+        supports->KHR_push_descriptor +
         supports->EXT_vertex_attribute_divisor +
+        supports->EXT_memory_budget +
         supports->KHR_portability_subset
     );
 }
@@ -11933,8 +16184,21 @@ static inline void CreateDeviceExtensionArray(
     CHECK(KHR_swapchain)
     CHECK(KHR_maintenance1)
     CHECK(KHR_get_memory_requirements2)
+    CHECK(KHR_dedicated_allocation)
+    CHECK(KHR_multiview)
+    CHECK(KHR_maintenance2)
+    CHECK(KHR_maintenance3)
     CHECK(KHR_driver_properties)
+    CHECK(KHR_draw_indirect_count)
+    CHECK(KHR_create_renderpass2)
+    CHECK(KHR_depth_stencil_resolve)
+    CHECK(KHR_timeline_semaphore)
+    CHECK(EXT_descriptor_indexing)
+    CHECK(KHR_synchronization2)
+    CHECK(KHR_dynamic_rendering)
+    CHECK(KHR_push_descriptor)
     CHECK(EXT_vertex_attribute_divisor)
+    CHECK(EXT_memory_budget)
     CHECK(KHR_portability_subset)
     #undef CHECK
 }
@@ -12379,6 +16643,94 @@ static Uint8 VULKAN_INTERNAL_IsDeviceSuitable(
             swapchainSupportDetails.presentModesLength > 0	);
 }
 
+static void VULKAN_INTERNAL_FindDedicatedQueueFamilies(
+    VulkanRenderer *renderer
+) {
+    Uint32 queueFamilyCount, i;
+    VkQueueFamilyProperties *queueProps;
+    VkQueueFlags flags;
+
+    renderer->computeQueueFamilyIndex = renderer->queueFamilyIndex;
+    renderer->transferQueueFamilyIndex = renderer->queueFamilyIndex;
+
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        NULL
+    );
+
+    queueProps = (VkQueueFamilyProperties*) SDL_stack_alloc(
+        VkQueueFamilyProperties,
+        queueFamilyCount
+    );
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        queueProps
+    );
+
+    /* Only families without graphics count as dedicated, otherwise
+     * the work would just contend with the unified queue.
+     */
+    for (i = 0; i < queueFamilyCount; i += 1)
+    {
+        flags = queueProps[i].queueFlags;
+
+        if (queueProps[i].queueCount == 0 || (flags & VK_QUEUE_GRAPHICS_BIT))
+        {
+            continue;
+        }
+
+        /* Coarse transfer granularity would reject arbitrary texture regions */
+        if (
+            queueProps[i].minImageTransferGranularity.width != 1 ||
+            queueProps[i].minImageTransferGranularity.height != 1 ||
+            queueProps[i].minImageTransferGranularity.depth != 1
+        ) {
+            continue;
+        }
+
+        if (
+            (flags & VK_QUEUE_COMPUTE_BIT) &&
+            renderer->computeQueueFamilyIndex == renderer->queueFamilyIndex
+        ) {
+            renderer->computeQueueFamilyIndex = i;
+        }
+        else if (
+            !(flags & VK_QUEUE_COMPUTE_BIT) &&
+            (flags & VK_QUEUE_TRANSFER_BIT) &&
+            renderer->transferQueueFamilyIndex == renderer->queueFamilyIndex
+        ) {
+            renderer->transferQueueFamilyIndex = i;
+        }
+    }
+
+    /* No DMA family, but async compute can still take the copies off the unified queue */
+    if (renderer->transferQueueFamilyIndex == renderer->queueFamilyIndex)
+    {
+        renderer->transferQueueFamilyIndex = renderer->computeQueueFamilyIndex;
+    }
+
+    SDL_stack_free(queueProps);
+
+    renderer->queueFamilyIndices[0] = renderer->queueFamilyIndex;
+    renderer->queueFamilyIndexCount = 1;
+
+    if (renderer->computeQueueFamilyIndex != renderer->queueFamilyIndex)
+    {
+        renderer->queueFamilyIndices[renderer->queueFamilyIndexCount] = renderer->computeQueueFamilyIndex;
+        renderer->queueFamilyIndexCount += 1;
+    }
+
+    if (
+        renderer->transferQueueFamilyIndex != renderer->queueFamilyIndex &&
+        renderer->transferQueueFamilyIndex != renderer->computeQueueFamilyIndex
+    ) {
+        renderer->queueFamilyIndices[renderer->queueFamilyIndexCount] = renderer->transferQueueFamilyIndex;
+        renderer->queueFamilyIndexCount += 1;
+    }
+}
+
 static Uint8 VULKAN_INTERNAL_DeterminePhysicalDevice(
     VulkanRenderer *renderer,
     VkSurfaceKHR surface
@@ -12478,6 +16830,7 @@ static Uint8 VULKAN_INTERNAL_DeterminePhysicalDevice(
         renderer->supports = physicalDeviceExtensions[suitableIndex];
         renderer->physicalDevice = physicalDevices[suitableIndex];
         renderer->queueFamilyIndex = suitableQueueFamilyIndex;
+        VULKAN_INTERNAL_FindDedicatedQueueFamilies(renderer);
     }
     else
     {
@@ -12502,11 +16855,157 @@ static Uint8 VULKAN_INTERNAL_DeterminePhysicalDevice(
         renderer->physicalDeviceProperties.pNext = NULL;
     }
 
+    if (renderer->supports.KHR_push_descriptor)
+    {
+        renderer->physicalDevicePushDescriptorProperties.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+        renderer->physicalDevicePushDescriptorProperties.pNext =
+            renderer->physicalDeviceProperties.pNext;
+
+        renderer->physicalDeviceProperties.pNext =
+            &renderer->physicalDevicePushDescriptorProperties;
+    }
+    else
+    {
+        renderer->physicalDevicePushDescriptorProperties.maxPushDescriptors = 0;
+    }
+
     renderer->vkGetPhysicalDeviceProperties2KHR(
         renderer->physicalDevice,
         &renderer->physicalDeviceProperties
     );
 
+    /* The extension is useless without the feature, so drop it if the feature is missing */
+    if (renderer->supports.KHR_synchronization2)
+    {
+        VkPhysicalDeviceFeatures2 features;
+        VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features;
+
+        synchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        synchronization2Features.pNext = NULL;
+        synchronization2Features.synchronization2 = VK_FALSE;
+
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &synchronization2Features;
+
+        renderer->vkGetPhysicalDeviceFeatures2KHR(
+            renderer->physicalDevice,
+            &features
+        );
+
+        renderer->supports.KHR_synchronization2 = synchronization2Features.synchronization2;
+    }
+
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        VkPhysicalDeviceFeatures2 features;
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
+
+        timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timelineSemaphoreFeatures.pNext = NULL;
+        timelineSemaphoreFeatures.timelineSemaphore = VK_FALSE;
+
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &timelineSemaphoreFeatures;
+
+        renderer->vkGetPhysicalDeviceFeatures2KHR(
+            renderer->physicalDevice,
+            &features
+        );
+
+        renderer->supports.KHR_timeline_semaphore = timelineSemaphoreFeatures.timelineSemaphore;
+    }
+
+    /* Bindless tables need every one of these features, and descriptor indexing depends on maintenance3 */
+    if (renderer->supports.EXT_descriptor_indexing && renderer->supports.KHR_maintenance3)
+    {
+        VkPhysicalDeviceFeatures2 features;
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures;
+        VkPhysicalDeviceProperties2 properties;
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT descriptorIndexingProperties;
+
+        SDL_zero(descriptorIndexingFeatures);
+        descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &descriptorIndexingFeatures;
+
+        renderer->vkGetPhysicalDeviceFeatures2KHR(
+            renderer->physicalDevice,
+            &features
+        );
+
+        SDL_zero(descriptorIndexingProperties);
+        descriptorIndexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+
+        properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties.pNext = &descriptorIndexingProperties;
+
+        renderer->vkGetPhysicalDeviceProperties2KHR(
+            renderer->physicalDevice,
+            &properties
+        );
+
+        renderer->maxBindlessTableSize = SDL_min(
+            SDL_min(
+                descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+                descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindSamplers
+            ),
+            SDL_min(
+                descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindSampledImages,
+                descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindSamplers
+            )
+        );
+        renderer->maxBindlessTableSize = SDL_min(renderer->maxBindlessTableSize, MAX_BINDLESS_TABLE_SIZE);
+
+        if (
+            !descriptorIndexingFeatures.runtimeDescriptorArray ||
+            !descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing ||
+            !descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind ||
+            !descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending ||
+            !descriptorIndexingFeatures.descriptorBindingPartiallyBound ||
+            !descriptorIndexingFeatures.descriptorBindingVariableDescriptorCount ||
+            renderer->maxBindlessTableSize == 0
+        ) {
+            renderer->supports.EXT_descriptor_indexing = 0;
+            renderer->maxBindlessTableSize = 0;
+        }
+    }
+    else
+    {
+        renderer->supports.EXT_descriptor_indexing = 0;
+    }
+
+    /* Dynamic rendering needs its whole dependency chain on a 1.0 instance */
+    if (
+        renderer->supports.KHR_dynamic_rendering &&
+        renderer->supports.KHR_depth_stencil_resolve &&
+        renderer->supports.KHR_create_renderpass2 &&
+        renderer->supports.KHR_multiview &&
+        renderer->supports.KHR_maintenance2
+    ) {
+        VkPhysicalDeviceFeatures2 features;
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures;
+
+        dynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+        dynamicRenderingFeatures.pNext = NULL;
+        dynamicRenderingFeatures.dynamicRendering = VK_FALSE;
+
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &dynamicRenderingFeatures;
+
+        renderer->vkGetPhysicalDeviceFeatures2KHR(
+            renderer->physicalDevice,
+            &features
+        );
+
+        renderer->supports.KHR_dynamic_rendering = dynamicRenderingFeatures.dynamicRendering;
+    }
+    else
+    {
+        renderer->supports.KHR_dynamic_rendering = 0;
+    }
+
     renderer->vkGetPhysicalDeviceMemoryProperties(
         renderer->physicalDevice,
         &renderer->memoryProperties
@@ -12523,19 +17022,29 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     VkResult vulkanResult;
     VkDeviceCreateInfo deviceCreateInfo;
     VkPhysicalDeviceFeatures deviceFeatures;
+    VkPhysicalDeviceFeatures supportedDeviceFeatures;
     VkPhysicalDevicePortabilitySubsetFeaturesKHR portabilityFeatures;
+    VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features;
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures;
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures;
     const char **deviceExtensions;
 
-    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfos[3];
     float queuePriority = 1.0f;
+    Uint32 i;
 
-    queueCreateInfo.sType =
-        VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    queueCreateInfo.pNext = NULL;
-    queueCreateInfo.flags = 0;
-    queueCreateInfo.queueFamilyIndex = renderer->queueFamilyIndex;
-    queueCreateInfo.queueCount = 1;
-    queueCreateInfo.pQueuePriorities = &queuePriority;
+    /* One queue per family; dedicated families were picked with the device */
+    for (i = 0; i < renderer->queueFamilyIndexCount; i += 1)
+    {
+        queueCreateInfos[i].sType =
+            VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueCreateInfos[i].pNext = NULL;
+        queueCreateInfos[i].flags = 0;
+        queueCreateInfos[i].queueFamilyIndex = renderer->queueFamilyIndices[i];
+        queueCreateInfos[i].queueCount = 1;
+        queueCreateInfos[i].pQueuePriorities = &queuePriority;
+    }
 
     /* specifying used device features */
 
@@ -12545,6 +17054,21 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     deviceFeatures.multiDrawIndirect = VK_TRUE;
     deviceFeatures.independentBlend = VK_TRUE;
 
+    renderer->vkGetPhysicalDeviceFeatures(
+        renderer->physicalDevice,
+        &supportedDeviceFeatures
+    );
+
+    renderer->supportsPipelineStatistics =
+        supportedDeviceFeatures.pipelineStatisticsQuery &&
+        supportedDeviceFeatures.inheritedQueries;
+
+    if (renderer->supportsPipelineStatistics)
+    {
+        deviceFeatures.pipelineStatisticsQuery = VK_TRUE;
+        deviceFeatures.inheritedQueries = VK_TRUE;
+    }
+
     /* creating the logical device */
 
     deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -12573,9 +17097,43 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     {
         deviceCreateInfo.pNext = NULL;
     }
+    if (renderer->supports.KHR_synchronization2)
+    {
+        synchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        synchronization2Features.pNext = (void*) deviceCreateInfo.pNext;
+        synchronization2Features.synchronization2 = VK_TRUE;
+        deviceCreateInfo.pNext = &synchronization2Features;
+    }
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timelineSemaphoreFeatures.pNext = (void*) deviceCreateInfo.pNext;
+        timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+        deviceCreateInfo.pNext = &timelineSemaphoreFeatures;
+    }
+    if (renderer->supports.EXT_descriptor_indexing)
+    {
+        SDL_zero(descriptorIndexingFeatures);
+        descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+        descriptorIndexingFeatures.pNext = (void*) deviceCreateInfo.pNext;
+        descriptorIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+        descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingVariableDescriptorCount = VK_TRUE;
+        deviceCreateInfo.pNext = &descriptorIndexingFeatures;
+    }
+    if (renderer->supports.KHR_dynamic_rendering)
+    {
+        dynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+        dynamicRenderingFeatures.pNext = (void*) deviceCreateInfo.pNext;
+        dynamicRenderingFeatures.dynamicRendering = VK_TRUE;
+        deviceCreateInfo.pNext = &dynamicRenderingFeatures;
+    }
     deviceCreateInfo.flags = 0;
-    deviceCreateInfo.queueCreateInfoCount = 1;
-    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+    deviceCreateInfo.queueCreateInfoCount = renderer->queueFamilyIndexCount;
+    deviceCreateInfo.pQueueCreateInfos = queueCreateInfos;
     deviceCreateInfo.enabledLayerCount = 0;
     deviceCreateInfo.ppEnabledLayerNames = NULL;
     deviceCreateInfo.enabledExtensionCount = GetDeviceExtensionCount(
@@ -12615,6 +17173,103 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
         &renderer->unifiedQueue
     );
 
+    renderer->computeQueue = renderer->unifiedQueue;
+    renderer->transferQueue = renderer->unifiedQueue;
+
+    if (renderer->computeQueueFamilyIndex != renderer->queueFamilyIndex)
+    {
+        renderer->vkGetDeviceQueue(
+            renderer->logicalDevice,
+            renderer->computeQueueFamilyIndex,
+            0,
+            &renderer->computeQueue
+        );
+    }
+
+    if (renderer->transferQueueFamilyIndex == renderer->computeQueueFamilyIndex)
+    {
+        renderer->transferQueue = renderer->computeQueue;
+    }
+    else
+    {
+        renderer->vkGetDeviceQueue(
+            renderer->logicalDevice,
+            renderer->transferQueueFamilyIndex,
+            0,
+            &renderer->transferQueue
+        );
+    }
+
+    if (renderer->supports.KHR_timeline_semaphore)
+    {
+        VkSemaphoreCreateInfo semaphoreCreateInfo;
+        VkSemaphoreTypeCreateInfoKHR semaphoreTypeCreateInfo;
+
+        semaphoreTypeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        semaphoreTypeCreateInfo.pNext = NULL;
+        semaphoreTypeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        semaphoreTypeCreateInfo.initialValue = 0;
+
+        semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreCreateInfo.pNext = &semaphoreTypeCreateInfo;
+        semaphoreCreateInfo.flags = 0;
+
+        for (i = 0; i < renderer->queueFamilyIndexCount; i += 1)
+        {
+            vulkanResult = renderer->vkCreateSemaphore(
+                renderer->logicalDevice,
+                &semaphoreCreateInfo,
+                NULL,
+                &renderer->timelines[i].semaphore
+            );
+            VULKAN_ERROR_CHECK(vulkanResult, vkCreateSemaphore, 0)
+
+            renderer->timelines[i].submittedValue = 0;
+            renderer->timelines[i].completedValue = 0;
+            renderer->timelineCount += 1;
+        }
+    }
+
+    if (renderer->supports.EXT_descriptor_indexing)
+    {
+        VkDescriptorSetLayoutBinding bindlessBinding;
+        VkDescriptorBindingFlagsEXT bindlessBindingFlags;
+        VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsCreateInfo;
+        VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo;
+
+        bindlessBinding.binding = 0;
+        bindlessBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        bindlessBinding.descriptorCount = renderer->maxBindlessTableSize;
+        bindlessBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+        bindlessBinding.pImmutableSamplers = NULL;
+
+        /* Tables are sized at creation, and entries may change while other entries are in use */
+        bindlessBindingFlags =
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
+            VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT_EXT;
+
+        bindingFlagsCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+        bindingFlagsCreateInfo.pNext = NULL;
+        bindingFlagsCreateInfo.bindingCount = 1;
+        bindingFlagsCreateInfo.pBindingFlags = &bindlessBindingFlags;
+
+        descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        descriptorSetLayoutCreateInfo.pNext = &bindingFlagsCreateInfo;
+        descriptorSetLayoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+        descriptorSetLayoutCreateInfo.bindingCount = 1;
+        descriptorSetLayoutCreateInfo.pBindings = &bindlessBinding;
+
+        vulkanResult = renderer->vkCreateDescriptorSetLayout(
+            renderer->logicalDevice,
+            &descriptorSetLayoutCreateInfo,
+            NULL,
+            &renderer->bindlessDescriptorSetLayout
+        );
+        VULKAN_ERROR_CHECK(vulkanResult, vkCreateDescriptorSetLayout, 0)
+    }
+
     return 1;
 }
 
@@ -12774,8 +17429,11 @@ static SDL_bool VULKAN_PrepareDriver()
     return result;
 }
 
-static SDL_GpuDevice* VULKAN_CreateDevice(SDL_bool debugMode)
-{
+static SDL_GpuDevice* VULKAN_CreateDevice(
+    SDL_bool debugMode,
+    const void *pipelineCacheData,
+    size_t pipelineCacheSize
+) {
     VulkanRenderer *renderer;
 
     SDL_GpuDevice *result;
@@ -12787,6 +17445,12 @@ static SDL_GpuDevice* VULKAN_CreateDevice(SDL_bool debugMode)
 
     /* Variables: Query Pool Creation */
     VkQueryPoolCreateInfo queryPoolCreateInfo;
+    VkQueueFamilyProperties *queueProps;
+    Uint32 queueFamilyCount;
+    Uint32 timestampValidBits;
+
+    /* Variables: Pipeline Cache Creation */
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo;
 
     /* Variables: Device Feature Checks */
     VkPhysicalDeviceFeatures physicalDeviceFeatures;
@@ -12863,6 +17527,7 @@ static SDL_GpuDevice* VULKAN_CreateDevice(SDL_bool debugMode)
     renderer->renderPassFetchLock = SDL_CreateMutex();
     renderer->framebufferFetchLock = SDL_CreateMutex();
     renderer->queryLock = SDL_CreateMutex();
+    renderer->uniformArenaLock = SDL_CreateMutex();
 
     /*
      * Create submitted command buffer list
@@ -12883,16 +17548,30 @@ static SDL_GpuDevice* VULKAN_CreateDevice(SDL_bool debugMode)
         renderer->memoryAllocator->subAllocators[i].memoryTypeIndex = i;
         renderer->memoryAllocator->subAllocators[i].allocations = NULL;
         renderer->memoryAllocator->subAllocators[i].allocationCount = 0;
-        renderer->memoryAllocator->subAllocators[i].sortedFreeRegions = SDL_malloc(
-            sizeof(VulkanMemoryFreeRegion*) * 4
-        );
-        renderer->memoryAllocator->subAllocators[i].sortedFreeRegionCount = 0;
-        renderer->memoryAllocator->subAllocators[i].sortedFreeRegionCapacity = 4;
+        SDL_zero(renderer->memoryAllocator->subAllocators[i].freeIndices);
     }
 
     /* UBO alignment */
 
     renderer->minUBOAlignment = (Uint32) renderer->physicalDeviceProperties.properties.limits.minUniformBufferOffsetAlignment;
+    renderer->maxUniformPushSize = SDL_min(
+        MAX_UNIFORM_PUSH_SIZE,
+        renderer->physicalDeviceProperties.properties.limits.maxUniformBufferRange
+    );
+
+    /* Uniform arena, pages are created on demand */
+
+    renderer->uniformArenaPageCapacity = 4;
+    renderer->uniformArenaPageCount = 0;
+    renderer->uniformArenaPages = SDL_malloc(
+        renderer->uniformArenaPageCapacity * sizeof(VulkanBuffer*)
+    );
+
+    renderer->availableUniformBlockCapacity = UNIFORM_ARENA_BLOCKS_PER_PAGE;
+    renderer->availableUniformBlockCount = 0;
+    renderer->availableUniformBlocks = SDL_malloc(
+        renderer->availableUniformBlockCapacity * sizeof(VulkanUniformBlock)
+    );
 
     /* Initialize query pool */
 
@@ -12917,6 +17596,100 @@ static SDL_GpuDevice* VULKAN_CreateDevice(SDL_bool debugMode)
     }
     renderer->freeQueryIndexStack[MAX_QUERIES - 1] = -1;
 
+    /* Initialize timestamp query pool */
+
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        NULL
+    );
+    queueProps = (VkQueueFamilyProperties*) SDL_stack_alloc(
+        VkQueueFamilyProperties,
+        queueFamilyCount
+    );
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        queueProps
+    );
+    timestampValidBits = queueProps[renderer->queueFamilyIndex].timestampValidBits;
+    SDL_stack_free(queueProps);
+
+    renderer->supportsTimestamps = timestampValidBits > 0;
+    renderer->timestampMask = (timestampValidBits >= 64) ?
+        ~0ULL :
+        ((1ULL << timestampValidBits) - 1);
+    renderer->timestampPeriod = renderer->physicalDeviceProperties.properties.limits.timestampPeriod;
+    renderer->timestampQueryPool = VK_NULL_HANDLE;
+    renderer->freeTimestampQueryIndexStackHead = -1;
+
+    if (renderer->supportsTimestamps)
+    {
+        queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolCreateInfo.queryCount = MAX_TIMESTAMP_QUERIES;
+
+        vulkanResult = renderer->vkCreateQueryPool(
+            renderer->logicalDevice,
+            &queryPoolCreateInfo,
+            NULL,
+            &renderer->timestampQueryPool
+        );
+        VULKAN_ERROR_CHECK(vulkanResult, vkCreateQueryPool, NULL)
+
+        for (i = 0; i < MAX_TIMESTAMP_QUERIES - 1; i += 1)
+        {
+            renderer->freeTimestampQueryIndexStack[i] = i + 1;
+        }
+        renderer->freeTimestampQueryIndexStack[MAX_TIMESTAMP_QUERIES - 1] = -1;
+        renderer->freeTimestampQueryIndexStackHead = 0;
+    }
+
+    /* Initialize pipeline cache */
+
+    renderer->pipelineCacheIdentity.backend = SDL_GPU_BACKEND_VULKAN;
+    renderer->pipelineCacheIdentity.vendorID = renderer->physicalDeviceProperties.properties.vendorID;
+    renderer->pipelineCacheIdentity.deviceID = renderer->physicalDeviceProperties.properties.deviceID;
+    renderer->pipelineCacheIdentity.driverVersion = renderer->physicalDeviceProperties.properties.driverVersion;
+    SDL_memcpy(
+        renderer->pipelineCacheIdentity.deviceUUID,
+        renderer->physicalDeviceProperties.properties.pipelineCacheUUID,
+        VK_UUID_SIZE
+    );
+
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.pNext = NULL;
+    pipelineCacheCreateInfo.flags = 0;
+    pipelineCacheCreateInfo.pInitialData = PipelineCache_GetPayload(
+        &renderer->pipelineCacheIdentity,
+        pipelineCacheData,
+        pipelineCacheSize,
+        &pipelineCacheCreateInfo.initialDataSize
+    );
+
+    vulkanResult = renderer->vkCreatePipelineCache(
+        renderer->logicalDevice,
+        &pipelineCacheCreateInfo,
+        NULL,
+        &renderer->pipelineCache
+    );
+
+    if (vulkanResult != VK_SUCCESS && pipelineCacheCreateInfo.pInitialData != NULL)
+    {
+        /* The driver rejected the seed data, start over with an empty cache */
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Pipeline cache data was rejected by the driver, ignoring");
+
+        pipelineCacheCreateInfo.pInitialData = NULL;
+        pipelineCacheCreateInfo.initialDataSize = 0;
+
+        vulkanResult = renderer->vkCreatePipelineCache(
+            renderer->logicalDevice,
+            &pipelineCacheCreateInfo,
+            NULL,
+            &renderer->pipelineCache
+        );
+    }
+    VULKAN_ERROR_CHECK(vulkanResult, vkCreatePipelineCache, NULL)
+
     /* Initialize caches */
 
     for (i = 0; i < NUM_COMMAND_POOL_BUCKETS; i += 1)
@@ -12926,13 +17699,21 @@ static SDL_GpuDevice* VULKAN_CreateDevice(SDL_bool debugMode)
         renderer->commandPoolHashTable.buckets[i].capacity = 0;
     }
 
-    renderer->renderPassHashArray.elements = NULL;
-    renderer->renderPassHashArray.count = 0;
-    renderer->renderPassHashArray.capacity = 0;
+    for (i = 0; i < NUM_RENDER_PASS_HASH_BUCKETS; i += 1)
+    {
+        renderer->renderPassHashTable.buckets[i].elements = NULL;
+        renderer->renderPassHashTable.buckets[i].count = 0;
+        renderer->renderPassHashTable.buckets[i].capacity = 0;
+    }
+
+    for (i = 0; i < NUM_FRAMEBUFFER_HASH_BUCKETS; i += 1)
+    {
+        renderer->framebufferHashTable.buckets[i].elements = NULL;
+        renderer->framebufferHashTable.buckets[i].count = 0;
+        renderer->framebufferHashTable.buckets[i].capacity = 0;
+    }
 
-    renderer->framebufferHashArray.elements = NULL;
-    renderer->framebufferHashArray.count = 0;
-    renderer->framebufferHashArray.capacity = 0;
+    SDL_AtomicSet(&renderer->submitCounter, 0);
 
     /* Initialize fence pool */
 
@@ -13026,6 +17807,14 @@ static SDL_GpuDevice* VULKAN_CreateDevice(SDL_bool debugMode)
         renderer->computePipelinesToDestroyCapacity
     );
 
+    renderer->bindlessTablesToDestroyCapacity = 4;
+    renderer->bindlessTablesToDestroyCount = 0;
+
+    renderer->bindlessTablesToDestroy = SDL_malloc(
+        sizeof(VulkanBindlessTable*) *
+        renderer->bindlessTablesToDestroyCapacity
+    );
+
     renderer->shadersToDestroyCapacity = 16;
     renderer->shadersToDestroyCount = 0;
 